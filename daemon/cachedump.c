@@ -96,14 +96,26 @@ dump_rrset(SSL* ssl, struct ub_packed_rrset_key* k,
 	return 1;
 }
 
+/** walk the entries of the admission window, then the lru list.
+ * start with NULL, returns NULL at the end */
+static struct lruhash_entry*
+lru_walk_next(struct lruhash* h, struct lruhash_entry* e)
+{
+	if(!e)
+		return h->win_start?h->win_start:h->lru_start;
+	if(!e->lru_next && e->in_window)
+		return h->lru_start;
+	return e->lru_next;
+}
+
 /** dump lruhash rrset cache */
 static int
 dump_rrset_lruhash(SSL* ssl, struct lruhash* h, time_t now)
 {
 	struct lruhash_entry* e;
 	/* lruhash already locked by caller */
-	/* walk in order of lru; best first */
-	for(e=h->lru_start; e; e = e->lru_next) {
+	/* walk the admission window, then the lru in order; best first */
+	for(e=lru_walk_next(h, NULL); e; e = lru_walk_next(h, e)) {
 		lock_rw_rdlock(&e->lock);
 		if(!dump_rrset(ssl, (struct ub_packed_rrset_key*)e->key,
 			(struct packed_rrset_data*)e->data, now)) {
@@ -250,8 +262,8 @@ dump_msg_lruhash(SSL* ssl, struct worker* worker, struct lruhash* h)
 	struct reply_info* d;
 
 	/* lruhash already locked by caller */
-	/* walk in order of lru; best first */
-	for(e=h->lru_start; e; e = e->lru_next) {
+	/* walk the admission window, then the lru in order; best first */
+	for(e=lru_walk_next(h, NULL); e; e = lru_walk_next(h, e)) {
 		regional_free_all(worker->scratchpad);
 		lock_rw_rdlock(&e->lock);
 		/* make copy of rrset in worker buffer */
@@ -313,10 +325,20 @@ read_fixed(SSL* ssl, sldns_buffer* buf, const char* str)
 	return (strcmp((char*)sldns_buffer_begin(buf), str) == 0);
 }
 
+/** the rrs of an rrset that is read, before they go into the rrset data */
+struct load_rrs {
+	/** the rdata lengths, with the rdlength */
+	uint16_t* len;
+	/** the absolute ttls */
+	time_t* ttl;
+	/** the rdatas, in the region */
+	uint8_t** data;
+};
+
 /** load an RR into rrset */
 static int
 load_rr(SSL* ssl, sldns_buffer* buf, struct regional* region,
-	struct ub_packed_rrset_key* rk, struct packed_rrset_data* d,
+	struct ub_packed_rrset_key* rk, struct load_rrs* d,
 	unsigned int i, int is_rrsig, int* go_on, time_t now)
 {
 	uint8_t rr[LDNS_RR_BUF_SIZE];
@@ -346,12 +368,12 @@ load_rr(SSL* ssl, sldns_buffer* buf, struct regional* region,
 	}
 
 	/* convert ldns rr into packed_rr */
-	d->rr_ttl[i] = (time_t)sldns_wirerr_get_ttl(rr, rr_len, dname_len) + now;
+	d->ttl[i] = (time_t)sldns_wirerr_get_ttl(rr, rr_len, dname_len) + now;
 	sldns_buffer_clear(buf);
-	d->rr_len[i] = sldns_wirerr_get_rdatalen(rr, rr_len, dname_len)+2;
-	d->rr_data[i] = (uint8_t*)regional_alloc_init(region, 
-		sldns_wirerr_get_rdatawl(rr, rr_len, dname_len), d->rr_len[i]);
-	if(!d->rr_data[i]) {
+	d->len[i] = sldns_wirerr_get_rdatalen(rr, rr_len, dname_len)+2;
+	d->data[i] = (uint8_t*)regional_alloc_init(region, 
+		sldns_wirerr_get_rdatawl(rr, rr_len, dname_len), d->len[i]);
+	if(!d->data[i]) {
 		log_warn("error out of memory");
 		return 0;
 	}
@@ -374,13 +396,13 @@ load_rr(SSL* ssl, sldns_buffer* buf, struct regional* region,
 /** move entry into cache */
 static int
 move_into_cache(struct ub_packed_rrset_key* k, 
-	struct packed_rrset_data* d, struct worker* worker)
+	struct packed_rrset_data* d, struct load_rrs* rrs,
+	struct worker* worker)
 {
 	struct ub_packed_rrset_key* ak;
 	struct packed_rrset_data* ad;
 	size_t s, i, num = d->count + d->rrsig_count;
 	struct rrset_ref ref;
-	uint8_t* p;
 
 	ak = alloc_special_obtain(&worker->alloc);
 	if(!ak) {
@@ -390,36 +412,28 @@ move_into_cache(struct ub_packed_rrset_key* k,
 	ak->entry.data = NULL;
 	ak->rk = k->rk;
 	ak->entry.hash = rrset_key_hash(&k->rk);
-	ak->rk.dname = (uint8_t*)memdup(k->rk.dname, k->rk.dname_len);
-	if(!ak->rk.dname) {
+	if(!ub_packed_rrset_name_alloc(ak, k->rk.dname_len)) {
 		log_warn("error out of memory");
 		ub_packed_rrset_parsedelete(ak, &worker->alloc);
 		return 0;
 	}
-	s = sizeof(*ad) + (sizeof(size_t) + sizeof(uint8_t*) + 
-		sizeof(time_t))* num;
+	memmove(ak->rk.dname, k->rk.dname, k->rk.dname_len);
+	s = sizeof(*ad) + PACKED_RRSET_ARRAYS_SIZE(num);
 	for(i=0; i<num; i++)
-		s += d->rr_len[i];
-	ad = (struct packed_rrset_data*)malloc(s);
+		s += rrs->len[i];
+	ad = (struct packed_rrset_data*)alloc_sized_obtain(&worker->alloc, s);
 	if(!ad) {
 		log_warn("error out of memory");
 		ub_packed_rrset_parsedelete(ak, &worker->alloc);
 		return 0;
 	}
-	p = (uint8_t*)ad;
-	memmove(p, d, sizeof(*ad));
-	p += sizeof(*ad);
-	memmove(p, &d->rr_len[0], sizeof(size_t)*num);
-	p += sizeof(size_t)*num;
-	memmove(p, &d->rr_data[0], sizeof(uint8_t*)*num);
-	p += sizeof(uint8_t*)*num;
-	memmove(p, &d->rr_ttl[0], sizeof(time_t)*num);
-	p += sizeof(time_t)*num;
+	memmove(ad, d, sizeof(*ad));
+	memmove(packed_rrset_lens(ad), rrs->len, sizeof(uint16_t)*num);
+	packed_rrset_offs_setup(ad);
 	for(i=0; i<num; i++) {
-		memmove(p, d->rr_data[i], d->rr_len[i]);
-		p += d->rr_len[i];
+		packed_rr_set_ttl(ad, i, rrs->ttl[i]);
+		memmove(packed_rr_data(ad, i), rrs->data[i], rrs->len[i]);
 	}
-	packed_rrset_ptr_fixup(ad);
 
 	ak->entry.data = ad;
 
@@ -438,6 +452,7 @@ load_rrset(SSL* ssl, sldns_buffer* buf, struct worker* worker)
 	struct regional* region = worker->scratchpad;
 	struct ub_packed_rrset_key* rk;
 	struct packed_rrset_data* d;
+	struct load_rrs rrs;
 	unsigned int rr_count, rrsig_count, trust, security;
 	long long ttl;
 	unsigned int i;
@@ -476,27 +491,27 @@ load_rrset(SSL* ssl, sldns_buffer* buf, struct worker* worker)
 	d->trust = (enum rrset_trust)trust;
 	d->ttl = (time_t)ttl + *worker->env.now;
 
-	d->rr_len = regional_alloc_zero(region, 
-		sizeof(size_t)*(d->count+d->rrsig_count));
-	d->rr_ttl = regional_alloc_zero(region, 
+	rrs.len = regional_alloc_zero(region, 
+		sizeof(uint16_t)*(d->count+d->rrsig_count));
+	rrs.ttl = regional_alloc_zero(region, 
 		sizeof(time_t)*(d->count+d->rrsig_count));
-	d->rr_data = regional_alloc_zero(region, 
+	rrs.data = regional_alloc_zero(region, 
 		sizeof(uint8_t*)*(d->count+d->rrsig_count));
-	if(!d->rr_len || !d->rr_ttl || !d->rr_data) {
+	if(!rrs.len || !rrs.ttl || !rrs.data) {
 		log_warn("error out of memory");
 		return 0;
 	}
 	
 	/* read the rr's themselves */
 	for(i=0; i<rr_count; i++) {
-		if(!load_rr(ssl, buf, region, rk, d, i, 0, 
+		if(!load_rr(ssl, buf, region, rk, &rrs, i, 0, 
 			&go_on, *worker->env.now)) {
 			log_warn("could not read rr %u", i);
 			return 0;
 		}
 	}
 	for(i=0; i<rrsig_count; i++) {
-		if(!load_rr(ssl, buf, region, rk, d, i+rr_count, 1, 
+		if(!load_rr(ssl, buf, region, rk, &rrs, i+rr_count, 1, 
 			&go_on, *worker->env.now)) {
 			log_warn("could not read rrsig %u", i);
 			return 0;
@@ -507,7 +522,7 @@ load_rrset(SSL* ssl, sldns_buffer* buf, struct worker* worker)
 		return 1;
 	}
 
-	return move_into_cache(rk, d, worker);
+	return move_into_cache(rk, d, &rrs, worker);
 }
 
 /** load rrset cache */
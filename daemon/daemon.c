@@ -74,6 +74,7 @@
 #include "util/config_file.h"
 #include "util/data/msgreply.h"
 #include "util/storage/lookup3.h"
+#include "util/storage/keyhash.h"
 #include "util/storage/slabhash.h"
 #include "services/listen_dnsport.h"
 #include "services/cache/rrset.h"
@@ -384,11 +385,25 @@ daemon_create_workers(struct daemon* daemon)
 	if(!daemon->rand) {
 		unsigned int seed = (unsigned int)time(NULL) ^ 
 			(unsigned int)getpid() ^ 0x438;
+		uint8_t key[KEYHASH_KEY_SIZE];
 		daemon->rand = ub_initstate(seed, NULL);
 		if(!daemon->rand)
 			fatal_exit("could not init random generator");
+		/* the hash key is set once, the caches are kept over a
+		 * reload and their hash values have to stay the same */
+		for(i=0; i<KEYHASH_KEY_SIZE; i++)
+			key[i] = (uint8_t)ub_random(daemon->rand);
+		keyhash_set_key(key);
+		hash_set_raninit((uint32_t)ub_random(daemon->rand));
 	}
-	hash_set_raninit((uint32_t)ub_random(daemon->rand));
+	/* the admission filter sketches are kept with the caches over a
+	 * reload, a new cache gets a sketch with a new seed */
+	(void)slabhash_set_admission(daemon->env->msg_cache,
+		daemon->cfg->cache_admission_filter,
+		(uint32_t)ub_random(daemon->rand));
+	(void)slabhash_set_admission(&daemon->env->rrset_cache->table,
+		daemon->cfg->cache_admission_filter,
+		(uint32_t)ub_random(daemon->rand));
 	shufport = (int*)calloc(65536, sizeof(int));
 	if(!shufport)
 		fatal_exit("out of memory during daemon init");
@@ -396,6 +411,9 @@ daemon_create_workers(struct daemon* daemon)
 	verbose(VERB_ALGO, "total of %d outgoing ports available", numport);
 	
 	daemon->num = (daemon->cfg->num_threads?daemon->cfg->num_threads:1);
+	/* the workers read the rrset cache without locks */
+	if(!alloc_set_readers(&daemon->superalloc, daemon->num))
+		fatal_exit("out of memory during daemon init");
 	daemon->workers = (struct worker**)calloc((size_t)daemon->num, 
 		sizeof(struct worker*));
 	for(i=0; i<daemon->num; i++) {
@@ -582,6 +600,7 @@ daemon_cleanup(struct daemon* daemon)
 	free(daemon->workers);
 	daemon->workers = NULL;
 	daemon->num = 0;
+	(void)alloc_set_readers(&daemon->superalloc, 0);
 	daemon->cfg = NULL;
 }
 
@@ -610,6 +629,7 @@ daemon_delete(struct daemon* daemon)
 	free(daemon->env);
 #ifdef HAVE_SSL
 	SSL_CTX_free((SSL_CTX*)daemon->listen_sslctx);
+	listen_sslctx_delete_ticket_keys();
 	SSL_CTX_free((SSL_CTX*)daemon->connect_sslctx);
 #endif
 	free(daemon);
@@ -655,6 +675,7 @@ void daemon_apply_cfg(struct daemon* daemon, struct config_file* cfg)
 {
         daemon->cfg = cfg;
 	config_apply(cfg);
+	alloc_set_arena(&daemon->superalloc, cfg->cache_hugepages);
 	if(!daemon->env->msg_cache ||
 	   cfg->msg_cache_size != slabhash_get_size(daemon->env->msg_cache) ||
 	   cfg->msg_cache_slabs != daemon->env->msg_cache->size) {
@@ -662,7 +683,8 @@ void daemon_apply_cfg(struct daemon* daemon, struct config_file* cfg)
 		daemon->env->msg_cache = slabhash_create(cfg->msg_cache_slabs,
 			HASH_DEFAULT_STARTARRAY, cfg->msg_cache_size,
 			msgreply_sizefunc, query_info_compare,
-			query_entry_delete, reply_info_delete, NULL);
+			query_entry_delete, reply_info_delete,
+			&daemon->superalloc);
 		if(!daemon->env->msg_cache) {
 			fatal_exit("malloc failure updating config settings");
 		}
@@ -95,6 +95,9 @@ struct daemon {
 	struct ub_randstate* rand;
 	/** master allocation cache */
 	struct alloc_cache superalloc;
+	/** increased when the caches are flushed, the threads empty their
+	 * answer caches when it changes */
+	size_t cache_flush;
 	/** the module environment master value, copied and changed by threads*/
 	struct module_env* env;
 	/** stack of module callbacks */
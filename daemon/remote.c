@@ -271,7 +271,7 @@ add_open(const char* ip, int nr, struct listen_port** list, int noproto_is_err)
 	}
 
 	/* open fd */
-	fd = create_tcp_accept_sock(res, 1, &noproto, 0);
+	fd = create_tcp_accept_sock(res, 1, &noproto, 0, 0);
 	freeaddrinfo(res);
 	if(fd == -1 && noproto) {
 		if(!noproto_is_err)
@@ -612,8 +612,16 @@ print_stats(SSL* ssl, const char* nm, struct stats_info* s)
 			- s->svr.num_queries_missed_cache))) return 0;
 	if(!ssl_printf(ssl, "%s.num.cachemiss"SQ"%u\n", nm, 
 		(unsigned)s->svr.num_queries_missed_cache)) return 0;
+	if(!ssl_printf(ssl, "%s.num.l1cachehits"SQ"%u\n", nm, 
+		(unsigned)s->svr.num_queries_l1cache)) return 0;
 	if(!ssl_printf(ssl, "%s.num.prefetch"SQ"%u\n", nm, 
 		(unsigned)s->svr.num_queries_prefetch)) return 0;
+	if(!ssl_printf(ssl, "%s.num.prefetch.popular"SQ"%u\n", nm, 
+		(unsigned)s->svr.num_queries_prefetch_popular)) return 0;
+	if(!ssl_printf(ssl, "%s.num.rrl.dropped"SQ"%u\n", nm, 
+		(unsigned)s->svr.num_queries_rrl_dropped)) return 0;
+	if(!ssl_printf(ssl, "%s.num.rrl.slipped"SQ"%u\n", nm, 
+		(unsigned)s->svr.num_queries_rrl_slipped)) return 0;
 	if(!ssl_printf(ssl, "%s.num.recursivereplies"SQ"%u\n", nm, 
 		(unsigned)s->mesh_replies_sent)) return 0;
 	if(!ssl_printf(ssl, "%s.requestlist.avg"SQ"%g\n", nm,
@@ -666,10 +674,12 @@ print_longnum(SSL* ssl, char* desc, size_t x)
 
 /** print mem stats */
 static int
-print_mem(SSL* ssl, struct worker* worker, struct daemon* daemon)
+print_mem(SSL* ssl, struct worker* worker, struct daemon* daemon,
+	struct stats_info* s)
 {
+	char nm[64];
 	int m;
-	size_t msg, rrset, val, iter;
+	size_t msg, rrset, val, iter, mapped, huge, thp;
 #ifdef HAVE_SBRK
 	extern void* unbound_start_brk;
 	void* cur = sbrk(0);
@@ -703,6 +713,38 @@ print_mem(SSL* ssl, struct worker* worker, struct daemon* daemon)
 		return 0;
 	if(!print_longnum(ssl, "mem.mod.validator"SQ, val))
 		return 0;
+	alloc_arena_stats(&daemon->superalloc, &mapped, &huge, &thp);
+	if(!print_longnum(ssl, "mem.cache.arena"SQ, mapped))
+		return 0;
+	if(!print_longnum(ssl, "mem.cache.arena.hugetlb"SQ, huge))
+		return 0;
+	if(!print_longnum(ssl, "mem.cache.arena.thp"SQ, thp))
+		return 0;
+	for(m=0; m<worker->env.mesh->mods.num; m++) {
+		snprintf(nm, sizeof(nm), "mem.region.hiwater.%s"SQ,
+			worker->env.mesh->mods.mod[m]->name);
+		if(!print_longnum(ssl, nm, s->mesh_region_hiwater[m]))
+			return 0;
+	}
+	return 1;
+}
+
+/** print the counts of the cache expiry scan */
+static int
+print_cache_expiry(SSL* ssl, struct daemon* daemon)
+{
+	size_t live, expired;
+	slabhash_expiry_stats(daemon->env->msg_cache, &live, &expired);
+	if(!print_longnum(ssl, "msg.cache.live"SQ, live))
+		return 0;
+	if(!print_longnum(ssl, "msg.cache.expired"SQ, expired))
+		return 0;
+	slabhash_expiry_stats(&daemon->env->rrset_cache->table, &live,
+		&expired);
+	if(!print_longnum(ssl, "rrset.cache.live"SQ, live))
+		return 0;
+	if(!print_longnum(ssl, "rrset.cache.expired"SQ, expired))
+		return 0;
 	return 1;
 }
 
@@ -874,6 +916,19 @@ print_ext(SSL* ssl, struct stats_info* s)
 		(unsigned)s->svr.unwanted_queries)) return 0;
 	if(!ssl_printf(ssl, "unwanted.replies"SQ"%u\n", 
 		(unsigned)s->svr.unwanted_replies)) return 0;
+	/* ssl handshakes */
+	if(!ssl_printf(ssl, "num.ssl.service.handshake"SQ"%u\n", 
+		(unsigned)s->svr.ssl_service_handshake)) return 0;
+	if(!ssl_printf(ssl, "num.ssl.service.resumed"SQ"%u\n", 
+		(unsigned)s->svr.ssl_service_resumed)) return 0;
+	if(!ssl_printf(ssl, "num.ssl.service.failed"SQ"%u\n", 
+		(unsigned)s->svr.ssl_service_failed)) return 0;
+	if(!ssl_printf(ssl, "num.ssl.upstream.handshake"SQ"%u\n", 
+		(unsigned)s->svr.ssl_upstream_handshake)) return 0;
+	if(!ssl_printf(ssl, "num.ssl.upstream.resumed"SQ"%u\n", 
+		(unsigned)s->svr.ssl_upstream_resumed)) return 0;
+	if(!ssl_printf(ssl, "num.ssl.upstream.failed"SQ"%u\n", 
+		(unsigned)s->svr.ssl_upstream_failed)) return 0;
 	return 1;
 }
 
@@ -902,7 +957,9 @@ do_stats(SSL* ssl, struct daemon_remote* rc, int reset)
 	if(!print_uptime(ssl, rc->worker, reset))
 		return;
 	if(daemon->cfg->stat_extended) {
-		if(!print_mem(ssl, rc->worker, daemon)) 
+		if(!print_mem(ssl, rc->worker, daemon, &total)) 
+			return;
+		if(!print_cache_expiry(ssl, daemon))
 			return;
 		if(!print_hist(ssl, &total))
 			return;
@@ -1063,6 +1120,15 @@ do_lookup(SSL* ssl, struct worker* worker, char* arg)
 	free(nm);
 }
 
+/** empty the answer caches of the threads, after a cache flush */
+static void
+flush_l1cache(struct worker* worker)
+{
+	/* only the remote control thread writes it */
+	lock_atomic_store(&worker->daemon->cache_flush,
+		lock_atomic_load(&worker->daemon->cache_flush)+1);
+}
+
 /** flush something from rrset and msg caches */
 static void
 do_cache_remove(struct worker* worker, uint8_t* nm, size_t nmlen,
@@ -1070,6 +1136,7 @@ do_cache_remove(struct worker* worker, uint8_t* nm, size_t nmlen,
 {
 	hashvalue_t h;
 	struct query_info k;
+	flush_l1cache(worker);
 	rrset_cache_remove(worker->env.rrset_cache, nm, nmlen, t, c, 0);
 	if(t == LDNS_RR_TYPE_SOA)
 		rrset_cache_remove(worker->env.rrset_cache, nm, nmlen, t, c,
@@ -1213,7 +1280,7 @@ zone_del_rrset(struct lruhash_entry* e, void* arg)
 		struct packed_rrset_data* d = 
 			(struct packed_rrset_data*)e->data;
 		if(d->ttl >= inf->now) {
-			d->ttl = inf->expired;
+			packed_rrset_set_ttl(d, inf->expired);
 			inf->num_rrsets++;
 		}
 	}
@@ -1273,6 +1340,7 @@ do_flush_zone(SSL* ssl, struct worker* worker, char* arg)
 	inf.num_rrsets = 0;
 	inf.num_msgs = 0;
 	inf.num_keys = 0;
+	flush_l1cache(worker);
 	slabhash_traverse(&worker->env.rrset_cache->table, 1, 
 		&zone_del_rrset, &inf);
 
@@ -1299,7 +1367,7 @@ bogus_del_rrset(struct lruhash_entry* e, void* arg)
 	struct del_info* inf = (struct del_info*)arg;
 	struct packed_rrset_data* d = (struct packed_rrset_data*)e->data;
 	if(d->security == sec_status_bogus) {
-		d->ttl = inf->expired;
+		packed_rrset_set_ttl(d, inf->expired);
 		inf->num_rrsets++;
 	}
 }
@@ -1343,6 +1411,7 @@ do_flush_bogus(SSL* ssl, struct worker* worker)
 	inf.num_rrsets = 0;
 	inf.num_msgs = 0;
 	inf.num_keys = 0;
+	flush_l1cache(worker);
 	slabhash_traverse(&worker->env.rrset_cache->table, 1, 
 		&bogus_del_rrset, &inf);
 
@@ -1917,6 +1986,11 @@ do_set_option(SSL* ssl, struct worker* worker, char* arg)
 		(void)ssl_printf(ssl, "error setting option\n");
 		return;
 	}
+	/* the upstream ratelimits take effect without a reload */
+	lock_atomic_store(&worker->env.infra_cache->zone_ratelimit,
+		worker->env.cfg->upstream_zone_ratelimit);
+	lock_atomic_store(&worker->env.infra_cache->server_ratelimit,
+		worker->env.cfg->upstream_server_ratelimit);
 	send_ok(ssl);
 }
 
@@ -2071,6 +2145,7 @@ execute_cmd(struct daemon_remote* rc, SSL* ssl, char* cmd,
 		(void)dump_cache(ssl, worker);
 		return;
 	} else if(cmdcmp(p, "load_cache", 10)) {
+		flush_l1cache(worker);
 		if(load_cache(ssl, worker)) send_ok(ssl);
 		return;
 	} else if(cmdcmp(p, "list_forwards", 13)) {
@@ -2176,6 +2251,8 @@ execute_cmd(struct daemon_remote* rc, SSL* ssl, char* cmd,
 	} else {
 		(void)ssl_printf(ssl, "error unknown command '%s'\n", p);
 	}
+	/* the rrsets that the flush commands removed */
+	alloc_retired_free(&worker->alloc, 1);
 }
 
 void 
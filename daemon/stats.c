@@ -54,6 +54,7 @@
 #include "util/tube.h"
 #include "util/timehist.h"
 #include "util/net_help.h"
+#include "util/netevent.h"
 #include "validator/validator.h"
 #include "ldns/sbuffer.h"
 
@@ -137,6 +138,7 @@ void
 server_stats_compile(struct worker* worker, struct stats_info* s, int reset)
 {
 	int i;
+	struct comm_ssl_stats service, upstream;
 
 	s->svr = worker->stats;
 	s->mesh_num_states = worker->env.mesh->all.count;
@@ -147,6 +149,9 @@ server_stats_compile(struct worker* worker, struct stats_info* s, int reset)
 	s->mesh_replies_sum_wait = worker->env.mesh->replies_sum_wait;
 	s->mesh_time_median = timehist_quartile(worker->env.mesh->histogram,
 		0.50);
+	for(i=0; i<MAX_MODULE; i++)
+		s->mesh_region_hiwater[i] =
+			worker->env.mesh->region_hiwater[i];
 
 	/* add in the values from the mesh */
 	s->svr.ans_secure += worker->env.mesh->ans_secure;
@@ -158,6 +163,14 @@ server_stats_compile(struct worker* worker, struct stats_info* s, int reset)
 		NUM_BUCKETS_HIST);
 	/* values from outside network */
 	s->svr.unwanted_replies = worker->back->unwanted_replies;
+	/* ssl handshake counters of the comm base */
+	comm_base_ssl_stats(worker->base, &service, &upstream, 0);
+	s->svr.ssl_service_handshake = service.handshake;
+	s->svr.ssl_service_resumed = service.resumed;
+	s->svr.ssl_service_failed = service.failed;
+	s->svr.ssl_upstream_handshake = upstream.handshake;
+	s->svr.ssl_upstream_resumed = upstream.resumed;
+	s->svr.ssl_upstream_failed = upstream.failed;
 
 	/* get and reset validator rrset bogus number */
 	s->svr.rrset_bogus = get_rrset_bogus(worker);
@@ -204,16 +217,21 @@ void server_stats_reply(struct worker* worker, int reset)
 
 void server_stats_add(struct stats_info* total, struct stats_info* a)
 {
+	int i;
 	total->svr.num_queries += a->svr.num_queries;
 	total->svr.num_queries_missed_cache += a->svr.num_queries_missed_cache;
+	total->svr.num_queries_l1cache += a->svr.num_queries_l1cache;
 	total->svr.num_queries_prefetch += a->svr.num_queries_prefetch;
+	total->svr.num_queries_prefetch_popular +=
+		a->svr.num_queries_prefetch_popular;
+	total->svr.num_queries_rrl_dropped += a->svr.num_queries_rrl_dropped;
+	total->svr.num_queries_rrl_slipped += a->svr.num_queries_rrl_slipped;
 	total->svr.sum_query_list_size += a->svr.sum_query_list_size;
 	/* the max size reached is upped to higher of both */
 	if(a->svr.max_query_list_size > total->svr.max_query_list_size)
 		total->svr.max_query_list_size = a->svr.max_query_list_size;
 
 	if(a->svr.extended) {
-		int i;
 		total->svr.qtype_big += a->svr.qtype_big;
 		total->svr.qclass_big += a->svr.qclass_big;
 		total->svr.qtcp += a->svr.qtcp;
@@ -234,6 +252,15 @@ void server_stats_add(struct stats_info* total, struct stats_info* a)
 		total->svr.rrset_bogus += a->svr.rrset_bogus;
 		total->svr.unwanted_replies += a->svr.unwanted_replies;
 		total->svr.unwanted_queries += a->svr.unwanted_queries;
+		total->svr.ssl_service_handshake +=
+			a->svr.ssl_service_handshake;
+		total->svr.ssl_service_resumed += a->svr.ssl_service_resumed;
+		total->svr.ssl_service_failed += a->svr.ssl_service_failed;
+		total->svr.ssl_upstream_handshake +=
+			a->svr.ssl_upstream_handshake;
+		total->svr.ssl_upstream_resumed +=
+			a->svr.ssl_upstream_resumed;
+		total->svr.ssl_upstream_failed += a->svr.ssl_upstream_failed;
 		for(i=0; i<STATS_QTYPE_NUM; i++)
 			total->svr.qtype[i] += a->svr.qtype[i];
 		for(i=0; i<STATS_QCLASS_NUM; i++)
@@ -256,6 +283,11 @@ void server_stats_add(struct stats_info* total, struct stats_info* a)
 	 * taking the median over all of the data, but is good and fast
 	 * added up here, division later*/
 	total->mesh_time_median += a->mesh_time_median;
+	/* the high-water marks are upped to the higher of both */
+	for(i=0; i<MAX_MODULE; i++)
+		if(a->mesh_region_hiwater[i] > total->mesh_region_hiwater[i])
+			total->mesh_region_hiwater[i] =
+				a->mesh_region_hiwater[i];
 }
 
 void server_stats_insquery(struct server_stats* stats, struct comm_point* c,
@@ -43,6 +43,7 @@
 #ifndef DAEMON_STATS_H
 #define DAEMON_STATS_H
 #include "util/timehist.h"
+#include "util/module.h"
 struct worker;
 struct config_file;
 struct comm_point;
@@ -65,8 +66,16 @@ struct server_stats {
 	size_t num_queries;
 	/** number of queries that had a cache-miss. */
 	size_t num_queries_missed_cache;
+	/** number of queries answered from the answer cache of the thread */
+	size_t num_queries_l1cache;
 	/** number of prefetch queries - cachehits with prefetch */
 	size_t num_queries_prefetch;
+	/** number of prefetches of popular queries, by the scheduler */
+	size_t num_queries_prefetch_popular;
+	/** number of queries dropped by the response rate limit */
+	size_t num_queries_rrl_dropped;
+	/** number of queries answered with TC by the response rate limit */
+	size_t num_queries_rrl_slipped;
 
 	/**
 	 * Sum of the querylistsize of the worker for 
@@ -127,6 +136,18 @@ struct server_stats {
 	size_t unwanted_replies;
 	/** unwanted traffic received on client-facing ports */
 	size_t unwanted_queries;
+	/** ssl service handshakes completed */
+	size_t ssl_service_handshake;
+	/** ssl service handshakes that resumed a session */
+	size_t ssl_service_resumed;
+	/** ssl service handshakes that failed */
+	size_t ssl_service_failed;
+	/** ssl upstream handshakes completed */
+	size_t ssl_upstream_handshake;
+	/** ssl upstream handshakes that resumed a session */
+	size_t ssl_upstream_resumed;
+	/** ssl upstream handshakes that failed */
+	size_t ssl_upstream_failed;
 
 	/** histogram data exported to array 
 	 * if the array is the same size, no data is lost, and
@@ -157,6 +178,9 @@ struct stats_info {
 	struct timeval mesh_replies_sum_wait;
 	/** mesh stats: median of waiting times for replies (in sec) */
 	double mesh_time_median;
+	/** mesh stats: high-water mark of the state region size, per
+	 * module (in bytes) */
+	size_t mesh_region_hiwater[MAX_MODULE];
 };
 
 /** 
@@ -467,6 +467,9 @@ perform_setup(struct daemon* daemon, struct config_file* cfg, int debug_mode,
 		if(!(daemon->listen_sslctx = listen_sslctx_create(
 			cfg->ssl_service_key, cfg->ssl_service_pem, NULL)))
 			fatal_exit("could not set up listen SSL_CTX");
+		if(!listen_sslctx_setup_ticket_keys(daemon->listen_sslctx,
+			cfg->ssl_session_ticket_keys))
+			fatal_exit("could not set session ticket SSL_CTX");
 	}
 	if(!(daemon->connect_sslctx = connect_sslctx_create(NULL, NULL, NULL)))
 		fatal_exit("could not set up connect SSL_CTX");
@@ -666,6 +669,15 @@ run_daemon(const char* cfgfile, int cmdline_verbose, int debug_mode)
 			/* reopen log after HUP to facilitate log rotation */
 			if(!cfg->use_syslog)
 				log_init(cfg->logfile, 0, cfg->chrootdir);
+#ifdef HAVE_SSL
+			/* read the ticket keys again, they may be rotated */
+			if(daemon->listen_sslctx &&
+				!listen_sslctx_setup_ticket_keys(
+				daemon->listen_sslctx,
+				cfg->ssl_session_ticket_keys))
+				log_err("could not reload the "
+					"ssl-session-ticket-keys");
+#endif
 		}
 		/* work */
 		daemon_fork(daemon);
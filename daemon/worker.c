@@ -60,6 +60,9 @@
 #include "services/cache/dns.h"
 #include "services/mesh.h"
 #include "services/localzone.h"
+#include "services/rrl.h"
+#include "services/hotnames.h"
+#include "services/cache/l1cache.h"
 #include "util/data/msgparse.h"
 #include "util/data/msgencode.h"
 #include "util/data/dname.h"
@@ -84,6 +87,10 @@
 
 /** Size of an UDP datagram */
 #define NORMAL_UDP_SIZE	512 /* bytes */
+/** hash bins of every cache slab to scan for expired entries per slice */
+#define EXPIRY_SCAN_BINS 256
+/** the cache hits read without locks touch the rrset LRU once per this many */
+#define RRSET_TOUCH_SAMPLE 8
 
 /** 
  * seconds to add to prefetch leeway.  This is a TTL that expires old rrsets
@@ -181,7 +188,10 @@ worker_mem_report(struct worker* ATTR_UNUSED(worker),
 		+ sizeof(*worker->env.scratch_buffer) 
 		+ sldns_buffer_capacity(worker->env.scratch_buffer)
 		+ forwards_get_mem(worker->env.fwds)
-		+ hints_get_mem(worker->env.hints);
+		+ hints_get_mem(worker->env.hints)
+		+ rrl_get_mem(worker->rrl)
+		+ hotnames_get_mem(worker->hotnames)
+		+ l1cache_get_mem(worker->l1cache);
 	if(worker->thread_num == 0)
 		me += acl_list_get_mem(worker->daemon->acl);
 	if(cur_serv) {
@@ -518,28 +528,40 @@ answer_norec_from_cache(struct worker* worker, struct query_info* qinfo,
 	return 1;
 }
 
-/** answer query from the cache */
-static int
-answer_from_cache(struct worker* worker, struct query_info* qinfo,
+/** return values of answer_cached_rrsets */
+enum cached_answer {
+	/** the cache entry cannot be used, resolve the query */
+	cached_answer_none = 0,
+	/** the answer is encoded */
+	cached_answer_ok,
+	/** the cache entry is bogus, SERVFAIL is encoded */
+	cached_answer_bogus,
+	/** the answer could not be encoded, SERVFAIL is encoded */
+	cached_answer_fail
+};
+
+/**
+ * Encode the answer from a cached reply, whose rrsets are locked, or are
+ * read without locks.
+ * @param worker: the worker.
+ * @param qinfo: the query.
+ * @param rep: the cached reply.
+ * @param id: query id.
+ * @param flags: query flags.
+ * @param repinfo: the reply, the answer goes into its buffer.
+ * @param edns: the EDNS of the query, it is changed for the answer.
+ * @param secure: returns if the answer is secure.
+ * @return what was encoded.
+ */
+static enum cached_answer
+answer_cached_rrsets(struct worker* worker, struct query_info* qinfo,
 	struct reply_info* rep, uint16_t id, uint16_t flags, 
-	struct comm_reply* repinfo, struct edns_data* edns)
+	struct comm_reply* repinfo, struct edns_data* edns, int* secure)
 {
 	time_t timenow = *worker->env.now;
 	uint16_t udpsize = edns->udp_size;
-	int secure;
 	int must_validate = (!(flags&BIT_CD) || worker->env.cfg->ignore_cd)
 		&& worker->env.need_to_validate;
-	/* see if it is possible */
-	if(rep->ttl < timenow) {
-		/* the rrsets may have been updated in the meantime.
-		 * we will refetch the message format from the
-		 * authoritative server 
-		 */
-		return 0;
-	}
-	if(!rrset_array_lock(rep->ref, rep->rrset_count, timenow))
-		return 0;
-	/* locked and ids and ttls are OK. */
 	/* check CNAME chain (if any) */
 	if(rep->an_numrrsets > 0 && (rep->rrsets[0]->rk.type == 
 		htons(LDNS_RR_TYPE_CNAME) || rep->rrsets[0]->rk.type == 
@@ -547,11 +569,7 @@ answer_from_cache(struct worker* worker, struct query_info* qinfo,
 		if(!reply_check_cname_chain(rep)) {
 			/* cname chain invalid, redo iterator steps */
 			verbose(VERB_ALGO, "Cache reply: cname chain broken");
-		bail_out:
-			rrset_array_unlock_touch(worker->env.rrset_cache, 
-				worker->scratchpad, rep->ref, rep->rrset_count);
-			regional_free_all(worker->scratchpad);
-			return 0;
+			return cached_answer_none;
 		}
 	}
 	/* check security status of the cached answer */
@@ -563,30 +581,23 @@ answer_from_cache(struct worker* worker, struct query_info* qinfo,
 		edns->bits &= EDNS_DO;
 		error_encode(repinfo->c->buffer, LDNS_RCODE_SERVFAIL, 
 			qinfo, id, flags, edns);
-		rrset_array_unlock_touch(worker->env.rrset_cache, 
-			worker->scratchpad, rep->ref, rep->rrset_count);
-		regional_free_all(worker->scratchpad);
-		if(worker->stats.extended) {
-			worker->stats.ans_bogus ++;
-			worker->stats.ans_rcode[LDNS_RCODE_SERVFAIL] ++;
-		}
-		return 1;
+		return cached_answer_bogus;
 	} else if( rep->security == sec_status_unchecked && must_validate) {
 		verbose(VERB_ALGO, "Cache reply: unchecked entry needs "
 			"validation");
-		goto bail_out; /* need to validate cache entry first */
+		return cached_answer_none; /* need to validate it first */
 	} else if(rep->security == sec_status_secure) {
 		if(reply_all_rrsets_secure(rep))
-			secure = 1;
+			*secure = 1;
 		else	{
 			if(must_validate) {
 				verbose(VERB_ALGO, "Cache reply: secure entry"
 					" changed status");
-				goto bail_out; /* rrset changed, re-verify */
+				return cached_answer_none; /* re-verify */
 			}
-			secure = 0;
+			*secure = 0;
 		}
-	} else	secure = 0;
+	} else	*secure = 0;
 
 	edns->edns_version = EDNS_ADVERTISED_VERSION;
 	edns->udp_size = EDNS_ADVERTISED_SIZE;
@@ -594,15 +605,138 @@ answer_from_cache(struct worker* worker, struct query_info* qinfo,
 	edns->bits &= EDNS_DO;
 	if(!reply_info_answer_encode(qinfo, rep, id, flags, 
 		repinfo->c->buffer, timenow, 1, worker->scratchpad,
-		udpsize, edns, (int)(edns->bits & EDNS_DO), secure)) {
+		udpsize, edns, (int)(edns->bits & EDNS_DO), *secure)) {
 		error_encode(repinfo->c->buffer, LDNS_RCODE_SERVFAIL, 
 			qinfo, id, flags, edns);
+		return cached_answer_fail;
+	}
+	return cached_answer_ok;
+}
+
+/**
+ * Answer from the cached reply, reading the rrsets without locks.
+ * @return false if that did not work out, and the rrsets have to be
+ *	locked.  Otherwise, ans is what was encoded.
+ */
+static int
+answer_cached_optimistic(struct worker* worker, struct query_info* qinfo,
+	hashvalue_t h, struct lruhash_entry* e, uint16_t id, uint16_t flags, 
+	struct comm_reply* repinfo, struct edns_data* edns, int* secure,
+	enum cached_answer* ans)
+{
+	time_t timenow = *worker->env.now;
+	struct reply_info* rep = (struct reply_info*)e->data;
+	struct edns_data orig_edns = *edns;
+	sldns_buffer* buf = repinfo->c->buffer;
+	size_t len = sldns_buffer_limit(buf);
+	uint8_t* query;
+	uint32_t* vers = (uint32_t*)regional_alloc(worker->scratchpad,
+		sizeof(uint32_t)*rep->rrset_count);
+	/* the query is kept, to put it back if the answer is discarded */
+	query = (uint8_t*)regional_alloc_init(worker->scratchpad,
+		sldns_buffer_begin(buf), len);
+	if(!vers || !query || !alloc_read_begin(&worker->alloc))
+		return 0;
+	/* the rrset data is not freed during the read section, if a
+	 * writer changed it, what was read is discarded */
+	if(!rrset_array_peek(rep->ref, rep->rrset_count, timenow, vers)) {
+		alloc_read_end(&worker->alloc);
+		return 0;
+	}
+	*ans = answer_cached_rrsets(worker, qinfo, rep, id, flags, repinfo,
+		edns, secure);
+	if(!rrset_array_validate(rep->ref, rep->rrset_count, vers)) {
+		alloc_read_end(&worker->alloc);
+		*edns = orig_edns;
+		sldns_buffer_clear(buf);
+		sldns_buffer_write(buf, query, len);
+		sldns_buffer_flip(buf);
+		return 0;
+	}
+	if(*ans == cached_answer_ok && worker->l1cache)
+		l1cache_store(worker->l1cache, e, qinfo, h, flags, &orig_edns,
+			orig_edns.udp_size, vers, *secure, timenow,
+			repinfo->c->buffer);
+	alloc_read_end(&worker->alloc);
+	/* the LRU touch takes locks, do it for a sample of the hits */
+	if(++worker->rrset_touch >= RRSET_TOUCH_SAMPLE) {
+		worker->rrset_touch = 0;
+		rrset_array_touch(worker->env.rrset_cache, rep->ref,
+			rep->rrset_count);
+	}
+	return 1;
+}
+
+/** answer query from the encoded answers of this thread, the message
+ * entry is read locked */
+static int
+answer_from_l1cache(struct worker* worker, struct lruhash_entry* e,
+	struct query_info* qinfo, hashvalue_t h, struct comm_point* c,
+	struct edns_data* edns)
+{
+	int secure = 0;
+	if(!worker->l1cache || !l1cache_answer(worker->l1cache, e, qinfo, h,
+		*(uint16_t*)sldns_buffer_begin(c->buffer),
+		sldns_buffer_read_u16_at(c->buffer, 2), edns,
+		*worker->env.now, c->buffer, &secure))
+		return 0;
+	worker->stats.num_queries_l1cache++;
+	if(worker->stats.extended) {
+		if(secure) worker->stats.ans_secure++;
+		server_stats_insrcode(&worker->stats, c->buffer);
+	}
+	return 1;
+}
+
+/** answer query from the cache, the message entry is read locked */
+static int
+answer_from_cache(struct worker* worker, struct query_info* qinfo,
+	hashvalue_t h, struct lruhash_entry* e, uint16_t id, uint16_t flags, 
+	struct comm_reply* repinfo, struct edns_data* edns)
+{
+	time_t timenow = *worker->env.now;
+	struct reply_info* rep = (struct reply_info*)e->data;
+	uint16_t udpsize = edns->udp_size;
+	int secure = 0;
+	enum cached_answer ans;
+	/* see if it is possible */
+	if(rep->ttl < timenow) {
+		/* the rrsets may have been updated in the meantime.
+		 * we will refetch the message format from the
+		 * authoritative server 
+		 */
+		return 0;
+	}
+	if(!answer_cached_optimistic(worker, qinfo, h, e, id, flags,
+		repinfo, edns, &secure, &ans)) {
+		if(!rrset_array_lock(rep->ref, rep->rrset_count, timenow)) {
+			regional_free_all(worker->scratchpad);
+			return 0;
+		}
+		/* locked and ids and ttls are OK. */
+		ans = answer_cached_rrsets(worker, qinfo, rep, id, flags,
+			repinfo, edns, &secure);
+		if(ans == cached_answer_ok && worker->l1cache) {
+			/* the rrsets are locked, their data can be noted */
+			l1cache_store(worker->l1cache, e, qinfo, h, flags,
+				edns, udpsize, NULL, secure, timenow,
+				repinfo->c->buffer);
+		}
+		/* cannot send the reply right now, because blocking network
+		 * syscall is bad while holding locks. */
+		rrset_array_unlock_touch(worker->env.rrset_cache,
+			worker->scratchpad, rep->ref, rep->rrset_count);
 	}
-	/* cannot send the reply right now, because blocking network syscall
-	 * is bad while holding locks. */
-	rrset_array_unlock_touch(worker->env.rrset_cache, worker->scratchpad,
-		rep->ref, rep->rrset_count);
 	regional_free_all(worker->scratchpad);
+	if(ans == cached_answer_none)
+		return 0;
+	if(ans == cached_answer_bogus) {
+		if(worker->stats.extended) {
+			worker->stats.ans_bogus ++;
+			worker->stats.ans_rcode[LDNS_RCODE_SERVFAIL] ++;
+		}
+		return 1;
+	}
 	if(worker->stats.extended) {
 		if(secure) worker->stats.ans_secure++;
 		server_stats_insrcode(&worker->stats, repinfo->c->buffer);
@@ -838,6 +972,19 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		server_stats_insrcode(&worker->stats, c->buffer);
 		return 1;
 	}
+	if(edns.keepalive.pos && edns.keepalive.len != 0 &&
+		c->type != comm_udp) {
+		/* RFC 7828, queries carry the option without a timeout */
+		verbose(VERB_ALGO, "worker request: edns-tcp-keepalive "
+			"option with data, formerror.");
+		log_addr(VERB_CLIENT,"from",&repinfo->addr, repinfo->addrlen);
+		sldns_buffer_rewind(c->buffer);
+		LDNS_QR_SET(sldns_buffer_begin(c->buffer));
+		LDNS_RCODE_SET(sldns_buffer_begin(c->buffer),
+			LDNS_RCODE_FORMERR);
+		server_stats_insrcode(&worker->stats, c->buffer);
+		return 1;
+	}
 	if(edns.edns_present && edns.edns_version != 0) {
 		edns.ext_rcode = (uint8_t)(EDNS_RCODE_BADVERS>>4);
 		edns.edns_version = EDNS_ADVERTISED_VERSION;
@@ -879,9 +1026,37 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		sldns_buffer_flip(c->buffer);
 		return 1;
 	}
+	if(edns.keepalive.pos && edns.keepalive.len == 0 &&
+		(ret = comm_point_tcp_idle_timeout(c)) > 0) {
+		/* tell the client how long the connection stays open */
+		ret /= 100;
+		sldns_write_uint16(worker->keepalive_data,
+			(uint16_t)(ret>0xffff?0xffff:ret));
+		edns.opt_list = &worker->keepalive_opt;
+	}
 	if(worker->stats.extended)
 		server_stats_insquery(&worker->stats, c, qinfo.qtype,
 			qinfo.qclass, &edns, repinfo);
+	if(worker->rrl && c->type == comm_udp) {
+		switch(rrl_check(worker->rrl, &repinfo->addr,
+			repinfo->addrlen, &qinfo, worker->env.now_tv)) {
+		case rrl_drop:
+			worker->stats.num_queries_rrl_dropped++;
+			comm_point_drop_reply(repinfo);
+			return 0;
+		case rrl_slip:
+			/* truncated answer, a real client retries with TCP */
+			worker->stats.num_queries_rrl_slipped++;
+			error_encode(c->buffer, LDNS_RCODE_NOERROR, &qinfo,
+				*(uint16_t*)sldns_buffer_begin(c->buffer),
+				sldns_buffer_read_u16_at(c->buffer, 2), &edns);
+			LDNS_TC_SET(sldns_buffer_begin(c->buffer));
+			return 1;
+		case rrl_pass:
+		default:
+			break;
+		}
+	}
 	if(c->type != comm_udp)
 		edns.udp_size = 65535; /* max size for TCP replies */
 	if(qinfo.qclass == LDNS_RR_CLASS_CH && answer_chaos(worker, &qinfo,
@@ -924,10 +1099,14 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		return 1;
 	}
 	h = query_info_hash(&qinfo);
+	if(worker->hotnames)
+		hotnames_add(worker->hotnames, &qinfo, h,
+			sldns_buffer_read_u16_at(c->buffer, 2),
+			*worker->env.now);
 	if((e=slabhash_lookup(worker->env.msg_cache, h, &qinfo, 0))) {
 		/* answer from cache - we have acquired a readlock on it */
-		if(answer_from_cache(worker, &qinfo, 
-			(struct reply_info*)e->data, 
+		if(answer_from_l1cache(worker, e, &qinfo, h, c, &edns) ||
+			answer_from_cache(worker, &qinfo, h, e,
 			*(uint16_t*)sldns_buffer_begin(c->buffer), 
 			sldns_buffer_read_u16_at(c->buffer, 2), repinfo, 
 			&edns)) {
@@ -1042,6 +1221,84 @@ void worker_stat_timer_cb(void* arg)
 	worker_restart_timer(worker);
 }
 
+/** restart expiry scan timer for worker, if enabled */
+static void
+worker_restart_expiry_timer(struct worker* worker)
+{
+	if(worker->env.cfg->cache_expiry_scan > 0) {
+		struct timeval tv;
+#ifndef S_SPLINT_S
+		tv.tv_sec = worker->env.cfg->cache_expiry_scan / 1000;
+		tv.tv_usec = (worker->env.cfg->cache_expiry_scan % 1000)*1000;
+#endif
+		comm_timer_set(worker->expiry_timer, &tv);
+	}
+}
+
+void worker_expiry_timer_cb(void* arg)
+{
+	struct worker* worker = (struct worker*)arg;
+	size_t n;
+	/* a slice of the caches, the workers take turns on the slabs */
+	n = slabhash_reclaim_expired(worker->env.msg_cache,
+		&msgreply_expired, *worker->env.now, EXPIRY_SCAN_BINS);
+	n += slabhash_reclaim_expired(&worker->env.rrset_cache->table,
+		&ub_rrset_expired, *worker->env.now, EXPIRY_SCAN_BINS);
+	alloc_retired_free(&worker->alloc, 1);
+	if(n > 0)
+		verbose(VERB_ALGO, "expiry scan removed %u entries",
+			(unsigned)n);
+	worker_restart_expiry_timer(worker);
+}
+
+void worker_hot_timer_cb(void* arg)
+{
+	struct worker* worker = (struct worker*)arg;
+	struct hotnames* hn = worker->hotnames;
+	time_t now = *worker->env.now;
+	struct hotname** top;
+	struct timeval tv;
+	size_t i, n;
+	n = hotnames_top(hn, HOTNAMES_MIN_COUNT, &top);
+	/* most popular first, so they get the prefetch budget */
+	for(i=0; i<n; i++) {
+		struct hotname* p = top[i];
+		struct query_info qinfo;
+		struct lruhash_entry* e;
+		struct reply_info* rep;
+		time_t leeway;
+		if(now < p->holddown)
+			continue;
+		qinfo.qname = p->qname;
+		qinfo.qname_len = p->qname_len;
+		qinfo.qtype = p->qtype;
+		qinfo.qclass = p->qclass;
+		if(!(e=slabhash_lookup(worker->env.msg_cache, p->hash,
+			&qinfo, 0)))
+			continue;
+		rep = (struct reply_info*)e->data;
+		/* refresh it when it is in the last part of the TTL, or
+		 * when it expires before the next run of the timer */
+		if(now < rep->prefetch_ttl && rep->ttl > now+1) {
+			lock_rw_unlock(&e->lock);
+			continue;
+		}
+		leeway = rep->ttl - now;
+		lock_rw_unlock(&e->lock);
+		if(!hotnames_budget(hn, now))
+			break;
+		p->holddown = now + HOTNAMES_HOLDDOWN;
+		worker->stats.num_queries_prefetch_popular++;
+		mesh_new_prefetch(worker->env.mesh, &qinfo, p->flags,
+			(leeway>0?leeway:0) + PREFETCH_EXPIRY_ADD);
+	}
+#ifndef S_SPLINT_S
+	tv.tv_sec = 1;
+	tv.tv_usec = 0;
+#endif
+	comm_timer_set(worker->hot_timer, &tv);
+}
+
 void worker_probe_timer_cb(void* arg)
 {
 	struct worker* worker = (struct worker*)arg;
@@ -1143,7 +1400,7 @@ worker_init(struct worker* worker, struct config_file *cfg,
 	}
 	worker->front = listen_create(worker->base, ports,
 		cfg->msg_buffer_size, (int)cfg->incoming_num_tcp, 
-		worker->daemon->listen_sslctx, worker_handle_request, worker);
+		cfg->tcp_idle_timeout, worker->daemon->listen_sslctx, worker_handle_request, worker);
 	if(!worker->front) {
 		log_err("could not create listening sockets");
 		worker_delete(worker);
@@ -1156,7 +1413,8 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		worker->daemon->env->infra_cache, worker->rndstate,
 		cfg->use_caps_bits_for_id, worker->ports, worker->numports,
 		cfg->unwanted_threshold, &worker_alloc_cleanup, worker,
-		cfg->do_udp, worker->daemon->connect_sslctx, cfg->delay_close);
+		cfg->do_udp, worker->daemon->connect_sslctx, cfg->delay_close,
+		cfg->tcp_upstream_fastopen);
 	if(!worker->back) {
 		log_err("could not create outgoing sockets");
 		worker_delete(worker);
@@ -1174,6 +1432,11 @@ worker_init(struct worker* worker, struct config_file *cfg,
 	if(!worker->stat_timer) {
 		log_err("could not create statistics timer");
 	}
+	worker->expiry_timer = comm_timer_create(worker->base, 
+		worker_expiry_timer_cb, worker);
+	if(!worker->expiry_timer) {
+		log_err("could not create expiry scan timer");
+	}
 
 	/* we use the msg_buffer_size as a good estimate for what the 
 	 * user wants for memory usage sizes */
@@ -1183,6 +1446,46 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		worker_delete(worker);
 		return 0;
 	}
+	if(cfg->rrl_ratelimit > 0) {
+		worker->rrl = rrl_create(cfg->rrl_size, cfg->rrl_ratelimit,
+			cfg->rrl_slip, cfg->rrl_ipv4_prefix,
+			cfg->rrl_ipv6_prefix, (uint32_t)ub_random(
+			worker->rndstate));
+		if(!worker->rrl) {
+			log_err("malloc failure");
+			worker_delete(worker);
+			return 0;
+		}
+	}
+
+	if(cfg->prefetch_popular > 0) {
+		struct timeval tv;
+		worker->hotnames = hotnames_create(cfg->prefetch_popular,
+			cfg->prefetch_popular_rate);
+		worker->hot_timer = comm_timer_create(worker->base,
+			worker_hot_timer_cb, worker);
+		if(!worker->hotnames || !worker->hot_timer) {
+			log_err("malloc failure");
+			worker_delete(worker);
+			return 0;
+		}
+#ifndef S_SPLINT_S
+		tv.tv_sec = 1;
+		tv.tv_usec = 0;
+#endif
+		comm_timer_set(worker->hot_timer, &tv);
+	}
+	worker->keepalive_opt.opt_code = LDNS_EDNS_KEEPALIVE;
+	worker->keepalive_opt.opt_len = sizeof(worker->keepalive_data);
+	worker->keepalive_opt.opt_data = worker->keepalive_data;
+	if(cfg->msg_cache_l1_slots > 0) {
+		if(!(worker->l1cache = l1cache_create(
+			cfg->msg_cache_l1_slots, &worker->daemon->cache_flush))) {
+			log_err("malloc failure");
+			worker_delete(worker);
+			return 0;
+		}
+	}
 
 	server_stats_init(&worker->stats, cfg);
 	alloc_init(&worker->alloc, &worker->daemon->superalloc, 
@@ -1244,6 +1547,7 @@ worker_init(struct worker* worker, struct config_file *cfg,
 			worker->env.cfg->stat_interval);
 		worker_restart_timer(worker);
 	}
+	worker_restart_expiry_timer(worker);
 	return 1;
 }
 
@@ -1273,6 +1577,8 @@ worker_delete(struct worker* worker)
 	comm_signal_delete(worker->comsig);
 	tube_delete(worker->cmd);
 	comm_timer_delete(worker->stat_timer);
+	comm_timer_delete(worker->expiry_timer);
+	comm_timer_delete(worker->hot_timer);
 	comm_timer_delete(worker->env.probe_timer);
 	free(worker->ports);
 	if(worker->thread_num == 0) {
@@ -1285,6 +1591,9 @@ worker_delete(struct worker* worker)
 	ub_randfree(worker->rndstate);
 	alloc_clear(&worker->alloc);
 	regional_destroy(worker->scratchpad);
+	rrl_delete(worker->rrl);
+	hotnames_delete(worker->hotnames);
+	l1cache_delete(worker->l1cache);
 	free(worker);
 }
 
@@ -1321,9 +1630,11 @@ worker_alloc_cleanup(void* arg)
 
 void worker_stats_clear(struct worker* worker)
 {
+	struct comm_ssl_stats service, upstream;
 	server_stats_init(&worker->stats, worker->env.cfg);
 	mesh_stats_clear(worker->env.mesh);
 	worker->back->unwanted_replies = 0;
+	comm_base_ssl_stats(worker->base, &service, &upstream, 1);
 }
 
 void worker_start_accept(void* arg)
@@ -59,6 +59,9 @@ struct ub_randstate;
 struct regional;
 struct tube;
 struct daemon_remote;
+struct rrl;
+struct hotnames;
+struct l1cache;
 
 /** worker commands */
 enum worker_commands {
@@ -101,6 +104,23 @@ struct worker {
 	struct comm_point* cmd_com;
 	/** timer for statistics */
 	struct comm_timer* stat_timer;
+	/** timer for the expiry scan of the caches */
+	struct comm_timer* expiry_timer;
+	/** timer for the prefetch of popular queries */
+	struct comm_timer* hot_timer;
+	/** the popular queries, NULL if not enabled */
+	struct hotnames* hotnames;
+	/** the answer cache of this thread, NULL if not enabled */
+	struct l1cache* l1cache;
+	/** the edns-tcp-keepalive option, appended to replies over tcp
+	 * when the query has the option.  The mesh copies it for the
+	 * replies it sends later. */
+	struct edns_option keepalive_opt;
+	/** the data of the keepalive option, the idle timeout in units of
+	 * 100 msec */
+	uint8_t keepalive_data[2];
+	/** cache hits since the last rrset LRU touch */
+	int rrset_touch;
 
 	/** random() table for this worker. */
 	struct ub_randstate* rndstate;
@@ -112,6 +132,8 @@ struct worker {
 	struct server_stats stats;
 	/** thread scratch regional */
 	struct regional* scratchpad;
+	/** response rate limit for client queries, NULL if off */
+	struct rrl* rrl;
 
 	/** module environment passed to modules, changed for this thread */
 	struct module_env env;
@@ -222,6 +244,12 @@ void worker_stats_clear(struct worker* worker);
 /** statistics timer callback handler */
 void worker_stat_timer_cb(void* arg);
 
+/** expiry scan timer callback handler */
+void worker_expiry_timer_cb(void* arg);
+
+/** popular prefetch timer callback handler */
+void worker_hot_timer_cb(void* arg);
+
 /** probe timer callback handler */
 void worker_probe_timer_cb(void* arg);
 
@@ -388,12 +388,15 @@ delegpt_rrset_add_ns(struct delegpt* dp, struct regional* region,
 	if(nsdata->security == sec_status_bogus)
 		dp->bogus = 1;
 	for(i=0; i<nsdata->count; i++) {
-		if(nsdata->rr_len[i] < 2+1) continue; /* len + root label */
-		if(dname_valid(nsdata->rr_data[i]+2, nsdata->rr_len[i]-2) !=
-			(size_t)sldns_read_uint16(nsdata->rr_data[i]))
+		if(packed_rr_len(nsdata, i) < 2+1)
+			continue; /* len + root label */
+		if(dname_valid(packed_rr_data(nsdata, i)+2,
+			packed_rr_len(nsdata, i)-2) !=
+			(size_t)sldns_read_uint16(packed_rr_data(nsdata, i)))
 			continue; /* bad format */
 		/* add rdata of NS (= wirefmt dname), skip rdatalen bytes */
-		if(!delegpt_add_ns(dp, region, nsdata->rr_data[i]+2, lame))
+		if(!delegpt_add_ns(dp, region, packed_rr_data(nsdata, i)+2,
+			lame))
 			return 0;
 	}
 	return 1;
@@ -412,9 +415,9 @@ delegpt_add_rrset_A(struct delegpt* dp, struct regional* region,
         sa.sin_family = AF_INET;
         sa.sin_port = (in_port_t)htons(UNBOUND_DNS_PORT);
         for(i=0; i<d->count; i++) {
-                if(d->rr_len[i] != 2 + INET_SIZE)
+                if(packed_rr_len(d, i) != 2 + INET_SIZE)
                         continue;
-                memmove(&sa.sin_addr, d->rr_data[i]+2, INET_SIZE);
+                memmove(&sa.sin_addr, packed_rr_data(d, i)+2, INET_SIZE);
                 if(!delegpt_add_target(dp, region, ak->rk.dname,
                         ak->rk.dname_len, (struct sockaddr_storage*)&sa,
                         len, (d->security==sec_status_bogus), lame))
@@ -436,9 +439,10 @@ delegpt_add_rrset_AAAA(struct delegpt* dp, struct regional* region,
         sa.sin6_family = AF_INET6;
         sa.sin6_port = (in_port_t)htons(UNBOUND_DNS_PORT);
         for(i=0; i<d->count; i++) {
-                if(d->rr_len[i] != 2 + INET6_SIZE) /* rdatalen + len of IP6 */
+                /* rdatalen + len of IP6 */
+                if(packed_rr_len(d, i) != 2 + INET6_SIZE)
                         continue;
-                memmove(&sa.sin6_addr, d->rr_data[i]+2, INET6_SIZE);
+                memmove(&sa.sin6_addr, packed_rr_data(d, i)+2, INET6_SIZE);
                 if(!delegpt_add_target(dp, region, ak->rk.dname,
                         ak->rk.dname_len, (struct sockaddr_storage*)&sa,
                         len, (d->security==sec_status_bogus), lame))
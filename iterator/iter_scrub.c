@@ -184,9 +184,12 @@ mark_additional_rrset(sldns_buffer* pkt, struct msg_parse* msg,
 
 /** Get target name of a CNAME */
 static int
-parse_get_cname_target(struct rrset_parse* rrset, uint8_t** sname, 
-	size_t* snamelen)
+parse_get_cname_target(sldns_buffer* pkt, struct rrset_parse* rrset,
+	uint8_t** sname, size_t* snamelen)
 {
+	/* the rdata has not been walked by parse_packet, check it */
+	if(!parse_rrset_calc_size(pkt, rrset))
+		return 0;
 	if(rrset->rr_count != 1) {
 		struct rr_parse* sig;
 		verbose(VERB_ALGO, "Found CNAME rrset with "
@@ -215,7 +218,7 @@ synth_cname(uint8_t* qname, size_t qnamelen, struct rrset_parse* dname_rrset,
 	/* we already know that sname is a strict subdomain of DNAME owner */
 	uint8_t* dtarg = NULL;
 	size_t dtarglen;
-	if(!parse_get_cname_target(dname_rrset, &dtarg, &dtarglen))
+	if(!parse_get_cname_target(pkt, dname_rrset, &dtarg, &dtarglen))
 		return 0; 
 	log_assert(qnamelen > dname_rrset->dname_len);
 	/* DNAME from com. to net. with qname example.com. -> example.net. */
@@ -372,7 +375,8 @@ scrub_normalize(sldns_buffer* pkt, struct msg_parse* msg,
 				/* check next cname */
 				uint8_t* t = NULL;
 				size_t tlen = 0;
-				if(!parse_get_cname_target(rrset, &t, &tlen))
+				if(!parse_get_cname_target(pkt, rrset, &t,
+					&tlen))
 					return 0;
 				if(dname_pkt_compare(pkt, alias, t) == 0) {
 					/* it's OK and better capitalized */
@@ -406,7 +410,8 @@ scrub_normalize(sldns_buffer* pkt, struct msg_parse* msg,
 		/* Follow the CNAME chain. */
 		if(rrset->type == LDNS_RR_TYPE_CNAME) {
 			uint8_t* oldsname = sname;
-			if(!parse_get_cname_target(rrset, &sname, &snamelen))
+			if(!parse_get_cname_target(pkt, rrset, &sname,
+				&snamelen))
 				return 0;
 			prev = rrset;
 			rrset = rrset->rrset_all_next;
@@ -527,7 +532,8 @@ store_rrset(sldns_buffer* pkt, struct msg_parse* msg, struct module_env* env,
 	if(!k)
 		return;
 	k->entry.data = NULL;
-	if(!parse_copy_decompress_rrset(pkt, msg, rrset, NULL, k)) {
+	if(!parse_copy_decompress_rrset(pkt, msg, rrset, env->alloc, NULL,
+		k)) {
 		alloc_special_release(env->alloc, k);
 		return;
 	}
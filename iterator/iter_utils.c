@@ -674,10 +674,10 @@ rrset_equal(struct ub_packed_rrset_key* k1, struct ub_packed_rrset_key* k2)
 		return 0;
 	t = d1->count + d1->rrsig_count;
 	for(i=0; i<t; i++) {
-		if(d1->rr_len[i] != d2->rr_len[i] ||
-			d1->rr_ttl[i] != d2->rr_ttl[i] ||
-			memcmp(d1->rr_data[i], d2->rr_data[i], 
-				d1->rr_len[i]) != 0)
+		if(packed_rr_len(d1, i) != packed_rr_len(d2, i) ||
+			packed_rr_ttl(d1, i) != packed_rr_ttl(d2, i) ||
+			memcmp(packed_rr_data(d1, i), packed_rr_data(d2, i), 
+				packed_rr_len(d1, i)) != 0)
 			return 0;
 	}
 	return 1;
@@ -786,8 +786,8 @@ void iter_store_parentside_neg(struct module_env* env,
 	neg->rk.dname_len = qinfo->qname_len;
 	neg->entry.hash = rrset_key_hash(&neg->rk);
 	newd = (struct packed_rrset_data*)regional_alloc_zero(env->scratch, 
-		sizeof(struct packed_rrset_data) + sizeof(size_t) +
-		sizeof(uint8_t*) + sizeof(time_t) + sizeof(uint16_t));
+		sizeof(struct packed_rrset_data) + PACKED_RRSET_ARRAYS_SIZE(1)
+		+ sizeof(uint16_t));
 	if(!newd) {
 		log_err("out of memory in store_parentside_neg");
 		return;
@@ -799,12 +799,10 @@ void iter_store_parentside_neg(struct module_env* env,
 	newd->count = 1;
 	newd->rrsig_count = 0;
 	newd->trust = rrset_trust_ans_noAA;
-	newd->rr_len = (size_t*)((uint8_t*)newd +
-		sizeof(struct packed_rrset_data));
-	newd->rr_len[0] = 0 /* zero len rdata */ + sizeof(uint16_t);
-	packed_rrset_ptr_fixup(newd);
-	newd->rr_ttl[0] = newd->ttl;
-	sldns_write_uint16(newd->rr_data[0], 0 /* zero len rdata */);
+	packed_rr_len(newd, 0) = 0 /* zero len rdata */ + sizeof(uint16_t);
+	packed_rrset_offs_setup(newd);
+	packed_rr_set_ttl(newd, 0, newd->ttl);
+	sldns_write_uint16(packed_rr_data(newd, 0), 0 /* zero len rdata */);
 	/* store it */
 	log_rrset_key(VERB_ALGO, "store parent-side negative", neg);
 	iter_store_parentside_rrset(env, neg);
@@ -1841,6 +1841,15 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 			iq->dnssec_expected?"expected": "not expected",
 			iq->dnssec_lame_query?" but lame_query anyway": "");
 	}
+	if(!infra_ratelimit_inc(qstate->env->infra_cache, iq->dp->name,
+		iq->dp->namelen, &target->addr, target->addrlen,
+		qstate->env->now_tv)) {
+		/* fail now, so that the mesh state and the query slots are
+		 * released, instead of queueing more work for that server */
+		log_name_addr(VERB_QUERY, "query exceeds upstream ratelimit "
+			"for", iq->dp->name, &target->addr, target->addrlen);
+		return error_response(qstate, id, LDNS_RCODE_SERVFAIL);
+	}
 	fptr_ok(fptr_whitelist_modenv_send_query(qstate->env->send_query));
 	outq = (*qstate->env->send_query)(
 		iq->qchase.qname, iq->qchase.qname_len, 
@@ -2793,6 +2802,11 @@ process_response(struct module_qstate* qstate, struct iter_qstate* iq,
 	if(!scrub_message(pkt, prs, &iq->qchase, iq->dp->name, 
 		qstate->env->scratch, qstate->env, ie))
 		goto handle_it;
+	/* walk the rdata of the rrsets that are kept */
+	if(parse_msg_calc_size(pkt, prs) != LDNS_RCODE_NOERROR) {
+		verbose(VERB_ALGO, "malformed rdata in reply packet");
+		goto handle_it;
+	}
 
 	/* allocate response dns_msg in region */
 	iq->response = dns_alloc_msg(pkt, prs, qstate->region);
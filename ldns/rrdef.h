@@ -417,7 +417,11 @@ enum sldns_enum_edns_option
 	LDNS_EDNS_DAU = 5, /* RFC6975 */
 	LDNS_EDNS_DHU = 6, /* RFC6975 */
 	LDNS_EDNS_N3U = 7, /* RFC6975 */
-	LDNS_EDNS_CLIENT_SUBNET = 8 /* draft-vandergaast-edns-client-subnet */
+	LDNS_EDNS_CLIENT_SUBNET = 8, /* draft-vandergaast-edns-client-subnet */
+	/* 9 draft-andrews-dnsext-expire */
+	LDNS_EDNS_COOKIE = 10, /* draft-ietf-dnsop-cookies */
+	LDNS_EDNS_KEEPALIVE = 11, /* draft-ietf-dnsop-edns-tcp-keepalive */
+	LDNS_EDNS_PADDING = 12 /* draft-mayrhofer-edns0-padding */
 };
 typedef enum sldns_edns_option sldns_edns_option;
 
@@ -49,6 +49,7 @@
 #include "services/cache/infra.h"
 #include "util/data/msgreply.h"
 #include "util/storage/slabhash.h"
+#include "util/random.h"
 #include "ldns/sbuffer.h"
 
 int 
@@ -74,7 +75,8 @@ context_finalize(struct ub_ctx* ctx)
 		ctx->env->msg_cache = slabhash_create(cfg->msg_cache_slabs,
 			HASH_DEFAULT_STARTARRAY, cfg->msg_cache_size,
 			msgreply_sizefunc, query_info_compare,
-			query_entry_delete, reply_info_delete, NULL);
+			query_entry_delete, reply_info_delete,
+			&ctx->superalloc);
 		if(!ctx->env->msg_cache)
 			return UB_NOMEM;
 	}
@@ -82,6 +84,14 @@ context_finalize(struct ub_ctx* ctx)
 		ctx->env->cfg, ctx->env->alloc);
 	if(!ctx->env->rrset_cache)
 		return UB_NOMEM;
+	if(!slabhash_set_admission(ctx->env->msg_cache,
+		cfg->cache_admission_filter, (uint32_t)ub_random(ctx->seed_rnd))
+		&& cfg->cache_admission_filter)
+		return UB_NOMEM;
+	if(!slabhash_set_admission(&ctx->env->rrset_cache->table,
+		cfg->cache_admission_filter, (uint32_t)ub_random(ctx->seed_rnd))
+		&& cfg->cache_admission_filter)
+		return UB_NOMEM;
 	ctx->env->infra_cache = infra_adjust(ctx->env->infra_cache, cfg);
 	if(!ctx->env->infra_cache)
 		return UB_NOMEM;
@@ -60,6 +60,7 @@
 #include "util/config_file.h"
 #include "util/netevent.h"
 #include "util/storage/lookup3.h"
+#include "util/storage/keyhash.h"
 #include "util/storage/slabhash.h"
 #include "util/net_help.h"
 #include "util/data/dname.h"
@@ -199,8 +200,13 @@ libworker_setup(struct ub_ctx* ctx, int is_bg, struct event_base* eb)
 		 * in different threads that this may clash */
 		static int done_raninit = 0;
 		if(!done_raninit) {
+			uint8_t key[KEYHASH_KEY_SIZE];
+			size_t i;
 			done_raninit = 1;
 			hash_set_raninit((uint32_t)ub_random(w->env->rnd));
+			for(i=0; i<sizeof(key); i++)
+				key[i] = (uint8_t)ub_random(w->env->rnd);
+			keyhash_set_key(key);
 		}
 	}
 	seed = 0;
@@ -231,7 +237,7 @@ libworker_setup(struct ub_ctx* ctx, int is_bg, struct event_base* eb)
 		w->env->infra_cache, w->env->rnd, cfg->use_caps_bits_for_id,
 		ports, numports, cfg->unwanted_threshold,
 		&libworker_alloc_cleanup, w, cfg->do_udp, w->sslctx,
-		cfg->delay_close);
+		cfg->delay_close, cfg->tcp_upstream_fastopen);
 	if(!w->is_bg || w->is_bg_thread) {
 		lock_basic_unlock(&ctx->cfglock);
 	}
@@ -473,8 +479,9 @@ fill_res(struct ub_result* res, struct ub_packed_rrset_key* answer,
 		return 0; /* out of memory */
 	for(i=0; i<data->count; i++) {
 		/* remove rdlength from rdata */
-		res->len[i] = (int)(data->rr_len[i] - 2);
-		res->data[i] = memdup(data->rr_data[i]+2, (size_t)res->len[i]);
+		res->len[i] = (int)(packed_rr_len(data, i) - 2);
+		res->data[i] = memdup(packed_rr_data(data, i)+2,
+			(size_t)res->len[i]);
 		if(!res->data[i])
 			return 0; /* out of memory */
 	}
@@ -578,6 +585,7 @@ setup_qinfo_edns(struct libworker* w, struct ctx_query* q,
 	edns->ext_rcode = 0;
 	edns->edns_version = 0;
 	edns->bits = EDNS_DO;
+	edns->opt_list = NULL;
 	if(sldns_buffer_capacity(w->back->udp_buff) < 65535)
 		edns->udp_size = (uint16_t)sldns_buffer_capacity(
 			w->back->udp_buff);
@@ -969,6 +977,16 @@ void worker_stat_timer_cb(void* ATTR_UNUSED(arg))
 	log_assert(0);
 }
 
+void worker_expiry_timer_cb(void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
+void worker_hot_timer_cb(void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 void worker_probe_timer_cb(void* ATTR_UNUSED(arg))
 {
 	log_assert(0);
@@ -261,22 +261,20 @@ struct lruhash_entry {
   struct packed_rrset_data* data;
 };
 
-%ignore packed_rrset_data::rr_len;
-%ignore packed_rrset_data::rr_ttl;
-%ignore packed_rrset_data::rr_data;
+%ignore packed_rrset_data::wire;
 
 struct packed_rrset_data {
   uint32_t ttl; //TTL (in seconds like time())
 
-  size_t count; //number of rrs
-  size_t rrsig_count; //number of rrsigs
+  uint32_t count; //number of rrs
+  uint32_t rrsig_count; //number of rrsigs
 
   enum rrset_trust trust; 
   enum sec_status security;
 
-  size_t* rr_len;   //length of every rr's rdata
-  uint32_t *rr_ttl; //ttl of every rr
-  uint8_t** rr_data; //array of pointers to every rr's rdata; The rr_data[i] rdata is stored in uncompressed wireformat. 
+  int wire;
+  //rr_len, rr_ttl and rr_data are accessed by index below, the rdata is
+  //stored in uncompressed wireformat after the structure.
 };
 
 %pythoncode %{
@@ -299,26 +297,26 @@ struct packed_rrset_data {
    PyObject* _get_data_rr_len(struct packed_rrset_data* d, int idx) {
      if ((d != NULL) && (idx >= 0) && 
              ((size_t)idx < (d->count+d->rrsig_count))) 
-        return PyInt_FromLong(d->rr_len[idx]);
+        return PyInt_FromLong(packed_rr_len(d, idx));
      return Py_None;
    }
    void _set_data_rr_ttl(struct packed_rrset_data* d, int idx, uint32_t ttl)
    {
      if ((d != NULL) && (idx >= 0) && 
              ((size_t)idx < (d->count+d->rrsig_count))) 
-        d->rr_ttl[idx] = ttl;
+        packed_rr_set_ttl(d, idx, ttl);
    }
    PyObject* _get_data_rr_ttl(struct packed_rrset_data* d, int idx) {
      if ((d != NULL) && (idx >= 0) && 
              ((size_t)idx < (d->count+d->rrsig_count))) 
-        return PyInt_FromLong(d->rr_ttl[idx]);
+        return PyInt_FromLong(packed_rr_ttl(d, idx));
      return Py_None;
    }
    PyObject* _get_data_rr_data(struct packed_rrset_data* d, int idx) {
      if ((d != NULL) && (idx >= 0) && 
              ((size_t)idx < (d->count+d->rrsig_count))) 
-        return PyString_FromStringAndSize((char*)d->rr_data[idx],
-                d->rr_len[idx]);
+        return PyString_FromStringAndSize((char*)packed_rr_data(d, idx),
+                packed_rr_len(d, idx));
      return Py_None;
    }
 %}
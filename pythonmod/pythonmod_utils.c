@@ -95,7 +95,7 @@ void invalidateQueryInCache(struct module_qstate* qstate, struct query_info* qin
 	      
 		       data->ttl = r->ttl;
 		       for(j=0; j<data->count + data->rrsig_count; j++)
-			   data->rr_ttl[j] = r->ttl;
+			   packed_rr_set_ttl(data, j, r->ttl);
 		   }
 		   rrset_array_unlock(r->ref, r->rrset_count);
 	   }
@@ -49,6 +49,7 @@
 #include "util/module.h"
 #include "util/net_help.h"
 #include "util/regional.h"
+#include "util/alloc.h"
 #include "util/config_file.h"
 #include "ldns/sbuffer.h"
 
@@ -127,7 +128,7 @@ dns_cache_store_msg(struct module_env* env, struct query_info* qinfo,
 		/* we do not store the message, but we did store the RRs,
 		 * which could be useful for delegation information */
 		verbose(VERB_ALGO, "TTL 0: dropped msg from cache");
-		free(rep);
+		alloc_sized_release(env->alloc, rep);
 		return;
 	}
 
@@ -599,9 +600,8 @@ synth_dname_msg(struct ub_packed_rrset_key* rrset, struct regional* region,
 	ck->rk.dname_len = q->qname_len;
 	ck->entry.hash = rrset_key_hash(&ck->rk);
 	newd = (struct packed_rrset_data*)regional_alloc_zero(region,
-		sizeof(struct packed_rrset_data) + sizeof(size_t) + 
-		sizeof(uint8_t*) + sizeof(time_t) + sizeof(uint16_t) 
-		+ newlen);
+		sizeof(struct packed_rrset_data) + PACKED_RRSET_ARRAYS_SIZE(1)
+		+ sizeof(uint16_t) + newlen);
 	if(!newd)
 		return NULL;
 	ck->entry.data = newd;
@@ -609,15 +609,13 @@ synth_dname_msg(struct ub_packed_rrset_key* rrset, struct regional* region,
 	newd->count = 1;
 	newd->rrsig_count = 0;
 	newd->trust = rrset_trust_ans_noAA;
-	newd->rr_len = (size_t*)((uint8_t*)newd + 
-		sizeof(struct packed_rrset_data));
-	newd->rr_len[0] = newlen + sizeof(uint16_t);
-	packed_rrset_ptr_fixup(newd);
-	newd->rr_ttl[0] = newd->ttl;
+	packed_rr_len(newd, 0) = newlen + sizeof(uint16_t);
+	packed_rrset_offs_setup(newd);
+	packed_rr_set_ttl(newd, 0, newd->ttl);
 	msg->rep->ttl = newd->ttl;
 	msg->rep->prefetch_ttl = PREFETCH_TTL_CALC(newd->ttl);
-	sldns_write_uint16(newd->rr_data[0], newlen);
-	memmove(newd->rr_data[0] + sizeof(uint16_t), newname, newlen);
+	sldns_write_uint16(packed_rr_data(newd, 0), newlen);
+	memmove(packed_rr_data(newd, 0) + sizeof(uint16_t), newname, newlen);
 	msg->rep->an_numrrsets ++;
 	msg->rep->rrset_count ++;
 	return msg;
@@ -744,37 +742,43 @@ dns_cache_store(struct module_env* env, struct query_info* msgqinf,
 	struct regional* region)
 {
 	struct reply_info* rep = NULL;
-	/* alloc, malloc properly (not in region, like msg is) */
-	rep = reply_info_copy(msgrep, env->alloc, NULL);
-	if(!rep)
-		return 0;
 	/* ttl must be relative ;i.e. 0..86400 not  time(0)+86400. 
 	 * the env->now is added to message and RRsets in this routine. */
 	/* the leeway is used to invalidate other rrsets earlier */
 
 	if(is_referral) {
-		/* store rrsets */
+		/* store rrsets, only the ones that the cache would not
+		 * keep a superior version of are copied */
 		struct rrset_ref ref;
+		time_t t;
 		size_t i;
-		for(i=0; i<rep->rrset_count; i++) {
-			packed_rrset_ttl_add((struct packed_rrset_data*)
-				rep->rrsets[i]->entry.data, *env->now);
-			ref.key = rep->rrsets[i];
-			ref.id = rep->rrsets[i]->id;
-			/*ignore ret: it was in the cache, ref updated */
+		for(i=0; i<msgrep->rrset_count; i++) {
 			/* no leeway for typeNS */
+			t = *env->now + ((ntohs(msgrep->rrsets[i]->rk.type)
+				==LDNS_RR_TYPE_NS && !pside) ? 0:leeway);
+			if(rrset_cache_superior(env->rrset_cache,
+				msgrep->rrsets[i], t))
+				continue;
+			/* alloc, malloc properly (not in region) */
+			ref.key = packed_rrset_copy_alloc(msgrep->rrsets[i],
+				env->alloc, *env->now);
+			if(!ref.key)
+				return 0;
+			ref.id = ref.key->id;
+			/*ignore ret: it was in the cache, ref updated */
 			(void)rrset_cache_update(env->rrset_cache, &ref, 
-				env->alloc, *env->now + 
-				((ntohs(ref.key->rk.type)==LDNS_RR_TYPE_NS
-				 && !pside) ? 0:leeway));
+				env->alloc, t);
 		}
-		free(rep);
 		return 1;
 	} else {
 		/* store msg, and rrsets */
 		struct query_info qinf;
 		hashvalue_t h;
 
+		/* alloc, malloc properly (not in region, like msg is) */
+		rep = reply_info_copy(msgrep, env->alloc, NULL);
+		if(!rep)
+			return 0;
 		qinf = *msgqinf;
 		qinf.qname = memdup(msgqinf->qname, msgqinf->qname_len);
 		if(!qinf.qname) {
@@ -42,7 +42,7 @@
 #include "ldns/rrdef.h"
 #include "services/cache/infra.h"
 #include "util/storage/slabhash.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/keyhash.h"
 #include "util/data/dname.h"
 #include "util/log.h"
 #include "util/net_help.h"
@@ -99,6 +99,54 @@ infra_deldatafunc(void* d, void* ATTR_UNUSED(arg))
 	free(data);
 }
 
+size_t 
+rate_sizefunc(void* k, void* ATTR_UNUSED(d))
+{
+	struct rate_key* key = (struct rate_key*)k;
+	return sizeof(*key) + sizeof(struct rate_data) + key->namelen
+		+ lock_get_mem(&key->entry.lock);
+}
+
+int 
+rate_compfunc(void* key1, void* key2)
+{
+	struct rate_key* k1 = (struct rate_key*)key1;
+	struct rate_key* k2 = (struct rate_key*)key2;
+	if(!k1->name || !k2->name) {
+		/* zones sort before servers */
+		if(k1->name)
+			return -1;
+		if(k2->name)
+			return 1;
+		return sockaddr_cmp(&k1->addr, k1->addrlen, &k2->addr,
+			k2->addrlen);
+	}
+	if(k1->namelen != k2->namelen) {
+		if(k1->namelen < k2->namelen)
+			return -1;
+		return 1;
+	}
+	return query_dname_compare(k1->name, k2->name);
+}
+
+void 
+rate_delkeyfunc(void* k, void* ATTR_UNUSED(arg))
+{
+	struct rate_key* key = (struct rate_key*)k;
+	if(!key)
+		return;
+	lock_rw_destroy(&key->entry.lock);
+	free(key->name);
+	free(key);
+}
+
+void 
+rate_deldatafunc(void* d, void* ATTR_UNUSED(arg))
+{
+	struct rate_data* data = (struct rate_data*)d;
+	free(data);
+}
+
 struct infra_cache* 
 infra_create(struct config_file* cfg)
 {
@@ -113,7 +161,18 @@ infra_create(struct config_file* cfg)
 		free(infra);
 		return NULL;
 	}
+	infra->rates = slabhash_create(cfg->infra_cache_slabs,
+		INFRA_HOST_STARTSIZE, cfg->upstream_ratelimit_size,
+		&rate_sizefunc, &rate_compfunc, &rate_delkeyfunc,
+		&rate_deldatafunc, NULL);
+	if(!infra->rates) {
+		slabhash_delete(infra->hosts);
+		free(infra);
+		return NULL;
+	}
 	infra->host_ttl = cfg->host_ttl;
+	infra->zone_ratelimit = cfg->upstream_zone_ratelimit;
+	infra->server_ratelimit = cfg->upstream_server_ratelimit;
 	return infra;
 }
 
@@ -123,6 +182,7 @@ infra_delete(struct infra_cache* infra)
 	if(!infra)
 		return;
 	slabhash_delete(infra->hosts);
+	slabhash_delete(infra->rates);
 	free(infra);
 }
 
@@ -133,10 +193,14 @@ infra_adjust(struct infra_cache* infra, struct config_file* cfg)
 	if(!infra)
 		return infra_create(cfg);
 	infra->host_ttl = cfg->host_ttl;
+	infra->zone_ratelimit = cfg->upstream_zone_ratelimit;
+	infra->server_ratelimit = cfg->upstream_server_ratelimit;
 	maxmem = cfg->infra_cache_numhosts * (sizeof(struct infra_key)+
 		sizeof(struct infra_data)+INFRA_BYTES_NAME);
 	if(maxmem != slabhash_get_size(infra->hosts) ||
-		cfg->infra_cache_slabs != infra->hosts->size) {
+		cfg->infra_cache_slabs != infra->hosts->size ||
+		cfg->upstream_ratelimit_size != slabhash_get_size(
+		infra->rates)) {
 		infra_delete(infra);
 		infra = infra_create(cfg);
 	}
@@ -147,20 +211,23 @@ infra_adjust(struct infra_cache* infra, struct config_file* cfg)
 static hashvalue_t
 hash_addr(struct sockaddr_storage* addr, socklen_t addrlen)
 {
-	hashvalue_t h = 0xab;
+	uint8_t buf[2+2+INET6_SIZE];
 	/* select the pieces to hash, some OS have changing data inside */
 	if(addr_is_ip6(addr, addrlen)) {
 		struct sockaddr_in6* in6 = (struct sockaddr_in6*)addr;
-		h = hashlittle(&in6->sin6_family, sizeof(in6->sin6_family), h);
-		h = hashlittle(&in6->sin6_port, sizeof(in6->sin6_port), h);
-		h = hashlittle(&in6->sin6_addr, INET6_SIZE, h);
+		buf[0] = 6;
+		buf[1] = 0;
+		memmove(buf+2, &in6->sin6_port, 2);
+		memmove(buf+4, &in6->sin6_addr, INET6_SIZE);
+		return keyhash(buf, 4+INET6_SIZE, 0xab);
 	} else {
 		struct sockaddr_in* in = (struct sockaddr_in*)addr;
-		h = hashlittle(&in->sin_family, sizeof(in->sin_family), h);
-		h = hashlittle(&in->sin_port, sizeof(in->sin_port), h);
-		h = hashlittle(&in->sin_addr, INET_SIZE, h);
+		buf[0] = 4;
+		buf[1] = 0;
+		memmove(buf+2, &in->sin_port, 2);
+		memmove(buf+4, &in->sin_addr, INET_SIZE);
+		return keyhash(buf, 4+INET_SIZE, 0xab);
 	}
-	return h;
 }
 
 /** calculate infra hash for a key */
@@ -204,6 +271,7 @@ data_entry_init(struct infra_cache* infra, struct lruhash_entry* e,
 	data->timeout_A = 0;
 	data->timeout_AAAA = 0;
 	data->timeout_other = 0;
+	data->tcp_fastopen_fail = 0;
 }
 
 /** 
@@ -371,6 +439,46 @@ infra_update_tcp_works(struct infra_cache* infra,
 	lock_rw_unlock(&e->lock);
 }
 
+int
+infra_tcp_fastopen_ok(struct infra_cache* infra,
+        struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* nm,
+	size_t nmlen, time_t timenow)
+{
+	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen,
+		nm, nmlen, 0);
+	struct infra_data* data;
+	int ok = 1;
+	if(!e)
+		return 1; /* not known to fail */
+	data = (struct infra_data*)e->data;
+	if(data->ttl >= timenow && data->tcp_fastopen_fail)
+		ok = 0;
+	lock_rw_unlock(&e->lock);
+	return ok;
+}
+
+int
+infra_tcp_fastopen_fail(struct infra_cache* infra,
+        struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* nm,
+	size_t nmlen, time_t timenow)
+{
+	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen,
+		nm, nmlen, 1);
+	int needtoinsert = 0;
+	if(!e) {
+		if(!(e = new_entry(infra, addr, addrlen, nm, nmlen, timenow)))
+			return 0;
+		needtoinsert = 1;
+	} else if(((struct infra_data*)e->data)->ttl < timenow) {
+		data_entry_init(infra, e, timenow);
+	}
+	((struct infra_data*)e->data)->tcp_fastopen_fail = 1;
+	if(needtoinsert)
+		slabhash_insert(infra->hosts, e->hash, e, e->data, NULL);
+	else 	{ lock_rw_unlock(&e->lock); }
+	return 1;
+}
+
 int 
 infra_rtt_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 	socklen_t addrlen, uint8_t* nm, size_t nmlen, int qtype,
@@ -562,8 +670,138 @@ infra_get_lame_rtt(struct infra_cache* infra,
 	return 1;
 }
 
+/** fill the lookup key of the rate of a zone, or of a server address if
+ * name is NULL */
+static void
+rate_lookup_key(struct rate_key* k, uint8_t* name, size_t namelen,
+	struct sockaddr_storage* addr, socklen_t addrlen)
+{
+	memset(k, 0, sizeof(*k));
+	k->name = name;
+	k->namelen = namelen;
+	if(name) {
+		k->entry.hash = dname_query_hash(name, 0xab);
+	} else {
+		k->addrlen = addrlen;
+		memcpy(&k->addr, addr, addrlen);
+		k->entry.hash = hash_addr(addr, addrlen);
+	}
+	k->entry.key = (void*)k;
+}
+
+/**
+ * Take a token from the bucket for the zone or server.
+ * @param infra: infra cache with the rates.
+ * @param name: zone name, or NULL for a server.
+ * @param namelen: length of name.
+ * @param addr: server address, if name is NULL.
+ * @param addrlen: length of addr.
+ * @param lim: queries per second allowed.
+ * @param now: time now, in msec.
+ * @return false if the bucket is empty.
+ */
+static int
+rate_take(struct infra_cache* infra, uint8_t* name, size_t namelen,
+	struct sockaddr_storage* addr, socklen_t addrlen, int lim,
+	long long now)
+{
+	struct rate_key k, *key;
+	struct rate_data* d;
+	struct lruhash_entry* e;
+	int ok = 1;
+	rate_lookup_key(&k, name, namelen, addr, addrlen);
+	e = slabhash_lookup(infra->rates, k.entry.hash, &k, 1);
+	if(e) {
+		/* refill the bucket for the elapsed time, it holds up to
+		 * one second of queries */
+		long long elapsed;
+		d = (struct rate_data*)e->data;
+		elapsed = now - d->last;
+		if(elapsed > 1000 || elapsed < 0)
+			elapsed = 1000;
+		d->tokens += elapsed * (long long)lim;
+		if(d->tokens > (long long)lim * 1000)
+			d->tokens = (long long)lim * 1000;
+		d->last = now;
+		if(d->tokens >= 1000)
+			d->tokens -= 1000;
+		else	ok = 0;
+		lock_rw_unlock(&e->lock);
+		return ok;
+	}
+	/* new entry with a full bucket, minus this query; if malloc fails
+	 * the query is not limited */
+	key = (struct rate_key*)memdup(&k, sizeof(k));
+	d = (struct rate_data*)malloc(sizeof(*d));
+	if(!key || !d) {
+		free(key);
+		free(d);
+		return 1;
+	}
+	if(name) {
+		key->name = memdup(name, namelen);
+		if(!key->name) {
+			free(key);
+			free(d);
+			return 1;
+		}
+	}
+	lock_rw_init(&key->entry.lock);
+	key->entry.key = (void*)key;
+	key->entry.data = (void*)d;
+	d->tokens = (long long)lim * 1000 - 1000;
+	d->last = now;
+	slabhash_insert(infra->rates, key->entry.hash, &key->entry, d, NULL);
+	return 1;
+}
+
+/**
+ * Give a token back to the bucket of a zone, the query was taken from it
+ * but is not sent.
+ * @param infra: infra cache with the rates.
+ * @param name: zone name.
+ * @param namelen: length of name.
+ * @param lim: queries per second allowed.
+ */
+static void
+rate_give(struct infra_cache* infra, uint8_t* name, size_t namelen, int lim)
+{
+	struct rate_key k;
+	struct rate_data* d;
+	struct lruhash_entry* e;
+	rate_lookup_key(&k, name, namelen, NULL, 0);
+	e = slabhash_lookup(infra->rates, k.entry.hash, &k, 1);
+	if(!e)
+		return;
+	d = (struct rate_data*)e->data;
+	d->tokens += 1000;
+	if(d->tokens > (long long)lim * 1000)
+		d->tokens = (long long)lim * 1000;
+	lock_rw_unlock(&e->lock);
+}
+
+int
+infra_ratelimit_inc(struct infra_cache* infra, uint8_t* name,
+	size_t namelen, struct sockaddr_storage* addr, socklen_t addrlen,
+	struct timeval* now)
+{
+	int zlim = lock_atomic_load(&infra->zone_ratelimit);
+	int slim = lock_atomic_load(&infra->server_ratelimit);
+	long long ms = (long long)now->tv_sec*1000 + now->tv_usec/1000;
+	if(zlim > 0 && !rate_take(infra, name, namelen, NULL, 0, zlim, ms))
+		return 0;
+	if(slim > 0 && !rate_take(infra, NULL, 0, addr, addrlen, slim, ms)) {
+		/* the query is not sent, so it does not count for the zone */
+		if(zlim > 0)
+			rate_give(infra, name, namelen, zlim);
+		return 0;
+	}
+	return 1;
+}
+
 size_t 
 infra_get_mem(struct infra_cache* infra)
 {
-	return sizeof(*infra) + slabhash_get_mem(infra->hosts);
+	return sizeof(*infra) + slabhash_get_mem(infra->hosts)
+		+ slabhash_get_mem(infra->rates);
 }
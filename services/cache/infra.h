@@ -98,6 +98,34 @@ struct infra_data {
 	uint8_t timeout_AAAA;
 	/** timeouts counter for others */
 	uint8_t timeout_other;
+	/** TCP fast open failed for the host, connect without it */
+	uint8_t tcp_fastopen_fail;
+};
+
+/**
+ * Query rate towards a zone or a server, for the upstream ratelimit.
+ */
+struct rate_key {
+	/** zone name in wireformat, or NULL if this is for a server */
+	uint8_t* name;
+	/** length of name */
+	size_t namelen;
+	/** the server address, if name is NULL */
+	struct sockaddr_storage addr;
+	/** length of addr */
+	socklen_t addrlen;
+	/** hash table entry, data of type rate_data. */
+	struct lruhash_entry entry;
+};
+
+/**
+ * Token bucket for the queries sent to a zone or a server.
+ */
+struct rate_data {
+	/** tokens in the bucket, in thousandths of a query */
+	long long tokens;
+	/** time of the last refill, in msec */
+	long long last;
 };
 
 /**
@@ -108,6 +136,15 @@ struct infra_cache {
 	struct slabhash* hosts;
 	/** TTL value for host information, in seconds */
 	int host_ttl;
+	/** The hash table with query rates for zones and servers */
+	struct slabhash* rates;
+	/** queries per second allowed towards a zone, 0 is no limit.
+	 * The remote control changes it while the workers run, it is
+	 * accessed with lock_atomic_load and lock_atomic_store. */
+	int zone_ratelimit;
+	/** queries per second allowed towards a server, 0 is no limit,
+	 * accessed like zone_ratelimit */
+	int server_ratelimit;
 };
 
 /** infra host cache default hash lookup size */
@@ -226,6 +263,35 @@ void infra_update_tcp_works(struct infra_cache* infra,
         struct sockaddr_storage* addr, socklen_t addrlen,
 	uint8_t* name, size_t namelen);
 
+/**
+ * See if TCP fast open can be used to connect to the host.
+ * @param infra: infrastructure cache.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
+ * @param name: name of zone
+ * @param namelen: length of name
+ * @param timenow: what time it is now.
+ * @return: false if TCP fast open failed for the host before.
+ */
+int infra_tcp_fastopen_ok(struct infra_cache* infra,
+        struct sockaddr_storage* addr, socklen_t addrlen,
+	uint8_t* name, size_t namelen, time_t timenow);
+
+/**
+ * Note that a TCP fast open connection to the host failed, the next
+ * connections are made without it, until the host entry expires.
+ * @param infra: infrastructure cache.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
+ * @param name: name of zone
+ * @param namelen: length of name
+ * @param timenow: what time it is now.
+ * @return: 0 on error.
+ */
+int infra_tcp_fastopen_fail(struct infra_cache* infra,
+        struct sockaddr_storage* addr, socklen_t addrlen,
+	uint8_t* name, size_t namelen, time_t timenow);
+
 /**
  * Update edns information for the host.
  * @param infra: infrastructure cache.
@@ -286,6 +352,22 @@ long long infra_get_host_rto(struct infra_cache* infra,
 	size_t namelen, struct rtt_info* rtt, int* delay, time_t timenow,
 	int* tA, int* tAAAA, int* tother);
 
+/**
+ * See if a query may be sent, under the upstream ratelimits for the zone
+ * and for the server.  If so, the query is counted against both.  If not,
+ * it is counted against neither.
+ * @param infra: infrastructure cache.
+ * @param name: zone name, of the delegation point.
+ * @param namelen: length of zone name.
+ * @param addr: server address.
+ * @param addrlen: length of addr.
+ * @param now: the time now.
+ * @return false if the query is over the ratelimit and must not be sent.
+ */
+int infra_ratelimit_inc(struct infra_cache* infra, uint8_t* name,
+	size_t namelen, struct sockaddr_storage* addr, socklen_t addrlen,
+	struct timeval* now);
+
 /**
  * Get memory used by the infra cache.
  * @param infra: infrastructure cache.
@@ -306,4 +388,16 @@ void infra_delkeyfunc(void* k, void* arg);
 /** delete data and destroy the lameness hashtable */
 void infra_deldatafunc(void* d, void* arg);
 
+/** calculate size of a rate entry */
+size_t rate_sizefunc(void* k, void* d);
+
+/** compare two rate keys, returns -1, 0, or +1 */
+int rate_compfunc(void* key1, void* key2);
+
+/** delete rate key, and destroy the lock */
+void rate_delkeyfunc(void* k, void* arg);
+
+/** delete rate data */
+void rate_deldatafunc(void* d, void* arg);
+
 #endif /* SERVICES_CACHE_INFRA_H */
@@ -0,0 +1,281 @@
+/*
+ * services/cache/l1cache.c - per thread cache of encoded answers.
+ *
+ * Copyright (c) 2014, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the per thread cache of encoded answers.
+ */
+#include "config.h"
+#include "services/cache/l1cache.h"
+#include "util/data/packed_rrset.h"
+#include "util/data/msgparse.h"
+#include "util/data/dname.h"
+#include "util/net_help.h"
+#include "util/log.h"
+#include "ldns/sbuffer.h"
+#include "ldns/pkthdr.h"
+
+struct l1cache*
+l1cache_create(size_t num, size_t* flush)
+{
+	struct l1cache* l1 = (struct l1cache*)calloc(1, sizeof(*l1));
+	size_t n = 1;
+	if(!l1)
+		return NULL;
+	while(n < num)
+		n <<= 1;
+	l1->mask = n-1;
+	l1->flush = flush;
+	l1->flush_seen = lock_atomic_load(flush);
+	l1->slots = (struct l1cache_slot*)calloc(n,
+		sizeof(struct l1cache_slot));
+	if(!l1->slots) {
+		free(l1);
+		return NULL;
+	}
+	return l1;
+}
+
+void
+l1cache_delete(struct l1cache* l1)
+{
+	size_t i;
+	if(!l1)
+		return;
+	for(i=0; i<=l1->mask; i++)
+		free(l1->slots[i].pkt);
+	free(l1->slots);
+	free(l1);
+}
+
+/** get the lock version, false if it is write locked, or if there are no
+ * lock versions */
+static int
+l1cache_version(lock_rw_t* lock, uint32_t* version)
+{
+#ifdef LOCK_RW_HAVE_VERSION
+	return lock_rw_version(lock, version);
+#else
+	(void)lock;
+	*version = 0;
+	return 0;
+#endif
+}
+
+/** see if the slot is for the query */
+static int
+l1cache_match(struct l1cache_slot* s, struct query_info* qinfo,
+	hashvalue_t hash, uint16_t flags, struct edns_data* edns)
+{
+	/* replies with edns options are not stored */
+	return s->len != 0 && !edns->opt_list && s->hash == hash &&
+		s->qtype == qinfo->qtype &&
+		s->qclass == qinfo->qclass && s->flags == flags &&
+		s->udpsize == edns->udp_size &&
+		s->edns == (edns->edns_present?1:0) &&
+		s->dnssec == ((edns->bits & EDNS_DO)?1:0) &&
+		s->qname_len == qinfo->qname_len &&
+		memcmp(s->qname, qinfo->qname, qinfo->qname_len) == 0;
+}
+
+int
+l1cache_answer(struct l1cache* l1, struct lruhash_entry* e,
+	struct query_info* qinfo, hashvalue_t hash, uint16_t id,
+	uint16_t flags, struct edns_data* edns, time_t now,
+	sldns_buffer* buf, int* secure)
+{
+	struct l1cache_slot* s = &l1->slots[hash&l1->mask];
+	struct reply_info* rep = (struct reply_info*)e->data;
+	uint32_t v;
+	uint8_t* p;
+	size_t i;
+	if(lock_atomic_load(l1->flush) != l1->flush_seen) {
+		/* the caches were flushed, empty the slots */
+		for(i=0; i<=l1->mask; i++)
+			l1->slots[i].len = 0;
+		l1->flush_seen = lock_atomic_load(l1->flush);
+		return 0;
+	}
+	if(!l1cache_match(s, qinfo, hash, flags, edns))
+		return 0;
+	/* the message entry must be the same, and not written to since.
+	 * A freed and reused entry or reply has another TTL */
+	if(s->msg != e || s->rep != rep || s->ttl != rep->ttl ||
+		!l1cache_version(&e->lock, &v) || v != s->msg_vers) {
+		s->len = 0;
+		return 0;
+	}
+	if(s->ttl < now)
+		return 0;
+	/* the rrsets must not have been deleted or updated.  These reads
+	 * are not locked, the keys stay allocated and a stale value only
+	 * makes the check fail. */
+	for(i=0; i<s->num_refs; i++) {
+		if(s->ref[i].key->id != s->ref[i].id ||
+			!l1cache_version(&s->ref[i].key->entry.lock, &v) ||
+			v != s->vers[i]) {
+			s->len = 0;
+			return 0;
+		}
+	}
+	if(s->len > sldns_buffer_capacity(buf))
+		return 0;
+	sldns_buffer_clear(buf);
+	sldns_buffer_write(buf, s->pkt, s->len);
+	sldns_buffer_flip(buf);
+	p = sldns_buffer_begin(buf);
+	memmove(p, &id, sizeof(id));
+	if(now != s->stamp) {
+		uint32_t passed = (uint32_t)(now - s->stamp);
+		for(i=0; i<s->num_ttls; i++) {
+			uint32_t ttl = sldns_read_uint32(p+s->ttl_pos[i]);
+			sldns_write_uint32(p+s->ttl_pos[i],
+				ttl>passed?ttl-passed:0);
+		}
+	}
+	*secure = (int)s->secure;
+	return 1;
+}
+
+/** find the TTLs in the packet, returns false if it cannot be stored */
+static int
+l1cache_find_ttls(struct l1cache_slot* s)
+{
+	sldns_buffer pkt;
+	size_t i, num;
+	sldns_buffer_init_frm_data(&pkt, s->pkt, s->len);
+	num = (size_t)LDNS_ANCOUNT(s->pkt) + (size_t)LDNS_NSCOUNT(s->pkt) +
+		(size_t)LDNS_ARCOUNT(s->pkt);
+	s->num_ttls = 0;
+	sldns_buffer_set_position(&pkt, LDNS_HEADER_SIZE);
+	for(i=0; i<(size_t)LDNS_QDCOUNT(s->pkt); i++) {
+		if(!pkt_dname_len(&pkt) || sldns_buffer_remaining(&pkt) < 4)
+			return 0;
+		sldns_buffer_skip(&pkt, 4);
+	}
+	for(i=0; i<num; i++) {
+		uint16_t t;
+		if(!pkt_dname_len(&pkt) || sldns_buffer_remaining(&pkt) < 10)
+			return 0;
+		t = sldns_buffer_read_u16(&pkt);
+		sldns_buffer_skip(&pkt, 2);
+		if(t != LDNS_RR_TYPE_OPT) {
+			if(s->num_ttls >= L1CACHE_MAX_RRS)
+				return 0;
+			s->ttl_pos[s->num_ttls++] = (uint16_t)
+				sldns_buffer_position(&pkt);
+		}
+		sldns_buffer_skip(&pkt, 4);
+		t = sldns_buffer_read_u16(&pkt);
+		if(sldns_buffer_remaining(&pkt) < t)
+			return 0;
+		sldns_buffer_skip(&pkt, (ssize_t)t);
+	}
+	return 1;
+}
+
+void
+l1cache_store(struct l1cache* l1, struct lruhash_entry* e,
+	struct query_info* qinfo, hashvalue_t hash, uint16_t flags,
+	struct edns_data* edns, uint16_t udpsize, uint32_t* vers,
+	int secure, time_t now, sldns_buffer* buf)
+{
+	struct l1cache_slot* s = &l1->slots[hash&l1->mask];
+	struct reply_info* rep = (struct reply_info*)e->data;
+	size_t i, len = sldns_buffer_limit(buf);
+	/* an answer without rrsets cannot be checked against the rrset
+	 * cache, and is not stored, nor one with edns options */
+	if(rep->rrset_count == 0 || edns->opt_list ||
+		rep->rrset_count > L1CACHE_MAX_REFS ||
+		len < LDNS_HEADER_SIZE || len > L1CACHE_MAX_SIZE ||
+		qinfo->qname_len > sizeof(s->qname) ||
+		lock_atomic_load(l1->flush) != l1->flush_seen)
+		return;
+	s->len = 0;
+	if(!l1cache_version(&e->lock, &s->msg_vers))
+		return;
+	for(i=0; i<rep->rrset_count; i++) {
+		s->ref[i] = rep->ref[i];
+		if(i>0 && rep->ref[i].key == rep->ref[i-1].key)
+			s->vers[i] = s->vers[i-1]; /* noted once */
+		else if(vers)
+			s->vers[i] = vers[i];
+		else if(!l1cache_version(&rep->ref[i].key->entry.lock,
+			&s->vers[i]))
+			return;
+	}
+	if(len > s->cap) {
+		uint8_t* p = (uint8_t*)malloc(len);
+		if(!p)
+			return;
+		free(s->pkt);
+		s->pkt = p;
+		s->cap = len;
+	}
+	memmove(s->pkt, sldns_buffer_begin(buf), len);
+	s->len = len;
+	if(!l1cache_find_ttls(s)) {
+		s->len = 0;
+		return;
+	}
+	s->hash = hash;
+	s->qtype = qinfo->qtype;
+	s->qclass = qinfo->qclass;
+	s->flags = flags;
+	s->udpsize = udpsize;
+	s->edns = edns->edns_present?1:0;
+	s->dnssec = (edns->bits & EDNS_DO)?1:0;
+	s->secure = secure?1:0;
+	s->qname_len = qinfo->qname_len;
+	memmove(s->qname, qinfo->qname, qinfo->qname_len);
+	s->msg = e;
+	s->rep = rep;
+	s->ttl = rep->ttl;
+	s->stamp = now;
+	s->num_refs = rep->rrset_count;
+}
+
+size_t
+l1cache_get_mem(struct l1cache* l1)
+{
+	size_t i, s;
+	if(!l1)
+		return 0;
+	s = sizeof(*l1) + (l1->mask+1)*sizeof(struct l1cache_slot);
+	for(i=0; i<=l1->mask; i++)
+		s += l1->slots[i].cap;
+	return s;
+}
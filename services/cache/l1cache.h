@@ -0,0 +1,199 @@
+/*
+ * services/cache/l1cache.h - per thread cache of encoded answers.
+ *
+ * Copyright (c) 2014, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains a small, direct mapped cache of encoded answers for
+ * one worker thread.  It sits behind the lookup in the shared message
+ * cache, and saves the work to lock the rrsets and encode the answer.
+ * The lookup of the message entry, with its bin lock and read lock, is
+ * still done, a slot can not be checked without it.  A
+ * slot holds the answer as it was encoded from a message entry, the lock
+ * versions of the message entry and its rrsets, and where the TTLs are
+ * in the packet.  A hit needs the same message entry, with the same
+ * reply and lock version, that the caller holds a read lock on.  The
+ * rrsets are checked without locking them: the keys are never freed
+ * while the daemon runs, their id changes when they are deleted, and
+ * every write lock of the rrset, for an update of the data, its TTL or
+ * its security status, changes the lock version.  The TTLs in the copy
+ * are lowered for the time that passed.  A cache flush empties the
+ * caches of all threads.  The lock versions need the compact locks,
+ * without them nothing is stored.
+ */
+
+#ifndef SERVICES_CACHE_L1CACHE_H
+#define SERVICES_CACHE_L1CACHE_H
+#include "util/storage/lruhash.h"
+#include "util/data/msgreply.h"
+#include "ldns/rrdef.h"
+struct edns_data;
+struct sldns_buffer;
+
+/** max number of rrsets in an answer that is stored */
+#define L1CACHE_MAX_REFS 8
+/** max number of RRs in an answer that is stored */
+#define L1CACHE_MAX_RRS 24
+/** max size of an answer that is stored */
+#define L1CACHE_MAX_SIZE 1232
+
+/**
+ * A slot with an encoded answer.
+ */
+struct l1cache_slot {
+	/** hash of the query, query_info_hash */
+	hashvalue_t hash;
+	/** query type */
+	uint16_t qtype;
+	/** query class */
+	uint16_t qclass;
+	/** query flags */
+	uint16_t flags;
+	/** udp size of the query */
+	uint16_t udpsize;
+	/** EDNS present in the query */
+	uint8_t edns;
+	/** the EDNS DO bit was set in the query */
+	uint8_t dnssec;
+	/** the answer is secure, for statistics */
+	uint8_t secure;
+	/** length of the query name */
+	size_t qname_len;
+	/** the query name, the answer echoes its case */
+	uint8_t qname[LDNS_MAX_DOMAINLEN+1];
+	/** the message entry the answer was encoded from */
+	struct lruhash_entry* msg;
+	/** the reply of the message entry */
+	struct reply_info* rep;
+	/** lock version of the message entry */
+	uint32_t msg_vers;
+	/** TTL of the message, absolute time */
+	time_t ttl;
+	/** time the answer was encoded */
+	time_t stamp;
+	/** number of rrset references */
+	size_t num_refs;
+	/** the rrset keys and ids */
+	struct rrset_ref ref[L1CACHE_MAX_REFS];
+	/** lock versions of the rrsets that were encoded */
+	uint32_t vers[L1CACHE_MAX_REFS];
+	/** number of TTLs in the packet */
+	size_t num_ttls;
+	/** position of the TTLs in the packet */
+	uint16_t ttl_pos[L1CACHE_MAX_RRS];
+	/** length of the packet, 0 for an empty slot */
+	size_t len;
+	/** allocated size of the packet buffer */
+	size_t cap;
+	/** the encoded answer */
+	uint8_t* pkt;
+};
+
+/**
+ * Per thread answer cache.
+ */
+struct l1cache {
+	/** the slots, a power of two */
+	struct l1cache_slot* slots;
+	/** number of slots minus one */
+	size_t mask;
+	/** the flush counter, shared by the threads, that is increased
+	 * when the caches are flushed */
+	size_t* flush;
+	/** the value of the flush counter when the slots were filled */
+	size_t flush_seen;
+};
+
+/**
+ * Create answer cache.
+ * @param num: number of slots, rounded up to a power of two.
+ * @param flush: the flush counter, the cache is emptied when it changes.
+ * @return new cache or NULL on malloc failure.
+ */
+struct l1cache* l1cache_create(size_t num, size_t* flush);
+
+/**
+ * Delete answer cache.
+ * @param l1: to delete.
+ */
+void l1cache_delete(struct l1cache* l1);
+
+/**
+ * Answer a query from the cache.
+ * @param l1: the cache.
+ * @param e: the message cache entry for the query, read locked.
+ * @param qinfo: the query.
+ * @param hash: query_info_hash of the query.
+ * @param id: query id, network order.
+ * @param flags: query flags, host order.
+ * @param edns: the EDNS of the query.
+ * @param now: current time.
+ * @param buf: the answer is written here.
+ * @param secure: returns if the answer is secure.
+ * @return true if answered.
+ */
+int l1cache_answer(struct l1cache* l1, struct lruhash_entry* e,
+	struct query_info* qinfo, hashvalue_t hash, uint16_t id,
+	uint16_t flags, struct edns_data* edns, time_t now,
+	struct sldns_buffer* buf, int* secure);
+
+/**
+ * Store an answer, that was encoded from the message cache, in the cache.
+ * @param l1: the cache.
+ * @param e: the message cache entry that was encoded, read locked.
+ * @param qinfo: the query.
+ * @param hash: query_info_hash of the query.
+ * @param flags: query flags, host order.
+ * @param edns: the EDNS of the query, for the present and DO bits.
+ * @param udpsize: the udp size of the query.
+ * @param vers: the lock versions of the rrsets of the reply, that the
+ *	encode was checked with, or NULL if the rrsets are locked.
+ * @param secure: if the answer is secure.
+ * @param now: the time the answer was encoded with.
+ * @param buf: the encoded answer.
+ */
+void l1cache_store(struct l1cache* l1, struct lruhash_entry* e,
+	struct query_info* qinfo, hashvalue_t hash, uint16_t flags,
+	struct edns_data* edns, uint16_t udpsize, uint32_t* vers,
+	int secure, time_t now, struct sldns_buffer* buf);
+
+/**
+ * Get memory used by the cache.
+ * @param l1: the cache.
+ * @return number of bytes.
+ */
+size_t l1cache_get_mem(struct l1cache* l1);
+
+#endif /* SERVICES_CACHE_L1CACHE_H */
@@ -154,10 +154,10 @@ need_to_update_rrset(void* nd, void* cd, time_t timenow, int equal, int ns)
 		 * that check was before this one. */
 		if(ns) {
 			size_t i;
-			newd->ttl = cached->ttl;
+			packed_rrset_set_ttl(newd, cached->ttl);
 			for(i=0; i<(newd->count+newd->rrsig_count); i++)
-				if(newd->rr_ttl[i] > newd->ttl)
-					newd->rr_ttl[i] = newd->ttl;
+				if(packed_rr_ttl(newd, i) > newd->ttl)
+					packed_rr_set_ttl(newd, i, newd->ttl);
 		}
 		return 1;
 	}
@@ -222,6 +222,8 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 	}
 	log_assert(ref->key->id != 0);
 	slabhash_insert(&r->table, h, &k->entry, k->entry.data, alloc);
+	/* the replaced and evicted rrsets, now that the locks are gone */
+	alloc_retired_free(alloc, ALLOC_RETIRE_BATCH);
 	if(e) {
 		/* For NSEC, NSEC3, DNAME, when rdata is updated, update 
 		 * the ID number so that proofs in message cache are 
@@ -236,6 +238,23 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 	return 0;
 }
 
+int
+rrset_cache_superior(struct rrset_cache* r, struct ub_packed_rrset_key* k,
+	time_t timenow)
+{
+	struct lruhash_entry* e;
+	int superior;
+	if(!(e=slabhash_lookup(&r->table, k->entry.hash, k, 0)))
+		return 0;
+	/* the NS ttl fixup is not done, the passed rrset is not changed,
+	 * it does not change the outcome */
+	superior = !need_to_update_rrset(k->entry.data, e->data, timenow,
+		rrsetdata_equal((struct packed_rrset_data*)k->entry.data,
+		(struct packed_rrset_data*)e->data), 0);
+	lock_rw_unlock(&e->lock);
+	return superior;
+}
+
 struct ub_packed_rrset_key* 
 rrset_cache_lookup(struct rrset_cache* r, uint8_t* qname, size_t qnamelen, 
 	uint16_t qtype, uint16_t qclass, uint32_t flags, time_t timenow,
@@ -326,6 +345,62 @@ rrset_array_unlock_touch(struct rrset_cache* r, struct regional* scratch,
 	}
 }
 
+int
+rrset_array_peek(struct rrset_ref* ref, size_t count, time_t timenow,
+	uint32_t* vers)
+{
+#ifdef LOCK_RW_HAVE_VERSION
+	size_t i;
+	for(i=0; i<count; i++) {
+		if(i>0 && ref[i].key == ref[i-1].key)
+			continue; /* only check items once */
+		if(!lock_rw_version(&ref[i].key->entry.lock, &vers[i]))
+			return 0;
+		if(ref[i].id != ref[i].key->id || timenow >
+			((struct packed_rrset_data*)(ref[i].key->entry.data))
+			->ttl)
+			return 0;
+	}
+	return 1;
+#else
+	(void)ref; (void)count; (void)timenow; (void)vers;
+	return 0;
+#endif
+}
+
+int
+rrset_array_validate(struct rrset_ref* ref, size_t count, uint32_t* vers)
+{
+#ifdef LOCK_RW_HAVE_VERSION
+	size_t i;
+	for(i=0; i<count; i++) {
+		if(i>0 && ref[i].key == ref[i-1].key)
+			continue;
+		/* a reused key keeps its lock, but gets a new id */
+		if(!lock_rw_version_check(&ref[i].key->entry.lock, vers[i]) ||
+			ref[i].id != ref[i].key->id)
+			return 0;
+	}
+	return 1;
+#else
+	(void)ref; (void)count; (void)vers;
+	return 0;
+#endif
+}
+
+void
+rrset_array_touch(struct rrset_cache* r, struct rrset_ref* ref, size_t count)
+{
+	size_t i;
+	for(i=0; i<count; i++) {
+		if(i>0 && ref[i].key == ref[i-1].key)
+			continue; /* only touch items once */
+		/* the hash may be of a reused key, touch checks the id */
+		rrset_cache_touch(r, ref[i].key, ref[i].key->entry.hash,
+			ref[i].id);
+	}
+}
+
 void 
 rrset_update_sec_status(struct rrset_cache* r, 
 	struct ub_packed_rrset_key* rrset, time_t now)
@@ -359,7 +434,8 @@ rrset_update_sec_status(struct rrset_cache* r,
 			updata->security == sec_status_bogus) {
 			cachedata->ttl = updata->ttl + now;
 			for(i=0; i<cachedata->count+cachedata->rrsig_count; i++)
-				cachedata->rr_ttl[i] = updata->rr_ttl[i]+now;
+				packed_rr_set_ttl(cachedata, i,
+					packed_rr_ttl(updata, i)+now);
 		}
 	}
 	lock_rw_unlock(&e->lock);
@@ -391,10 +467,10 @@ rrset_check_sec_status(struct rrset_cache* r,
 			size_t i;
 			updata->ttl = cachedata->ttl - now;
 			for(i=0; i<cachedata->count+cachedata->rrsig_count; i++)
-				if(cachedata->rr_ttl[i] < now)
-					updata->rr_ttl[i] = 0;
-				else updata->rr_ttl[i] = 
-					cachedata->rr_ttl[i]-now;
+				if(packed_rr_ttl(cachedata, i) < now)
+					packed_rr_set_ttl(updata, i, 0);
+				else packed_rr_set_ttl(updata, i,
+					packed_rr_ttl(cachedata, i)-now);
 		}
 		if(cachedata->trust > updata->trust)
 			updata->trust = cachedata->trust;
@@ -133,6 +133,19 @@ void rrset_cache_touch(struct rrset_cache* r, struct ub_packed_rrset_key* key,
 int rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref, 
 	struct alloc_cache* alloc, time_t timenow);
 
+/**
+ * See if the rrset cache holds an rrset that rrset_cache_update would keep
+ * in favor of the one passed, so that the caller does not have to make
+ * a copy of the rrset to store.
+ * @param r: the rrset cache.
+ * @param k: the rrset, it can be region allocated, it is not changed.
+ *	The TTLs in it do not have to be absolute.
+ * @param timenow: current time (to see if ttl in cache is expired).
+ * @return: true if the cached rrset is superior.
+ */
+int rrset_cache_superior(struct rrset_cache* r, struct ub_packed_rrset_key* k,
+	time_t timenow);
+
 /**
  * Lookup rrset. You obtain read/write lock. You must unlock before lookup
  * anything of else.
@@ -188,6 +201,43 @@ void rrset_array_unlock(struct rrset_ref* ref, size_t count);
 void rrset_array_unlock_touch(struct rrset_cache* r, struct regional* scratch,
 	struct rrset_ref* ref, size_t count);
 
+/**
+ * Start to read a (sorted) list of rrset references without locks.
+ * Checks TTLs and IDs of the rrsets, and notes the versions of their
+ * locks.  The caller must be in a read section, alloc_read_begin, so
+ * that the rrset data is not freed while it is read, and the rrsets
+ * must not be used unless rrset_array_validate succeeds afterwards.
+ * @param ref: array of rrset references (key pointer and ID value).
+ *	duplicate references are allowed and handled.
+ * @param count: size of array.
+ * @param timenow: used to compare with TTL.
+ * @param vers: array of count lock versions, filled in.
+ * @return false if the rrsets have timed out, are purged, are being
+ *	written to, or the locks do not support reads without locks.
+ */
+int rrset_array_peek(struct rrset_ref* ref, size_t count, time_t timenow,
+	uint32_t* vers);
+
+/**
+ * Check that the rrsets were not changed while they were read without
+ * locks, after rrset_array_peek.
+ * @param ref: array of rrset references (key pointer and ID value).
+ * @param count: size of array.
+ * @param vers: the lock versions from rrset_array_peek.
+ * @return true if what was read is consistent.
+ */
+int rrset_array_validate(struct rrset_ref* ref, size_t count,
+	uint32_t* vers);
+
+/**
+ * Touch LRU on a (sorted) list of rrset references, that are not locked.
+ * @param r: the rrset cache. In this cache LRU is updated.
+ * @param ref: array of rrset references (key pointer and ID value).
+ * @param count: size of array.
+ */
+void rrset_array_touch(struct rrset_cache* r, struct rrset_ref* ref,
+	size_t count);
+
 /**
  * Update security status of an rrset. Looks up the rrset.
  * If found, checks if rdata is equal.
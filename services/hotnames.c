@@ -0,0 +1,261 @@
+/*
+ * services/hotnames.c - track the most popular queries for prefetch.
+ *
+ * Copyright (c) 2014, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * \file
+ *
+ * This file contains the tracking of the most popular queries, with the
+ * SpaceSaving algorithm.
+ */
+#include "config.h"
+#include "services/hotnames.h"
+#include "util/data/msgreply.h"
+#include "util/data/dname.h"
+#include "util/log.h"
+
+struct hotnames*
+hotnames_create(size_t max, int rate)
+{
+	struct hotnames* hn = (struct hotnames*)calloc(1, sizeof(*hn));
+	size_t b = 1;
+	if(!hn)
+		return NULL;
+	while(b < max*2)
+		b <<= 1;
+	hn->max = max;
+	hn->mask = b-1;
+	hn->rate = rate;
+	hn->nodes = (struct hotname*)calloc(max, sizeof(struct hotname));
+	hn->heap = (struct hotname**)calloc(max, sizeof(struct hotname*));
+	hn->top = (struct hotname**)calloc(max, sizeof(struct hotname*));
+	hn->buckets = (struct hotname**)calloc(b, sizeof(struct hotname*));
+	if(!hn->nodes || !hn->heap || !hn->top || !hn->buckets) {
+		hotnames_delete(hn);
+		return NULL;
+	}
+	return hn;
+}
+
+void
+hotnames_delete(struct hotnames* hn)
+{
+	if(!hn)
+		return;
+	free(hn->nodes);
+	free(hn->heap);
+	free(hn->top);
+	free(hn->buckets);
+	free(hn);
+}
+
+/** find the query in the table */
+static struct hotname*
+hotnames_find(struct hotnames* hn, struct query_info* qinfo,
+	hashvalue_t hash)
+{
+	struct hotname* p;
+	for(p = hn->buckets[hash&hn->mask]; p; p = p->next) {
+		if(p->hash == hash && p->qtype == qinfo->qtype &&
+			p->qclass == qinfo->qclass &&
+			p->qname_len == qinfo->qname_len &&
+			query_dname_compare(p->qname, qinfo->qname) == 0)
+			return p;
+	}
+	return NULL;
+}
+
+/** remove the node from its hash bucket */
+static void
+hotnames_unlink(struct hotnames* hn, struct hotname* n)
+{
+	struct hotname** pp = &hn->buckets[n->hash&hn->mask];
+	while(*pp) {
+		if(*pp == n) {
+			*pp = n->next;
+			return;
+		}
+		pp = &(*pp)->next;
+	}
+}
+
+/** move the node down the heap, after its count went up */
+static void
+hotnames_sift_down(struct hotnames* hn, struct hotname* n)
+{
+	size_t i = n->heap_idx, c;
+	while((c = 2*i+1) < hn->num) {
+		if(c+1 < hn->num && hn->heap[c+1]->count < hn->heap[c]->count)
+			c++;
+		if(hn->heap[c]->count >= n->count)
+			break;
+		hn->heap[i] = hn->heap[c];
+		hn->heap[i]->heap_idx = i;
+		i = c;
+	}
+	hn->heap[i] = n;
+	n->heap_idx = i;
+}
+
+/** move the node up the heap, for a new node at the bottom */
+static void
+hotnames_sift_up(struct hotnames* hn, struct hotname* n)
+{
+	size_t i = n->heap_idx, p;
+	while(i > 0 && hn->heap[(p = (i-1)/2)]->count > n->count) {
+		hn->heap[i] = hn->heap[p];
+		hn->heap[i]->heap_idx = i;
+		i = p;
+	}
+	hn->heap[i] = n;
+	n->heap_idx = i;
+}
+
+/** halve the counts, the heap order stays the same */
+static void
+hotnames_decay(struct hotnames* hn)
+{
+	size_t i;
+	for(i=0; i<hn->num; i++) {
+		hn->nodes[i].count /= 2;
+		hn->nodes[i].error /= 2;
+	}
+}
+
+void
+hotnames_add(struct hotnames* hn, struct query_info* qinfo,
+	hashvalue_t hash, uint16_t flags, time_t now)
+{
+	struct hotname* n;
+	int fresh = 0;
+	if(now >= hn->next_decay) {
+		if(hn->next_decay != 0)
+			hotnames_decay(hn);
+		hn->next_decay = now + HOTNAMES_DECAY;
+	}
+	if((n = hotnames_find(hn, qinfo, hash))) {
+		n->count++;
+		n->flags = flags;
+		hotnames_sift_down(hn, n);
+		return;
+	}
+	if(qinfo->qname_len > sizeof(n->qname))
+		return;
+	if(hn->num < hn->max) {
+		/* a free node, it is added at the bottom of the heap */
+		n = &hn->nodes[hn->num];
+		n->heap_idx = hn->num;
+		hn->heap[hn->num++] = n;
+		fresh = 1;
+		n->count = 0;
+		n->error = 0;
+	} else {
+		/* replace the query with the lowest count */
+		n = hn->heap[0];
+		hotnames_unlink(hn, n);
+		n->error = n->count;
+	}
+	n->hash = hash;
+	n->qtype = qinfo->qtype;
+	n->qclass = qinfo->qclass;
+	n->qname_len = qinfo->qname_len;
+	memmove(n->qname, qinfo->qname, qinfo->qname_len);
+	n->flags = flags;
+	n->holddown = 0;
+	n->count++;
+	n->next = hn->buckets[hash&hn->mask];
+	hn->buckets[hash&hn->mask] = n;
+	if(fresh)
+		hotnames_sift_up(hn, n);
+	else	hotnames_sift_down(hn, n);
+}
+
+size_t
+hotnames_count(struct hotnames* hn, struct query_info* qinfo,
+	hashvalue_t hash)
+{
+	struct hotname* n = hotnames_find(hn, qinfo, hash);
+	if(!n)
+		return 0;
+	return n->count - n->error;
+}
+
+/** compare two queries for the top list, the higher count first */
+static int
+hotnames_top_cmp(const void* a, const void* b)
+{
+	const struct hotname* x = *(struct hotname* const*)a;
+	const struct hotname* y = *(struct hotname* const*)b;
+	if(x->count - x->error > y->count - y->error)
+		return -1;
+	if(x->count - x->error < y->count - y->error)
+		return 1;
+	return 0;
+}
+
+size_t
+hotnames_top(struct hotnames* hn, size_t min, struct hotname*** list)
+{
+	size_t i, n = 0;
+	for(i=0; i<hn->num; i++) {
+		if(hn->nodes[i].count - hn->nodes[i].error >= min)
+			hn->top[n++] = &hn->nodes[i];
+	}
+	qsort(hn->top, n, sizeof(struct hotname*), hotnames_top_cmp);
+	*list = hn->top;
+	return n;
+}
+
+int
+hotnames_budget(struct hotnames* hn, time_t now)
+{
+	if(now != hn->budget_time) {
+		hn->budget_time = now;
+		hn->budget = hn->rate;
+	}
+	if(hn->budget <= 0)
+		return 0;
+	hn->budget--;
+	return 1;
+}
+
+size_t
+hotnames_get_mem(struct hotnames* hn)
+{
+	if(!hn)
+		return 0;
+	return sizeof(*hn) + hn->max*(sizeof(struct hotname) +
+		2*sizeof(struct hotname*)) + (hn->mask+1)*sizeof(struct hotname*);
+}
@@ -0,0 +1,178 @@
+/*
+ * services/hotnames.h - track the most popular queries for prefetch.
+ *
+ * Copyright (c) 2014, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * \file
+ *
+ * This file contains the tracking of the most popular queries, the heavy
+ * hitters, with the SpaceSaving algorithm.  A fixed number of queries is
+ * counted.  When a new query arrives and the table is full, it replaces
+ * the query with the lowest count and takes over that count, so the
+ * popular queries stay in the table.  The counts are halved periodically
+ * so that queries that stopped being popular fade out.  The worker uses it
+ * to refresh the popular names in the cache before they expire.  The table
+ * is per thread and needs no locks.
+ */
+
+#ifndef SERVICES_HOTNAMES_H
+#define SERVICES_HOTNAMES_H
+#include "util/storage/lruhash.h"
+#include "ldns/rrdef.h"
+struct query_info;
+
+/** the counts are halved after this many seconds */
+#define HOTNAMES_DECAY 60
+/** the count a query needs before it is prefetched */
+#define HOTNAMES_MIN_COUNT 4
+/** seconds before a query is prefetched again */
+#define HOTNAMES_HOLDDOWN 5
+
+/**
+ * A tracked query.
+ */
+struct hotname {
+	/** next in the hash bucket */
+	struct hotname* next;
+	/** hash of the query, query_info_hash */
+	hashvalue_t hash;
+	/** position in the heap */
+	size_t heap_idx;
+	/** number of times the query is seen, an overestimate */
+	size_t count;
+	/** the overestimate, the count taken over from the replaced query */
+	size_t error;
+	/** the query flags, for the prefetch */
+	uint16_t flags;
+	/** query type */
+	uint16_t qtype;
+	/** query class */
+	uint16_t qclass;
+	/** length of the query name */
+	size_t qname_len;
+	/** time before which no prefetch is done again */
+	time_t holddown;
+	/** the query name */
+	uint8_t qname[LDNS_MAX_DOMAINLEN+1];
+};
+
+/**
+ * Table of popular queries.
+ */
+struct hotnames {
+	/** the tracked queries, max of them */
+	struct hotname* nodes;
+	/** min-heap of the nodes in use, by count */
+	struct hotname** heap;
+	/** number of nodes in use */
+	size_t num;
+	/** maximum number of nodes */
+	size_t max;
+	/** array for the list of the most popular queries */
+	struct hotname** top;
+	/** hash buckets, a power of two */
+	struct hotname** buckets;
+	/** number of buckets minus one */
+	size_t mask;
+	/** time when the counts are halved next */
+	time_t next_decay;
+	/** the second that the prefetch budget is for */
+	time_t budget_time;
+	/** prefetches left in this second */
+	int budget;
+	/** max number of prefetches per second */
+	int rate;
+};
+
+/**
+ * Create popular queries table.
+ * @param max: number of queries to track.
+ * @param rate: max number of prefetches per second.
+ * @return new table or NULL on malloc failure.
+ */
+struct hotnames* hotnames_create(size_t max, int rate);
+
+/**
+ * Delete popular queries table.
+ * @param hn: to delete.
+ */
+void hotnames_delete(struct hotnames* hn);
+
+/**
+ * Count a query.
+ * @param hn: the table.
+ * @param qinfo: the query.
+ * @param hash: query_info_hash of the query.
+ * @param flags: query flags.
+ * @param now: current time.
+ */
+void hotnames_add(struct hotnames* hn, struct query_info* qinfo,
+	hashvalue_t hash, uint16_t flags, time_t now);
+
+/**
+ * Get the count of a query, as a guaranteed lower bound.
+ * @param hn: the table.
+ * @param qinfo: the query.
+ * @param hash: query_info_hash of the query.
+ * @return the count or 0 if not tracked.
+ */
+size_t hotnames_count(struct hotnames* hn, struct query_info* qinfo,
+	hashvalue_t hash);
+
+/**
+ * Get the popular queries, most popular first.
+ * @param hn: the table.
+ * @param min: the lowest guaranteed count of the queries in the list.
+ * @param list: returns the array of queries, valid until the next call.
+ * @return number of queries in the list.
+ */
+size_t hotnames_top(struct hotnames* hn, size_t min, struct hotname*** list);
+
+/**
+ * Take a prefetch from the budget of this second.
+ * @param hn: the table.
+ * @param now: current time.
+ * @return false if the budget is used up.
+ */
+int hotnames_budget(struct hotnames* hn, time_t now);
+
+/**
+ * Get memory used by the table.
+ * @param hn: the table.
+ * @return number of bytes.
+ */
+size_t hotnames_get_mem(struct hotnames* hn);
+
+#endif /* SERVICES_HOTNAMES_H */
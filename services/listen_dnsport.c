@@ -55,9 +55,14 @@
 #include <netdb.h>
 #endif
 #include <fcntl.h>
+#ifdef HAVE_NETINET_TCP_H
+#include <netinet/tcp.h>
+#endif
 
 /** number of queued TCP connections for listen() */
 #define TCP_BACKLOG 5 
+/** max number of pending TCP fast open connections, not yet accepted */
+#define TCP_FASTOPEN_QLEN 128
 
 /**
  * Debug print of the getaddrinfo returned address.
@@ -437,7 +442,7 @@ create_udp_sock(int family, int socktype, struct sockaddr* addr,
 
 int
 create_tcp_accept_sock(struct addrinfo *addr, int v6only, int* noproto,
-	int* reuseport)
+	int* reuseport, int tcp_fastopen)
 {
 	int s;
 #if defined(SO_REUSEADDR) || defined(SO_REUSEPORT) || defined(IPV6_V6ONLY)
@@ -517,6 +522,26 @@ create_tcp_accept_sock(struct addrinfo *addr, int v6only, int* noproto,
 #else
 	(void)v6only;
 #endif /* IPV6_V6ONLY */
+#ifdef TCP_FASTOPEN
+	if(tcp_fastopen) {
+		/* accept data in the SYN from clients with a cookie */
+		int qlen = TCP_FASTOPEN_QLEN;
+		if(setsockopt(s, IPPROTO_TCP, TCP_FASTOPEN, (void*)&qlen,
+			(socklen_t)sizeof(qlen)) < 0) {
+			/* this option is not essential, we can continue */
+#ifndef USE_WINSOCK
+			log_warn("setsockopt(.. TCP_FASTOPEN ..) failed: %s",
+				strerror(errno));
+#else
+			log_warn("setsockopt(.. TCP_FASTOPEN ..) failed: %s",
+				wsa_strerror(WSAGetLastError()));
+#endif
+		}
+	}
+#else
+	if(tcp_fastopen)
+		verbose(VERB_ALGO, "tcp-fastopen not supported on this system");
+#endif /* TCP_FASTOPEN */
 	if(bind(s, addr->ai_addr, addr->ai_addrlen) != 0) {
 #ifndef USE_WINSOCK
 		/* detect freebsd jail with no ipv6 permission */
@@ -566,7 +591,7 @@ create_tcp_accept_sock(struct addrinfo *addr, int v6only, int* noproto,
 static int
 make_sock(int stype, const char* ifname, const char* port, 
 	struct addrinfo *hints, int v6only, int* noip6, size_t rcv, size_t snd,
-	int* reuseport)
+	int* reuseport, int tcp_fastopen)
 {
 	struct addrinfo *res = NULL;
 	int r, s, inuse, noproto;
@@ -601,7 +626,8 @@ make_sock(int stype, const char* ifname, const char* port,
 			*noip6 = 1;
 		}
 	} else	{
-		s = create_tcp_accept_sock(res, v6only, &noproto, reuseport);
+		s = create_tcp_accept_sock(res, v6only, &noproto, reuseport,
+			tcp_fastopen);
 		if(s == -1 && noproto && hints->ai_family == AF_INET6){
 			*noip6 = 1;
 		}
@@ -614,7 +640,7 @@ make_sock(int stype, const char* ifname, const char* port,
 static int
 make_sock_port(int stype, const char* ifname, const char* port, 
 	struct addrinfo *hints, int v6only, int* noip6, size_t rcv, size_t snd,
-	int* reuseport)
+	int* reuseport, int tcp_fastopen)
 {
 	char* s = strchr(ifname, '@');
 	if(s) {
@@ -636,10 +662,10 @@ make_sock_port(int stype, const char* ifname, const char* port,
 		(void)strlcpy(p, s+1, sizeof(p));
 		p[strlen(s+1)]=0;
 		return make_sock(stype, newif, p, hints, v6only, noip6,
-			rcv, snd, reuseport);
+			rcv, snd, reuseport, tcp_fastopen);
 	}
 	return make_sock(stype, ifname, port, hints, v6only, noip6, rcv, snd,
-		reuseport);
+		reuseport, tcp_fastopen);
 }
 
 /**
@@ -733,19 +759,20 @@ set_recvpktinfo(int s, int family)
  * @param ssl_port: ssl service port number
  * @param reuseport: try to set SO_REUSEPORT if nonNULL and true.
  * 	set to false on exit if reuseport failed due to no kernel support.
+ * @param tcp_fastopen: try to enable TCP fast open on the tcp sockets.
  * @return: returns false on error.
  */
 static int
 ports_create_if(const char* ifname, int do_auto, int do_udp, int do_tcp, 
 	struct addrinfo *hints, const char* port, struct listen_port** list,
-	size_t rcv, size_t snd, int ssl_port, int* reuseport)
+	size_t rcv, size_t snd, int ssl_port, int* reuseport, int tcp_fastopen)
 {
 	int s, noip6=0;
 	if(!do_udp && !do_tcp)
 		return 0;
 	if(do_auto) {
 		if((s = make_sock_port(SOCK_DGRAM, ifname, port, hints, 1, 
-			&noip6, rcv, snd, reuseport)) == -1) {
+			&noip6, rcv, snd, reuseport, 0)) == -1) {
 			if(noip6) {
 				log_warn("IPv6 protocol not available");
 				return 1;
@@ -772,7 +799,7 @@ ports_create_if(const char* ifname, int do_auto, int do_udp, int do_tcp,
 	} else if(do_udp) {
 		/* regular udp socket */
 		if((s = make_sock_port(SOCK_DGRAM, ifname, port, hints, 1, 
-			&noip6, rcv, snd, reuseport)) == -1) {
+			&noip6, rcv, snd, reuseport, 0)) == -1) {
 			if(noip6) {
 				log_warn("IPv6 protocol not available");
 				return 1;
@@ -793,7 +820,7 @@ ports_create_if(const char* ifname, int do_auto, int do_udp, int do_tcp,
 			atoi(strchr(ifname, '@')+1) == ssl_port) ||
 			(!strchr(ifname, '@') && atoi(port) == ssl_port));
 		if((s = make_sock_port(SOCK_STREAM, ifname, port, hints, 1, 
-			&noip6, 0, 0, reuseport)) == -1) {
+			&noip6, 0, 0, reuseport, tcp_fastopen)) == -1) {
 			if(noip6) {
 				/*log_warn("IPv6 protocol not available");*/
 				return 1;
@@ -836,8 +863,8 @@ listen_cp_insert(struct comm_point* c, struct listen_dnsport* front)
 
 struct listen_dnsport* 
 listen_create(struct comm_base* base, struct listen_port* ports,
-	size_t bufsize, int tcp_accept_count, void* sslctx,
-	comm_point_callback_t* cb, void *cb_arg)
+	size_t bufsize, int tcp_accept_count, int tcp_idle_timeout,
+	void* sslctx, comm_point_callback_t* cb, void *cb_arg)
 {
 	struct listen_dnsport* front = (struct listen_dnsport*)
 		malloc(sizeof(struct listen_dnsport));
@@ -849,6 +876,13 @@ listen_create(struct comm_base* base, struct listen_port* ports,
 		free(front);
 		return NULL;
 	}
+	front->tcp_pool = comm_buffer_pool_create(bufsize,
+		NETEVENT_TCP_POOL_MAX_FREE);
+	if(!front->tcp_pool) {
+		sldns_buffer_free(front->udp_buff);
+		free(front);
+		return NULL;
+	}
 
 	/* create comm points as needed */
 	while(ports) {
@@ -858,11 +892,13 @@ listen_create(struct comm_base* base, struct listen_port* ports,
 				front->udp_buff, cb, cb_arg);
 		else if(ports->ftype == listen_type_tcp)
 			cp = comm_point_create_tcp(base, ports->fd, 
-				tcp_accept_count, bufsize, cb, cb_arg);
+				tcp_accept_count, tcp_idle_timeout,
+				front->tcp_pool, cb, cb_arg);
 		else if(ports->ftype == listen_type_ssl) {
 			cp = comm_point_create_tcp(base, ports->fd, 
-				tcp_accept_count, bufsize, cb, cb_arg);
-			cp->ssl = sslctx;
+				tcp_accept_count, tcp_idle_timeout,
+				front->tcp_pool, cb, cb_arg);
+			if(cp) cp->ssl = sslctx;
 		} else if(ports->ftype == listen_type_udpancil) 
 			cp = comm_point_create_udp_ancil(base, ports->fd, 
 				front->udp_buff, cb, cb_arg);
@@ -908,6 +944,7 @@ listen_delete(struct listen_dnsport* front)
 		return;
 	listen_list_delete(front->cps);
 	sldns_buffer_free(front->udp_buff);
+	comm_buffer_pool_delete(front->tcp_pool);
 	free(front);
 }
 
@@ -948,7 +985,7 @@ listening_ports_open(struct config_file* cfg, int* reuseport)
 				do_auto, cfg->do_udp, do_tcp, 
 				&hints, portbuf, &list,
 				cfg->so_rcvbuf, cfg->so_sndbuf,
-				cfg->ssl_port, reuseport)) {
+				cfg->ssl_port, reuseport, cfg->tcp_fastopen)) {
 				listening_ports_free(list);
 				return NULL;
 			}
@@ -959,7 +996,7 @@ listening_ports_open(struct config_file* cfg, int* reuseport)
 				do_auto, cfg->do_udp, do_tcp, 
 				&hints, portbuf, &list,
 				cfg->so_rcvbuf, cfg->so_sndbuf,
-				cfg->ssl_port, reuseport)) {
+				cfg->ssl_port, reuseport, cfg->tcp_fastopen)) {
 				listening_ports_free(list);
 				return NULL;
 			}
@@ -972,7 +1009,7 @@ listening_ports_open(struct config_file* cfg, int* reuseport)
 			if(!ports_create_if(cfg->ifs[i], 0, cfg->do_udp, 
 				do_tcp, &hints, portbuf, &list, 
 				cfg->so_rcvbuf, cfg->so_sndbuf,
-				cfg->ssl_port, reuseport)) {
+				cfg->ssl_port, reuseport, cfg->tcp_fastopen)) {
 				listening_ports_free(list);
 				return NULL;
 			}
@@ -983,7 +1020,7 @@ listening_ports_open(struct config_file* cfg, int* reuseport)
 			if(!ports_create_if(cfg->ifs[i], 0, cfg->do_udp, 
 				do_tcp, &hints, portbuf, &list, 
 				cfg->so_rcvbuf, cfg->so_sndbuf,
-				cfg->ssl_port, reuseport)) {
+				cfg->ssl_port, reuseport, cfg->tcp_fastopen)) {
 				listening_ports_free(list);
 				return NULL;
 			}
@@ -1013,7 +1050,8 @@ size_t listen_get_mem(struct listen_dnsport* listen)
 {
 	size_t s = sizeof(*listen) + sizeof(*listen->base) + 
 		sizeof(*listen->udp_buff) + 
-		sldns_buffer_capacity(listen->udp_buff);
+		sldns_buffer_capacity(listen->udp_buff) +
+		comm_buffer_pool_get_mem(listen->tcp_pool);
 	struct listen_list* p;
 	for(p = listen->cps; p; p = p->next) {
 		s += sizeof(*p);
@@ -1024,12 +1062,13 @@ size_t listen_get_mem(struct listen_dnsport* listen)
 
 void listen_stop_accept(struct listen_dnsport* listen)
 {
-	/* do not stop the ones that have no tcp_free list
-	 * (they have already stopped listening) */
+	/* do not stop the ones that have no tcp_free list and no idle
+	 * connections (they have already stopped listening) */
 	struct listen_list* p;
 	for(p=listen->cps; p; p=p->next) {
 		if(p->com->type == comm_tcp_accept &&
-			p->com->tcp_free != NULL) {
+			(p->com->tcp_free != NULL ||
+			p->com->tcp_idle_last != NULL)) {
 			comm_point_stop_listening(p->com);
 		}
 	}
@@ -1037,12 +1076,14 @@ void listen_stop_accept(struct listen_dnsport* listen)
 
 void listen_start_accept(struct listen_dnsport* listen)
 {
-	/* do not start the ones that have no tcp_free list, it is no
-	 * use to listen to them because they have no free tcp handlers */
+	/* do not start the ones that have no tcp_free list and no idle
+	 * connections, it is no use to listen to them because they have
+	 * no tcp handlers to use */
 	struct listen_list* p;
 	for(p=listen->cps; p; p=p->next) {
 		if(p->com->type == comm_tcp_accept &&
-			p->com->tcp_free != NULL) {
+			(p->com->tcp_free != NULL ||
+			p->com->tcp_idle_last != NULL)) {
 			comm_point_start_listening(p->com, -1, -1);
 		}
 	}
@@ -60,6 +60,10 @@ struct listen_dnsport {
 	    datagram at any time. */
 	struct sldns_buffer* udp_buff;
 
+	/** buffers for the TCP handlers, shared by the tcp accept ports.
+	    Idle TCP connections hold no buffer. */
+	struct comm_buffer_pool* tcp_pool;
+
 	/** list of comm points used to get incoming events */
 	struct listen_list* cps;
 };
@@ -128,6 +132,7 @@ void listening_ports_free(struct listen_port* list);
  * @param bufsize: size of datagram buffer.
  * @param tcp_accept_count: max number of simultaneous TCP connections 
  * 	from clients.
+ * @param tcp_idle_timeout: timeout in msec for idle TCP connections.
  * @param sslctx: nonNULL if ssl context.
  * @param cb: callback function when a request arrives. It is passed
  *	  the packet and user argument. Return true to send a reply.
@@ -136,7 +141,8 @@ void listening_ports_free(struct listen_port* list);
  */
 struct listen_dnsport* listen_create(struct comm_base* base,
 	struct listen_port* ports, size_t bufsize, int tcp_accept_count,
-	void* sslctx, comm_point_callback_t* cb, void* cb_arg);
+	int tcp_idle_timeout, void* sslctx, comm_point_callback_t* cb,
+	void* cb_arg);
 
 /**
  * delete the listening structure
@@ -200,9 +206,10 @@ int create_udp_sock(int family, int socktype, struct sockaddr* addr,
  * @param noproto: if error caused by lack of protocol support.
  * @param reuseport: if nonNULL and true, try to set SO_REUSEPORT on
  * 	listening UDP port.  Set to false on return if it failed to do so.
+ * @param tcp_fastopen: if true, try to enable TCP fast open on the socket.
  * @return: the socket. -1 on error.
  */
 int create_tcp_accept_sock(struct addrinfo *addr, int v6only, int* noproto,
-	int* reuseport);
+	int* reuseport, int tcp_fastopen);
 
 #endif /* LISTEN_DNSPORT_H */
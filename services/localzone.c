@@ -51,6 +51,55 @@
 #include "util/data/msgreply.h"
 #include "util/data/msgparse.h"
 
+/** minimum number of local-data rrs for a parse thread of its own */
+#define LZ_PARSE_MIN_SLICE 4096
+
+/** a local-data rr, parsed for the bulk load */
+struct lz_parsed_rr {
+	/** the config string, for logs */
+	const char* str;
+	/** the rr in wireformat, starts with the owner name */
+	uint8_t* rr;
+	/** length of the rr */
+	size_t len;
+	/** length of the owner name */
+	size_t dname_len;
+	/** number of labels in the owner name */
+	int labs;
+	/** class of the rr, host order */
+	uint16_t dclass;
+	/** position in the config, keeps the order of rrs with one owner */
+	size_t idx;
+};
+
+/** a part of the local-data, parsed and sorted by one thread */
+struct lz_parse_slice {
+	/** the rrs of this slice, sorted after the parse */
+	struct lz_parsed_rr* rrs;
+	/** number of rrs */
+	size_t num;
+	/** next rr to take, when the slices are merged */
+	size_t pos;
+	/** the parsed rrs are allocated here */
+	struct regional* region;
+	/** if true, the parse failed */
+	int error;
+	/** the thread that parses the slice */
+	ub_thread_t thr;
+};
+
+/** the parsed local-data, in sorted slices */
+struct lz_parsed {
+	/** all the rrs */
+	struct lz_parsed_rr* rrs;
+	/** number of rrs */
+	size_t num;
+	/** the slices of the rrs array */
+	struct lz_parse_slice* slices;
+	/** number of slices */
+	int num_slices;
+};
+
 struct local_zones* 
 local_zones_create(void)
 {
@@ -288,8 +337,8 @@ rr_is_duplicate(struct packed_rrset_data* pd, uint8_t* rdata, size_t rdata_len)
 {
 	size_t i;
 	for(i=0; i<pd->count; i++) {
-		if(pd->rr_len[i] == rdata_len &&
-			memcmp(pd->rr_data[i], rdata, rdata_len) == 0)
+		if(packed_rr_len(pd, i) == rdata_len &&
+			memcmp(packed_rr_data(pd, i), rdata, rdata_len) == 0)
 			return 1;
 	}
 	return 0;
@@ -332,39 +381,57 @@ new_local_rrset(struct regional* region, struct local_data* node,
 	return rrset;
 }
 
-/** insert RR into RRset data structure; Wastes a couple of bytes */
+/** insert RR into RRset data structure; Wastes a couple of bytes.
+ * The rrset data is one block, it is rebuilt with the new RR, and the
+ * block in the region is grown by doubling */
 static int
-insert_rr(struct regional* region, struct packed_rrset_data* pd,
+insert_rr(struct regional* region, struct local_rrset* rrset,
 	uint8_t* rdata, size_t rdata_len, time_t ttl)
 {
-	size_t* oldlen = pd->rr_len;
-	time_t* oldttl = pd->rr_ttl;
-	uint8_t** olddata = pd->rr_data;
+	struct packed_rrset_data* old = (struct packed_rrset_data*)
+		rrset->rrset->entry.data, *pd;
+	size_t i, s;
 
-	/* add RR to rrset */
-	pd->count++;
-	pd->rr_len = regional_alloc(region, sizeof(*pd->rr_len)*pd->count);
-	pd->rr_ttl = regional_alloc(region, sizeof(*pd->rr_ttl)*pd->count);
-	pd->rr_data = regional_alloc(region, sizeof(*pd->rr_data)*pd->count);
-	if(!pd->rr_len || !pd->rr_ttl || !pd->rr_data) {
-		log_err("out of memory");
+	if(rdata_len > 0xffff) {
+		log_err("rdata too long for local data");
 		return 0;
 	}
-	if(pd->count > 1) {
-		memcpy(pd->rr_len+1, oldlen, 
-			sizeof(*pd->rr_len)*(pd->count-1));
-		memcpy(pd->rr_ttl+1, oldttl, 
-			sizeof(*pd->rr_ttl)*(pd->count-1));
-		memcpy(pd->rr_data+1, olddata, 
-			sizeof(*pd->rr_data)*(pd->count-1));
-	}
-	pd->rr_len[0] = rdata_len;
-	pd->rr_ttl[0] = ttl;
-	pd->rr_data[0] = regional_alloc_init(region, rdata, rdata_len);
-	if(!pd->rr_data[0]) {
+
+	/* add RR to rrset, in front of the rrs already there */
+	s = sizeof(*pd) + PACKED_RRSET_ARRAYS_SIZE(old->count+1) + rdata_len;
+	for(i=0; i<old->count; i++)
+		s += packed_rr_len(old, i);
+	pd = (struct packed_rrset_data*)malloc(s);
+	if(!pd) {
 		log_err("out of memory");
 		return 0;
 	}
+	*pd = *old;
+	pd->count++;
+	packed_rr_len(pd, 0) = rdata_len;
+	for(i=0; i<old->count; i++)
+		packed_rr_len(pd, i+1) = packed_rr_len(old, i);
+	packed_rrset_offs_setup(pd);
+	packed_rr_set_ttl(pd, 0, ttl);
+	memmove(packed_rr_data(pd, 0), rdata, rdata_len);
+	for(i=0; i<old->count; i++) {
+		packed_rr_set_ttl(pd, i+1, packed_rr_ttl(old, i));
+		memmove(packed_rr_data(pd, i+1), packed_rr_data(old, i),
+			packed_rr_len(old, i));
+	}
+	if(s > rrset->space) {
+		rrset->space = s*2;
+		old = (struct packed_rrset_data*)regional_alloc(region,
+			rrset->space);
+		if(!old) {
+			free(pd);
+			log_err("out of memory");
+			return 0;
+		}
+		rrset->rrset->entry.data = old;
+	}
+	memcpy(old, pd, s);
+	free(pd);
 	return 1;
 }
 
@@ -416,6 +483,37 @@ lz_find_create_node(struct local_zone* z, uint8_t* nm, size_t nmlen,
 	return 1;
 }
 
+/** enter data RR into a domain name node of the auth zone */
+static int
+lz_enter_rr_into_node(struct local_zone* z, struct local_data* node,
+	uint16_t rrtype, uint16_t rrclass, time_t ttl, uint8_t* rdata,
+	size_t rdata_len, const char* rrstr)
+{
+	struct local_rrset* rrset;
+	struct packed_rrset_data* pd;
+	rrset = local_data_find_type(node, rrtype);
+	if(!rrset) {
+		rrset = new_local_rrset(z->region, node, rrtype, rrclass);
+		if(!rrset)
+			return 0;
+		if(query_dname_compare(node->name, z->name) == 0) {
+			if(rrtype == LDNS_RR_TYPE_NSEC)
+			  rrset->rrset->rk.flags = PACKED_RRSET_NSEC_AT_APEX;
+			if(rrtype == LDNS_RR_TYPE_SOA)
+				z->soa = rrset->rrset;
+		}
+	} 
+	pd = (struct packed_rrset_data*)rrset->rrset->entry.data;
+	log_assert(rrset && pd);
+
+	/* check for duplicate RR */
+	if(rr_is_duplicate(pd, rdata, rdata_len)) {
+		verbose(VERB_ALGO, "ignoring duplicate RR: %s", rrstr);
+		return 1;
+	} 
+	return insert_rr(z->region, rrset, rdata, rdata_len, ttl);
+}
+
 /** enter data RR into auth zone */
 static int
 lz_enter_rr_into_zone(struct local_zone* z, const char* rrstr)
@@ -424,8 +522,6 @@ lz_enter_rr_into_zone(struct local_zone* z, const char* rrstr)
 	size_t nmlen;
 	int nmlabs;
 	struct local_data* node;
-	struct local_rrset* rrset;
-	struct packed_rrset_data* pd;
 	uint16_t rrtype = 0, rrclass = 0;
 	time_t ttl = 0;
 	uint8_t rr[LDNS_RR_BUF_SIZE];
@@ -451,57 +547,8 @@ lz_enter_rr_into_zone(struct local_zone* z, const char* rrstr)
 	}
 	log_assert(node);
 	free(nm);
-
-	rrset = local_data_find_type(node, rrtype);
-	if(!rrset) {
-		rrset = new_local_rrset(z->region, node, rrtype, rrclass);
-		if(!rrset)
-			return 0;
-		if(query_dname_compare(node->name, z->name) == 0) {
-			if(rrtype == LDNS_RR_TYPE_NSEC)
-			  rrset->rrset->rk.flags = PACKED_RRSET_NSEC_AT_APEX;
-			if(rrtype == LDNS_RR_TYPE_SOA)
-				z->soa = rrset->rrset;
-		}
-	} 
-	pd = (struct packed_rrset_data*)rrset->rrset->entry.data;
-	log_assert(rrset && pd);
-
-	/* check for duplicate RR */
-	if(rr_is_duplicate(pd, rdata, rdata_len)) {
-		verbose(VERB_ALGO, "ignoring duplicate RR: %s", rrstr);
-		return 1;
-	} 
-	return insert_rr(z->region, pd, rdata, rdata_len, ttl);
-}
-
-/** enter a data RR into auth data; a zone for it must exist */
-static int
-lz_enter_rr_str(struct local_zones* zones, const char* rr)
-{
-	uint8_t* rr_name;
-	uint16_t rr_class;
-	size_t len;
-	int labs;
-	struct local_zone* z;
-	int r;
-	if(!get_rr_nameclass(rr, &rr_name, &rr_class)) {
-		log_err("bad rr %s", rr);
-		return 0;
-	}
-	labs = dname_count_size_labels(rr_name, &len);
-	lock_rw_rdlock(&zones->lock);
-	z = local_zones_lookup(zones, rr_name, len, labs, rr_class);
-	if(!z) {
-		lock_rw_unlock(&zones->lock);
-		fatal_exit("internal error: no zone for rr %s", rr);
-	}
-	lock_rw_wrlock(&z->lock);
-	lock_rw_unlock(&zones->lock);
-	free(rr_name);
-	r = lz_enter_rr_into_zone(z, rr);
-	lock_rw_unlock(&z->lock);
-	return r;
+	return lz_enter_rr_into_node(z, node, rrtype, rrclass, ttl, rdata,
+		rdata_len, rrstr);
 }
 
 /** parse local-zone: statements */
@@ -721,14 +768,162 @@ init_parents(struct local_zones* zones)
 	lock_rw_unlock(&zones->lock);
 }
 
+/** compare parsed rrs by class and owner name, and keep the config order */
+static int
+lz_parsed_cmp(const void* a, const void* b)
+{
+	struct lz_parsed_rr* x = (struct lz_parsed_rr*)a;
+	struct lz_parsed_rr* y = (struct lz_parsed_rr*)b;
+	int m, c;
+	if(x->dclass != y->dclass)
+		return x->dclass < y->dclass ? -1 : 1;
+	if((c = dname_lab_cmp(x->rr, x->labs, y->rr, y->labs, &m)) != 0)
+		return c;
+	if(x->idx != y->idx)
+		return x->idx < y->idx ? -1 : 1;
+	return 0;
+}
+
+/** parse and sort the rrs of a slice, can run in a thread of its own */
+static void*
+lz_parse_slice(void* arg)
+{
+	struct lz_parse_slice* sl = (struct lz_parse_slice*)arg;
+	uint8_t rr[LDNS_RR_BUF_SIZE];
+	size_t i;
+	for(i=0; i<sl->num; i++) {
+		struct lz_parsed_rr* p = &sl->rrs[i];
+		size_t len = sizeof(rr), dname_len = 0;
+		int e = sldns_str2wire_rr_buf(p->str, rr, &len, &dname_len,
+			3600, NULL, 0, NULL, 0);
+		if(e) {
+			log_err("error parsing local-data at %d: '%s': %s",
+				LDNS_WIREPARSE_OFFSET(e), p->str,
+				sldns_get_errorstr_parse(e));
+			log_err("bad local-data: %s", p->str);
+			sl->error = 1;
+			return NULL;
+		}
+		p->rr = regional_alloc_init(sl->region, rr, len);
+		if(!p->rr) {
+			log_err("out of memory");
+			sl->error = 1;
+			return NULL;
+		}
+		p->len = len;
+		p->dname_len = dname_len;
+		p->labs = dname_count_labels(p->rr);
+		p->dclass = sldns_wirerr_get_class(rr, len, dname_len);
+	}
+	qsort(sl->rrs, sl->num, sizeof(*sl->rrs), lz_parsed_cmp);
+	return NULL;
+}
+
+/** free the parsed local-data */
+static void
+lz_parsed_free(struct lz_parsed* pd)
+{
+	int i;
+	for(i=0; i<pd->num_slices; i++)
+		regional_destroy(pd->slices[i].region);
+	free(pd->slices);
+	free(pd->rrs);
+	memset(pd, 0, sizeof(*pd));
+}
+
+/**
+ * Parse the local-data strings, every string once.  Large amounts are
+ * parsed in slices by num-threads threads.
+ * @param cfg: config with the local-data.
+ * @param pd: the parsed data is returned here, free with lz_parsed_free.
+ * @return false on a parse error or alloc failure.
+ */
+static int
+lz_parse_data(struct config_file* cfg, struct lz_parsed* pd)
+{
+	struct config_strlist* p;
+	size_t i, start = 0;
+	int n, r = 1;
+	memset(pd, 0, sizeof(*pd));
+	for(p = cfg->local_data; p; p = p->next)
+		pd->num++;
+	if(pd->num == 0)
+		return 1;
+	n = cfg->num_threads;
+	if((size_t)n > pd->num/LZ_PARSE_MIN_SLICE)
+		n = (int)(pd->num/LZ_PARSE_MIN_SLICE);
+#ifdef THREADS_DISABLED
+	n = 1;
+#endif
+	if(n < 1)
+		n = 1;
+	pd->rrs = (struct lz_parsed_rr*)calloc(pd->num, sizeof(*pd->rrs));
+	pd->slices = (struct lz_parse_slice*)calloc((size_t)n,
+		sizeof(*pd->slices));
+	if(!pd->rrs || !pd->slices) {
+		log_err("out of memory");
+		lz_parsed_free(pd);
+		return 0;
+	}
+	for(p = cfg->local_data, i = 0; p; p = p->next, i++) {
+		pd->rrs[i].str = p->str;
+		pd->rrs[i].idx = i;
+	}
+	for(pd->num_slices = 0; pd->num_slices < n; pd->num_slices++) {
+		struct lz_parse_slice* sl = &pd->slices[pd->num_slices];
+		size_t end = pd->num*(pd->num_slices+1)/n;
+		sl->rrs = pd->rrs + start;
+		sl->num = end - start;
+		start = end;
+		if(!(sl->region = regional_create())) {
+			log_err("out of memory");
+			lz_parsed_free(pd);
+			return 0;
+		}
+	}
+	/* the first slice is parsed by this thread */
+	for(i=1; i<(size_t)n; i++)
+		ub_thread_create(&pd->slices[i].thr, lz_parse_slice,
+			&pd->slices[i]);
+	(void)lz_parse_slice(&pd->slices[0]);
+	for(i=1; i<(size_t)n; i++)
+		ub_thread_join(pd->slices[i].thr);
+	for(i=0; i<(size_t)n; i++)
+		if(pd->slices[i].error)
+			r = 0;
+	if(!r)
+		lz_parsed_free(pd);
+	return r;
+}
+
+/** take the next rr from the merged slices, in sorted order */
+static struct lz_parsed_rr*
+lz_parsed_next(struct lz_parsed* pd)
+{
+	struct lz_parsed_rr* best = NULL;
+	struct lz_parse_slice* bsl = NULL;
+	int i;
+	for(i=0; i<pd->num_slices; i++) {
+		struct lz_parse_slice* sl = &pd->slices[i];
+		if(sl->pos < sl->num && (!best ||
+			lz_parsed_cmp(&sl->rrs[sl->pos], best) < 0)) {
+			best = &sl->rrs[sl->pos];
+			bsl = sl;
+		}
+	}
+	if(bsl)
+		bsl->pos++;
+	return best;
+}
+
 /** enter implicit transparent zone for local-data: without local-zone: */
 static int
-lz_setup_implicit(struct local_zones* zones, struct config_file* cfg)
+lz_setup_implicit(struct local_zones* zones, struct lz_parsed* pd)
 {
 	/* walk over all items that have no parent zone and find
 	 * the name that covers them all (could be the root) and
 	 * add that as a transparent zone */
-	struct config_strlist* p;
+	size_t i;
 	int have_name = 0;
 	int have_other_classes = 0;
 	uint16_t dclass = 0;
@@ -738,44 +933,39 @@ lz_setup_implicit(struct local_zones* zones, struct config_file* cfg)
 	int match = 0; /* number of labels match count */
 
 	init_parents(zones); /* to enable local_zones_lookup() */
-	for(p = cfg->local_data; p; p = p->next) {
-		uint8_t* rr_name;
-		uint16_t rr_class;
-		size_t len;
-		int labs;
-		if(!get_rr_nameclass(p->str, &rr_name, &rr_class)) {
-			log_err("Bad local-data RR %s", p->str);
-			return 0;
-		}
-		labs = dname_count_size_labels(rr_name, &len);
-		lock_rw_rdlock(&zones->lock);
-		if(!local_zones_lookup(zones, rr_name, len, labs, rr_class)) {
+	lock_rw_rdlock(&zones->lock);
+	for(i=0; i<pd->num; i++) {
+		struct lz_parsed_rr* p = &pd->rrs[i];
+		/* the slices are sorted, the same owner is often repeated */
+		if(i > 0 && p->dclass == pd->rrs[i-1].dclass &&
+			p->dname_len == pd->rrs[i-1].dname_len &&
+			query_dname_compare(p->rr, pd->rrs[i-1].rr) == 0)
+			continue;
+		if(!local_zones_lookup(zones, p->rr, p->dname_len, p->labs,
+			p->dclass)) {
 			if(!have_name) {
-				dclass = rr_class;
-				nm = rr_name;
-				nmlen = len;
-				nmlabs = labs;
-				match = labs;
+				dclass = p->dclass;
+				nm = p->rr;
+				nmlen = p->dname_len;
+				nmlabs = p->labs;
+				match = p->labs;
 				have_name = 1;
 			} else {
 				int m;
-				if(rr_class != dclass) {
+				if(p->dclass != dclass) {
 					/* process other classes later */
-					free(rr_name);
 					have_other_classes = 1;
-					lock_rw_unlock(&zones->lock);
 					continue;
 				}
 				/* find smallest shared topdomain */
 				(void)dname_lab_cmp(nm, nmlabs, 
-					rr_name, labs, &m);
-				free(rr_name);
+					p->rr, p->labs, &m);
 				if(m < match)
 					match = m;
 			}
-		} else free(rr_name);
-		lock_rw_unlock(&zones->lock);
+		}
 	}
+	lock_rw_unlock(&zones->lock);
 	if(have_name) {
 		uint8_t* n2;
 		struct local_zone* z;
@@ -783,7 +973,6 @@ lz_setup_implicit(struct local_zones* zones, struct config_file* cfg)
 		n2 = nm;
 		dname_remove_labels(&n2, &nmlen, nmlabs - match);
 		n2 = memdup(n2, nmlen);
-		free(nm);
 		if(!n2) {
 			log_err("out of memory");
 			return 0;
@@ -798,23 +987,121 @@ lz_setup_implicit(struct local_zones* zones, struct config_file* cfg)
 	}
 	if(have_other_classes) { 
 		/* restart to setup other class */
-		return lz_setup_implicit(zones, cfg);
+		return lz_setup_implicit(zones, pd);
 	}
 	return 1;
 }
 
-/** enter auth data */
+/**
+ * Find or create the node for an owner name in the bulk load.  The names
+ * come in sorted order, so the node is mostly new and the parent is the
+ * parent of the node before it.  The node is inserted without a search
+ * first, and the parents are only searched when they are not the parent
+ * of the node before.
+ * @param z: the zone.
+ * @param p: the rr with the owner name.
+ * @param spare: unused node from an earlier call, or NULL.
+ * @param parent: parent node of the node before, updated.
+ * @param res: the node is returned here.
+ * @return false on alloc failure.
+ */
 static int
-lz_enter_data(struct local_zones* zones, struct config_file* cfg)
+lz_bulk_find_create_node(struct local_zone* z, struct lz_parsed_rr* p,
+	struct local_data** spare, struct local_data** parent,
+	struct local_data** res)
 {
-	struct config_strlist* p;
-	for(p = cfg->local_data; p; p = p->next) {
-		if(!lz_enter_rr_str(zones, p->str))
-			return 0;
+	struct local_data* ld = *spare;
+	uint8_t* pnm = p->rr;
+	size_t pnmlen = p->dname_len;
+	if(!ld && !(ld = (struct local_data*)regional_alloc_zero(z->region,
+		sizeof(*ld)))) {
+		log_err("out of memory adding local data");
+		return 0;
+	}
+	ld->node.key = ld;
+	ld->name = regional_alloc_init(z->region, p->rr, p->dname_len);
+	if(!ld->name) {
+		log_err("out of memory");
+		return 0;
+	}
+	ld->namelen = p->dname_len;
+	ld->namelabs = p->labs;
+	if(!rbtree_insert(&z->data, &ld->node)) {
+		/* it exists, keep the node for the next name */
+		*spare = ld;
+		*res = lz_find_node(z, p->rr, p->dname_len, p->labs);
+		return 1;
+	}
+	*spare = NULL;
+	*res = ld;
+	/* see if empty nonterminals need to be created */
+	if(p->labs > z->namelabs) {
+		dname_remove_label(&pnm, &pnmlen);
+		if(*parent && (*parent)->namelabs == p->labs-1 &&
+			query_dname_compare((*parent)->name, pnm) == 0)
+			return 1;
+		return lz_find_create_node(z, pnm, pnmlen, p->labs-1, parent);
 	}
 	return 1;
 }
 
+/** enter auth data, in one pass over the data sorted by owner name; the
+ * zone and the node are looked up once for an owner name */
+static int
+lz_enter_data(struct local_zones* zones, struct lz_parsed* pd)
+{
+	struct lz_parsed_rr* p, *prev = NULL;
+	struct local_zone* z = NULL, *nz;
+	struct local_data* node = NULL, *spare = NULL, *parent = NULL;
+	int r = 1;
+	lock_rw_rdlock(&zones->lock);
+	while(r && (p = lz_parsed_next(pd))) {
+		if(!prev || p->dclass != prev->dclass ||
+			query_dname_compare(p->rr, prev->rr) != 0) {
+			nz = local_zones_lookup(zones, p->rr, p->dname_len,
+				p->labs, p->dclass);
+			if(!nz) {
+				lock_rw_unlock(&zones->lock);
+				fatal_exit("internal error: no zone for rr %s",
+					p->str);
+			}
+			if(nz != z) {
+				if(z)
+					lock_rw_unlock(&z->lock);
+				z = nz;
+				lock_rw_wrlock(&z->lock);
+				/* nodes are allocated in the zone region */
+				spare = NULL;
+				parent = NULL;
+			}
+			if(z->type == local_zone_redirect &&
+				query_dname_compare(z->name, p->rr) != 0) {
+				log_err("local-data in redirect zone must "
+					"reside at top of zone, not at %s",
+					p->str);
+				r = 0;
+				break;
+			}
+			if(!lz_bulk_find_create_node(z, p, &spare, &parent,
+				&node)) {
+				r = 0;
+				break;
+			}
+		}
+		r = lz_enter_rr_into_node(z, node,
+			sldns_wirerr_get_type(p->rr, p->len, p->dname_len),
+			p->dclass, (time_t)sldns_wirerr_get_ttl(p->rr, p->len,
+			p->dname_len), sldns_wirerr_get_rdatawl(p->rr, p->len,
+			p->dname_len), sldns_wirerr_get_rdatalen(p->rr, p->len,
+			p->dname_len)+2, p->str);
+		prev = p;
+	}
+	if(z)
+		lock_rw_unlock(&z->lock);
+	lock_rw_unlock(&zones->lock);
+	return r;
+}
+
 /** free memory from config */
 static void
 lz_freeup_cfg(struct config_file* cfg)
@@ -830,6 +1117,7 @@ lz_freeup_cfg(struct config_file* cfg)
 int 
 local_zones_apply_cfg(struct local_zones* zones, struct config_file* cfg)
 {
+	struct lz_parsed pd;
 	/* create zones from zone statements. */
 	if(!lz_enter_zones(zones, cfg)) {
 		return 0;
@@ -838,17 +1126,24 @@ local_zones_apply_cfg(struct local_zones* zones, struct config_file* cfg)
 	if(!lz_enter_defaults(zones, cfg)) {
 		return 0;
 	}
+	/* parse local data, every rr once */
+	if(!lz_parse_data(cfg, &pd)) {
+		return 0;
+	}
 	/* create implicit transparent zone from data. */
-	if(!lz_setup_implicit(zones, cfg)) {
+	if(!lz_setup_implicit(zones, &pd)) {
+		lz_parsed_free(&pd);
 		return 0;
 	}
 
 	/* setup parent ptrs for lookup during data entry */
 	init_parents(zones);
 	/* insert local data */
-	if(!lz_enter_data(zones, cfg)) {
+	if(!lz_enter_data(zones, &pd)) {
+		lz_parsed_free(&pd);
 		return 0;
 	}
+	lz_parsed_free(&pd);
 	/* freeup memory from cfg struct. */
 	lz_freeup_cfg(cfg);
 	return 1;
@@ -146,6 +146,8 @@ struct local_rrset {
 	struct local_rrset* next;
 	/** RRset data item */
 	struct ub_packed_rrset_key* rrset;
+	/** size of the region block for the rrset data */
+	size_t space;
 };
 
 /**
@@ -180,6 +180,7 @@ mesh_create(struct module_stack* stack, struct module_env* env)
 	mesh->stats_dropped = 0;
 	mesh->max_reply_states = env->cfg->num_queries_per_thread;
 	mesh->max_forever_states = (mesh->max_reply_states+1)/2;
+	mesh->region_presize = env->cfg->region_presize;
 #ifndef S_SPLINT_S
 	mesh->jostle_max.tv_sec = (time_t)(env->cfg->jostle_time / 1000);
 	mesh->jostle_max.tv_usec = (time_t)((env->cfg->jostle_time % 1000)
@@ -494,6 +495,23 @@ void mesh_report_reply(struct mesh_area* mesh, struct outbound_entry* e,
 	mesh_run(mesh, e->qstate->mesh_info, event, e);
 }
 
+/** see if the query is expected to have a large answer, with signatures */
+static int
+mesh_expect_large(struct module_env* env, struct query_info* qinfo,
+	uint16_t qflags)
+{
+	switch(qinfo->qtype) {
+	case LDNS_RR_TYPE_DNSKEY:
+	case LDNS_RR_TYPE_DS:
+	case LDNS_RR_TYPE_RRSIG:
+	case LDNS_RR_TYPE_ANY:
+		return 1;
+	default:
+		break;
+	}
+	return env->need_to_validate && !(qflags&BIT_CD);
+}
+
 struct mesh_state* 
 mesh_state_create(struct module_env* env, struct query_info* qinfo, 
 	uint16_t qflags, int prime)
@@ -503,6 +521,8 @@ mesh_state_create(struct module_env* env, struct query_info* qinfo,
 	int i;
 	if(!region)
 		return NULL;
+	if(env->mesh->region_presize && mesh_expect_large(env, qinfo, qflags))
+		regional_reserve(region, env->mesh->region_presize);
 	mstate = (struct mesh_state*)regional_alloc(region, 
 		sizeof(struct mesh_state));
 	if(!mstate) {
@@ -985,6 +1005,10 @@ int mesh_state_add_reply(struct mesh_state* s, struct edns_data* edns,
 		return 0;
 	r->query_reply = *rep;
 	r->edns = *edns;
+	/* the options are kept with the reply, the caller reuses them */
+	if(edns->opt_list && !(r->edns.opt_list = edns_opt_copy_region(
+		edns->opt_list, s->s.region)))
+		return 0;
 	r->qid = qid;
 	r->qflags = qflags;
 	r->start_time = *s->s.env->now_tv;
@@ -1075,6 +1099,10 @@ void mesh_run(struct mesh_area* mesh, struct mesh_state* mstate,
 			mesh->mods.mod[mstate->s.curmod]->operate));
 		(*mesh->mods.mod[mstate->s.curmod]->operate)
 			(&mstate->s, ev, mstate->s.curmod, e);
+		if(regional_get_mem(mstate->s.region) >
+			mesh->region_hiwater[mstate->s.curmod])
+			mesh->region_hiwater[mstate->s.curmod] =
+				regional_get_mem(mstate->s.region);
 
 		/* examine results */
 		mstate->s.reply = NULL;
@@ -1160,6 +1188,7 @@ mesh_stats_clear(struct mesh_area* mesh)
 	mesh->ans_bogus = 0;
 	memset(&mesh->ans_rcode[0], 0, sizeof(size_t)*16);
 	mesh->ans_nodata = 0;
+	memset(&mesh->region_hiwater[0], 0, sizeof(size_t)*MAX_MODULE);
 }
 
 size_t 
@@ -104,6 +104,8 @@ struct mesh_area {
 	size_t max_reply_states;
 	/** max forever number of reply states to have */
 	size_t max_forever_states;
+	/** bytes to reserve in the region of states with large answers */
+	size_t region_presize;
 
 	/** stats, cumulative number of reply states jostled out */
 	size_t stats_jostled;
@@ -123,6 +125,9 @@ struct mesh_area {
 	size_t ans_rcode[16];
 	/** (extended stats) rcode nodata in replies */
 	size_t ans_nodata;
+	/** (extended stats) high-water mark of the state region size,
+	 * after the module ran */
+	size_t region_hiwater[MAX_MODULE];
 
 	/** backup of query if other operations recurse and need the
 	 * network buffers */
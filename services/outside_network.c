@@ -66,6 +66,9 @@
 #include <netdb.h>
 #endif
 #include <fcntl.h>
+#ifdef HAVE_NETINET_TCP_H
+#include <netinet/tcp.h>
+#endif
 
 /** number of times to retry making a random ID that is unique. */
 #define MAX_ID_RETRY 1000
@@ -94,6 +97,14 @@ pending_cmp(const void* key1, const void* key2)
 	return sockaddr_cmp(&p1->addr, p1->addrlen, &p2->addr, p2->addrlen);
 }
 
+int
+ssl_session_cmp(const void* key1, const void* key2)
+{
+	struct ssl_session_entry* s1 = (struct ssl_session_entry*)key1;
+	struct ssl_session_entry* s2 = (struct ssl_session_entry*)key2;
+	return sockaddr_cmp(&s1->addr, s1->addrlen, &s2->addr, s2->addrlen);
+}
+
 int 
 serviced_cmp(const void* key1, const void* key2)
 {
@@ -192,6 +203,165 @@ pick_outgoing_tcp(struct waiting_tcp* w, int s)
 	return 1;
 }
 
+/** find the ssl session entry for the upstream server */
+static struct ssl_session_entry*
+ssl_session_lookup(struct outside_network* outnet,
+	struct sockaddr_storage* addr, socklen_t addrlen)
+{
+	struct ssl_session_entry key;
+	key.node.key = &key;
+	memcpy(&key.addr, addr, addrlen);
+	key.addrlen = addrlen;
+	return (struct ssl_session_entry*)rbtree_search(outnet->ssl_sessions,
+		&key);
+}
+
+/** remove the ssl session entry from the lru list */
+static void
+ssl_session_lru_remove(struct outside_network* outnet,
+	struct ssl_session_entry* e)
+{
+	if(e->lru_prev)
+		e->lru_prev->lru_next = e->lru_next;
+	else	outnet->ssl_session_first = e->lru_next;
+	if(e->lru_next)
+		e->lru_next->lru_prev = e->lru_prev;
+	else	outnet->ssl_session_last = e->lru_prev;
+}
+
+/** put the ssl session entry at the front of the lru list */
+static void
+ssl_session_lru_front(struct outside_network* outnet,
+	struct ssl_session_entry* e)
+{
+	e->lru_prev = NULL;
+	e->lru_next = outnet->ssl_session_first;
+	if(outnet->ssl_session_first)
+		outnet->ssl_session_first->lru_prev = e;
+	else	outnet->ssl_session_last = e;
+	outnet->ssl_session_first = e;
+}
+
+/** delete ssl session entry, it must be removed from the tree */
+static void
+ssl_session_entry_delete(struct ssl_session_entry* e)
+{
+#ifdef HAVE_SSL
+	SSL_SESSION_free((SSL_SESSION*)e->session);
+#endif
+	free(e);
+}
+
+/** helper ssl session delete */
+static void
+ssl_session_node_del(rbnode_t* node, void* ATTR_UNUSED(arg))
+{
+	ssl_session_entry_delete((struct ssl_session_entry*)node);
+}
+
+/** set the stored session of the server on the ssl connection, so that
+ * it can be resumed */
+static void
+ssl_session_resume(struct outside_network* outnet, struct waiting_tcp* w,
+	void* ssl)
+{
+#ifdef HAVE_SSL
+	struct ssl_session_entry* e = ssl_session_lookup(outnet, &w->addr,
+		w->addrlen);
+	if(!e)
+		return;
+	if(!SSL_set_session((SSL*)ssl, (SSL_SESSION*)e->session)) {
+		verbose(VERB_ALGO, "could not set ssl session to resume");
+		return;
+	}
+	ssl_session_lru_remove(outnet, e);
+	ssl_session_lru_front(outnet, e);
+#else
+	(void)outnet; (void)w; (void)ssl;
+#endif
+}
+
+/** store the session of the ssl connection to the server, to resume it
+ * on the next connection */
+static void
+ssl_session_store(struct outside_network* outnet, struct waiting_tcp* w,
+	void* ssl)
+{
+#ifdef HAVE_SSL
+	struct ssl_session_entry* e;
+	SSL_SESSION* sess = SSL_get1_session((SSL*)ssl);
+	if(!sess)
+		return;
+	e = ssl_session_lookup(outnet, &w->addr, w->addrlen);
+	if(e) {
+		SSL_SESSION_free((SSL_SESSION*)e->session);
+		e->session = sess;
+		ssl_session_lru_remove(outnet, e);
+		ssl_session_lru_front(outnet, e);
+		return;
+	}
+	if(outnet->ssl_sessions->count >= OUTNET_SSL_SESSIONS_MAX) {
+		/* make space, drop the least recently used entry */
+		e = outnet->ssl_session_last;
+		ssl_session_lru_remove(outnet, e);
+		(void)rbtree_delete(outnet->ssl_sessions, e);
+		ssl_session_entry_delete(e);
+	}
+	e = (struct ssl_session_entry*)calloc(1, sizeof(*e));
+	if(!e) {
+		SSL_SESSION_free(sess);
+		return;
+	}
+	e->node.key = e;
+	memcpy(&e->addr, &w->addr, w->addrlen);
+	e->addrlen = w->addrlen;
+	e->session = sess;
+	(void)rbtree_insert(outnet->ssl_sessions, &e->node);
+	ssl_session_lru_front(outnet, e);
+#else
+	(void)outnet; (void)w; (void)ssl;
+#endif
+}
+
+/**
+ * Check if the data sent with the SYN of a TCP fast open connection was
+ * acknowledged by the server.  If the connection was set up, but the
+ * data had to be sent again after the handshake, the server or a
+ * middlebox does not do fast open, and this is stored in the infra cache
+ * so the next connections to the server do not use it.  Errors and
+ * timeouts of the connection itself are not held against fast open.
+ * @param pend: the tcp connection, with the query, fd still open.
+ */
+static void
+outnet_tcp_fastopen_check(struct pending_tcp* pend)
+{
+#if defined(TCP_FASTOPEN_CONNECT) && defined(TCP_INFO)
+	struct waiting_tcp* w = pend->query;
+	struct tcp_info ti;
+	socklen_t len = (socklen_t)sizeof(ti);
+	if(!pend->tcp_fastopen || !w || !w->zone || pend->c->fd == -1)
+		return;
+	pend->tcp_fastopen = 0;
+	memset(&ti, 0, sizeof(ti));
+	if(getsockopt(pend->c->fd, IPPROTO_TCP, TCP_INFO, (void*)&ti,
+		&len) == -1) {
+		verbose(VERB_ALGO, "getsockopt(.. TCP_INFO ..) failed: %s",
+			strerror(errno));
+		return;
+	}
+	if(ti.tcpi_state == TCP_SYN_SENT || ti.tcpi_state == TCP_CLOSE ||
+		(ti.tcpi_options & TCPI_OPT_SYN_DATA))
+		return;
+	log_addr(VERB_ALGO, "tcp fast open data not acked by",
+		&w->addr, w->addrlen);
+	if(!infra_tcp_fastopen_fail(w->outnet->infra, &w->addr, w->addrlen,
+		w->zone, w->zonelen, *w->outnet->now_secs))
+		log_err("out of memory caching tcp fast open failure");
+#else
+	(void)pend;
+#endif /* TCP_FASTOPEN_CONNECT and TCP_INFO */
+}
+
 /** use next free buffer to service a tcp query */
 static int
 outnet_tcp_take_into_use(struct waiting_tcp* w, uint8_t* pkt, size_t pkt_len)
@@ -222,7 +392,27 @@ outnet_tcp_take_into_use(struct waiting_tcp* w, uint8_t* pkt, size_t pkt_len)
 		return 0;
 
 	fd_set_nonblock(s);
+	pend->tcp_fastopen = 0;
+#ifdef TCP_FASTOPEN_CONNECT
+	if(w->outnet->tcp_fastopen && (!w->zone || infra_tcp_fastopen_ok(
+		w->outnet->infra, &w->addr, w->addrlen, w->zone, w->zonelen,
+		*w->outnet->now_secs))) {
+		/* the query is sent with the SYN, on the first write, if
+		 * the kernel has a cookie for the server */
+		int on = 1;
+		if(setsockopt(s, IPPROTO_TCP, TCP_FASTOPEN_CONNECT,
+			(void*)&on, (socklen_t)sizeof(on)) == 0)
+			pend->tcp_fastopen = 1;
+		else	verbose(VERB_ALGO, "setsockopt(.. TCP_FASTOPEN_CONNECT "
+			"..) failed: %s", strerror(errno));
+	}
+#endif /* TCP_FASTOPEN_CONNECT */
 	if(connect(s, (struct sockaddr*)&w->addr, w->addrlen) == -1) {
+		/* with fast open the connect is deferred until the first
+		 * write when the kernel has a cookie for the server, and
+		 * then returns success; without a cookie it connects as
+		 * usual and no data goes with the SYN */
+		pend->tcp_fastopen = 0;
 #ifndef USE_WINSOCK
 #ifdef EINPROGRESS
 		if(errno != EINPROGRESS) {
@@ -253,6 +443,7 @@ outnet_tcp_take_into_use(struct waiting_tcp* w, uint8_t* pkt, size_t pkt_len)
 #ifdef USE_WINSOCK
 		comm_point_tcp_win_bio_cb(pend->c, pend->c->ssl);
 #endif
+		ssl_session_resume(w->outnet, w, pend->c->ssl);
 		pend->c->ssl_shake_state = comm_ssl_shake_write;
 	}
 	w->pkt = NULL;
@@ -331,8 +522,12 @@ outnet_tcp_cb(struct comm_point* c, void* arg, int error,
 				"outnettcp: bad ID in reply, from:",
 				&pend->query->addr, pend->query->addrlen);
 			error = NETEVENT_CLOSED;
+		} else if(c->ssl) {
+			/* keep the session, to resume it next time */
+			ssl_session_store(outnet, pend->query, c->ssl);
 		}
 	}
+	outnet_tcp_fastopen_check(pend);
 	fptr_ok(fptr_whitelist_pending_tcp(pend->query->cb));
 	(void)(*pend->query->cb)(c, pend->query->cb_arg, error, reply_info);
 	decomission_pending_tcp(outnet, pend);
@@ -588,7 +783,7 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 	struct ub_randstate* rnd, int use_caps_for_id, int* availports, 
 	int numavailports, size_t unwanted_threshold,
 	void (*unwanted_action)(void*), void* unwanted_param, int do_udp,
-	void* sslctx, int delayclose)
+	void* sslctx, int delayclose, int tcp_fastopen)
 {
 	struct outside_network* outnet = (struct outside_network*)
 		calloc(1, sizeof(struct outside_network));
@@ -603,6 +798,7 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 	outnet->infra = infra;
 	outnet->rnd = rnd;
 	outnet->sslctx = sslctx;
+	outnet->tcp_fastopen = tcp_fastopen;
 	outnet->svcd_overhead = 0;
 	outnet->want_to_quit = 0;
 	outnet->unwanted_threshold = unwanted_threshold;
@@ -646,6 +842,7 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 	if(	!(outnet->udp_buff = sldns_buffer_new(bufsize)) ||
 		!(outnet->pending = rbtree_create(pending_cmp)) ||
 		!(outnet->serviced = rbtree_create(serviced_cmp)) ||
+		!(outnet->ssl_sessions = rbtree_create(ssl_session_cmp)) ||
 		!create_pending_tcp(outnet, bufsize)) {
 		log_err("malloc failed");
 		outside_network_delete(outnet);
@@ -764,6 +961,11 @@ outside_network_delete(struct outside_network* outnet)
 		traverse_postorder(outnet->serviced, serviced_node_del, NULL);
 		free(outnet->serviced);
 	}
+	if(outnet->ssl_sessions) {
+		traverse_postorder(outnet->ssl_sessions, ssl_session_node_del,
+			NULL);
+		free(outnet->ssl_sessions);
+	}
 	if(outnet->udp_buff)
 		sldns_buffer_free(outnet->udp_buff);
 	if(outnet->unused_fds) {
@@ -1100,6 +1302,7 @@ outnet_tcptimer(void* arg)
 	} else {
 		/* it was in use */
 		struct pending_tcp* pend=(struct pending_tcp*)w->next_waiting;
+		outnet_tcp_fastopen_check(pend);
 		comm_point_close(pend->c);
 		pend->query = NULL;
 		pend->next_free = outnet->tcp_free;
@@ -1116,7 +1319,8 @@ outnet_tcptimer(void* arg)
 struct waiting_tcp* 
 pending_tcp_query(struct outside_network* outnet, sldns_buffer* packet, 
 	struct sockaddr_storage* addr, socklen_t addrlen, int timeout,
-	comm_point_callback_t* callback, void* callback_arg, int ssl_upstream)
+	comm_point_callback_t* callback, void* callback_arg, int ssl_upstream,
+	uint8_t* zone, size_t zonelen)
 {
 	struct pending_tcp* pend = outnet->tcp_free;
 	struct waiting_tcp* w;
@@ -1142,6 +1346,8 @@ pending_tcp_query(struct outside_network* outnet, sldns_buffer* packet,
 	w->cb = callback;
 	w->cb_arg = callback_arg;
 	w->ssl_upstream = ssl_upstream;
+	w->zone = zone;
+	w->zonelen = zonelen;
 #ifndef S_SPLINT_S
 	tv.tv_sec = timeout;
 	tv.tv_usec = 0;
@@ -1363,6 +1569,7 @@ serviced_encode(struct serviced_query* sq, sldns_buffer* buff, int with_edns)
 		edns.edns_present = 1;
 		edns.ext_rcode = 0;
 		edns.edns_version = EDNS_ADVERTISED_VERSION;
+		edns.opt_list = NULL;
 		if(sq->status == serviced_query_UDP_EDNS_FRAG) {
 			if(addr_is_ip6(&sq->addr, sq->addrlen)) {
 				if(EDNS_FRAG_SIZE_IP6 < EDNS_ADVERTISED_SIZE)
@@ -1641,7 +1848,7 @@ serviced_tcp_initiate(struct outside_network* outnet,
 	sq->last_sent_time = *sq->outnet->now_tv;
 	sq->pending = pending_tcp_query(outnet, buff, &sq->addr,
 		sq->addrlen, TCP_AUTH_QUERY_TIMEOUT, serviced_tcp_callback, 
-		sq, sq->ssl_upstream);
+		sq, sq->ssl_upstream, sq->zone, sq->zonelen);
 	if(!sq->pending) {
 		/* delete from tree so that a retry by above layer does not
 		 * clash with this entry */
@@ -1667,7 +1874,7 @@ serviced_tcp_send(struct serviced_query* sq, sldns_buffer* buff)
 	sq->last_sent_time = *sq->outnet->now_tv;
 	sq->pending = pending_tcp_query(sq->outnet, buff, &sq->addr,
 		sq->addrlen, TCP_AUTH_QUERY_TIMEOUT, serviced_tcp_callback, 
-		sq, sq->ssl_upstream);
+		sq, sq->ssl_upstream, sq->zone, sq->zonelen);
 	return sq->pending != NULL;
 }
 
@@ -1985,6 +2192,8 @@ size_t outnet_get_mem(struct outside_network* outnet)
 		outnet->pending->count;
 	s += sizeof(*outnet->serviced);
 	s += outnet->svcd_overhead;
+	s += sizeof(*outnet->ssl_sessions);
+	s += sizeof(struct ssl_session_entry) * outnet->ssl_sessions->count;
 	RBTREE_FOR(sq, struct serviced_query*, outnet->serviced) {
 		s += sizeof(*sq) + sq->qbuflen;
 		for(sb = sq->cblist; sb; sb = sb->next)
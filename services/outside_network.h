@@ -56,6 +56,9 @@ struct port_comm;
 struct port_if;
 struct sldns_buffer;
 
+/** max number of ssl sessions of upstream servers kept per thread */
+#define OUTNET_SSL_SESSIONS_MAX 64
+
 /**
  * Send queries to outside servers and wait for answers from servers.
  * Contains answer-listen sockets.
@@ -125,6 +128,15 @@ struct outside_network {
 	struct ub_randstate* rnd;
 	/** ssl context to create ssl wrapped TCP with DNS connections */
 	void* sslctx;
+	/** if TCP fast open is tried for outgoing TCP connections */
+	int tcp_fastopen;
+	/** ssl sessions of upstream servers, to resume them on the next
+	 * connection.  Sorted by addr, of struct ssl_session_entry. */
+	rbtree_t* ssl_sessions;
+	/** most recently used ssl session, start of the lru list */
+	struct ssl_session_entry* ssl_session_first;
+	/** least recently used ssl session, it is dropped first */
+	struct ssl_session_entry* ssl_session_last;
 
 	/**
 	 * Array of tcp pending used for outgoing TCP connections.
@@ -143,6 +155,25 @@ struct outside_network {
 	struct waiting_tcp* tcp_wait_last;
 };
 
+/**
+ * SSL session of an upstream server, kept to resume the session on the
+ * next connection to that server without a full handshake.
+ */
+struct ssl_session_entry {
+	/** redblacktree entry, key is the ssl_session_entry (addr). */
+	rbnode_t node;
+	/** address of the upstream server */
+	struct sockaddr_storage addr;
+	/** length of addr */
+	socklen_t addrlen;
+	/** the SSL_SESSION, owned */
+	void* session;
+	/** previous in the lru list, more recently used */
+	struct ssl_session_entry* lru_prev;
+	/** next in the lru list, less recently used */
+	struct ssl_session_entry* lru_next;
+};
+
 /**
  * Outgoing interface. Ports available and currently used are tracked
  * per interface
@@ -234,6 +265,8 @@ struct pending_tcp {
 	struct comm_point* c;
 	/** the query being serviced, NULL if the pending_tcp is unused. */
 	struct waiting_tcp* query;
+	/** if the query is sent with the SYN, with TCP fast open */
+	int tcp_fastopen;
 };
 
 /**
@@ -269,6 +302,11 @@ struct waiting_tcp {
 	void* cb_arg;
 	/** if it uses ssl upstream */
 	int ssl_upstream;
+	/** zone name of the server, for the infra cache, or NULL.
+	 * Not owned, the caller keeps it while the query is pending. */
+	uint8_t* zone;
+	/** length of zone name */
+	size_t zonelen;
 };
 
 /**
@@ -383,6 +421,7 @@ struct serviced_query {
  * @param sslctx: context to create outgoing connections with (if enabled).
  * @param delayclose: if not 0, udp sockets are delayed before timeout closure.
  * 	msec to wait on timeouted udp sockets.
+ * @param tcp_fastopen: if true, try TCP fast open for outgoing TCP.
  * @return: the new structure (with no pending answers) or NULL on error.
  */
 struct outside_network* outside_network_create(struct comm_base* base,
@@ -391,7 +430,7 @@ struct outside_network* outside_network_create(struct comm_base* base,
 	struct ub_randstate* rnd, int use_caps_for_id, int* availports, 
 	int numavailports, size_t unwanted_threshold,
 	void (*unwanted_action)(void*), void* unwanted_param, int do_udp,
-	void* sslctx, int delayclose);
+	void* sslctx, int delayclose, int tcp_fastopen);
 
 /**
  * Delete outside_network structure.
@@ -435,12 +474,16 @@ struct pending* pending_udp_query(struct outside_network* outnet,
  * @param callback: function to call on error, timeout or reply.
  * @param callback_arg: user argument for callback function.
  * @param ssl_upstream: if the tcp connection must use SSL.
+ * @param zone: zone name of the server, to look up in the infra cache if
+ *    TCP fast open works for it.  NULL if not known.  Must stay valid
+ *    while the query is pending.
+ * @param zonelen: length of zone.
  * @return: false on error for malloc or socket. Else the pending TCP object.
  */
 struct waiting_tcp* pending_tcp_query(struct outside_network* outnet, 
 	struct sldns_buffer* packet, struct sockaddr_storage* addr, 
 	socklen_t addrlen, int timeout, comm_point_callback_t* callback, 
-	void* callback_arg, int ssl_upstream);
+	void* callback_arg, int ssl_upstream, uint8_t* zone, size_t zonelen);
 
 /**
  * Delete pending answer.
@@ -542,4 +585,7 @@ int pending_cmp(const void* key1, const void* key2);
 /** compare function of serviced query rbtree */
 int serviced_cmp(const void* key1, const void* key2);
 
+/** compare function of ssl session rbtree */
+int ssl_session_cmp(const void* key1, const void* key2);
+
 #endif /* OUTSIDE_NETWORK_H */
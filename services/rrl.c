@@ -0,0 +1,163 @@
+/*
+ * services/rrl.c - response rate limiting for client queries.
+ *
+ * Copyright (c) 2014, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains response rate limiting (RRL) for queries from clients.
+ */
+#include "config.h"
+#include "services/rrl.h"
+#include "util/data/msgreply.h"
+#include "util/data/dname.h"
+#include "util/storage/lookup3.h"
+#include "util/storage/keyhash.h"
+#include "util/net_help.h"
+#include "util/log.h"
+
+struct rrl*
+rrl_create(size_t width, int ratelimit, int slip, int ipv4_prefix,
+	int ipv6_prefix, uint32_t seed)
+{
+	struct rrl* rrl = (struct rrl*)calloc(1, sizeof(*rrl));
+	size_t w = 1;
+	if(!rrl)
+		return NULL;
+	while(w < width)
+		w <<= 1;
+	rrl->width = w;
+	rrl->counts = (uint32_t*)calloc(RRL_DEPTH*w, sizeof(uint32_t));
+	if(!rrl->counts) {
+		free(rrl);
+		return NULL;
+	}
+	rrl->ratelimit = ratelimit;
+	rrl->interval = RRL_TICKS/(ratelimit>0?(uint32_t)ratelimit:1);
+	if(rrl->interval == 0)
+		rrl->interval = 1;
+	rrl->burst = (uint32_t)ratelimit * rrl->interval;
+	rrl->slip = slip;
+	rrl->ipv4_prefix = ipv4_prefix;
+	rrl->ipv6_prefix = ipv6_prefix;
+	rrl->seed = seed;
+	return rrl;
+}
+
+void
+rrl_delete(struct rrl* rrl)
+{
+	if(!rrl)
+		return;
+	free(rrl->counts);
+	free(rrl);
+}
+
+/** hash the client prefix and the query */
+static hashvalue_t
+rrl_hash(struct rrl* rrl, struct sockaddr_storage* addr, socklen_t addrlen,
+	struct query_info* qinfo)
+{
+	struct sockaddr_storage a;
+	uint16_t tc[2];
+	hashvalue_t h;
+	memmove(&a, addr, addrlen);
+	if(addr_is_ip6(&a, addrlen)) {
+		addr_mask(&a, addrlen, rrl->ipv6_prefix);
+		h = keyhash(&((struct sockaddr_in6*)&a)->sin6_addr,
+			sizeof(struct in6_addr), rrl->seed);
+	} else {
+		addr_mask(&a, addrlen, rrl->ipv4_prefix);
+		h = keyhash(&((struct sockaddr_in*)&a)->sin_addr,
+			sizeof(struct in_addr), rrl->seed);
+	}
+	tc[0] = qinfo->qtype;
+	tc[1] = qinfo->qclass;
+	h = keyhash(tc, sizeof(tc), h);
+	return dname_query_hash(qinfo->qname, h);
+}
+
+/** the time in ticks, it wraps around */
+static uint32_t
+rrl_ticks(struct timeval* now)
+{
+	return (uint32_t)((uint64_t)now->tv_sec*RRL_TICKS +
+		((uint64_t)now->tv_usec*RRL_TICKS)/1000000);
+}
+
+enum rrl_action
+rrl_check(struct rrl* rrl, struct sockaddr_storage* addr, socklen_t addrlen,
+	struct query_info* qinfo, struct timeval* now)
+{
+	hashvalue_t h1, h2;
+	uint32_t* c[RRL_DEPTH];
+	uint32_t lvl[RRL_DEPTH];
+	uint32_t t = rrl_ticks(now), min = rrl->burst;
+	int i;
+	/* the rows are indexed with h1 + i*h2, from two hashes */
+	h1 = rrl_hash(rrl, addr, addrlen, qinfo);
+	h2 = hashlittle(&h1, sizeof(h1), rrl->seed) | 1;
+	for(i=0; i<RRL_DEPTH; i++) {
+		c[i] = &rrl->counts[i*rrl->width +
+			((h1 + (hashvalue_t)i*h2) & (rrl->width-1))];
+		/* the fill of the bucket.  A bucket that is empty since
+		 * the past wraps to a large value, and holds nothing */
+		lvl[i] = *c[i] - t;
+		if(lvl[i] > rrl->burst)
+			lvl[i] = 0;
+		if(lvl[i] < min)
+			min = lvl[i];
+	}
+	if(min + rrl->interval <= rrl->burst) {
+		/* conservative update, only the lowest counters go up, this
+		 * keeps the overestimate from collisions small */
+		min += rrl->interval;
+		for(i=0; i<RRL_DEPTH; i++)
+			if(lvl[i] < min)
+				*c[i] = t + min;
+		return rrl_pass;
+	}
+	rrl->over_count++;
+	if(rrl->slip && rrl->over_count%(unsigned)rrl->slip == 0)
+		return rrl_slip;
+	return rrl_drop;
+}
+
+size_t
+rrl_get_mem(struct rrl* rrl)
+{
+	if(!rrl)
+		return 0;
+	return sizeof(*rrl) + RRL_DEPTH*rrl->width*sizeof(uint32_t);
+}
@@ -0,0 +1,138 @@
+/*
+ * services/rrl.h - response rate limiting for client queries.
+ *
+ * Copyright (c) 2014, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains response rate limiting (RRL) for queries from clients.
+ * Queries are counted per client prefix and per query (name, type, class)
+ * in a fixed size count-min sketch.  Every counter is a leaky bucket: it
+ * holds the time at which it is empty again, every answered query adds
+ * the interval between answers at the ratelimit, so the counts drain
+ * continuously instead of being reset every second.  When the bucket is
+ * full, the query is dropped or gets a truncated answer (slip), so that
+ * spoofed sources can not use the server as an amplifier.
+ *
+ * The sketch is per thread and needs no locks.  Spoofed queries for one
+ * victim are spread over the threads, so the victim gets up to the
+ * ratelimit times the number of threads answers per second.
+ */
+
+#ifndef SERVICES_RRL_H
+#define SERVICES_RRL_H
+struct query_info;
+
+/** number of rows (hash functions) in the count-min sketch */
+#define RRL_DEPTH 4
+/** the time in the sketch is in 1/RRL_TICKS parts of a second */
+#define RRL_TICKS 65536
+
+/**
+ * Response rate limit state.
+ */
+struct rrl {
+	/** number of counters per row, a power of two */
+	size_t width;
+	/** counters, RRL_DEPTH rows of width counters.  Each is the time,
+	 * in ticks, at which its bucket is empty, it wraps around. */
+	uint32_t* counts;
+	/** number of responses allowed per second per client and query */
+	int ratelimit;
+	/** the ticks between answers at the ratelimit */
+	uint32_t interval;
+	/** the ticks a full bucket holds, ratelimit answers */
+	uint32_t burst;
+	/** every slip-th query over the limit gets a TC answer, 0 drops all */
+	int slip;
+	/** number of queries over the limit, to pick which ones slip */
+	unsigned int over_count;
+	/** prefix length to group IPv4 clients */
+	int ipv4_prefix;
+	/** prefix length to group IPv6 clients */
+	int ipv6_prefix;
+	/** random seed for the hash, so colliding keys cannot be picked */
+	uint32_t seed;
+};
+
+/** what to do with a query */
+enum rrl_action {
+	/** under the limit, answer normally */
+	rrl_pass = 0,
+	/** over the limit, drop the query */
+	rrl_drop,
+	/** over the limit, answer with TC bit so a real client uses TCP */
+	rrl_slip
+};
+
+/**
+ * Create response rate limit state.
+ * @param width: number of counters per row, rounded up to a power of two.
+ * @param ratelimit: responses per second per client prefix and query.
+ * @param slip: every slip-th query over the limit gets a TC answer.
+ * 	0 drops all of them.
+ * @param ipv4_prefix: prefix length for IPv4 clients.
+ * @param ipv6_prefix: prefix length for IPv6 clients.
+ * @param seed: random seed for the hash.
+ * @return new state or NULL on malloc failure.
+ */
+struct rrl* rrl_create(size_t width, int ratelimit, int slip,
+	int ipv4_prefix, int ipv6_prefix, uint32_t seed);
+
+/**
+ * Delete response rate limit state.
+ * @param rrl: to delete.
+ */
+void rrl_delete(struct rrl* rrl);
+
+/**
+ * Count a query and see if it is over the rate limit.
+ * @param rrl: rate limit state.
+ * @param addr: address of the client.
+ * @param addrlen: length of addr.
+ * @param qinfo: the query.
+ * @param now: current time.
+ * @return action to take for the query.
+ */
+enum rrl_action rrl_check(struct rrl* rrl, struct sockaddr_storage* addr,
+	socklen_t addrlen, struct query_info* qinfo, struct timeval* now);
+
+/**
+ * Get memory used by response rate limit state.
+ * @param rrl: the state.
+ * @return number of bytes.
+ */
+size_t rrl_get_mem(struct rrl* rrl);
+
+#endif /* SERVICES_RRL_H */
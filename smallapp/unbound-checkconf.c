@@ -326,6 +326,11 @@ morechecks(struct config_file* cfg, const char* fname)
 		fatal_exit("ip4 and ip6 are both disabled, pointless");
 	if(!cfg->do_udp && !cfg->do_tcp)
 		fatal_exit("udp and tcp are both disabled, pointless");
+	if(cfg->rrl_ratelimit < 0 || cfg->rrl_slip < 0)
+		fatal_exit("rrl-ratelimit or rrl-slip value < 0");
+	if(cfg->rrl_ipv4_prefix < 0 || cfg->rrl_ipv4_prefix > 32 ||
+		cfg->rrl_ipv6_prefix < 0 || cfg->rrl_ipv6_prefix > 128)
+		fatal_exit("rrl-ipv4-prefix or rrl-ipv6-prefix out of range");
 	if(cfg->edns_buffer_size > cfg->msg_buffer_size)
 		fatal_exit("edns-buffer-size larger than msg-buffer-size, "
 			"answers will not fit in processing buffer");
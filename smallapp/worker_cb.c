@@ -197,6 +197,16 @@ void worker_stat_timer_cb(void* ATTR_UNUSED(arg))
 	log_assert(0);
 }
 
+void worker_expiry_timer_cb(void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
+void worker_hot_timer_cb(void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 void worker_probe_timer_cb(void* ATTR_UNUSED(arg))
 {
 	log_assert(0);
@@ -0,0 +1,245 @@
+/*
+ * testcode/cachesim.c - replay a query trace against the cache policies.
+ *
+ * Copyright (c) 2014, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * \file
+ *
+ * This program replays a trace of query names against a slabhash that
+ * is used like the msg and rrset caches: a lookup, and an insert on a
+ * miss.  It prints the hit rate with the plain LRU and with the TinyLFU
+ * admission filter.  Without a trace file, it generates a Zipf popularity
+ * workload that is mixed with a flood of random subdomain names, that are
+ * all used once.
+ */
+#include "config.h"
+#include "util/log.h"
+#include "util/storage/slabhash.h"
+#include "util/storage/lookup3.h"
+#include <math.h>
+
+/** an access in the trace */
+struct access {
+	/** id of the key */
+	int id;
+	/** hash of the key */
+	hashvalue_t hash;
+};
+
+/** print usage and exit */
+static void
+usage()
+{
+	printf("usage:	cachesim [options] [tracefile]\n");
+	printf("replays the names in the tracefile, one per line, or a\n");
+	printf("generated workload against the cache and prints hit rates.\n");
+	printf("-c num	cache size in entries, default 10000\n");
+	printf("-n num	generated number of queries, default 1000000\n");
+	printf("-k num	generated number of popular names, default 100000\n");
+	printf("-s num	generated Zipf exponent in percent, default 90\n");
+	printf("-r num	generated percentage of random names, default 30\n");
+	exit(1);
+}
+
+/** set the access for a name */
+static void
+set_access(struct access* a, const char* name, size_t len)
+{
+	a->id = (int)hashlittle(name, len, 0x5ca1ab1e);
+	a->hash = hashlittle(name, len, 0);
+}
+
+/** append access to the trace, grow array */
+static void
+add_access(struct access** trace, size_t* num, size_t* max,
+	const char* name, size_t len)
+{
+	if(*num == *max) {
+		*max = (*max)?(*max)*2:1024;
+		*trace = (struct access*)realloc(*trace, 
+			(*max)*sizeof(struct access));
+		if(!*trace)
+			fatal_exit("out of memory");
+	}
+	set_access(&(*trace)[(*num)++], name, len);
+}
+
+/** read trace file */
+static struct access*
+read_trace(const char* fname, size_t* num)
+{
+	struct access* trace = NULL;
+	size_t max = 0;
+	char line[1024];
+	FILE* in = fopen(fname, "r");
+	if(!in)
+		fatal_exit("could not open %s: %s", fname, strerror(errno));
+	*num = 0;
+	while(fgets(line, (int)sizeof(line), in)) {
+		size_t len = strlen(line);
+		while(len > 0 && (line[len-1] == '\n' || line[len-1] == '\r'))
+			line[--len] = 0;
+		if(len == 0 || line[0] == '#')
+			continue;
+		add_access(&trace, num, &max, line, len);
+	}
+	fclose(in);
+	return trace;
+}
+
+/** generate trace of Zipf popular names and random names */
+static struct access*
+gen_trace(size_t n, int k, double s, int rnd, size_t* num)
+{
+	struct access* trace = NULL;
+	size_t max = 0, i;
+	double* cdf = (double*)malloc(sizeof(double)*(size_t)k);
+	double sum = 0;
+	char name[64];
+	int j;
+	if(!cdf)
+		fatal_exit("out of memory");
+	for(j=0; j<k; j++) {
+		sum += 1.0/pow((double)(j+1), s);
+		cdf[j] = sum;
+	}
+	*num = 0;
+	for(i=0; i<n; i++) {
+		if(random()%100 < rnd) {
+			snprintf(name, sizeof(name), "r%ldx%u.flood.example.",
+				random(), (unsigned)i);
+		} else {
+			/* binary search for the rank */
+			double u = (double)random()/(double)RAND_MAX*sum;
+			int lo = 0, hi = k-1;
+			while(lo < hi) {
+				int mid = (lo+hi)/2;
+				if(cdf[mid] < u)
+					lo = mid+1;
+				else	hi = mid;
+			}
+			snprintf(name, sizeof(name), "www%d.example.", lo);
+		}
+		add_access(&trace, num, &max, name, strlen(name));
+	}
+	free(cdf);
+	return trace;
+}
+
+/** replay the trace, returns the number of hits */
+static size_t
+replay(struct access* trace, size_t num, size_t entries, int admission)
+{
+	size_t i, hits = 0;
+	struct slabhash* table = slabhash_create(HASH_DEFAULT_SLABS,
+		HASH_DEFAULT_STARTARRAY, entries*test_slabhash_sizefunc(NULL,
+		NULL), test_slabhash_sizefunc, test_slabhash_compfunc,
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	if(!table)
+		fatal_exit("out of memory");
+	if(admission && !slabhash_set_admission(table, 1, 
+		(uint32_t)random()))
+		fatal_exit("out of memory");
+	for(i=0; i<num; i++) {
+		struct slabhash_testkey* k = (struct slabhash_testkey*)
+			calloc(1, sizeof(*k));
+		struct slabhash_testdata* d;
+		struct lruhash_entry* e;
+		if(!k)
+			fatal_exit("out of memory");
+		k->id = trace[i].id;
+		k->entry.hash = trace[i].hash;
+		k->entry.key = k;
+		if((e = slabhash_lookup(table, trace[i].hash, k, 0))) {
+			lock_rw_unlock(&e->lock);
+			free(k);
+			hits++;
+			continue;
+		}
+		d = (struct slabhash_testdata*)calloc(1, sizeof(*d));
+		if(!d)
+			fatal_exit("out of memory");
+		lock_rw_init(&k->entry.lock);
+		k->entry.data = d;
+		slabhash_insert(table, trace[i].hash, &k->entry, d, NULL);
+	}
+	slabhash_delete(table);
+	return hits;
+}
+
+/** getopt global, in case header files fail to declare it. */
+extern int optind;
+/** getopt global, in case header files fail to declare it. */
+extern char* optarg;
+
+/** main program */
+int main(int argc, char* argv[])
+{
+	size_t entries = 10000, n = 1000000, num, hits;
+	int k = 100000, s = 90, rnd = 30, c;
+	struct access* trace;
+	while( (c=getopt(argc, argv, "c:n:k:s:r:h")) != -1) {
+		switch(c) {
+		case 'c': entries = (size_t)atoi(optarg); break;
+		case 'n': n = (size_t)atoi(optarg); break;
+		case 'k': k = atoi(optarg); break;
+		case 's': s = atoi(optarg); break;
+		case 'r': rnd = atoi(optarg); break;
+		case 'h':
+		case '?':
+		default:
+			usage();
+		}
+	}
+	argc -= optind;
+	argv += optind;
+	if(argc > 1 || entries == 0 || k <= 0 || s < 0)
+		usage();
+	log_init(NULL, 0, NULL);
+	srandom(1234);
+	if(argc == 1)
+		trace = read_trace(argv[0], &num);
+	else	trace = gen_trace(n, k, (double)s/100., rnd, &num);
+	if(num == 0)
+		fatal_exit("empty trace");
+	printf("%u queries, cache of %u entries\n", (unsigned)num,
+		(unsigned)entries);
+	hits = replay(trace, num, entries, 0);
+	printf("lru      hit rate %6.2f%%\n", (double)hits*100./(double)num);
+	hits = replay(trace, num, entries, 1);
+	printf("tinylfu  hit rate %6.2f%%\n", (double)hits*100./(double)num);
+	free(trace);
+	return 0;
+}
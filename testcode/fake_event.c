@@ -734,7 +734,7 @@ run_scenario(struct replay_runtime* runtime)
 struct listen_dnsport* 
 listen_create(struct comm_base* base, struct listen_port* ATTR_UNUSED(ports),
 	size_t bufsize, int ATTR_UNUSED(tcp_accept_count),
-	void* ATTR_UNUSED(sslctx), comm_point_callback_t* cb, void* cb_arg)
+	int ATTR_UNUSED(tcp_idle_timeout), void* ATTR_UNUSED(sslctx), comm_point_callback_t* cb, void* cb_arg)
 {
 	struct replay_runtime* runtime = (struct replay_runtime*)base;
 	struct listen_dnsport* l= calloc(1, sizeof(struct listen_dnsport));
@@ -901,7 +901,7 @@ outside_network_create(struct comm_base* base, size_t bufsize,
 	int ATTR_UNUSED(numavailports), size_t ATTR_UNUSED(unwanted_threshold),
 	void (*unwanted_action)(void*), void* ATTR_UNUSED(unwanted_param),
 	int ATTR_UNUSED(do_udp), void* ATTR_UNUSED(sslctx),
-	int ATTR_UNUSED(delayclose))
+	int ATTR_UNUSED(delayclose), int ATTR_UNUSED(tcp_fastopen))
 {
 	struct replay_runtime* runtime = (struct replay_runtime*)base;
 	struct outside_network* outnet =  calloc(1, 
@@ -987,7 +987,8 @@ struct waiting_tcp*
 pending_tcp_query(struct outside_network* outnet, sldns_buffer* packet,
 	struct sockaddr_storage* addr, socklen_t addrlen, int timeout,
 	comm_point_callback_t* callback, void* callback_arg,
-	int ATTR_UNUSED(ssl_upstream))
+	int ATTR_UNUSED(ssl_upstream), uint8_t* ATTR_UNUSED(zone),
+	size_t ATTR_UNUSED(zonelen))
 {
 	struct replay_runtime* runtime = (struct replay_runtime*)outnet->base;
 	struct fake_pending* pend = (struct fake_pending*)calloc(1,
@@ -1075,6 +1076,7 @@ struct serviced_query* outnet_serviced_query(struct outside_network* outnet,
 		edns.edns_version = EDNS_ADVERTISED_VERSION;
 		edns.udp_size = EDNS_ADVERTISED_SIZE;
 		edns.bits = 0;
+		edns.opt_list = NULL;
 		if(dnssec)
 			edns.bits = EDNS_DO;
 		attach_edns_record(pend->buffer, &edns);
@@ -1203,6 +1205,11 @@ size_t comm_point_get_mem(struct comm_point* ATTR_UNUSED(c))
 	return 0;
 }
 
+int comm_point_tcp_idle_timeout(struct comm_point* ATTR_UNUSED(c))
+{
+	return 0;
+}
+
 size_t serviced_get_mem(struct serviced_query* ATTR_UNUSED(c))
 {
 	return 0;
@@ -1322,6 +1329,12 @@ int serviced_cmp(const void* ATTR_UNUSED(a), const void* ATTR_UNUSED(b))
 	return 0;
 }
 
+int ssl_session_cmp(const void* ATTR_UNUSED(a), const void* ATTR_UNUSED(b))
+{
+	log_assert(0);
+	return 0;
+}
+
 /* timers in testbound for autotrust. statistics tested in tpkg. */
 struct comm_timer* comm_timer_create(struct comm_base* base, 
 	void (*cb)(void*), void* cb_arg)
@@ -1391,6 +1404,15 @@ struct event_base* comm_base_internal(struct comm_base* ATTR_UNUSED(b))
 	return NULL;
 }
 
+void comm_base_ssl_stats(struct comm_base* ATTR_UNUSED(b),
+	struct comm_ssl_stats* service, struct comm_ssl_stats* upstream,
+	int ATTR_UNUSED(reset))
+{
+	/* no ssl in testbound */
+	memset(service, 0, sizeof(*service));
+	memset(upstream, 0, sizeof(*upstream));
+}
+
 void daemon_remote_exec(struct worker* ATTR_UNUSED(worker))
 {
 }
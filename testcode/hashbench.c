@@ -0,0 +1,275 @@
+/*
+ * testcode/hashbench.c - measure the hash function for the hash tables.
+ *
+ * Copyright (c) 2014, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This program measures the speed of the hash functions that keyhash can
+ * use, for keys of several lengths and for the query hash of the message
+ * cache.  Then it makes names that all fall in the same hash bin with the
+ * lookup3 hash, that has a known initial value, like an attacker could,
+ * and prints how these names spread over the bins with each hash.
+ */
+#include "config.h"
+#include "util/log.h"
+#include "util/data/msgreply.h"
+#include "util/storage/keyhash.h"
+#include "util/storage/lookup3.h"
+#include "ldns/rrdef.h"
+#include <sys/time.h>
+#include <ctype.h>
+
+/** number of hash bins, like a new lruhash */
+#define BENCH_BINS 1024
+/** number of colliding names made */
+#define BENCH_NAMES 1000
+
+/** print usage and exit */
+static void
+usage()
+{
+	printf("usage:	hashbench [-n num]\n");
+	printf("measures the hash functions for the hash tables, and their\n");
+	printf("bin lengths for names that collide with lookup3.\n");
+	printf("-n num	number of colliding names, default %d\n", BENCH_NAMES);
+	exit(1);
+}
+
+/** the time since start in msec */
+static double
+elapsed(struct timeval* start)
+{
+	struct timeval end;
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	return (double)(end.tv_sec - start->tv_sec)*1000. +
+		((double)end.tv_usec - (double)start->tv_usec)/1000.;
+}
+
+/** measure the hash of keys of a length */
+static void
+bench_len(size_t len)
+{
+	uint8_t buf[256];
+	struct timeval start;
+	uint32_t h = 0;
+	double dt[2];
+	size_t i, n = 2000000;
+	int f;
+	for(i=0; i<sizeof(buf); i++)
+		buf[i] = (uint8_t)i;
+	for(f=0; f<2; f++) {
+		keyhash_set_func(f==0?keyhash_lookup3:keyhash_siphash);
+		if(gettimeofday(&start, NULL) < 0)
+			fatal_exit("gettimeofday: %s", strerror(errno));
+		for(i=0; i<n; i++)
+			h = keyhash(buf, len, h);
+		dt[f] = elapsed(&start);
+	}
+	printf("%3d bytes: lookup3 %6.1f ns %7.1f MB/s, siphash-1-3 %6.1f ns "
+		"%7.1f MB/s (%x)\n", (int)len, dt[0]*1000000./(double)n,
+		(double)(n*len)/(dt[0]*1000.), dt[1]*1000000./(double)n,
+		(double)(n*len)/(dt[1]*1000.), (unsigned)h);
+}
+
+/** the query hash as it was, lookup3 label by label */
+static hashvalue_t
+old_query_hash(struct query_info* q)
+{
+	uint8_t labuf[LDNS_MAX_LABELLEN+1];
+	uint8_t* d = q->qname;
+	hashvalue_t h = 0xab;
+	int i;
+	h = hashlittle(&q->qtype, sizeof(q->qtype), h);
+	h = hashlittle(&q->qclass, sizeof(q->qclass), h);
+	while(*d) {
+		labuf[0] = *d++;
+		for(i=0; i<labuf[0]; i++)
+			labuf[i+1] = (uint8_t)tolower((int)*d++);
+		h = hashlittle(labuf, (size_t)labuf[0]+1, h);
+	}
+	return h;
+}
+
+/** measure the query hash */
+static void
+bench_query(void)
+{
+	struct query_info q;
+	struct timeval start;
+	uint32_t h = 0;
+	double dt[3];
+	size_t i, n = 2000000;
+	q.qname = (uint8_t*)"\003www\007example\003com";
+	q.qname_len = 17;
+	q.qtype = LDNS_RR_TYPE_A;
+	q.qclass = LDNS_RR_CLASS_IN;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<n; i++) {
+		h += old_query_hash(&q);
+		q.qtype ^= (h&1);
+	}
+	dt[0] = elapsed(&start);
+	keyhash_set_func(keyhash_lookup3);
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<n; i++) {
+		h += query_info_hash(&q);
+		q.qtype ^= (h&1);
+	}
+	dt[1] = elapsed(&start);
+	keyhash_set_func(keyhash_siphash);
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<n; i++) {
+		h += query_info_hash(&q);
+		q.qtype ^= (h&1);
+	}
+	dt[2] = elapsed(&start);
+	printf("query hash of www.example.com: per label lookup3 %.1f ns, "
+		"lookup3 %.1f ns, siphash-1-3 %.1f ns (%x)\n",
+		dt[0]*1000000./(double)n, dt[1]*1000000./(double)n,
+		dt[2]*1000000./(double)n, (unsigned)h);
+}
+
+/** make the name with the number in the first label */
+static void
+make_name(struct query_info* q, uint8_t* buf, unsigned x)
+{
+	int i;
+	buf[0] = 8;
+	for(i=0; i<8; i++) {
+		buf[1+i] = (uint8_t)"abcdefghijklmnop"[x&0xf];
+		x >>= 4;
+	}
+	memcpy(buf+9, "\007example\003com", 13);
+	buf[22] = 0;
+	q->qname = buf;
+	q->qname_len = 23;
+	q->qtype = LDNS_RR_TYPE_A;
+	q->qclass = LDNS_RR_CLASS_IN;
+}
+
+/** print the bin lengths for the names with the current hash */
+static void
+bin_lengths(const char* desc, unsigned* names, int num)
+{
+	int bins[BENCH_BINS];
+	struct query_info q;
+	uint8_t buf[32];
+	double probes = 0;
+	int i, max = 0;
+	memset(bins, 0, sizeof(bins));
+	for(i=0; i<num; i++) {
+		make_name(&q, buf, names[i]);
+		bins[query_info_hash(&q)&(BENCH_BINS-1)]++;
+	}
+	for(i=0; i<BENCH_BINS; i++) {
+		if(bins[i] > max)
+			max = bins[i];
+		/* a lookup of every name walks half its bin on average */
+		probes += (double)bins[i]*((double)bins[i]+1.)/2.;
+	}
+	printf("%s: longest bin %d, average compares per lookup %.2f\n",
+		desc, max, probes/(double)num);
+}
+
+/** make names that fall in bin 0 with lookup3, and random names */
+static void
+bench_bins(int num)
+{
+	unsigned* bad = (unsigned*)calloc((size_t)num, sizeof(unsigned));
+	unsigned* good = (unsigned*)calloc((size_t)num, sizeof(unsigned));
+	uint8_t key[KEYHASH_KEY_SIZE];
+	struct query_info q;
+	uint8_t buf[32];
+	unsigned x;
+	int n = 0, i;
+	if(!bad || !good)
+		fatal_exit("out of memory");
+	/* the attacker knows the function and the initial value */
+	keyhash_set_func(keyhash_lookup3);
+	for(x=0; n<num; x++) {
+		make_name(&q, buf, x);
+		if((query_info_hash(&q)&(BENCH_BINS-1)) == 0)
+			bad[n++] = x;
+	}
+	for(i=0; i<num; i++)
+		good[i] = (unsigned)random();
+	printf("%d names in %d bins\n", num, BENCH_BINS);
+	bin_lengths("random names, lookup3", good, num);
+	bin_lengths("crafted names, lookup3", bad, num);
+	/* the key is random, and unknown to the attacker */
+	for(i=0; i<KEYHASH_KEY_SIZE; i++)
+		key[i] = (uint8_t)random();
+	keyhash_set_key(key);
+	keyhash_set_func(keyhash_siphash);
+	bin_lengths("random names, siphash-1-3", good, num);
+	bin_lengths("crafted names, siphash-1-3", bad, num);
+	free(bad);
+	free(good);
+}
+
+/** main program */
+int main(int argc, char* argv[])
+{
+	int c, num = BENCH_NAMES;
+	while((c = getopt(argc, argv, "hn:")) != -1) {
+		switch(c) {
+		case 'n':
+			if((num = atoi(optarg)) <= 0)
+				usage();
+			break;
+		case 'h':
+		default:
+			usage();
+		}
+	}
+	argc -= optind;
+	if(argc != 0)
+		usage();
+	log_init(NULL, 0, NULL);
+	srandom((unsigned)time(NULL) ^ (unsigned)getpid());
+	bench_len(4);
+	bench_len(8);
+	bench_len(16);
+	bench_len(32);
+	bench_len(64);
+	bench_len(255);
+	bench_query();
+	bench_bins(num);
+	return 0;
+}
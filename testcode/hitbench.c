@@ -0,0 +1,380 @@
+/*
+ * testcode/hitbench.c - measure rrset cache hits with several threads.
+ *
+ * Copyright (c) 2014, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This program measures the rate of cache hits on the rrset cache when
+ * several threads answer from it at the same time.  Every answer refers
+ * to the rrset of its own name, and the NS rrset and glue of the zone,
+ * that all answers share.  The rrsets are read with the rrset locks, and
+ * without them, checked with the lock versions.  A writer thread can
+ * update the glue while the readers run.
+ */
+#include "config.h"
+#include "util/log.h"
+#include "util/alloc.h"
+#include "util/locks.h"
+#include "util/regional.h"
+#include "util/data/msgreply.h"
+#include "util/data/msgparse.h"
+#include "util/data/packed_rrset.h"
+#include "util/net_help.h"
+#include "util/config_file.h"
+#include "services/cache/rrset.h"
+#include "ldns/sbuffer.h"
+#include "ldns/str2wire.h"
+#include <sys/time.h>
+
+/** maximum number of threads */
+#define BENCH_MAX_THREADS 32
+/** number of names in the cache */
+#define BENCH_NAMES 1000
+/** the hits every thread does */
+#define BENCH_HITS 1000000
+/** the cache hits read without locks touch the LRU once per this many */
+#define BENCH_TOUCH_SAMPLE 8
+
+#ifndef THREADS_DISABLED
+/** an answer, the rrset references to read */
+struct bench_answer {
+	/** number of references */
+	size_t count;
+	/** sorted references */
+	struct rrset_ref ref[4];
+};
+
+/** the shared state of the benchmark */
+static struct bench {
+	/** the rrset cache */
+	struct rrset_cache* cache;
+	/** super alloc */
+	struct alloc_cache superalloc;
+	/** the answers */
+	struct bench_answer answers[BENCH_NAMES];
+	/** read without locks */
+	int optimistic;
+	/** the writer runs until this is set */
+	volatile int stop;
+} bench;
+
+/** a bench thread */
+struct bench_thr {
+	/** thread number */
+	int num;
+	/** id */
+	ub_thread_t id;
+	/** alloc of the thread */
+	struct alloc_cache alloc;
+	/** scratch region */
+	struct regional* scratch;
+	/** hits that fell back to the locks */
+	size_t fallback;
+	/** checksum of the data that was read */
+	size_t sum;
+};
+
+/** append an rr in text format to the packet */
+static void
+add_rr(sldns_buffer* pkt, const char* str, int question)
+{
+	uint8_t rr[LDNS_RR_BUF_SIZE];
+	size_t len = sizeof(rr), dname_len = 0;
+	int s;
+	if(question)
+		s = sldns_str2wire_rr_question_buf(str, rr, &len, &dname_len,
+			NULL, 0, NULL, 0);
+	else	s = sldns_str2wire_rr_buf(str, rr, &len, &dname_len, 3600,
+			NULL, 0, NULL, 0);
+	if(s != 0)
+		fatal_exit("cannot parse %s: %s", str,
+			sldns_get_errorstr_parse(s));
+	sldns_buffer_write(pkt, rr, len);
+}
+
+/** create the answer packet for the name, with the glue address */
+static void
+make_pkt(sldns_buffer* pkt, int i, int glue)
+{
+	char str[256];
+	sldns_buffer_clear(pkt);
+	sldns_buffer_write_u16(pkt, 0); /* id */
+	sldns_buffer_write_u16(pkt, BIT_QR|BIT_RD|BIT_RA);
+	sldns_buffer_write_u16(pkt, 1); /* qdcount */
+	sldns_buffer_write_u16(pkt, 1); /* ancount */
+	sldns_buffer_write_u16(pkt, 2); /* nscount */
+	sldns_buffer_write_u16(pkt, 2); /* arcount */
+	snprintf(str, sizeof(str), "h%d.example.com. IN A", i);
+	add_rr(pkt, str, 1);
+	snprintf(str, sizeof(str), "h%d.example.com. 3600 IN A 192.0.2.%d", i,
+		i%250+1);
+	add_rr(pkt, str, 0);
+	add_rr(pkt, "example.com. 3600 IN NS ns1.example.com.", 0);
+	add_rr(pkt, "example.com. 3600 IN NS ns2.example.com.", 0);
+	snprintf(str, sizeof(str), "ns1.example.com. 3600 IN A 198.51.100.%d",
+		glue);
+	add_rr(pkt, str, 0);
+	add_rr(pkt, "ns2.example.com. 3600 IN A 198.51.100.2", 0);
+	sldns_buffer_flip(pkt);
+}
+
+/** compare refs in lock order, like reply_info_sortref */
+static int
+ref_cmp(const void* a, const void* b)
+{
+	struct ub_packed_rrset_key* x = ((const struct rrset_ref*)a)->key;
+	struct ub_packed_rrset_key* y = ((const struct rrset_ref*)b)->key;
+	if(x < y) return -1;
+	if(x > y) return 1;
+	return 0;
+}
+
+/** store the rrsets of the answer packet in the cache, note the refs */
+static void
+store_pkt(sldns_buffer* pkt, struct alloc_cache* alloc,
+	struct regional* region, struct bench_answer* a)
+{
+	struct query_info qinf;
+	struct reply_info* rep = NULL;
+	struct edns_data edns;
+	struct rrset_ref ref;
+	size_t i;
+	if(reply_info_parse(pkt, alloc, &qinf, &rep, region, &edns) != 0)
+		fatal_exit("cannot parse packet");
+	for(i=0; i<rep->rrset_count; i++) {
+		ref.key = rep->rrsets[i];
+		ref.id = rep->rrsets[i]->id;
+		(void)rrset_cache_update(bench.cache, &ref, alloc, 0);
+		if(a)
+			a->ref[i] = ref;
+	}
+	if(a) {
+		a->count = rep->rrset_count;
+		qsort(a->ref, a->count, sizeof(struct rrset_ref), ref_cmp);
+	}
+	/* the rrsets are now owned by the cache */
+	rep->rrset_count = 0;
+	reply_info_parsedelete(rep, alloc);
+	regional_free_all(region);
+	query_info_clear(&qinf);
+}
+
+/** read the rrsets of the answer, like the encoder does */
+static size_t
+read_answer(struct bench_answer* a)
+{
+	size_t i, j, sum = 0;
+	for(i=0; i<a->count; i++) {
+		struct packed_rrset_data* d = (struct packed_rrset_data*)
+			a->ref[i].key->entry.data;
+		sum += a->ref[i].key->rk.dname_len;
+		for(j=0; j<d->count; j++)
+			sum += packed_rr_len(d, j) + packed_rr_data(d, j)[2];
+	}
+	return sum;
+}
+
+/** thread routine of a reader */
+static void*
+bench_thr_main(void* arg)
+{
+	struct bench_thr* t = (struct bench_thr*)arg;
+	uint32_t vers[4];
+	size_t i, sum;
+	int touch = 0;
+	for(i=0; i<BENCH_HITS; i++) {
+		struct bench_answer* a = &bench.answers[(i*7919 +
+			(size_t)t->num*101)%BENCH_NAMES];
+		if(bench.optimistic && alloc_read_begin(&t->alloc)) {
+			if(rrset_array_peek(a->ref, a->count, 0, vers)) {
+				sum = read_answer(a);
+				if(rrset_array_validate(a->ref, a->count,
+					vers)) {
+					alloc_read_end(&t->alloc);
+					t->sum += sum;
+					if(++touch >= BENCH_TOUCH_SAMPLE) {
+						touch = 0;
+						rrset_array_touch(bench.cache,
+							a->ref, a->count);
+					}
+					continue;
+				}
+			}
+			alloc_read_end(&t->alloc);
+			t->fallback++;
+		}
+		if(!rrset_array_lock(a->ref, a->count, 0))
+			fatal_exit("rrsets not in the cache");
+		t->sum += read_answer(a);
+		rrset_array_unlock_touch(bench.cache, t->scratch, a->ref,
+			a->count);
+		regional_free_all(t->scratch);
+	}
+	return NULL;
+}
+
+/** thread routine of the writer, updates the glue */
+static void*
+bench_writer_main(void* arg)
+{
+	struct bench_thr* t = (struct bench_thr*)arg;
+	sldns_buffer* pkt = sldns_buffer_new(65535);
+	int n = 0;
+	if(!pkt)
+		fatal_exit("out of memory");
+	while(!bench.stop) {
+		make_pkt(pkt, 0, 10+(n++)%2);
+		store_pkt(pkt, &t->alloc, t->scratch, NULL);
+	}
+	sldns_buffer_free(pkt);
+	return NULL;
+}
+
+/** run the readers, and returns hits per second */
+static double
+bench_run(int threads, int optimistic, int writer, size_t* fallback)
+{
+	struct bench_thr t[BENCH_MAX_THREADS+1];
+	struct timeval start, end;
+	double elapsed;
+	int i;
+	bench.optimistic = optimistic;
+	bench.stop = 0;
+	*fallback = 0;
+	for(i=0; i<threads+writer; i++) {
+		t[i].num = i;
+		t[i].fallback = 0;
+		t[i].sum = 0;
+		alloc_init(&t[i].alloc, &bench.superalloc, i+1);
+		if(!(t[i].scratch = regional_create()))
+			fatal_exit("out of memory");
+	}
+	if(writer)
+		ub_thread_create(&t[threads].id, bench_writer_main,
+			&t[threads]);
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<threads; i++)
+		ub_thread_create(&t[i].id, bench_thr_main, &t[i]);
+	for(i=0; i<threads; i++)
+		ub_thread_join(t[i].id);
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	bench.stop = 1;
+	if(writer)
+		ub_thread_join(t[threads].id);
+	for(i=0; i<threads+writer; i++) {
+		*fallback += t[i].fallback;
+		regional_destroy(t[i].scratch);
+		alloc_clear(&t[i].alloc);
+	}
+	elapsed = (double)(end.tv_sec - start.tv_sec) +
+		(double)(end.tv_usec - start.tv_usec)/1000000.;
+	return (double)threads*BENCH_HITS/elapsed;
+}
+#endif /* THREADS_DISABLED */
+
+/** print usage and exit */
+static void
+usage()
+{
+	printf("usage:	hitbench [-w] [max threads]\n");
+	printf("measures the rrset cache hits per second, with the rrset\n");
+	printf("locks and without them, for 1 up to max threads.\n");
+	printf("-w	run a writer thread that updates the rrsets.\n");
+	exit(1);
+}
+
+/** main program */
+int main(int argc, char* argv[])
+{
+#ifndef THREADS_DISABLED
+	struct alloc_cache alloc;
+	struct regional* region;
+	sldns_buffer* pkt;
+	size_t fb, fb2;
+	int max = 4, writer = 0, i, c;
+	while((c = getopt(argc, argv, "hw")) != -1) {
+		switch(c) {
+		case 'w':
+			writer = 1;
+			break;
+		case 'h':
+		default:
+			usage();
+		}
+	}
+	argc -= optind;
+	argv += optind;
+	if(argc > 1)
+		usage();
+	if(argc == 1 && ((max = atoi(argv[0])) <= 0 ||
+		max > BENCH_MAX_THREADS))
+		usage();
+	log_init(NULL, 0, NULL);
+	alloc_init(&bench.superalloc, NULL, 0);
+	if(!alloc_set_readers(&bench.superalloc, BENCH_MAX_THREADS+2))
+		fatal_exit("out of memory");
+	alloc_init(&alloc, &bench.superalloc, 0);
+	if(!(bench.cache = rrset_cache_create(NULL, &bench.superalloc)))
+		fatal_exit("out of memory");
+	pkt = sldns_buffer_new(65535);
+	region = regional_create();
+	if(!pkt || !region)
+		fatal_exit("out of memory");
+	for(i=0; i<BENCH_NAMES; i++) {
+		make_pkt(pkt, i, 1);
+		store_pkt(pkt, &alloc, region, &bench.answers[i]);
+	}
+	printf("%d names, %d hits per thread%s\n", BENCH_NAMES, BENCH_HITS,
+		writer?", with a writer":"");
+	for(i=1; i<=max; i*=2) {
+		double locked = bench_run(i, 0, writer, &fb);
+		double opt = bench_run(i, 1, writer, &fb2);
+		printf("%2d threads: locked %10.0f hits/s  without locks "
+			"%10.0f hits/s (%u fell back to locks)\n", i, locked, opt,
+			(unsigned)fb2);
+	}
+	rrset_cache_delete(bench.cache);
+	sldns_buffer_free(pkt);
+	regional_destroy(region);
+	alloc_clear(&alloc);
+	alloc_clear(&bench.superalloc);
+#else
+	(void)argc; (void)argv;
+	usage();
+#endif
+	return 0;
+}
@@ -0,0 +1,257 @@
+/*
+ * testcode/localbench.c - measure the load of local-data.
+ *
+ * Copyright (c) 2014, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * \file
+ *
+ * This program measures how fast local-data is loaded, in RRs per second.
+ * The RRs are loaded from the config, with the bulk loader, and one at a
+ * time like unbound-control local_data does, and the zone contents that
+ * result are compared.
+ */
+#include "config.h"
+#include "util/log.h"
+#include "util/config_file.h"
+#include "util/data/dname.h"
+#include "util/data/packed_rrset.h"
+#include "services/localzone.h"
+#include <sys/time.h>
+
+/** default number of generated RRs */
+#define BENCH_RRS 100000
+
+/** print usage and exit */
+static void
+usage()
+{
+	printf("usage:	localbench [-n num] [-t threads] [-f file]\n");
+	printf("measures the load of local-data, in RRs per second.\n");
+	printf("-n num	number of generated RRs, default %d\n", BENCH_RRS);
+	printf("-t num	number of threads for the parse, default 1\n");
+	printf("-f file	load the RRs from the file, one per line\n");
+	exit(1);
+}
+
+/** the time since start in msec */
+static double
+elapsed(struct timeval* start)
+{
+	struct timeval end;
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	return (double)(end.tv_sec - start->tv_sec)*1000. +
+		((double)end.tv_usec - (double)start->tv_usec)/1000.;
+}
+
+/** add an RR string to the list */
+static void
+add_rr(struct config_strlist** list, const char* str)
+{
+	char* s = strdup(str);
+	if(!s || !cfg_strlist_insert(list, s))
+		fatal_exit("out of memory");
+}
+
+/** make RRs in example., two addresses per name, and a TXT record
+ * for every tenth name */
+static void
+make_rrs(struct config_strlist** list, int num)
+{
+	char buf[256];
+	int i;
+	for(i=0; i<num; i++) {
+		if(i%20 == 19)
+			snprintf(buf, sizeof(buf), "h%d.z%d.example. TXT "
+				"\"text of name %d\"", i/2, i%1000, i/2);
+		else	snprintf(buf, sizeof(buf), "h%d.z%d.example. A "
+				"10.%d.%d.%d", i/2, (i/2)%1000, (i>>16)&0xff,
+				(i>>8)&0xff, i&0xff);
+		add_rr(list, buf);
+	}
+}
+
+/** read RRs from file, one per line */
+static int
+read_rrs(struct config_strlist** list, const char* fname)
+{
+	char buf[65536];
+	int num = 0;
+	FILE* in = fopen(fname, "r");
+	if(!in)
+		fatal_exit("could not open %s: %s", fname, strerror(errno));
+	while(fgets(buf, (int)sizeof(buf), in)) {
+		buf[strcspn(buf, "\r\n")] = 0;
+		if(buf[0] == 0 || buf[0] == ';' || buf[0] == '#')
+			continue;
+		add_rr(list, buf);
+		num++;
+	}
+	fclose(in);
+	return num;
+}
+
+/** check that the rrsets of two nodes are the same, in the same order */
+static void
+compare_node(struct local_data* a, struct local_data* b)
+{
+	struct local_rrset* ra = a->rrsets, *rb = b->rrsets;
+	size_t i;
+	if(query_dname_compare(a->name, b->name) != 0)
+		fatal_exit("different names");
+	for(; ra && rb; ra = ra->next, rb = rb->next) {
+		struct packed_rrset_data* da = (struct packed_rrset_data*)
+			ra->rrset->entry.data;
+		struct packed_rrset_data* db = (struct packed_rrset_data*)
+			rb->rrset->entry.data;
+		if(ra->rrset->rk.type != rb->rrset->rk.type ||
+			da->count != db->count)
+			fatal_exit("different rrsets");
+		for(i=0; i<da->count; i++)
+			if(packed_rr_len(da, i) != packed_rr_len(db, i) ||
+				packed_rr_ttl(da, i) != packed_rr_ttl(db, i) ||
+				memcmp(packed_rr_data(da, i),
+				packed_rr_data(db, i), packed_rr_len(da, i))
+				!= 0)
+				fatal_exit("different rrs");
+	}
+	if(ra || rb)
+		fatal_exit("different number of rrsets");
+}
+
+/** check that two local zones have the same content */
+static void
+compare_zones(struct local_zones* a, struct local_zones* b)
+{
+	struct local_zone* za, *zb;
+	rbnode_t* na, *nb;
+	if(a->ztree.count != b->ztree.count)
+		fatal_exit("different number of zones");
+	RBTREE_FOR(za, struct local_zone*, &a->ztree) {
+		zb = local_zones_find(b, za->name, za->namelen, za->namelabs,
+			za->dclass);
+		if(!zb || za->data.count != zb->data.count)
+			fatal_exit("different zones");
+		for(na = rbtree_first(&za->data), nb = rbtree_first(&zb->data);
+			na != RBTREE_NULL && nb != RBTREE_NULL;
+			na = rbtree_next(na), nb = rbtree_next(nb))
+			compare_node((struct local_data*)na->key,
+				(struct local_data*)nb->key);
+	}
+}
+
+/** main program */
+int main(int argc, char* argv[])
+{
+	int c, num = BENCH_RRS, threads = 1;
+	const char* fname = NULL;
+	struct config_file* cfg, *cfg2;
+	struct config_strlist* p;
+	struct local_zones* bulk, *one;
+	struct timeval start;
+	double msec;
+	while((c = getopt(argc, argv, "hn:t:f:")) != -1) {
+		switch(c) {
+		case 'n':
+			if((num = atoi(optarg)) <= 0)
+				usage();
+			break;
+		case 't':
+			if((threads = atoi(optarg)) <= 0)
+				usage();
+			break;
+		case 'f':
+			fname = optarg;
+			break;
+		case 'h':
+		default:
+			usage();
+		}
+	}
+	argc -= optind;
+	if(argc != 0)
+		usage();
+	log_init(NULL, 0, NULL);
+	cfg = config_create();
+	cfg2 = config_create();
+	bulk = local_zones_create();
+	one = local_zones_create();
+	if(!cfg || !cfg2 || !bulk || !one)
+		fatal_exit("out of memory");
+	cfg->num_threads = threads;
+	if(fname)
+		num = read_rrs(&cfg->local_data, fname);
+	else	make_rrs(&cfg->local_data, num);
+	/* the zone for the rrs, when they are added one at a time; without
+	 * it every name gets a transparent zone of its own */
+	if(!cfg_str2list_insert(&cfg->local_zones, strdup("example."),
+		strdup("transparent")) ||
+		!cfg_str2list_insert(&cfg2->local_zones, strdup("example."),
+		strdup("transparent")))
+		fatal_exit("out of memory");
+
+	/* one at a time, with the local_data command */
+	if(!local_zones_apply_cfg(one, cfg2))
+		fatal_exit("could not apply config");
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(p = cfg->local_data; p; p = p->next)
+		if(!local_zones_add_RR(one, p->str))
+			fatal_exit("could not add %s", p->str);
+	msec = elapsed(&start);
+	printf("one at a time:	%d RRs in %g msec, %.0f RRs/sec\n", num, msec,
+		(double)num*1000./msec);
+
+	/* bulk, from the config */
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	if(!local_zones_apply_cfg(bulk, cfg))
+		fatal_exit("could not apply config");
+	msec = elapsed(&start);
+	printf("bulk, %d threads:	%d RRs in %g msec, %.0f RRs/sec\n",
+		threads, num, msec, (double)num*1000./msec);
+
+	/* rrs from a file, that are not in example., have different zones
+	 * when they are added one at a time */
+	if(!fname) {
+		compare_zones(bulk, one);
+		printf("same zone content\n");
+	}
+	local_zones_delete(bulk);
+	local_zones_delete(one);
+	config_delete(cfg);
+	config_delete(cfg2);
+	return 0;
+}
@@ -0,0 +1,309 @@
+/*
+ * testcode/lockbench.c - measure rwlock throughput under contention.
+ *
+ * Copyright (c) 2014, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * \file
+ *
+ * This program measures the throughput of the lock_rw locks, that are
+ * used in every cache entry, when several threads contend for a small
+ * set of them.  If pthreads are available the same is done with
+ * pthread_rwlock_t for comparison.  It also measures how long a writer
+ * waits for a lock that the other threads keep read locked.
+ */
+#include "config.h"
+#include "util/log.h"
+#include "util/locks.h"
+#include <sys/time.h>
+
+/** number of locks the threads contend for */
+#define BENCH_LOCKS 16
+/** maximum number of threads */
+#define BENCH_MAX_THREADS 32
+
+#ifndef THREADS_DISABLED
+/** the operations on the lock type that is measured */
+struct lock_ops {
+	/** name of the lock type */
+	const char* name;
+	/** size of the lock */
+	size_t size;
+	/** init the ith lock */
+	void (*init)(int i);
+	/** deinit the ith lock */
+	void (*destroy)(int i);
+	/** read lock */
+	void (*rdlock)(int i);
+	/** write lock */
+	void (*wrlock)(int i);
+	/** unlock */
+	void (*unlock)(int i);
+};
+
+/** the locks, with the data that they protect */
+static struct bench_lock {
+	/** lock_rw lock */
+	lock_rw_t rw;
+#ifdef HAVE_PTHREAD_RWLOCK_T
+	/** pthread lock */
+	pthread_rwlock_t prw;
+#endif
+	/** protected data */
+	int data;
+} locks[BENCH_LOCKS];
+
+/** lock_rw init */
+static void rw_init(int i) { lock_rw_init(&locks[i].rw); }
+/** lock_rw destroy */
+static void rw_destroy(int i) { (void)i; lock_rw_destroy(&locks[i].rw); }
+/** lock_rw read lock */
+static void rw_rdlock(int i) { lock_rw_rdlock(&locks[i].rw); }
+/** lock_rw write lock */
+static void rw_wrlock(int i) { lock_rw_wrlock(&locks[i].rw); }
+/** lock_rw unlock */
+static void rw_unlock(int i) { lock_rw_unlock(&locks[i].rw); }
+
+/** lock_rw operations */
+static struct lock_ops rw_ops = { "lock_rw_t", sizeof(lock_rw_t),
+	rw_init, rw_destroy, rw_rdlock, rw_wrlock, rw_unlock };
+
+#ifdef HAVE_PTHREAD_RWLOCK_T
+/** pthread init */
+static void prw_init(int i) { LOCKRET(pthread_rwlock_init(&locks[i].prw,
+	NULL)); }
+/** pthread destroy */
+static void prw_destroy(int i) { LOCKRET(pthread_rwlock_destroy(
+	&locks[i].prw)); }
+/** pthread read lock */
+static void prw_rdlock(int i) { LOCKRET(pthread_rwlock_rdlock(
+	&locks[i].prw)); }
+/** pthread write lock */
+static void prw_wrlock(int i) { LOCKRET(pthread_rwlock_wrlock(
+	&locks[i].prw)); }
+/** pthread unlock */
+static void prw_unlock(int i) { LOCKRET(pthread_rwlock_unlock(
+	&locks[i].prw)); }
+
+/** pthread rwlock operations */
+static struct lock_ops prw_ops = { "pthread_rwlock_t",
+	sizeof(pthread_rwlock_t), prw_init, prw_destroy, prw_rdlock,
+	prw_wrlock, prw_unlock };
+#endif /* HAVE_PTHREAD_RWLOCK_T */
+
+/** per thread benchmark info */
+struct bench_thr {
+	/** thread num, first entry (for checklocks) */
+	int num;
+	/** thread id */
+	ub_thread_t id;
+	/** lock operations */
+	struct lock_ops* ops;
+	/** number of operations to do */
+	int count;
+	/** percentage of writes */
+	int writes;
+	/** random state */
+	unsigned int seed;
+};
+
+/** benchmark thread, does count lock and unlock operations */
+static void*
+bench_thr_main(void* arg)
+{
+	struct bench_thr* t = (struct bench_thr*)arg;
+	struct lock_ops* ops = t->ops;
+	volatile int x;
+	int i, l;
+	for(i=0; i<t->count; i++) {
+		t->seed = t->seed*1103515245 + 12345;
+		l = (int)((t->seed>>16) % BENCH_LOCKS);
+		if((int)((t->seed>>8) % 100) < t->writes) {
+			(*ops->wrlock)(l);
+			locks[l].data++;
+			(*ops->unlock)(l);
+		} else {
+			(*ops->rdlock)(l);
+			x = locks[l].data;
+			(*ops->unlock)(l);
+		}
+	}
+	(void)x;
+	return NULL;
+}
+
+/** run the benchmark for one lock type and print the result */
+static void
+bench(struct lock_ops* ops, int threads, int count, int writes)
+{
+	struct bench_thr t[BENCH_MAX_THREADS];
+	struct timeval start, end;
+	double sec;
+	int i;
+	for(i=0; i<BENCH_LOCKS; i++) {
+		(*ops->init)(i);
+		locks[i].data = 0;
+	}
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<threads; i++) {
+		t[i].num = i+1;
+		t[i].ops = ops;
+		t[i].count = count;
+		t[i].writes = writes;
+		t[i].seed = (unsigned int)i;
+		ub_thread_create(&t[i].id, bench_thr_main, &t[i]);
+	}
+	for(i=0; i<threads; i++)
+		ub_thread_join(t[i].id);
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<BENCH_LOCKS; i++)
+		(*ops->destroy)(i);
+	sec = (double)(end.tv_sec - start.tv_sec) +
+		(double)(end.tv_usec - start.tv_usec)/1000000.0;
+	printf("%-18s %3u bytes  %2d threads  %3d%% writes  %12.0f ops/sec\n",
+		ops->name, (unsigned)ops->size, threads, writes,
+		(double)threads*(double)count/sec);
+}
+
+/** set when the writer is done, the readers stop */
+static int readers_stop;
+
+/** reader thread, read locks the first lock until the writer is done */
+static void*
+bench_reader_main(void* arg)
+{
+	struct bench_thr* t = (struct bench_thr*)arg;
+	struct lock_ops* ops = t->ops;
+	volatile int x;
+	while(!lock_atomic_load(&readers_stop)) {
+		(*ops->rdlock)(0);
+		x = locks[0].data;
+		(*ops->unlock)(0);
+		lock_atomic_store(&t->count, 1);
+	}
+	(void)x;
+	return NULL;
+}
+
+/** run a writer against readers on the same lock and print the
+ * time the writer needs for a write lock */
+static void
+bench_writer(struct lock_ops* ops, int threads, int count)
+{
+	struct bench_thr t[BENCH_MAX_THREADS];
+	struct timeval start, end;
+	double sec;
+	int i, writes = count/10000;
+	if(writes < 1)
+		writes = 1;
+	(*ops->init)(0);
+	locks[0].data = 0;
+	lock_atomic_store(&readers_stop, 0);
+	for(i=1; i<threads; i++) {
+		t[i].num = i+1;
+		t[i].ops = ops;
+		t[i].count = 0;
+		ub_thread_create(&t[i].id, bench_reader_main, &t[i]);
+	}
+	/* wait until the readers are busy */
+	for(i=1; i<threads; i++) {
+		while(!lock_atomic_load(&t[i].count))
+			;
+	}
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<writes; i++) {
+		(*ops->wrlock)(0);
+		locks[0].data++;
+		(*ops->unlock)(0);
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	lock_atomic_store(&readers_stop, 1);
+	for(i=1; i<threads; i++)
+		ub_thread_join(t[i].id);
+	(*ops->destroy)(0);
+	sec = (double)(end.tv_sec - start.tv_sec) +
+		(double)(end.tv_usec - start.tv_usec)/1000000.0;
+	printf("%-18s %3u bytes  %2d readers  1 writer  %12.3f usec/write\n",
+		ops->name, (unsigned)ops->size, threads-1,
+		sec*1000000.0/(double)writes);
+}
+#endif /* THREADS_DISABLED */
+
+/** print usage and exit */
+static void
+usage()
+{
+	printf("usage:	lockbench [threads] [count] [write percentage]\n");
+	printf("measures rwlock throughput, default 4 threads, 1000000\n");
+	printf("operations per thread and 5%% writes.  Then one writer\n");
+	printf("does count/10000 writes while the others read the lock.\n");
+	exit(1);
+}
+
+/** main program */
+int main(int argc, const char* argv[])
+{
+	int threads = 4, count = 1000000, writes = 5;
+	if(argc > 4)
+		usage();
+	if(argc > 1 && ((threads = atoi(argv[1])) <= 0 ||
+		threads > BENCH_MAX_THREADS))
+		usage();
+	if(argc > 2 && (count = atoi(argv[2])) <= 0)
+		usage();
+	if(argc > 3 && ((writes = atoi(argv[3])) < 0 || writes > 100))
+		usage();
+	log_init(NULL, 0, NULL);
+#ifdef THREADS_DISABLED
+	printf("no thread support, nothing to measure\n");
+#else
+	checklock_start();
+	bench(&rw_ops, threads, count, writes);
+#  ifdef HAVE_PTHREAD_RWLOCK_T
+	bench(&prw_ops, threads, count, writes);
+#  endif
+	if(threads > 1) {
+		bench_writer(&rw_ops, threads, count);
+#  ifdef HAVE_PTHREAD_RWLOCK_T
+		bench_writer(&prw_ops, threads, count);
+#  endif
+	}
+	checklock_stop();
+#endif
+	return 0;
+}
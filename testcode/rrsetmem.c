@@ -0,0 +1,233 @@
+/*
+ * testcode/rrsetmem.c - report memory used per rrset cache entry.
+ *
+ * Copyright (c) 2014, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * \file
+ *
+ * This program fills an rrset cache with typical rrsets and prints the
+ * number of bytes every cache entry uses.  It is used to measure the
+ * effect of changes to the packed rrset layout.
+ */
+#include "config.h"
+#include "util/log.h"
+#include "util/alloc.h"
+#include "util/regional.h"
+#include "util/data/msgreply.h"
+#include "util/data/msgparse.h"
+#include "util/data/packed_rrset.h"
+#include "util/net_help.h"
+#include "util/config_file.h"
+#include "util/storage/slabhash.h"
+#include "services/cache/rrset.h"
+#include "ldns/sbuffer.h"
+#include "ldns/str2wire.h"
+
+/** a scenario of rrsets to put in the cache */
+struct scenario {
+	/** description */
+	const char* desc;
+	/** rrs in the answer section, %s is replaced by the owner name,
+	 * NULL terminated */
+	const char* rrs[8];
+};
+
+/** the scenarios that are measured */
+static struct scenario scenarios[] = {
+	{ "1 A", { "%s 3600 IN A 192.0.2.1", NULL } },
+	{ "1 AAAA", { "%s 3600 IN AAAA 2001:db8::1", NULL } },
+	{ "4 A", { "%s 3600 IN A 192.0.2.1", "%s 3600 IN A 192.0.2.2",
+		"%s 3600 IN A 192.0.2.3", "%s 3600 IN A 192.0.2.4", NULL } },
+	{ "4 NS", { "%s 3600 IN NS ns1.example.net.",
+		"%s 3600 IN NS ns2.example.net.",
+		"%s 3600 IN NS ns3.example.net.",
+		"%s 3600 IN NS ns4.example.net.", NULL } },
+	{ "1 A + RRSIG", { "%s 3600 IN A 192.0.2.1",
+		"%s 3600 IN RRSIG A 8 3 3600 20300101000000 20140101000000 "
+		"12345 example.com. AwEAAcXmZ7vJ0kHEkVQ1l5jA1sR5l+G3y0J9w"
+		"c1YwvT0EvhsHn3rSPk9xIQ2ut3J7qQk4WkN0s5bSHc6xHn+q0w6HGfYzF"
+		"xF2s2ZpY1iKQZ9iW8K2x8bBFkD3xJmS8y5pQ0uL7dS6cCzE4hF8T0s=",
+		NULL } },
+	{ NULL, { NULL } }
+};
+
+/** print usage and exit */
+static void
+usage()
+{
+	printf("usage:	rrsetmem [count]\n");
+	printf("fills an rrset cache with count entries per scenario and\n");
+	printf("prints the memory used per entry on stdout.\n");
+	exit(1);
+}
+
+/** append an rr in text format to the packet, false on failure */
+static int
+add_rr(sldns_buffer* pkt, const char* tmpl, const char* name, int question)
+{
+	char str[1024];
+	uint8_t rr[LDNS_RR_BUF_SIZE];
+	size_t len = sizeof(rr), dname_len = 0;
+	int s;
+	snprintf(str, sizeof(str), tmpl, name);
+	if(question)
+		s = sldns_str2wire_rr_question_buf(str, rr, &len, &dname_len,
+			NULL, 0, NULL, 0);
+	else	s = sldns_str2wire_rr_buf(str, rr, &len, &dname_len, 3600,
+			NULL, 0, NULL, 0);
+	if(s != 0) {
+		printf("cannot parse %s: %s\n", str,
+			sldns_get_errorstr_parse(s));
+		return 0;
+	}
+	if(sldns_buffer_remaining(pkt) < len)
+		return 0;
+	sldns_buffer_write(pkt, rr, len);
+	return 1;
+}
+
+/** create the answer packet for the scenario and owner name */
+static int
+make_pkt(sldns_buffer* pkt, struct scenario* sc, const char* name)
+{
+	size_t i;
+	sldns_buffer_clear(pkt);
+	sldns_buffer_write_u16(pkt, 0); /* id */
+	sldns_buffer_write_u16(pkt, BIT_QR|BIT_RD|BIT_RA);
+	sldns_buffer_write_u16(pkt, 1); /* qdcount */
+	for(i=0; sc->rrs[i]; i++)
+		;
+	sldns_buffer_write_u16(pkt, (uint16_t)i); /* ancount */
+	sldns_buffer_write_u16(pkt, 0); /* nscount */
+	sldns_buffer_write_u16(pkt, 0); /* arcount */
+	if(!add_rr(pkt, "%s IN A", name, 1))
+		return 0;
+	for(i=0; sc->rrs[i]; i++)
+		if(!add_rr(pkt, sc->rrs[i], name, 0))
+			return 0;
+	sldns_buffer_flip(pkt);
+	return 1;
+}
+
+/** store the rrsets of the reply in the cache, and free the reply */
+static void
+store_reply(struct rrset_cache* r, struct alloc_cache* alloc,
+	struct reply_info* rep)
+{
+	struct rrset_ref ref;
+	size_t i;
+	for(i=0; i<rep->rrset_count; i++) {
+		ref.key = rep->rrsets[i];
+		ref.id = rep->rrsets[i]->id;
+		(void)rrset_cache_update(r, &ref, alloc, 0);
+	}
+	/* the rrsets are now owned by the cache */
+	rep->rrset_count = 0;
+	reply_info_parsedelete(rep, alloc);
+}
+
+/** fill a cache for the scenario and print the memory used per entry */
+static void
+measure(struct scenario* sc, int count, struct alloc_cache* alloc,
+	struct regional* region, sldns_buffer* pkt)
+{
+	struct config_file* cfg = config_create();
+	struct rrset_cache* r;
+	size_t base, used, datasize = 0, entrysize = 0;
+	char name[64];
+	int i;
+	if(!cfg)
+		fatal_exit("out of memory");
+	/* make room for all the entries, without lru eviction */
+	cfg->rrset_cache_size = (size_t)count*4096;
+	r = rrset_cache_create(cfg, alloc);
+	config_delete(cfg);
+	if(!r)
+		fatal_exit("out of memory");
+	base = slabhash_get_mem(&r->table);
+	for(i=0; i<count; i++) {
+		struct query_info qinf;
+		struct reply_info* rep = NULL;
+		struct edns_data edns;
+		snprintf(name, sizeof(name), "h%d.example.com.", i);
+		if(!make_pkt(pkt, sc, name))
+			fatal_exit("cannot create packet for %s", sc->desc);
+		if(reply_info_parse(pkt, alloc, &qinf, &rep, region, &edns) != 0)
+			fatal_exit("cannot parse packet for %s", sc->desc);
+		if(i == 0 && rep->rrset_count > 0) {
+			datasize = packed_rrset_sizeof((struct packed_rrset_data*)
+				rep->rrsets[0]->entry.data);
+			entrysize = ub_rrset_sizefunc(rep->rrsets[0],
+				rep->rrsets[0]->entry.data);
+		}
+		regional_free_all(region);
+		query_info_clear(&qinf);
+		store_reply(r, alloc, rep);
+	}
+	used = slabhash_get_mem(&r->table) - base;
+	printf("%-12s data %5u  entry %5u  cache %8.1f bytes per entry\n",
+		sc->desc, (unsigned)datasize, (unsigned)entrysize,
+		(double)used/(double)count);
+	rrset_cache_delete(r);
+}
+
+/** main program */
+int main(int argc, const char* argv[])
+{
+	struct alloc_cache alloc;
+	struct regional* region;
+	sldns_buffer* pkt;
+	int count = 10000, i;
+	if(argc > 2)
+		usage();
+	if(argc == 2 && (count = atoi(argv[1])) <= 0)
+		usage();
+	log_init(NULL, 0, NULL);
+	alloc_init(&alloc, NULL, 0);
+	pkt = sldns_buffer_new(65535);
+	region = regional_create();
+	if(!pkt || !region)
+		fatal_exit("out of memory");
+	printf("sizeof(struct packed_rrset_data) %u, "
+		"per rr arrays %u bytes\n",
+		(unsigned)sizeof(struct packed_rrset_data),
+		(unsigned)PACKED_RRSET_ARRAYS_SIZE(1));
+	for(i=0; scenarios[i].desc; i++)
+		measure(&scenarios[i], count, &alloc, region, pkt);
+	sldns_buffer_free(pkt);
+	regional_destroy(region);
+	alloc_clear(&alloc);
+	return 0;
+}
@@ -44,6 +44,9 @@
 #include "util/data/dname.h"
 #include "ldns/sbuffer.h"
 #include "ldns/str2wire.h"
+#include "util/storage/lookup3.h"
+#include <ctype.h>
+#include <sys/time.h>
 
 /** put dname into buffer */
 static sldns_buffer*
@@ -830,6 +833,180 @@ dname_setup_bufs(sldns_buffer* loopbuf, sldns_buffer* boundbuf)
 	sldns_buffer_flip(boundbuf);
 }
 
+/** set to 1 to print the timings of the dname benchmark */
+static int dname_bench_print = 0;
+
+/** the byte by byte query_dname_compare, to check the fast one against */
+static int
+ref_query_dname_compare(uint8_t* d1, uint8_t* d2)
+{
+	uint8_t lab1 = *d1++, lab2 = *d2++;
+	while(lab1 != 0 || lab2 != 0) {
+		if(lab1 != lab2)
+			return (lab1 < lab2)?-1:1;
+		while(lab1--) {
+			if(tolower((int)*d1) != tolower((int)*d2))
+				return (tolower((int)*d1) < tolower((int)*d2))?
+					-1:1;
+			d1++;
+			d2++;
+		}
+		lab1 = *d1++;
+		lab2 = *d2++;
+	}
+	return 0;
+}
+
+/** the label by label lookup3 dname_query_hash, for the benchmark */
+static hashvalue_t
+ref_dname_query_hash(uint8_t* dname, hashvalue_t h)
+{
+	uint8_t labuf[LDNS_MAX_LABELLEN+1];
+	uint8_t lablen = *dname++;
+	int i;
+	while(lablen) {
+		labuf[0] = lablen;
+		i=0;
+		while(lablen--)
+			labuf[++i] = (uint8_t)tolower((int)*dname++);
+		h = hashlittle(labuf, labuf[0] + 1, h);
+		lablen = *dname++;
+	}
+	return h;
+}
+
+/** random number for the dname tests, repeatable */
+static unsigned
+dname_rnd(unsigned* seed)
+{
+	*seed = *seed*1103515245 + 12345;
+	return (*seed>>16)&0x7fff;
+}
+
+/** make a random dname with mixed case and other bytes, returns length */
+static size_t
+dname_random(unsigned* seed, uint8_t* d, int maxlab)
+{
+	static const char chars[] = "abcdefghijklmnopqrstuvwxyz"
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-_@[`{\xc1\xe1\xff";
+	size_t len = 0;
+	int labs = 1 + (int)dname_rnd(seed)%4, i, j;
+	for(i=0; i<labs; i++) {
+		int lablen = 1 + (int)dname_rnd(seed)%maxlab;
+		if(len + lablen + 2 > LDNS_MAX_DOMAINLEN)
+			break;
+		d[len++] = (uint8_t)lablen;
+		for(j=0; j<lablen; j++)
+			d[len++] = (uint8_t)chars[dname_rnd(seed)%
+				(sizeof(chars)-1)];
+	}
+	d[len++] = 0;
+	return len;
+}
+
+/** change the case of some letters, and sometimes one byte */
+static void
+dname_mutate(unsigned* seed, uint8_t* d, size_t len)
+{
+	size_t i;
+	for(i=0; i+1<len; i++) {
+		if(isalpha((int)d[i]) && dname_rnd(seed)%2)
+			d[i] ^= 0x20;
+	}
+	if(dname_rnd(seed)%4 == 0) {
+		/* change a byte that is not a label length */
+		uint8_t* p = d;
+		while(p[0] && dname_rnd(seed)%3 != 0 && p[p[0]+1])
+			p += p[0]+1;
+		if(p[0])
+			p[1 + dname_rnd(seed)%p[0]] += 1 +
+				(uint8_t)(dname_rnd(seed)%3);
+	}
+}
+
+/** check the label at a time compare, hash and lowercase against the
+ * byte by byte versions, and time them */
+static void
+dname_test_fast(sldns_buffer* buff)
+{
+	uint8_t d1[LDNS_MAX_DOMAINLEN+1], d2[LDNS_MAX_DOMAINLEN+1];
+	uint8_t l1[LDNS_MAX_DOMAINLEN+1];
+	unsigned seed = 1;
+	size_t len, i, j, k;
+	int c;
+	struct timeval start, end;
+	double dtref, dtfast;
+	hashvalue_t h = 0;
+	unit_show_func("util/data/dname.c", "lower_copy");
+	/* a compressed name hashes like the uncompressed one */
+	sldns_buffer_clear(buff);
+	sldns_buffer_write(buff, "\000\000\000\000\000\000\000\000\000\000"
+		"\000\000\003www\007ExAmple\003com\000\004MAIL\300\020", 36);
+	sldns_buffer_flip(buff);
+	unit_assert(dname_pkt_hash(buff, sldns_buffer_at(buff, 29), 0x1234) ==
+		dname_query_hash((uint8_t*)"\004mail\007example\003com", 0x1234));
+	unit_assert(dname_pkt_hash(buff, sldns_buffer_at(buff, 12), 0x1234) !=
+		dname_pkt_hash(buff, sldns_buffer_at(buff, 29), 0x1234));
+	for(i=0; i<10000; i++) {
+		int maxlab = (i%3==0)?LDNS_MAX_LABELLEN:(i%3==1?20:7);
+		len = dname_random(&seed, d1, maxlab);
+		memmove(d2, d1, len);
+		dname_mutate(&seed, d2, len);
+		c = ref_query_dname_compare(d1, d2);
+		unit_assert(query_dname_compare(d1, d2) == c);
+		unit_assert(query_dname_compare(d2, d1) == -c);
+		unit_assert(dname_pkt_compare(buff, d1, d2) == c);
+		unit_assert(dname_pkt_hash(buff, d2, 0x1234) ==
+			dname_query_hash(d2, 0x1234));
+		memmove(l1, d1, len);
+		query_dname_tolower(l1);
+		/* the label lengths are below 'A' and stay the same */
+		for(j=0; j<len; j++)
+			unit_assert(l1[j] == (uint8_t)tolower((int)d1[j]));
+		unit_assert(dname_query_hash(l1, 0x1234) ==
+			dname_query_hash(d1, 0x1234));
+		if(c == 0) {
+			int m;
+			unit_assert(dname_query_hash(d1, 0x1234) ==
+				dname_query_hash(d2, 0x1234));
+			unit_assert(dname_lab_cmp(d1, dname_count_labels(d1),
+				d2, dname_count_labels(d2), &m) == 0);
+			unit_assert(dname_canonical_compare(d1, d2) == 0);
+		}
+	}
+
+	/* the microbenchmark, on a www.example.com like name */
+	len = dname_random(&seed, d1, 12);
+	memmove(d2, d1, len);
+	dname_mutate(&seed, d2, len);
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(k=0; k<200000; k++) {
+		h = ref_dname_query_hash(d1, h);
+		c = ref_query_dname_compare(d1, d2);
+		h += (hashvalue_t)c;
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	dtref = (double)(end.tv_sec - start.tv_sec)*1000. +
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(k=0; k<200000; k++) {
+		h = dname_query_hash(d1, h);
+		c = query_dname_compare(d1, d2);
+		h += (hashvalue_t)c;
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	dtfast = (double)(end.tv_sec - start.tv_sec)*1000. +
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	if(dname_bench_print)
+		printf("dname hash and compare of %d bytes, 200000 times: "
+			"old %g msec, new %g msec (%x)\n", (int)len,
+			dtref, dtfast, (unsigned)h);
+}
+
 void dname_test(void)
 {
 	sldns_buffer* loopbuf = sldns_buffer_new(14);
@@ -855,6 +1032,7 @@ void dname_test(void)
 	dname_test_canoncmp();
 	dname_test_topdomain();
 	dname_test_valid();
+	dname_test_fast(buff);
 	sldns_buffer_free(buff);
 	sldns_buffer_free(loopbuf);
 	sldns_buffer_free(boundbuf);
@@ -70,6 +70,7 @@
 int testcount = 0;
 
 #include "util/alloc.h"
+#include "util/data/packed_rrset.h"
 /** test alloc code */
 static void
 alloc_test(void) {
@@ -108,6 +109,315 @@ alloc_test(void) {
 	alloc_clear(&major);
 }
 
+#if defined(LOCK_RW_HAVE_VERSION) && !defined(THREADS_DISABLED)
+/** the value that the read section test reads without locks */
+static int* read_test_cur;
+/** number of read section test threads that are done */
+static int read_test_done;
+
+/** thread routine of the read section test */
+static void*
+alloc_read_thr_main(void* arg)
+{
+	struct alloc_cache* a = (struct alloc_cache*)arg;
+	int i, *p;
+	for(i=0; i<100000; i++) {
+		unit_assert(alloc_read_begin(a));
+		p = __atomic_load_n(&read_test_cur, __ATOMIC_ACQUIRE);
+		/* it is not freed during the read section */
+		unit_assert(*(volatile int*)p == 42);
+		alloc_read_end(a);
+	}
+	__atomic_add_fetch(&read_test_done, 1, __ATOMIC_RELEASE);
+	return NULL;
+}
+#endif
+
+/** test the read sections, memory is freed after the readers are done */
+static void
+alloc_read_test(void)
+{
+#if defined(LOCK_RW_HAVE_VERSION) && !defined(THREADS_DISABLED)
+	struct alloc_cache major, minor[2];
+	struct ub_packed_rrset_key* k;
+	ub_thread_t id[2];
+	int i, *p, *old;
+	unit_show_feature("alloc read sections");
+	alloc_init(&major, NULL, 0);
+	/* without readers, retired memory is freed at once */
+	alloc_retire(&major, malloc(10), ALLOC_RETIRE_MALLOC);
+	unit_assert(major.num_retired == 0);
+	unit_assert(alloc_set_readers(&major, 2));
+	read_test_cur = (int*)malloc(sizeof(int));
+	unit_assert(read_test_cur);
+	*read_test_cur = 42;
+	for(i=0; i<2; i++) {
+		alloc_init(&minor[i], &major, i);
+		unit_assert(minor[i].read_section);
+		ub_thread_create(&id[i], alloc_read_thr_main, &minor[i]);
+	}
+	while(__atomic_load_n(&read_test_done, __ATOMIC_ACQUIRE) < 2) {
+		p = (int*)malloc(sizeof(int));
+		unit_assert(p);
+		*p = 42;
+		old = __atomic_exchange_n(&read_test_cur, p, __ATOMIC_ACQ_REL);
+		alloc_read_wait(&major);
+		*old = 0;
+		free(old);
+	}
+	for(i=0; i<2; i++)
+		ub_thread_join(id[i]);
+	/* the retired blocks of the thread and super wait for a free */
+	alloc_retire(&minor[0], malloc(10), ALLOC_RETIRE_MALLOC);
+	alloc_retire(&minor[0], alloc_sized_obtain(&minor[0], 100),
+		ALLOC_RETIRE_SIZED);
+	alloc_retire(&major, alloc_sized_obtain(&major, 100),
+		ALLOC_RETIRE_SIZED);
+	unit_assert(minor[0].num_retired == 2 && major.num_retired == 1);
+	alloc_retired_free(&minor[0], 4);
+	unit_assert(minor[0].num_retired == 2 && major.num_retired == 1);
+	alloc_retired_free(&minor[0], 3);
+	unit_assert(minor[0].num_retired == 0 && major.num_retired == 0);
+	/* a retired key keeps its name until the free */
+	k = alloc_special_obtain(&minor[0]);
+	unit_assert(k && ub_packed_rrset_name_alloc(k, 10) == k->name);
+	ub_packed_rrset_name_free(k);
+	unit_assert(ub_packed_rrset_name_alloc(k, 100) &&
+		k->rk.dname != k->name);
+	k->id = 0;
+	alloc_retire(&minor[0], k, ALLOC_RETIRE_SPECIAL);
+	unit_assert(minor[0].num_retired == 1 && k->rk.dname);
+	alloc_retired_free(&minor[0], 1);
+	unit_assert(minor[0].num_retired == 0 && k->rk.dname == NULL);
+	alloc_retire(&minor[1], malloc(10), ALLOC_RETIRE_MALLOC);
+	for(i=0; i<2; i++)
+		alloc_clear(&minor[i]);
+	unit_assert(minor[1].num_retired == 0);
+	free(read_test_cur);
+	alloc_clear(&major);
+	unit_assert(major.read_seq == NULL);
+#endif
+}
+
+/** test sized alloc code */
+static void
+alloc_sized_test(void)
+{
+	struct alloc_cache major, minor1, minor2;
+	void* p[ALLOC_SIZED_MAX*2];
+	void* b1, *b2;
+	size_t i, n;
+
+	unit_show_feature("alloc_sized_obtain");
+	alloc_init(&major, NULL, 0);
+	alloc_init(&minor1, &major, 0);
+	alloc_init(&minor2, &major, 1);
+
+	/* size classes round up, large blocks keep their size */
+	unit_assert(alloc_sized_size(1) >= 1+sizeof(void*));
+	unit_assert(alloc_sized_size(100) >= 100);
+	unit_assert(alloc_sized_size(100) <= 100*5/4+16);
+	unit_assert(alloc_sized_size(100000) >= 100000);
+
+	/* block is reused from the freelist of the class */
+	b1 = alloc_sized_obtain(&minor1, 100);
+	unit_assert(b1);
+	memset(b1, 0xab, 100);
+	alloc_sized_release(&minor1, b1);
+	b2 = alloc_sized_obtain(&minor1, 90);
+	unit_assert(b1 == b2);
+	alloc_sized_release(&minor1, b2);
+	b2 = alloc_sized_obtain(&minor1, 1000);
+	unit_assert(b2 && b1 != b2);
+	alloc_sized_release(&minor1, b2);
+
+	/* obtained by one thread, released by another, batches move
+	 * to the super and are reused by the first thread */
+	for(i=0; i<ALLOC_SIZED_MAX*2; i++) {
+		p[i] = alloc_sized_obtain(&minor1, 200);
+		unit_assert(p[i]);
+	}
+	for(i=0; i<ALLOC_SIZED_MAX*2; i++)
+		alloc_sized_release(&minor2, p[i]);
+	n = 0;
+	for(i=0; i<ALLOC_SIZED_CLASSES; i++) {
+		unit_assert(minor2.num_sized[i] <= ALLOC_SIZED_MAX);
+		n += major.num_sized[i];
+	}
+	unit_assert(n > 0);
+	b1 = alloc_sized_obtain(&minor1, 200);
+	for(i=0; i<ALLOC_SIZED_MAX*2; i++)
+		if(p[i] == b1)
+			break;
+	unit_assert(i < ALLOC_SIZED_MAX*2);
+	alloc_sized_release(&minor1, b1);
+
+	/* large blocks and NULL alloc */
+	b1 = alloc_sized_obtain(&minor1, 100000);
+	unit_assert(b1);
+	memset(b1, 0, 100000);
+	alloc_sized_release(&minor2, b1);
+	b1 = alloc_sized_obtain(NULL, 50);
+	unit_assert(b1);
+	alloc_sized_release(NULL, b1);
+	alloc_sized_release(&minor1, NULL);
+
+	alloc_clear(&minor1);
+	alloc_clear(&minor2);
+	alloc_clear(&major);
+}
+
+/** test sized alloc with the huge page arena */
+static void
+alloc_arena_test(void)
+{
+	struct alloc_cache major, minor1, minor2;
+	void* p[ALLOC_SIZED_MAX*4];
+	size_t i, mapped, huge, thp;
+
+	unit_show_feature("alloc arena");
+	alloc_init(&major, NULL, 0);
+	alloc_init(&minor1, &major, 0);
+	alloc_init(&minor2, &major, 1);
+	alloc_set_arena(&major, 1);
+
+	for(i=0; i<ALLOC_SIZED_MAX*4; i++) {
+		p[i] = alloc_sized_obtain(&minor1, 100 + i*5);
+		unit_assert(p[i]);
+		memset(p[i], 0x42, 100 + i*5);
+	}
+	alloc_arena_stats(&major, &mapped, &huge, &thp);
+	/* if no region can be mapped, the arena is turned off */
+	unit_assert(mapped > 0 || !major.use_arena);
+	unit_assert(huge + thp <= mapped);
+	/* more than the super keeps, arena blocks are kept anyway */
+	for(i=0; i<ALLOC_SIZED_MAX*4; i++)
+		alloc_sized_release(&minor2, p[i]);
+	p[0] = alloc_sized_obtain(&minor2, 200);
+	unit_assert(p[0]);
+	alloc_sized_release(&minor2, p[0]);
+	/* large blocks do not use the arena */
+	p[0] = alloc_sized_obtain(&minor1, 100000);
+	unit_assert(p[0]);
+	memset(p[0], 0, 100000);
+	alloc_sized_release(&minor1, p[0]);
+
+	/* the rest of the region of a cleared alloc is carved again */
+	alloc_clear(&minor1);
+	alloc_init(&minor1, &major, 0);
+	alloc_arena_stats(&major, &mapped, &huge, &thp);
+	p[0] = alloc_sized_obtain(&minor1, 2000);
+	unit_assert(p[0]);
+	memset(p[0], 0x42, 2000);
+	alloc_arena_stats(&major, &i, &huge, &thp);
+	unit_assert(i == mapped);
+	alloc_sized_release(&minor1, p[0]);
+
+	alloc_clear(&minor1);
+	alloc_clear(&minor2);
+	alloc_clear(&major);
+}
+
+#include "util/locks.h"
+/** shared state for the threaded lock test */
+struct lock_test_data {
+	/** the lock that protects a and b */
+	lock_rw_t lock;
+	/** counters, always equal when the lock is not held */
+	int a, b;
+};
+
+/** structure for the threaded lock test */
+struct lock_test_thr {
+	/** thread num, first entry. */
+	int num;
+	/** id */
+	ub_thread_t id;
+	/** shared data */
+	struct lock_test_data* d;
+};
+
+/** thread routine of the lock test, increments under the write lock
+ * and checks under the read lock, and without the lock */
+static void*
+lock_test_thr_main(void* arg)
+{
+	struct lock_test_data* d = ((struct lock_test_thr*)arg)->d;
+	int i;
+#ifdef LOCK_RW_HAVE_VERSION
+	volatile int* a = &d->a, *b = &d->b;
+	uint32_t v;
+	int x, y;
+#endif
+	for(i=0; i<10000; i++) {
+		lock_rw_wrlock(&d->lock);
+		d->a++;
+		d->b++;
+		lock_rw_unlock(&d->lock);
+		lock_rw_rdlock(&d->lock);
+		unit_assert(d->a == d->b);
+		lock_rw_unlock(&d->lock);
+#ifdef LOCK_RW_HAVE_VERSION
+		if(lock_rw_version(&d->lock, &v)) {
+			x = *a;
+			y = *b;
+			if(lock_rw_version_check(&d->lock, v))
+				unit_assert(x == y);
+		}
+#endif
+	}
+	return NULL;
+}
+
+/** test the rwlock with several threads */
+static void
+lock_test(void)
+{
+#ifndef THREADS_DISABLED
+	struct lock_test_data d;
+	struct lock_test_thr t[4];
+	int i;
+	unit_show_feature("lock_rw");
+	memset(&d, 0, sizeof(d));
+	lock_rw_init(&d.lock);
+#ifdef LOCK_RW_HAVE_VERSION
+	{
+		uint32_t v, v2;
+		/* readers do not change the version, writers do */
+		unit_assert(lock_rw_version(&d.lock, &v));
+		lock_rw_rdlock(&d.lock);
+		unit_assert(lock_rw_version(&d.lock, &v2) && v2 == v);
+		lock_rw_unlock(&d.lock);
+		unit_assert(lock_rw_version_check(&d.lock, v));
+		lock_rw_wrlock(&d.lock);
+		unit_assert(!lock_rw_version(&d.lock, &v2));
+		unit_assert(!lock_rw_version_check(&d.lock, v));
+		lock_rw_unlock(&d.lock);
+		unit_assert(!lock_rw_version_check(&d.lock, v));
+		unit_assert(lock_rw_version(&d.lock, &v2) && v2 != v);
+		/* the version only comes back after the counter wraps */
+		for(i=2; i<=(int)(LOCK_RW_GEN/LOCK_RW_GEN_ONE); i++) {
+			lock_rw_wrlock(&d.lock);
+			lock_rw_unlock(&d.lock);
+			unit_assert(!lock_rw_version_check(&d.lock, v));
+		}
+		lock_rw_wrlock(&d.lock);
+		lock_rw_unlock(&d.lock);
+		unit_assert(lock_rw_version_check(&d.lock, v));
+	}
+#endif
+	for(i=0; i<4; i++) {
+		t[i].num = i+1;
+		t[i].d = &d;
+		ub_thread_create(&t[i].id, lock_test_thr_main, &t[i]);
+	}
+	for(i=0; i<4; i++)
+		ub_thread_join(t[i].id);
+	unit_assert(d.a == 4*10000 && d.b == 4*10000);
+	lock_rw_destroy(&d.lock);
+#endif /* THREADS_DISABLED */
+}
+
 #include "util/net_help.h"
 /** test net code */
 static void 
@@ -341,6 +651,130 @@ net_test(void)
 	}
 }
 
+#include "util/netevent.h"
+#ifndef USE_WINSOCK
+#ifdef USE_MINI_EVENT
+#  include "util/mini_event.h"
+#else
+#  ifdef HAVE_EVENT_H
+#    include <event.h>
+#  else
+#    include "event2/event.h"
+#  endif
+#endif /* USE_MINI_EVENT */
+/** connect to the tcp idle test port, and send one byte if asked,
+ * the start of a query that keeps the tcp handler busy.  The accept
+ * callback is called, the event loop does not run in the test.
+ * Returns the client socket, and the handler in hdl. */
+static int
+tcp_idle_connect(struct comm_point* cp, struct sockaddr_storage* addr,
+	socklen_t len, int busy, struct comm_point** hdl)
+{
+	int s = socket(AF_INET, SOCK_STREAM, 0);
+	unit_assert(s != -1);
+	unit_assert(connect(s, (struct sockaddr*)addr, len) == 0);
+	fd_set_nonblock(s);
+	comm_point_tcp_accept_callback(cp->fd, EV_READ, cp);
+	/* the new connection is the most recently idle one */
+	*hdl = cp->tcp_idle_first;
+	unit_assert(*hdl && (*hdl)->fd != -1);
+	if(busy) {
+		unit_assert(send(s, (void*)"", 1, 0) == 1);
+		comm_point_tcp_handle_callback((*hdl)->fd, EV_READ, *hdl);
+		unit_assert(!(*hdl)->tcp_is_idle);
+	}
+	return s;
+}
+
+/** see if the server has closed the connection */
+static int
+tcp_idle_closed(int s)
+{
+	uint8_t buf[16];
+	return recv(s, (void*)buf, sizeof(buf), 0) == 0;
+}
+
+/** the idle timeout of a tcp handler, in msec */
+static int
+tcp_idle_timer(struct comm_point* h)
+{
+	return (int)h->timeout->tv_sec*1000 + (int)h->timeout->tv_usec/1000;
+}
+
+/** test that an idle tcp connection is closed for a new connection,
+ * when all the tcp handlers are in use, and that the idle connections
+ * get the shorter timeout when the handlers fill up */
+static void
+tcp_idle_test(void)
+{
+	struct comm_base* base;
+	struct comm_buffer_pool* pool;
+	struct comm_point* cp, *h1, *h2, *h3, *h4, *h5;
+	struct sockaddr_storage addr;
+	socklen_t len;
+	int i, s, c1, c2, c3, c4, c5;
+
+	unit_show_feature("tcp idle connections");
+	unit_assert(ipstrtoaddr("127.0.0.1", 0, &addr, &len));
+	s = socket(AF_INET, SOCK_STREAM, 0);
+	unit_assert(s != -1);
+	unit_assert(bind(s, (struct sockaddr*)&addr, len) == 0);
+	unit_assert(getsockname(s, (struct sockaddr*)&addr, &len) == 0);
+	unit_assert(listen(s, 5) == 0);
+	fd_set_nonblock(s);
+	unit_assert( (base = comm_base_create(0)) );
+	unit_assert( (pool = comm_buffer_pool_create(512, 2)) );
+	unit_assert( (cp = comm_point_create_tcp(base, s, 2, 30000, pool,
+		NULL, NULL)) );
+	/* there is no callback for closed connections */
+	for(i=0; i<cp->max_tcp_count; i++)
+		cp->tcp_handlers[i]->tcp_do_close = 1;
+
+	/* the first connection is busy with a query, the second one is
+	 * accepted on the last handler and the accept stops listening */
+	c1 = tcp_idle_connect(cp, &addr, len, 1, &h1);
+	c2 = tcp_idle_connect(cp, &addr, len, 0, &h2);
+	unit_assert(cp->cur_tcp_count == 2 && !cp->tcp_free);
+	unit_assert(cp->tcp_idle_last == h2 && !h2->tcp_idle_next);
+	/* listen_start_accept starts it again, there is an idle one */
+	comm_point_start_listening(cp, -1, -1);
+
+	/* one more connection is accepted, by closing the idle one */
+	c3 = tcp_idle_connect(cp, &addr, len, 0, &h3);
+	unit_assert(cp->cur_tcp_count == 2);
+	unit_assert(tcp_idle_closed(c2));
+	unit_assert(!tcp_idle_closed(c1) && !tcp_idle_closed(c3));
+	close(c1);
+	close(c2);
+	close(c3);
+	comm_point_tcp_handle_callback(h1->fd, EV_READ, h1);
+	comm_point_tcp_handle_callback(h3->fd, EV_READ, h3);
+	unit_assert(cp->cur_tcp_count == 0);
+
+	/* the first idle connection has the full timeout, the second
+	 * connection fills the handlers and shortens the timeout of the
+	 * first one to the minimum */
+	c4 = tcp_idle_connect(cp, &addr, len, 0, &h4);
+	unit_assert(h4->tcp_idle_msec == 30000);
+	unit_assert(tcp_idle_timer(h4) == 30000);
+	c5 = tcp_idle_connect(cp, &addr, len, 0, &h5);
+	unit_assert(cp->cur_tcp_count == 2);
+	unit_assert(h4->tcp_idle_msec == NETEVENT_TCP_IDLE_TIMEOUT_MIN);
+	unit_assert(tcp_idle_timer(h4) <= NETEVENT_TCP_IDLE_TIMEOUT_MIN);
+	unit_assert(tcp_idle_timer(h5) == NETEVENT_TCP_IDLE_TIMEOUT_MIN);
+	/* and the timeout closes it */
+	comm_point_tcp_handle_callback(h4->fd, EV_TIMEOUT, h4);
+	unit_assert(cp->cur_tcp_count == 1);
+	unit_assert(tcp_idle_closed(c4) && !tcp_idle_closed(c5));
+
+	close(c4);
+	close(c5);
+	comm_point_delete(cp);
+	comm_buffer_pool_delete(pool);
+	comm_base_delete(base);
+}
+#endif /* USE_WINSOCK */
+
 #include "util/config_file.h"
 /** test config_file: cfg_parse_memsize */
 static void
@@ -442,6 +876,7 @@ infra_test(void)
 	int vs, to;
 	struct infra_key* k;
 	struct infra_data* d;
+	struct timeval tv;
 	int init = 376;
 
 	unit_show_feature("infra cache");
@@ -500,10 +935,346 @@ infra_test(void)
 			now, &vs, &edns_lame, &to) );
 	unit_assert( vs == 0 && to == init && edns_lame == 1 );
 
+	/* upstream ratelimit, a bucket of 2 queries per second */
+	slab->zone_ratelimit = 2;
+	tv.tv_sec = now;
+	tv.tv_usec = 0;
+	unit_assert( infra_ratelimit_inc(slab, zone, zonelen, &one, onelen, &tv) );
+	unit_assert( infra_ratelimit_inc(slab, zone, zonelen, &one, onelen, &tv) );
+	unit_assert( !infra_ratelimit_inc(slab, zone, zonelen, &one, onelen, &tv) );
+	unit_assert( infra_ratelimit_inc(slab, (uint8_t*)"\003com\000", 5,
+		&one, onelen, &tv) );
+	/* refilled by one query in half a second */
+	tv.tv_usec = 500000;
+	unit_assert( infra_ratelimit_inc(slab, zone, zonelen, &one, onelen, &tv) );
+	unit_assert( !infra_ratelimit_inc(slab, zone, zonelen, &one, onelen, &tv) );
+	slab->zone_ratelimit = 0;
+	slab->server_ratelimit = 1;
+	unit_assert( infra_ratelimit_inc(slab, zone, zonelen, &one, onelen, &tv) );
+	unit_assert( !infra_ratelimit_inc(slab, zone, zonelen, &one, onelen, &tv) );
+	/* a query the server limit refuses is not taken from the zone */
+	slab->zone_ratelimit = 2;
+	tv.tv_sec += 2;
+	unit_assert( infra_ratelimit_inc(slab, zone, zonelen, &one, onelen, &tv) );
+	unit_assert( !infra_ratelimit_inc(slab, zone, zonelen, &one, onelen, &tv) );
+	unit_assert( !infra_ratelimit_inc(slab, zone, zonelen, &one, onelen, &tv) );
+	slab->server_ratelimit = 0;
+	unit_assert( infra_ratelimit_inc(slab, zone, zonelen, &one, onelen, &tv) );
+	unit_assert( !infra_ratelimit_inc(slab, zone, zonelen, &one, onelen, &tv) );
+
 	infra_delete(slab);
 	config_delete(cfg);
 }
 
+#include "services/rrl.h"
+#include "util/data/msgreply.h"
+/** test response rate limit */
+static void
+rrl_test(void)
+{
+	struct sockaddr_storage one, two, other;
+	socklen_t onelen, twolen, otherlen;
+	struct query_info q1, q2;
+	struct rrl* rrl;
+	struct timeval now;
+	int i, drop = 0, slip = 0;
+
+	unit_show_feature("response rate limit");
+	unit_assert(ipstrtoaddr("192.0.2.1", 53, &one, &onelen));
+	unit_assert(ipstrtoaddr("192.0.2.200", 1234, &two, &twolen));
+	unit_assert(ipstrtoaddr("198.51.100.1", 53, &other, &otherlen));
+	memset(&q1, 0, sizeof(q1));
+	q1.qname = (uint8_t*)"\007example\003com\000";
+	q1.qname_len = 13;
+	q1.qtype = LDNS_RR_TYPE_ANY;
+	q1.qclass = LDNS_RR_CLASS_IN;
+	q2 = q1;
+	q2.qname = (uint8_t*)"\007EXAMPLE\003net\000";
+	now.tv_sec = 10;
+	now.tv_usec = 900000;
+	unit_assert( (rrl = rrl_create(1000, 5, 2, 24, 56, 12345)) );
+	unit_assert( rrl->width == 1024 );
+
+	for(i=0; i<5; i++)
+		unit_assert(rrl_check(rrl, &one, onelen, &q1, &now)==rrl_pass);
+	/* same /24 prefix counts for the same client */
+	unit_assert(rrl_check(rrl, &two, twolen, &q1, &now) != rrl_pass);
+	/* other clients and other queries are not limited */
+	unit_assert(rrl_check(rrl, &other, otherlen, &q1, &now) == rrl_pass);
+	unit_assert(rrl_check(rrl, &one, onelen, &q2, &now) == rrl_pass);
+	/* every other query over the limit slips */
+	for(i=0; i<10; i++) {
+		enum rrl_action a = rrl_check(rrl, &one, onelen, &q1, &now);
+		if(a == rrl_drop) drop++;
+		else if(a == rrl_slip) slip++;
+	}
+	unit_assert(drop == 5 && slip == 5);
+	/* over the start of the next second, the bucket is still full */
+	now.tv_sec++;
+	now.tv_usec = 0;
+	unit_assert(rrl_check(rrl, &one, onelen, &q1, &now) != rrl_pass);
+	/* it drains at the ratelimit, one answer every 1/5 second */
+	now.tv_usec = 150000;
+	unit_assert(rrl_check(rrl, &one, onelen, &q1, &now) == rrl_pass);
+	unit_assert(rrl_check(rrl, &one, onelen, &q1, &now) != rrl_pass);
+	/* a second later it is empty again */
+	now.tv_sec++;
+	for(i=0; i<5; i++)
+		unit_assert(rrl_check(rrl, &one, onelen, &q1, &now)==rrl_pass);
+	unit_assert(rrl_check(rrl, &one, onelen, &q1, &now) != rrl_pass);
+	/* buckets that have been unused for a long time are empty */
+	now.tv_sec += 65536/2;
+	unit_assert(rrl_check(rrl, &one, onelen, &q1, &now) == rrl_pass);
+	unit_assert(rrl_get_mem(rrl) > 1024*RRL_DEPTH*sizeof(uint32_t));
+	rrl_delete(rrl);
+
+	/* slip 0 drops all */
+	unit_assert( (rrl = rrl_create(16, 1, 0, 24, 56, 1)) );
+	unit_assert(rrl_check(rrl, &one, onelen, &q1, &now) == rrl_pass);
+	for(i=0; i<10; i++)
+		unit_assert(rrl_check(rrl, &one, onelen, &q1, &now)==rrl_drop);
+	rrl_delete(rrl);
+}
+
+#include "services/hotnames.h"
+/** make the query for name number id, in nm */
+static void
+hotnames_query(struct query_info* q, uint8_t* nm, int id)
+{
+	memmove(nm, "\004w000\007example\003com", 18);
+	nm[2] = (uint8_t)('0' + (id/100)%10);
+	nm[3] = (uint8_t)('0' + (id/10)%10);
+	nm[4] = (uint8_t)('0' + id%10);
+	q->qname = nm;
+	q->qname_len = 18;
+	q->qtype = LDNS_RR_TYPE_A;
+	q->qclass = LDNS_RR_CLASS_IN;
+}
+
+/** test the popular queries table */
+static void
+hotnames_test(void)
+{
+	struct hotnames* hn;
+	struct hotname** top;
+	struct query_info q;
+	uint8_t nm[32];
+	size_t i, n;
+	time_t now = 10;
+
+	unit_show_feature("popular queries");
+	memset(&q, 0, sizeof(q));
+	unit_assert( (hn = hotnames_create(8, 2)) );
+	/* three popular names, in a stream of names that are seen once */
+	for(i=0; i<1000; i++) {
+		hotnames_query(&q, nm, (i%4 != 3)? (int)(i%4) : 100+(int)i);
+		hotnames_add(hn, &q, query_info_hash(&q), 0, now);
+	}
+	unit_assert(hn->num == 8);
+	n = hotnames_top(hn, HOTNAMES_MIN_COUNT, &top);
+	unit_assert(n == 3);
+	for(i=0; i<n; i++) {
+		unit_assert(top[i]->count - top[i]->error >= 200);
+		if(i > 0)
+			unit_assert(top[i-1]->count - top[i-1]->error >=
+				top[i]->count - top[i]->error);
+	}
+	/* lookup of a tracked name, the names seen once are gone */
+	hotnames_query(&q, nm, 2);
+	unit_assert(hotnames_count(hn, &q, query_info_hash(&q)) == 250);
+	hotnames_query(&q, nm, 103);
+	unit_assert(hotnames_count(hn, &q, query_info_hash(&q)) == 0);
+	/* the counts are halved after the decay time */
+	hotnames_query(&q, nm, 2);
+	hotnames_add(hn, &q, query_info_hash(&q), 0, now+HOTNAMES_DECAY);
+	unit_assert(hotnames_count(hn, &q, query_info_hash(&q)) == 126);
+	/* the prefetch budget per second */
+	unit_assert(hotnames_budget(hn, now));
+	unit_assert(hotnames_budget(hn, now));
+	unit_assert(!hotnames_budget(hn, now));
+	unit_assert(hotnames_budget(hn, now+1));
+	unit_assert(hotnames_get_mem(hn) > 8*sizeof(struct hotname));
+	hotnames_delete(hn);
+}
+
+#include "services/cache/l1cache.h"
+#include "util/data/packed_rrset.h"
+#include "util/data/msgencode.h"
+#include "util/data/msgparse.h"
+#include "util/net_help.h"
+#include "util/regional.h"
+#include "ldns/sbuffer.h"
+#ifdef LOCK_RW_HAVE_VERSION
+/** encode the answer and store it in the answer cache, for the test */
+static void
+l1cache_test_store(struct l1cache* l1, struct lruhash_entry* e,
+	struct query_info* q, hashvalue_t h, struct edns_data* edns,
+	struct reply_info* rep, struct regional* region, sldns_buffer* buf)
+{
+	sldns_buffer_clear(buf);
+	unit_assert(reply_info_answer_encode(q, rep, 0, BIT_RD, buf, 10, 1,
+		region, 512, edns, 0, 0));
+	l1cache_store(l1, e, q, h, BIT_RD, edns, 512, NULL, 0, 10, buf);
+}
+#endif
+
+/** test the answer cache of a thread */
+static void
+l1cache_test(void)
+{
+	struct l1cache* l1;
+	struct query_info q;
+	struct edns_data edns;
+	struct reply_info rep;
+	struct lruhash_entry e;
+	struct ub_packed_rrset_key k, *rrs[1];
+	/* the rrset data with room for one rr behind it */
+	struct {
+		struct packed_rrset_data d;
+		uint8_t rest[PACKED_RRSET_ARRAYS_SIZE(1) + 6];
+	} d;
+	uint8_t nm[] = "\003www\007example\003com";
+	uint8_t rdata[] = "\000\004\300\000\002\001";
+	struct regional* region = regional_create();
+	sldns_buffer* buf = sldns_buffer_new(65535);
+	hashvalue_t h;
+	uint16_t id = htons(0x1234);
+	int secure = 1;
+	size_t flush = 0;
+#ifdef LOCK_RW_HAVE_VERSION
+	struct reply_info rep2;
+	uint32_t v;
+#endif
+
+	unit_show_feature("answer cache of a thread");
+	unit_assert(region && buf);
+	memset(&q, 0, sizeof(q));
+	q.qname = nm;
+	q.qname_len = sizeof(nm);
+	q.qtype = LDNS_RR_TYPE_A;
+	q.qclass = LDNS_RR_CLASS_IN;
+	h = query_info_hash(&q);
+	memset(&edns, 0, sizeof(edns));
+	edns.udp_size = 512;
+	/* one A record, that expires at 100 */
+	memset(&d, 0, sizeof(d));
+	d.d.ttl = 100;
+	d.d.count = 1;
+	packed_rr_len(&d.d, 0) = 6;
+	packed_rrset_offs_setup(&d.d);
+	packed_rr_set_ttl(&d.d, 0, 100);
+	memmove(packed_rr_data(&d.d, 0), rdata, 6);
+	memset(&k, 0, sizeof(k));
+	k.rk.dname = nm;
+	k.rk.dname_len = sizeof(nm);
+	k.rk.type = htons(LDNS_RR_TYPE_A);
+	k.rk.rrset_class = htons(LDNS_RR_CLASS_IN);
+	k.id = 5;
+	k.entry.key = &k;
+	k.entry.data = &d.d;
+	rrs[0] = &k;
+	memset(&rep, 0, sizeof(rep));
+	rep.flags = BIT_QR|BIT_RA;
+	rep.qdcount = 1;
+	rep.ttl = 100;
+	rep.prefetch_ttl = 90;
+	rep.an_numrrsets = 1;
+	rep.rrset_count = 1;
+	rep.security = sec_status_unchecked;
+	rep.rrsets = rrs;
+	rep.ref[0].key = &k;
+	rep.ref[0].id = 5;
+
+	memset(&e, 0, sizeof(e));
+	lock_rw_init(&e.lock);
+	lock_rw_init(&k.entry.lock);
+	e.hash = h;
+	e.key = &q;
+	e.data = &rep;
+
+	unit_assert( (l1 = l1cache_create(10, &flush)) );
+	unit_assert(l1->mask == 15);
+	unit_assert(!l1cache_answer(l1, &e, &q, h, id, BIT_RD, &edns, 10, buf,
+		&secure));
+	unit_assert(reply_info_answer_encode(&q, &rep, 0, BIT_RD, buf, 10, 1,
+		region, 512, &edns, 0, 0));
+	l1cache_store(l1, &e, &q, h, BIT_RD, &edns, 512, NULL, 0, 10, buf);
+#ifdef LOCK_RW_HAVE_VERSION
+	sldns_buffer_clear(buf);
+	/* the answer has the query id and the TTL lowered */
+	unit_assert(l1cache_answer(l1, &e, &q, h, id, BIT_RD, &edns, 15, buf,
+		&secure));
+	unit_assert(secure == 0);
+	unit_assert(sldns_buffer_limit(buf) == 12+sizeof(nm)+4+2+10+4);
+	unit_assert(sldns_buffer_read_u16_at(buf, 0) == 0x1234);
+	unit_assert(LDNS_ANCOUNT(sldns_buffer_begin(buf)) == 1);
+	unit_assert(sldns_buffer_read_u32_at(buf, 12+sizeof(nm)+4+2+4)
+		== 85);
+	/* a different query, EDNS, or an expired message */
+	unit_assert(!l1cache_answer(l1, &e, &q, h, id, 0, &edns, 15, buf,
+		&secure));
+	edns.udp_size = 4096;
+	unit_assert(!l1cache_answer(l1, &e, &q, h, id, BIT_RD, &edns, 15, buf,
+		&secure));
+	edns.udp_size = 512;
+	unit_assert(l1cache_answer(l1, &e, &q, h, id, BIT_RD, &edns, 100, buf,
+		&secure));
+	unit_assert(!l1cache_answer(l1, &e, &q, h, id, BIT_RD, &edns, 101, buf,
+		&secure));
+	/* the rrset is deleted */
+	k.id = 0;
+	unit_assert(!l1cache_answer(l1, &e, &q, h, id, BIT_RD, &edns, 15, buf,
+		&secure));
+	k.id = 5;
+	unit_assert(!l1cache_answer(l1, &e, &q, h, id, BIT_RD, &edns, 15, buf,
+		&secure));
+	/* the rrset is written to, for an update in place */
+	l1cache_test_store(l1, &e, &q, h, &edns, &rep, region, buf);
+	unit_assert(l1cache_answer(l1, &e, &q, h, id, BIT_RD, &edns, 15, buf,
+		&secure));
+	lock_rw_wrlock(&k.entry.lock);
+	lock_rw_unlock(&k.entry.lock);
+	unit_assert(!l1cache_answer(l1, &e, &q, h, id, BIT_RD, &edns, 15, buf,
+		&secure));
+	/* the message entry is written to, or has another reply */
+	l1cache_test_store(l1, &e, &q, h, &edns, &rep, region, buf);
+	lock_rw_wrlock(&e.lock);
+	lock_rw_unlock(&e.lock);
+	unit_assert(!l1cache_answer(l1, &e, &q, h, id, BIT_RD, &edns, 15, buf,
+		&secure));
+	l1cache_test_store(l1, &e, &q, h, &edns, &rep, region, buf);
+	rep2 = rep;
+	e.data = &rep2;
+	unit_assert(!l1cache_answer(l1, &e, &q, h, id, BIT_RD, &edns, 15, buf,
+		&secure));
+	e.data = &rep;
+	/* the versions noted by the lock free encode are used */
+	l1cache_test_store(l1, &e, &q, h, &edns, &rep, region, buf);
+	unit_assert(lock_rw_version(&k.entry.lock, &v));
+	v += LOCK_RW_GEN_ONE;
+	l1cache_store(l1, &e, &q, h, BIT_RD, &edns, 512, &v, 0, 10, buf);
+	unit_assert(!l1cache_answer(l1, &e, &q, h, id, BIT_RD, &edns, 15, buf,
+		&secure));
+	/* a cache flush empties the cache */
+	l1cache_test_store(l1, &e, &q, h, &edns, &rep, region, buf);
+	flush++;
+	unit_assert(!l1cache_answer(l1, &e, &q, h, id, BIT_RD, &edns, 15, buf,
+		&secure));
+	l1cache_test_store(l1, &e, &q, h, &edns, &rep, region, buf);
+	unit_assert(l1cache_answer(l1, &e, &q, h, id, BIT_RD, &edns, 15, buf,
+		&secure));
+#else
+	/* without lock versions, nothing is stored */
+	unit_assert(!l1cache_answer(l1, &e, &q, h, id, BIT_RD, &edns, 15, buf,
+		&secure));
+#endif
+	unit_assert(l1cache_get_mem(l1) > 16*sizeof(struct l1cache_slot));
+
+	l1cache_delete(l1);
+	sldns_buffer_free(buf);
+	regional_destroy(region);
+}
+
 #include "util/random.h"
 /** test randomness */
 static void
@@ -536,6 +1307,47 @@ rnd_test(void)
 	ub_randfree(r);
 }
 
+#include "util/storage/keyhash.h"
+#include "util/storage/lookup3.h"
+/** test the keyed hash with the SipHash reference vectors */
+static void
+keyhash_test(void)
+{
+	uint8_t key[KEYHASH_KEY_SIZE], in[64], other[KEYHASH_KEY_SIZE];
+	uint32_t h1, h2;
+	size_t i;
+	unit_show_feature("keyhash");
+	for(i=0; i<sizeof(key); i++)
+		key[i] = (uint8_t)i;
+	for(i=0; i<sizeof(in); i++)
+		in[i] = (uint8_t)i;
+	/* SipHash-2-4 vectors from the paper, and SipHash-1-3 of the same */
+	unit_assert(siphash_2_4(key, in, 0) == 0x726fdb47dd0e0e31ULL);
+	unit_assert(siphash_2_4(key, in, 1) == 0x74f839c593dc67fdULL);
+	unit_assert(siphash_2_4(key, in, 8) == 0x93f5f5799a932462ULL);
+	unit_assert(siphash_2_4(key, in, 15) == 0xa129ca6149be45e5ULL);
+	unit_assert(siphash_2_4(key, in, 63) == 0x958a324ceb064572ULL);
+	unit_assert(siphash_1_3(key, in, 0) == 0xabac0158050fc4dcULL);
+	unit_assert(siphash_1_3(key, in, 15) == 0xd320d86d2a519956ULL);
+	unit_assert(siphash_1_3(key, in, 63) == 0x9d199062b7bbb3a8ULL);
+
+	/* the key and the previous hash change the result */
+	keyhash_set_key(key);
+	h1 = keyhash(in, 10, 0);
+	unit_assert(h1 == keyhash(in, 10, 0));
+	unit_assert(h1 != keyhash(in, 10, 1));
+	unit_assert(h1 != keyhash(in, 11, 0));
+	memcpy(other, key, sizeof(other));
+	other[15] ^= 1;
+	keyhash_set_key(other);
+	h2 = keyhash(in, 10, 0);
+	unit_assert(h1 != h2);
+	keyhash_set_func(keyhash_lookup3);
+	unit_assert(keyhash(in, 10, 7) == hashlittle(in, 10, 7));
+	keyhash_set_func(keyhash_siphash);
+	unit_assert(keyhash(in, 10, 0) == h2);
+}
+
 void unit_show_func(const char* file, const char* func)
 {
 	printf("test %s:%s\n", file, func);
@@ -577,17 +1389,28 @@ main(int argc, char* argv[])
 	checklock_start();
 	neg_test();
 	rnd_test();
+	keyhash_test();
 	verify_test();
 	net_test();
+#ifndef USE_WINSOCK
+	tcp_idle_test();
+#endif
 	config_memsize_test();
 	dname_test();
 	rtt_test();
 	anchors_test();
 	alloc_test();
+	alloc_sized_test();
+	alloc_read_test();
+	alloc_arena_test();
+	lock_test();
 	regional_test();
 	lruhash_test();
 	slabhash_test();
 	infra_test();
+	rrl_test();
+	hotnames_test();
+	l1cache_test();
 	ldns_test();
 	msgparse_test();
 	checklock_stop();
@@ -65,6 +65,17 @@ static int matches_nolocation = 0;
 static int check_rrsigs = 0;
 /** do not check buffer sameness */
 static int check_nosameness = 0;
+/** measure the parse and encode speed of the packets, instead of testing
+ * them */
+static int perf_corpus = 0;
+/** the encodes done for perf_corpus */
+static size_t perf_corpus_num = 0;
+/** the bytes encoded for perf_corpus */
+static size_t perf_corpus_bytes = 0;
+/** the time spent in encodes for perf_corpus, in msec */
+static double perf_corpus_msec = 0;
+/** the time spent in parses for perf_corpus, in msec */
+static double perf_corpus_parse_msec = 0;
 
 /** see if buffers contain the same packet */
 static int
@@ -232,6 +243,179 @@ perftestpkt(sldns_buffer* pkt, struct alloc_cache* alloc, sldns_buffer* out,
 	regional_destroy(region);
 }
 
+/** measure the parse and encode of a packet of the corpus, add it to the
+ * totals */
+static void
+perfcorpuspkt(sldns_buffer* pkt, struct alloc_cache* alloc,
+	sldns_buffer* out, const char* hex)
+{
+	struct query_info qi;
+	struct reply_info* rep = 0, *cp;
+	struct regional* region = regional_create();
+	struct regional* r2 = regional_create();
+	struct edns_data edns;
+	struct timeval start, end;
+	size_t i, max = 1000;
+	uint16_t id, flags;
+
+	unit_assert(region && r2);
+	hex_to_buf(pkt, hex);
+	if(sldns_buffer_limit(pkt) < LDNS_HEADER_SIZE ||
+		reply_info_parse(pkt, alloc, &qi, &rep, region, &edns) != 0 ||
+		rep->rrset_count == 0) {
+		/* not a response with data */
+		query_info_clear(&qi);
+		reply_info_parsedelete(rep, alloc);
+		regional_destroy(region);
+		regional_destroy(r2);
+		return;
+	}
+	memmove(&id, sldns_buffer_begin(pkt), sizeof(id));
+	flags = sldns_buffer_read_u16_at(pkt, 2);
+	/* answers are encoded from the cache copy of the reply */
+	cp = reply_info_copy(rep, alloc, NULL);
+	unit_assert(cp);
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<max; i++) {
+		struct msg_parse* msg = regional_alloc_zero(r2, sizeof(*msg));
+		unit_assert(msg);
+		sldns_buffer_set_position(pkt, 0);
+		unit_assert(parse_packet(pkt, msg, r2) == 0);
+		unit_assert(parse_extract_edns(msg, &edns) == 0);
+		unit_assert(parse_msg_calc_size(pkt, msg) == 0);
+		regional_free_all(r2);
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	perf_corpus_parse_msec += (double)(end.tv_sec - start.tv_sec)*1000. +
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<max; i++) {
+		unit_assert(reply_info_encode(&qi, cp, id, flags, out, 0,
+			r2, 65535, 1));
+		regional_free_all(r2);
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	perf_corpus_msec += (double)(end.tv_sec - start.tv_sec)*1000. +
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	perf_corpus_num += max;
+	perf_corpus_bytes += max * sldns_buffer_limit(out);
+
+	query_info_clear(&qi);
+	reply_info_parsedelete(cp, alloc);
+	reply_info_parsedelete(rep, alloc);
+	regional_destroy(region);
+	regional_destroy(r2);
+}
+
+/** add an RR in presentation format to the answer section of pkt */
+static void
+add_answer_rr(sldns_buffer* pkt, const char* str)
+{
+	size_t len = sldns_buffer_remaining(pkt), dlen = 0;
+	unit_assert(sldns_str2wire_rr_buf(str, sldns_buffer_current(pkt),
+		&len, &dlen, 3600, NULL, 0, NULL, 0) == 0);
+	sldns_buffer_skip(pkt, (ssize_t)len);
+	sldns_buffer_write_u16_at(pkt, 6, sldns_buffer_read_u16_at(pkt, 6)+1);
+}
+
+/** time the encodes of the reply, in msec, the encoded answer is in out */
+static double
+perf_encode_msec(struct query_info* qi, struct reply_info* rep,
+	sldns_buffer* out, struct regional* r2, size_t max)
+{
+	struct timeval start, end;
+	size_t i;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<max; i++) {
+		unit_assert(reply_info_encode(qi, rep, 0x1234, 0x8180, out, 0,
+			r2, 65535, 1));
+		regional_free_all(r2);
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	return (double)(end.tv_sec - start.tv_sec)*1000. +
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+}
+
+/** measure the encode of a large signed TXT rrset, from the cache copy
+ * with wire headers, and from the parsed rrset without them */
+static void
+perf_large_rrset(sldns_buffer* pkt, struct alloc_cache* alloc,
+	sldns_buffer* out)
+{
+	struct query_info qi;
+	struct reply_info* rep = 0, *cp;
+	struct regional* region = regional_create();
+	struct regional* r2 = regional_create();
+	struct edns_data edns;
+	sldns_buffer* plain = sldns_buffer_new(65535);
+	char txt[256], sig[512], str[1024];
+	double wire_msec = 0, plain_msec = 0;
+	size_t i, round, max = 20000;
+	uint8_t qname[] = "\003www\007example\003com";
+
+	unit_assert(region && r2 && plain);
+	/* the query, and 8 TXT records of 200 bytes with 2 RSA signatures */
+	sldns_buffer_clear(pkt);
+	sldns_buffer_write_u16(pkt, 0x1234);
+	sldns_buffer_write_u16(pkt, 0x8180);
+	sldns_buffer_write_u16(pkt, 1);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write(pkt, qname, sizeof(qname));
+	sldns_buffer_write_u16(pkt, LDNS_RR_TYPE_TXT);
+	sldns_buffer_write_u16(pkt, LDNS_RR_CLASS_IN);
+	memset(sig, 'A', 344);
+	sig[344] = 0;
+	for(i=0; i<8; i++) {
+		memset(txt, (int)('a'+i), 200);
+		txt[200] = 0;
+		snprintf(str, sizeof(str), "www.example.com. 3600 IN TXT "
+			"\"%s\"", txt);
+		add_answer_rr(pkt, str);
+	}
+	for(i=0; i<2; i++) {
+		snprintf(str, sizeof(str), "www.example.com. 3600 IN RRSIG "
+			"TXT 8 3 3600 20300101000000 20200101000000 %d "
+			"example.com. %s", (int)(1000+i), sig);
+		add_answer_rr(pkt, str);
+	}
+	sldns_buffer_flip(pkt);
+	unit_assert(reply_info_parse(pkt, alloc, &qi, &rep, region,
+		&edns) == 0);
+	cp = reply_info_copy(rep, alloc, NULL);
+	unit_assert(cp && cp->rrset_count == 1);
+	unit_assert(((struct packed_rrset_data*)cp->rrsets[0]->entry.data)
+		->wire);
+	unit_assert(!((struct packed_rrset_data*)rep->rrsets[0]->entry.data)
+		->wire);
+	/* alternate, so that both see the same machine load */
+	for(round=0; round<5; round++) {
+		wire_msec += perf_encode_msec(&qi, cp, out, r2, max);
+		plain_msec += perf_encode_msec(&qi, rep, plain, r2, max);
+	}
+	unit_assert(sldns_buffer_limit(out) == sldns_buffer_limit(plain) &&
+		memcmp(sldns_buffer_begin(out), sldns_buffer_begin(plain),
+		sldns_buffer_limit(out)) == 0);
+	printf("large rrset encode: %u bytes, %g msec with wire headers, "
+		"%g msec without, for %u encodes\n",
+		(unsigned)sldns_buffer_limit(out), wire_msec, plain_msec,
+		(unsigned)(5*max));
+
+	query_info_clear(&qi);
+	reply_info_parsedelete(cp, alloc);
+	reply_info_parsedelete(rep, alloc);
+	sldns_buffer_free(plain);
+	regional_destroy(region);
+	regional_destroy(r2);
+}
+
 /** print packed rrset */
 static void
 print_rrset(struct ub_packed_rrset_key* rrset)
@@ -310,6 +494,39 @@ check_the_rrsigs(struct query_info* qinfo, struct reply_info* rep)
 }
 
 /** test a packet */
+/** check that the cache copy of the reply, with the rrsets stored with
+ * wire headers, encodes to the same packet */
+static void
+check_cache_copy(struct query_info* qi, struct reply_info* rep, uint16_t id,
+	uint16_t flags, struct alloc_cache* alloc, struct regional* region,
+	sldns_buffer* out, int dnssec)
+{
+	struct reply_info* cp = reply_info_copy(rep, alloc, NULL);
+	sldns_buffer* out2 = sldns_buffer_new(65535);
+	unit_assert(cp && out2);
+	unit_assert(reply_info_encode(qi, cp, id, flags, out2, 0, region,
+		65535, dnssec));
+	unit_assert(reply_info_encode(qi, rep, id, flags, out, 0, region,
+		65535, dnssec));
+	unit_assert(sldns_buffer_limit(out) == sldns_buffer_limit(out2));
+	unit_assert(memcmp(sldns_buffer_begin(out), sldns_buffer_begin(out2),
+		sldns_buffer_limit(out)) == 0);
+	/* a truncated encode stops at the same rrset */
+	if(sldns_buffer_limit(out) > 512) {
+		unit_assert(reply_info_encode(qi, cp, id, flags, out2, 0,
+			region, 512, dnssec));
+		unit_assert(reply_info_encode(qi, rep, id, flags, out, 0,
+			region, 512, dnssec));
+		unit_assert(sldns_buffer_limit(out) ==
+			sldns_buffer_limit(out2));
+		unit_assert(memcmp(sldns_buffer_begin(out),
+			sldns_buffer_begin(out2), sldns_buffer_limit(out))
+			== 0);
+	}
+	sldns_buffer_free(out2);
+	reply_info_parsedelete(cp, alloc);
+}
+
 static void
 testpkt(sldns_buffer* pkt, struct alloc_cache* alloc, sldns_buffer* out, 
 	const char* hex)
@@ -320,9 +537,14 @@ testpkt(sldns_buffer* pkt, struct alloc_cache* alloc, sldns_buffer* out,
 	uint16_t id;
 	uint16_t flags;
 	uint32_t timenow = 0;
-	struct regional* region = regional_create();
+	struct regional* region;
 	struct edns_data edns;
 
+	if(perf_corpus) {
+		perfcorpuspkt(pkt, alloc, out, hex);
+		return;
+	}
+	region = regional_create();
 	hex_to_buf(pkt, hex);
 	memmove(&id, sldns_buffer_begin(pkt), sizeof(id));
 	if(sldns_buffer_limit(pkt) < 2)
@@ -341,6 +563,8 @@ testpkt(sldns_buffer* pkt, struct alloc_cache* alloc, sldns_buffer* out,
 		unit_assert(ret != LDNS_RCODE_SERVFAIL);
 	} else if(!check_formerr_gone) {
 		const size_t lim = 512;
+		check_cache_copy(&qi, rep, id, flags, alloc, region, out,
+			(int)(edns.bits & EDNS_DO));
 		ret = reply_info_encode(&qi, rep, id, flags, out, timenow,
 			region, 65535, (int)(edns.bits & EDNS_DO) );
 		unit_assert(ret != 0); /* udp packets should fit */
@@ -435,6 +659,130 @@ simpletest(sldns_buffer* pkt, struct alloc_cache* alloc, sldns_buffer* out)
 	);
 }
 
+/** test that the rdata is sized (and checked) after parse_packet */
+static void
+lazysizetest(sldns_buffer* pkt)
+{
+	struct regional* region = regional_create();
+	struct msg_parse* msg;
+	unit_assert(region);
+
+	/* NS rrset with compressed rdata; \001a + ptr to the root */
+	hex_to_buf(pkt, "00 01 81 80 00 01 00 01 00 00 00 00 00 00 02 00 01 "
+		"c0 0c 00 02 00 01 00 00 0e 10 00 04 01 61 c0 0c");
+	msg = regional_alloc_zero(region, sizeof(*msg));
+	unit_assert(msg);
+	unit_assert(parse_packet(pkt, msg, region) == 0);
+	unit_assert(msg->rrset_first && msg->rrset_first->rr_first);
+	unit_assert(msg->rrset_first->rr_first->size == 0);
+	unit_assert(msg->rrset_first->size == 0);
+	sldns_buffer_set_position(pkt, 7);
+	unit_assert(parse_msg_calc_size(pkt, msg) == 0);
+	unit_assert(sldns_buffer_position(pkt) == 7);
+	unit_assert(msg->rrset_first->rr_first->size == 2+3);
+	unit_assert(msg->rrset_first->size == 2+3);
+	/* sizing again does not count it twice */
+	unit_assert(parse_rrset_calc_size(pkt, msg->rrset_first));
+	unit_assert(msg->rrset_first->size == 2+3);
+
+	/* the label in the rdata runs past the rdata */
+	hex_to_buf(pkt, "00 01 81 80 00 01 00 01 00 00 00 00 00 00 02 00 01 "
+		"c0 0c 00 02 00 01 00 00 0e 10 00 03 05 61 62");
+	msg = regional_alloc_zero(region, sizeof(*msg));
+	unit_assert(msg);
+	unit_assert(parse_packet(pkt, msg, region) == 0);
+	unit_assert(parse_msg_calc_size(pkt, msg) == LDNS_RCODE_FORMERR);
+	regional_destroy(region);
+}
+
+/** test the decode of the EDNS options of queries, and the encode */
+static void
+ednsopttest(sldns_buffer* pkt)
+{
+	struct edns_data edns;
+	struct edns_option o1, o2, *copy;
+	struct regional* region = regional_create();
+	uint8_t cookie[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+	uint8_t ka[2] = {0, 100};
+	size_t len;
+
+	/* cookie, nsid, client-subnet, keepalive and padding options */
+	hex_to_buf(pkt, "00 01 01 00 00 01 00 00 00 00 00 01 00 00 01 00 01 "
+		"00 00 29 10 00 00 00 80 00 00 25 "
+		"00 0a 00 08 01 02 03 04 05 06 07 08 00 03 00 00 "
+		"00 08 00 07 00 01 18 00 0a 01 02 00 0b 00 00 "
+		"00 0c 00 02 00 00");
+	sldns_buffer_set_position(pkt, 17);
+	unit_assert(parse_edns_from_pkt(pkt, &edns) == 0);
+	unit_assert(edns.edns_present && edns.udp_size == 4096 &&
+		edns.bits == EDNS_DO && !edns.opt_list);
+	unit_assert(edns.cookie.pos == 32 && edns.cookie.len == 8);
+	unit_assert(memcmp(sldns_buffer_at(pkt, edns.cookie.pos), cookie, 8)
+		== 0);
+	unit_assert(edns.subnet.pos == 48 && edns.subnet.len == 7);
+	unit_assert(edns.keepalive.pos == 59 && edns.keepalive.len == 0);
+	unit_assert(edns.padding.pos == 63 && edns.padding.len == 2);
+	unit_assert(sldns_buffer_remaining(pkt) == 0);
+
+	/* no options */
+	hex_to_buf(pkt, "00 01 01 00 00 01 00 00 00 00 00 01 00 00 01 00 01 "
+		"00 00 29 10 00 00 00 00 00 00 00");
+	sldns_buffer_set_position(pkt, 17);
+	unit_assert(parse_edns_from_pkt(pkt, &edns) == 0);
+	unit_assert(edns.edns_present && edns.cookie.pos == 0 &&
+		edns.subnet.pos == 0 && edns.keepalive.pos == 0 &&
+		edns.padding.pos == 0);
+
+	/* the option runs past the rdata, the rdata past the packet */
+	hex_to_buf(pkt, "00 01 01 00 00 01 00 00 00 00 00 01 00 00 01 00 01 "
+		"00 00 29 10 00 00 00 00 00 00 04 00 0a 00 08 01 02 03 04");
+	sldns_buffer_set_position(pkt, 17);
+	unit_assert(parse_edns_from_pkt(pkt, &edns) == LDNS_RCODE_FORMERR);
+	hex_to_buf(pkt, "00 01 01 00 00 01 00 00 00 00 00 01 00 00 01 00 01 "
+		"00 00 29 10 00 00 00 00 00 00 10 00 0b 00 00");
+	sldns_buffer_set_position(pkt, 17);
+	unit_assert(parse_edns_from_pkt(pkt, &edns) == LDNS_RCODE_FORMERR);
+
+	/* the options are appended to the OPT record */
+	hex_to_buf(pkt, "00 01 81 00 00 01 00 00 00 00 00 00 00 00 01 00 01");
+	memset(&edns, 0, sizeof(edns));
+	edns.edns_present = 1;
+	edns.udp_size = 1232;
+	o1.next = &o2;
+	o1.opt_code = LDNS_EDNS_COOKIE;
+	o1.opt_len = sizeof(cookie);
+	o1.opt_data = cookie;
+	o2.next = NULL;
+	o2.opt_code = LDNS_EDNS_KEEPALIVE;
+	o2.opt_len = sizeof(ka);
+	o2.opt_data = ka;
+	edns.opt_list = &o1;
+	len = calc_edns_field_size(&edns);
+	unit_assert(len == 11 + 4+8 + 4+2);
+	attach_edns_record(pkt, &edns);
+	unit_assert(sldns_buffer_limit(pkt) == 17 + len);
+	unit_assert(LDNS_ARCOUNT(sldns_buffer_begin(pkt)) == 1);
+	sldns_buffer_set_position(pkt, 17);
+	unit_assert(parse_edns_from_pkt(pkt, &edns) == 0);
+	unit_assert(edns.udp_size == 1232 && !edns.opt_list);
+	unit_assert(edns.cookie.pos == 32 && edns.cookie.len == 8);
+	unit_assert(edns.keepalive.pos == 44 && edns.keepalive.len == 2);
+	unit_assert(sldns_buffer_read_u16_at(pkt, 44) == 100);
+
+	/* a copy of the options does not change with the originals */
+	unit_assert(region);
+	copy = edns_opt_copy_region(&o1, region);
+	unit_assert(copy && copy != &o1 && copy->next && !copy->next->next);
+	ka[1] = 200;
+	unit_assert(copy->opt_code == LDNS_EDNS_COOKIE &&
+		copy->opt_len == sizeof(cookie) &&
+		memcmp(copy->opt_data, cookie, sizeof(cookie)) == 0);
+	unit_assert(copy->next->opt_code == LDNS_EDNS_KEEPALIVE &&
+		copy->next->opt_len == 2 &&
+		sldns_read_uint16(copy->next->opt_data) == 100);
+	regional_destroy(region);
+}
+
 /** simple test of parsing, pcat file */
 static void
 testfromfile(sldns_buffer* pkt, struct alloc_cache* alloc, sldns_buffer* out,
@@ -506,6 +854,8 @@ void msgparse_test(void)
 
 	unit_show_feature("message parse");
 	simpletest(pkt, &alloc, out);
+	lazysizetest(pkt);
+	ednsopttest(pkt);
 	/* plain hex dumps, like pcat */
 	testfromfile(pkt, &alloc, out, "testdata/test_packets.1");
 	testfromfile(pkt, &alloc, out, "testdata/test_packets.2");
@@ -531,6 +881,22 @@ void msgparse_test(void)
 	check_nosameness = 0;
 	check_rrsigs = 0;
 
+	/* encode speed, over the responses in the test files */
+	perf_corpus = 1;
+	testfromfile(pkt, &alloc, out, "testdata/test_packets.3");
+	testfromdrillfile(pkt, &alloc, out, "testdata/test_packets.4");
+	testfromdrillfile(pkt, &alloc, out, "testdata/test_packets.7");
+	perf_corpus = 0;
+	printf("corpus encode: did %u in %g msec for %f encode/sec, "
+		"%u bytes per packet\n", (unsigned)perf_corpus_num,
+		perf_corpus_msec, (double)perf_corpus_num /
+		(perf_corpus_msec/1000.), (unsigned)(perf_corpus_bytes /
+		(perf_corpus_num?perf_corpus_num:1)));
+	printf("corpus parse: did %u in %g msec for %f parse/sec\n",
+		(unsigned)perf_corpus_num, perf_corpus_parse_msec,
+		(double)perf_corpus_num / (perf_corpus_parse_msec/1000.));
+	perf_large_rrset(pkt, &alloc, out);
+
 	/* cleanup */
 	alloc_clear(&alloc);
 	alloc_clear(&super_a);
@@ -193,11 +193,12 @@ static void get_random_data(char** fromp, char** top, char* zname)
 static void add_item(struct val_neg_cache* neg)
 {
 	struct val_neg_zone* z;
-	struct packed_rrset_data rd;
+	/* the rrset data with room for one rr behind it */
+	struct {
+		struct packed_rrset_data d;
+		uint8_t rest[PACKED_RRSET_ARRAYS_SIZE(1) + 256];
+	} rd;
 	struct ub_packed_rrset_key nsec;
-	size_t rr_len;
-	time_t rr_ttl;
-	uint8_t* rr_data;
 	char* zname = get_random_zone();
 	char* from, *to;
 
@@ -223,15 +224,14 @@ static void add_item(struct val_neg_cache* neg)
 	nsec.rk.dname_len = strlen(from)+1;
 	nsec.rk.type = htons(LDNS_RR_TYPE_NSEC);
 	nsec.rk.rrset_class = htons(LDNS_RR_CLASS_IN);
-	nsec.entry.data = &rd;
-	rd.security = sec_status_secure;
-	rd.count = 1;
-	rd.rr_len = &rr_len;
-	rr_len = 19;
-	rd.rr_ttl = &rr_ttl;
-	rr_ttl = 0;
-	rd.rr_data = &rr_data;
-	rr_data = (uint8_t*)to;
+	nsec.entry.data = &rd.d;
+	rd.d.security = sec_status_secure;
+	rd.d.count = 1;
+	packed_rr_len(&rd.d, 0) = 19;
+	packed_rrset_offs_setup(&rd.d);
+	packed_rr_set_ttl(&rd.d, 0, 0);
+	/* the name is read from the rdata, it can be longer */
+	memmove(packed_rr_data(&rd.d, 0), to, 256);
 
 	neg_insert_data(neg, z, &nsec);
 	lock_basic_unlock(&neg->lock);
@@ -42,6 +42,7 @@
 #include "testcode/unitmain.h"
 #include "util/log.h"
 #include "util/regional.h"
+#include "util/alloc.h"
 
 /** test regional corner cases, zero, one, end of structure */
 static void
@@ -236,9 +237,56 @@ random_burden(void)
 		burden_test(max_alloc);
 }
 
+/** test regional with chunks from an alloc cache, and reserve */
+static void
+pooled_test(void)
+{
+	struct alloc_cache super, minor;
+	struct regional* r;
+	size_t i, n;
+	void* a;
+	alloc_init(&super, NULL, 0);
+	alloc_init(&minor, &super, 1);
+
+	r = alloc_reg_obtain(&minor);
+	unit_assert(r && r->alloc == &minor);
+	n = regional_get_mem(r);
+	regional_reserve(r, 100); /* fits already */
+	unit_assert(r->next == NULL && regional_get_mem(r) == n);
+	regional_reserve(r, 65536);
+	unit_assert(r->next != NULL && r->available >= 65536);
+	unit_assert(regional_get_mem(r) > n + 65536);
+	a = regional_alloc(r, 10240); /* large, fits in reserved chunk */
+	unit_assert(a && r->large_list == NULL);
+	memset(a, 0x42, 10240);
+	for(i=0; i<100; i++) {
+		a = regional_alloc(r, 3000);
+		unit_assert(a);
+		memset(a, 0x42, 3000);
+	}
+	alloc_reg_release(&minor, r);
+
+	/* the chunks come back from the pool */
+	r = alloc_reg_obtain(&minor);
+	unit_assert(r && r->next == NULL && r->large_list == NULL);
+	for(i=0; i<100; i++) {
+		a = regional_alloc(r, (i%2)?500:5000);
+		unit_assert(a);
+		memset(a, 0x42, (i%2)?500:5000);
+	}
+	regional_free_all(r);
+	unit_assert(r->next == NULL && r->large_list == NULL);
+	unit_assert(regional_get_mem(r) == r->first_size);
+	alloc_reg_release(&minor, r);
+
+	alloc_clear(&minor);
+	alloc_clear(&super);
+}
+
 void regional_test(void)
 {
 	unit_show_feature("regional");
 	specific_cases();
 	random_burden();
+	pooled_test();
 }
@@ -151,7 +151,7 @@ static void
 check_lru_table(struct lruhash* table)
 {
 	struct lruhash_entry* p;
-	size_t c = 0;
+	size_t c = 0, w = 0;
 	lock_quick_lock(&table->lock);
 	unit_assert( table->num <= table->size);
 	unit_assert( table->size_mask == (int)table->size-1 );
@@ -174,7 +174,26 @@ check_lru_table(struct lruhash* table)
 		c++;
 		p = p->lru_next;
 	}
+	/* and the admission window, that holds the rest of the entries */
+	unit_assert( (table->win_start && table->win_end) ||
+		(!table->win_start && !table->win_end) );
+	if(!table->admission)
+		unit_assert(!table->win_start && table->win_used == 0);
+	p = table->win_start;
+	while(p) {
+		unit_assert(p->in_window);
+		w += test_slabhash_sizefunc(p->key, p->data);
+		if(p->lru_prev) {
+			unit_assert(p->lru_prev->lru_next == p);
+		}
+		if(p->lru_next) {
+			unit_assert(p->lru_next->lru_prev == p);
+		}
+		c++;
+		p = p->lru_next;
+	}
 	unit_assert(c == table->num);
+	unit_assert(w == table->win_used);
 
 	/* this assertion is specific to the unit test */
 	unit_assert( table->space_used == 
@@ -356,6 +375,102 @@ test_threaded_table(struct slabhash* table)
 	if(0) slabhash_status(table, "hashtest", 1);
 }
 
+/** look up the key, and insert it if it is not there, like a cache */
+static int
+test_access(struct slabhash* table, int id)
+{
+	/* a hash that spreads the ids, the sketch needs it */
+	hashvalue_t h = (hashvalue_t)id * 0x9e3779b1;
+	testkey_t* key = newkey(id);
+	struct lruhash_entry* en;
+	key->entry.hash = h;
+	if((en = slabhash_lookup(table, h, key, 0))) {
+		lock_rw_unlock(&en->lock);
+		delkey(key);
+		return 1;
+	}
+	key->entry.data = newdata(id);
+	slabhash_insert(table, h, &key->entry, key->entry.data, NULL);
+	return 0;
+}
+
+/** test that the admission filter keeps popular entries during a scan */
+static void
+test_admission(void)
+{
+	size_t sz = test_slabhash_sizefunc(NULL, NULL);
+	struct slabhash* table = slabhash_create(1, 16, 100*sz,
+		test_slabhash_sizefunc, test_slabhash_compfunc,
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	struct tinylfu* lfu;
+	int i, j, hits = 0;
+	unit_assert(table);
+	unit_assert(slabhash_set_admission(table, 1, 1234));
+	/* popular entries, and a scan of entries that are used once */
+	for(j=0; j<5; j++)
+		for(i=0; i<50; i++)
+			(void)test_access(table, i);
+	check_table(table);
+	for(i=1000; i<3000; i++) {
+		(void)test_access(table, i);
+		/* the popular entries stay in use */
+		if(i%2 == 0)
+			(void)test_access(table, (i/2)%50);
+	}
+	check_table(table);
+	for(i=0; i<50; i++)
+		hits += test_access(table, i);
+	unit_assert(hits >= 45);
+	/* turned on again, as on a reload, the counts are kept */
+	lfu = table->array[0]->admission;
+	unit_assert(slabhash_set_admission(table, 1, 5678));
+	unit_assert(table->array[0]->admission == lfu);
+	/* turned off, the window is merged with the lru */
+	unit_assert(!slabhash_set_admission(table, 0, 0));
+	check_table(table);
+	unit_assert(table->array[0]->num > 50);
+	slabhash_delete(table);
+}
+
+/** test the removal of expired entries by the expiry scan */
+static void
+test_expiry_scan(void)
+{
+	struct slabhash* table = slabhash_create(1, 2, 1024*1024,
+		test_slabhash_sizefunc, test_slabhash_compfunc,
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	size_t i, n = 0, live, expired;
+	unit_assert(table);
+	/* the data value is the expiry time */
+	for(i=0; i<100; i++) {
+		testkey_t* k = newkey((int)i);
+		testdata_t* d = newdata((int)i);
+		k->entry.hash = (hashvalue_t)i * 0x9e3779b1;
+		k->entry.data = d;
+		slabhash_insert(table, k->entry.hash, &k->entry, d, NULL);
+	}
+	/* in small slices, the whole table is scanned */
+	for(i=0; i<table->array[0]->size; i++)
+		n += slabhash_reclaim_expired(table, &test_slabhash_expired,
+			49, 1);
+	unit_assert(n == 49);
+	check_table(table);
+	/* the next call completes the pass and updates the counts */
+	(void)slabhash_reclaim_expired(table, &test_slabhash_expired, 49, 1);
+	slabhash_expiry_stats(table, &live, &expired);
+	unit_assert(live == 51 && expired == 49);
+	for(i=0; i<100; i++) {
+		testkey_t* k = newkey((int)i);
+		struct lruhash_entry* e;
+		k->entry.hash = (hashvalue_t)i * 0x9e3779b1;
+		e = slabhash_lookup(table, k->entry.hash, k, 0);
+		unit_assert((e != NULL) == (i >= 49));
+		if(e) { lock_rw_unlock(&e->lock); }
+		delkey(k);
+	}
+	slabhash_delete(table);
+}
+
 void slabhash_test(void)
 {
 	/* start very very small array, so it can do lots of table_grow() */
@@ -373,4 +488,14 @@ void slabhash_test(void)
 		test_slabhash_delkey, test_slabhash_deldata, NULL);
 	test_threaded_table(table);
 	slabhash_delete(table);
+	/* again, with the admission filter */
+	table = slabhash_create(4, 2, 10400, 
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	unit_assert(slabhash_set_admission(table, 1, 42));
+	test_long_table(table);
+	test_threaded_table(table);
+	slabhash_delete(table);
+	test_admission();
+	test_expiry_scan();
 }
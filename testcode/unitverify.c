@@ -43,6 +43,7 @@
 #include "testcode/unitmain.h"
 #include "validator/val_sigcrypt.h"
 #include "validator/val_secalgo.h"
+#include "validator/val_sha1mb.h"
 #include "validator/val_nsec.h"
 #include "validator/val_nsec3.h"
 #include "validator/validator.h"
@@ -88,13 +89,7 @@ entry_to_repinfo(struct entry* e, struct alloc_cache* alloc,
 	int ret;
 	struct edns_data edns;
 	entry_to_buf(e, pkt);
-	/* lock alloc lock to please lock checking software. 
-	 * alloc_special_obtain assumes it is talking to a ub-alloc,
-	 * and does not need to perform locking. Here the alloc is
-	 * the only one, so we lock it here */
-	lock_quick_lock(&alloc->lock);
 	ret = reply_info_parse(pkt, alloc, qi, rep, region, &edns);
-	lock_quick_unlock(&alloc->lock);
 	if(ret != 0) {
 		char rcode[16];
 		sldns_wire2str_rcode_buf(ret, rcode, sizeof(rcode));
@@ -292,7 +287,7 @@ verifytest_file(const char* fname, const char* at_date)
 	 */
 	struct ub_packed_rrset_key* dnskey;
 	struct regional* region = regional_create();
-	struct alloc_cache alloc;
+	struct alloc_cache super_a, alloc;
 	sldns_buffer* buf = sldns_buffer_new(65535);
 	struct entry* e;
 	struct entry* list = read_datafile(fname, 1);
@@ -302,7 +297,8 @@ verifytest_file(const char* fname, const char* at_date)
 
 	if(!list)
 		fatal_exit("could not read %s: %s", fname, strerror(errno));
-	alloc_init(&alloc, NULL, 1);
+	alloc_init(&super_a, NULL, 0);
+	alloc_init(&alloc, &super_a, 1);
 	memset(&env, 0, sizeof(env));
 	memset(&ve, 0, sizeof(ve));
 	env.scratch = region;
@@ -323,6 +319,7 @@ verifytest_file(const char* fname, const char* at_date)
 	delete_entry(list);
 	regional_destroy(region);
 	alloc_clear(&alloc);
+	alloc_clear(&super_a);
 	sldns_buffer_free(buf);
 }
 
@@ -336,7 +333,7 @@ dstest_file(const char* fname)
 	 * The answer rrset is the keyset that will be used for verification
 	 */
 	struct regional* region = regional_create();
-	struct alloc_cache alloc;
+	struct alloc_cache super_a, alloc;
 	sldns_buffer* buf = sldns_buffer_new(65535);
 	struct entry* e;
 	struct entry* list = read_datafile(fname, 1);
@@ -344,7 +341,8 @@ dstest_file(const char* fname)
 
 	if(!list)
 		fatal_exit("could not read %s: %s", fname, strerror(errno));
-	alloc_init(&alloc, NULL, 1);
+	alloc_init(&super_a, NULL, 0);
+	alloc_init(&alloc, &super_a, 1);
 	memset(&env, 0, sizeof(env));
 	env.scratch = region;
 	env.scratch_buffer = buf;
@@ -358,6 +356,7 @@ dstest_file(const char* fname)
 	delete_entry(list);
 	regional_destroy(region);
 	alloc_clear(&alloc);
+	alloc_clear(&super_a);
 	sldns_buffer_free(buf);
 }
 
@@ -410,8 +409,10 @@ nsectest(void)
 	unit_assert(!unitest_nsec_has_type_rdata(bitmap, len, 2230));
 }
 
-/** Test hash algo - NSEC3 hash it and compare result */
-static void
+/** Test hash algo - NSEC3 hash it and compare result.
+ * Returns the reply, the hash cache points into it, delete it after
+ * the cache is done. */
+static struct reply_info*
 nsec3_hash_test_entry(struct entry* e, rbtree_t* ct,
 	struct alloc_cache* alloc, struct regional* region, 
 	sldns_buffer* buf)
@@ -449,8 +450,8 @@ nsec3_hash_test_entry(struct entry* e, rbtree_t* ct,
 	unit_assert(memcmp(hash->b32, answer->rk.dname+1, hash->b32_len) 
 		== 0);
 
-	reply_info_parsedelete(rep, alloc);
 	query_info_clear(&qinfo);
+	return rep;
 }
 
 
@@ -470,28 +471,203 @@ nsec3_hash_test(const char* fname)
 	 */
 	rbtree_t ct;
 	struct regional* region = regional_create();
-	struct alloc_cache alloc;
+	struct alloc_cache super_a, alloc;
 	sldns_buffer* buf = sldns_buffer_new(65535);
 	struct entry* e;
 	struct entry* list = read_datafile(fname, 1);
+	struct reply_info** reps;
+	size_t i, n = 0;
 
 	if(!list)
 		fatal_exit("could not read %s: %s", fname, strerror(errno));
 	rbtree_init(&ct, &nsec3_hash_cmp);
-	alloc_init(&alloc, NULL, 1);
-	unit_assert(region && buf);
+	alloc_init(&super_a, NULL, 0);
+	alloc_init(&alloc, &super_a, 1);
+	for(e = list; e; e = e->next)
+		n++;
+	reps = (struct reply_info**)calloc(n, sizeof(*reps));
+	unit_assert(region && buf && reps);
 
 	/* ready to go! */
-	for(e = list; e; e = e->next) {
-		nsec3_hash_test_entry(e, &ct, &alloc, region, buf);
+	for(e = list, i = 0; e; e = e->next, i++) {
+		reps[i] = nsec3_hash_test_entry(e, &ct, &alloc, region, buf);
 	}
 
+	/* the hash cache is in the region, and refers to the replies */
+	for(i=0; i<n; i++)
+		reply_info_parsedelete(reps[i], &alloc);
+	free(reps);
 	delete_entry(list);
 	regional_destroy(region);
 	alloc_clear(&alloc);
+	alloc_clear(&super_a);
 	sldns_buffer_free(buf);
 }
 
+/** number of random rrsets in the canonical sort test */
+#define CANON_SORT_TESTS 3000
+/** max number of RRs in an rrset in the canonical sort test */
+#define CANON_SORT_RRS 120
+/** max rdata length of an RR in the canonical sort test */
+#define CANON_SORT_RDMAX 512
+
+/** random name of a few short labels, with mixed case letters */
+static size_t
+canon_rand_dname(uint8_t* p)
+{
+	size_t len = 0, lablen, i;
+	int labs = random()%4, l;
+	for(l=0; l<labs; l++) {
+		lablen = 1 + random()%3;
+		p[len++] = (uint8_t)lablen;
+		for(i=0; i<lablen; i++)
+			p[len++] = (uint8_t)"aAbB-"[random()%5];
+	}
+	p[len++] = 0;
+	return len;
+}
+
+/** random rdata for the type, fields have few values so RRs collide */
+static size_t
+canon_rand_rdata(uint16_t type, uint8_t* p)
+{
+	const sldns_rr_descriptor* desc = sldns_rr_descript(type);
+	size_t len = 0, f, i, n;
+	for(f=0; f<desc->_maximum; f++) {
+		switch(desc->_wireformat[f]) {
+		case LDNS_RDF_TYPE_DNAME:
+			len += canon_rand_dname(p+len);
+			break;
+		case LDNS_RDF_TYPE_STR:
+			n = random()%3;
+			p[len++] = (uint8_t)n;
+			for(i=0; i<n; i++)
+				p[len++] = (uint8_t)"aA"[random()%2];
+			break;
+		default:
+			n = get_rdf_size(desc->_wireformat[f]);
+			if(n == 0)
+				n = random()%4;
+			for(i=0; i<n; i++)
+				p[len++] = (uint8_t)"aA\000"[random()%3];
+			break;
+		}
+	}
+	/* sometimes malformed, truncated or with trailing bytes */
+	switch(random()%10) {
+	case 0:
+		len = random()%(len+1);
+		break;
+	case 1:
+		p[len++] = (uint8_t)"aA"[random()%2];
+		break;
+	}
+	return len;
+}
+
+/** test that the radix sort gives the order of the canonical tree sort */
+static void
+canonical_sort_test(void)
+{
+	uint16_t types[] = {LDNS_RR_TYPE_NS, LDNS_RR_TYPE_CNAME,
+		LDNS_RR_TYPE_PTR, LDNS_RR_TYPE_MX, LDNS_RR_TYPE_SOA,
+		LDNS_RR_TYPE_RP, LDNS_RR_TYPE_SRV, LDNS_RR_TYPE_NAPTR,
+		LDNS_RR_TYPE_RRSIG, LDNS_RR_TYPE_PX, LDNS_RR_TYPE_NXT,
+		LDNS_RR_TYPE_A, LDNS_RR_TYPE_TXT, LDNS_RR_TYPE_HINFO,
+		LDNS_RR_TYPE_DNSKEY, LDNS_RR_TYPE_NSEC};
+	static uint8_t rdata[CANON_SORT_RRS][CANON_SORT_RDMAX];
+	struct regional* region = regional_create();
+	struct ub_packed_rrset_key k;
+	struct packed_rrset_data* d;
+	struct canon_order* radix, *tree;
+	uint16_t type;
+	size_t t, i, count;
+	unit_show_func("validator/val_sigcrypt.c", "canonical_order");
+	unit_assert(region);
+	memset(&k, 0, sizeof(k));
+	srandom(49);
+	for(t=0; t<CANON_SORT_TESTS; t++) {
+		type = types[random()%(sizeof(types)/sizeof(types[0]))];
+		k.rk.type = htons(type);
+		/* mostly small rrsets, some large ones for the radix passes */
+		count = 1 + random()%((t%4)?20:CANON_SORT_RRS);
+		d = (struct packed_rrset_data*)regional_alloc_zero(region,
+			sizeof(*d) + PACKED_RRSET_ARRAYS_SIZE(count) +
+			count*CANON_SORT_RDMAX);
+		unit_assert(d);
+		d->count = count;
+		k.entry.data = d;
+		for(i=0; i<count; i++) {
+			packed_rr_len(d, i) = (uint16_t)(2 + canon_rand_rdata(
+				type, rdata[i]+2));
+			sldns_write_uint16(rdata[i], packed_rr_len(d, i)-2);
+		}
+		packed_rrset_offs_setup(d);
+		for(i=0; i<count; i++)
+			memmove(packed_rr_data(d, i), rdata[i],
+				packed_rr_len(d, i));
+		radix = canonical_order(region, &k);
+		tree = canonical_order_tree(region, &k);
+		unit_assert(radix && tree);
+		unit_assert(radix->count == tree->count);
+		for(i=0; i<radix->count; i++)
+			unit_assert(radix->idx[i] == tree->idx[i]);
+		regional_free_all(region);
+	}
+	regional_destroy(region);
+}
+
+/** number of random hashes in the multi-buffer SHA-1 test */
+#define SHA1MB_TESTS 400
+
+/** test the multi-buffer SHA-1 against the crypto library */
+static void
+sha1mb_test(void)
+{
+	uint8_t names[5][LDNS_MAX_DOMAINLEN], salt[255];
+	uint8_t out[5][SHA1MB_DIGEST_LEN], ref[SHA1MB_DIGEST_LEN];
+	uint8_t buf[LDNS_MAX_DOMAINLEN+255];
+	uint8_t* np[5], *res[5];
+	size_t lens[5], saltlen, iter, num, t, i, k;
+	unit_show_func("validator/val_sha1mb.c", "sha1mb_nsec3_hash");
+	if(!sha1mb_available()) {
+		unit_assert(!sha1mb_nsec3_hash(1, np, lens, salt, 0, 0, res));
+		return;
+	}
+	srandom(50);
+	for(t=0; t<SHA1MB_TESTS; t++) {
+		num = 1 + random()%5;
+		/* short salts iterate side by side, long ones one by one */
+		saltlen = (t%4 == 0)?(size_t)random()%256:(size_t)random()%40;
+		iter = random()%20;
+		for(k=0; k<saltlen; k++)
+			salt[k] = (uint8_t)random();
+		for(i=0; i<num; i++) {
+			/* lengths around the block boundaries, and long */
+			lens[i] = 1 + random()%((t%2)?70:LDNS_MAX_DOMAINLEN);
+			for(k=0; k<lens[i]; k++)
+				names[i][k] = (uint8_t)random();
+			np[i] = names[i];
+			res[i] = out[i];
+		}
+		unit_assert(sha1mb_nsec3_hash(num, np, lens, salt, saltlen,
+			iter, res));
+		for(i=0; i<num; i++) {
+			memcpy(buf, names[i], lens[i]);
+			memcpy(buf+lens[i], salt, saltlen);
+			unit_assert(secalgo_ds_digest(LDNS_SHA1, buf,
+				lens[i]+saltlen, ref));
+			for(k=0; k<iter; k++) {
+				memcpy(buf, ref, SHA1MB_DIGEST_LEN);
+				memcpy(buf+SHA1MB_DIGEST_LEN, salt, saltlen);
+				unit_assert(secalgo_ds_digest(LDNS_SHA1, buf,
+					SHA1MB_DIGEST_LEN+saltlen, ref));
+			}
+			unit_assert(memcmp(ref, out[i], SHA1MB_DIGEST_LEN)==0);
+		}
+	}
+}
+
 void 
 verify_test(void)
 {
@@ -529,5 +705,7 @@ verify_test(void)
 #endif
 	dstest_file("testdata/test_ds.sha1");
 	nsectest();
+	canonical_sort_test();
+	sha1mb_test();
 	nsec3_hash_test("testdata/test_nsec3_hash.1");
 }
@@ -44,12 +44,66 @@
 #include "util/regional.h"
 #include "util/data/packed_rrset.h"
 #include "util/fptr_wlist.h"
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+#ifdef LOCK_RW_HAVE_VERSION
+#include <sched.h>
+#endif
 
 /** custom size of cached regional blocks */
 #define ALLOC_REG_SIZE	16384
 /** number of bits for ID part of uint64, rest for number of threads. */
 #define THRNUM_SHIFT	48	/* for 65k threads, 2^48 rrsets per thr. */
 
+/** header in front of sized blocks, keeps the block aligned */
+union alloc_sized_hdr {
+	/** the size class of the block, or ALLOC_SIZED_LARGE */
+	size_t cls;
+	/** for alignment */
+	uint64_t align_u64;
+	/** for alignment */
+	double align_d;
+	/** for alignment */
+	void* align_p;
+};
+
+/** size of the big classes, including the header, the block holds n */
+#define ALLOC_SIZED_BIG(n) ((n) + sizeof(union alloc_sized_hdr))
+/** the size classes of sized blocks, including their header.  Spaced
+ * so that no more than a quarter of a block is wasted.  The big classes
+ * at the end are spaced wider, they have room for a power of two, so
+ * that the regional chunks fit exactly. */
+static const size_t alloc_sized_class[ALLOC_SIZED_CLASSES] = {
+	32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448,
+	512, 640, 768, 896, 1024, 1280, 1536, 1792, 2048, 2560, 3072,
+	ALLOC_SIZED_BIG(4096), ALLOC_SIZED_BIG(8192), ALLOC_SIZED_BIG(16384),
+	ALLOC_SIZED_BIG(32768), ALLOC_SIZED_BIG(65536) };
+/** class number for blocks that are larger than the size classes */
+#define ALLOC_SIZED_LARGE ALLOC_SIZED_CLASSES
+/** first class number of the big classes, that are limited in bytes */
+#define ALLOC_SIZED_FIRST_BIG 25
+/** flag in the class number of blocks that are carved from the arena */
+#define ALLOC_SIZED_ARENA 0x100
+/** the rest of an arena region that a cleared alloc gave to the super,
+ * it is linked in the super->arena_spare list through its first bytes */
+struct arena_spare {
+	/** next in the list */
+	struct arena_spare* next;
+	/** bytes left in the region, at this position */
+	size_t avail;
+};
+/** smallest rest of a region that is kept for reuse */
+#define ALLOC_ARENA_SPARE_MIN 4096
+/** start of the blocks in an arena region, after the next pointer */
+#define ALLOC_ARENA_START 64
+/** see if a sized block is carved from the arena, pass user pointer */
+#define alloc_sized_is_arena(x) \
+	((((union alloc_sized_hdr*)(x)-1)->cls & ALLOC_SIZED_ARENA) != 0)
+
+/** access next pointer of a sized block on a free list */
+#define alloc_sized_next(x) (*(void**)(x))
+
 /** setup new special type */
 static void
 alloc_setup_special(alloc_special_t* t)
@@ -119,12 +173,88 @@ alloc_init(struct alloc_cache* alloc, struct alloc_cache* super,
 	alloc->cleanup_arg = NULL;
 	if(alloc->super)
 		prealloc_blocks(alloc, alloc->max_reg_blocks);
+	if(alloc->super && thread_num >= 0 &&
+		thread_num < alloc->super->num_read_seq)
+		alloc->read_section = &alloc->super->read_seq[
+			thread_num*ALLOC_READ_STRIDE];
 	if(!alloc->super) {
 		lock_quick_init(&alloc->lock);
 		lock_protect(&alloc->lock, alloc, sizeof(*alloc));
 	}
 }
 
+/** push the sized free lists into the super, or free them */
+static void
+sized_clear(struct alloc_cache* alloc)
+{
+	size_t c;
+	void* p, *np;
+	for(c=0; c<ALLOC_SIZED_CLASSES; c++) {
+		if(!alloc->sized[c])
+			continue;
+		if(alloc->super) {
+			p = alloc->sized[c];
+			while(alloc_sized_next(p)) /* find last */
+				p = alloc_sized_next(p);
+			lock_quick_lock(&alloc->super->lock);
+			alloc_sized_next(p) = alloc->super->sized[c];
+			alloc->super->sized[c] = alloc->sized[c];
+			alloc->super->num_sized[c] += alloc->num_sized[c];
+			lock_quick_unlock(&alloc->super->lock);
+		} else {
+			p = alloc->sized[c];
+			while(p) {
+				np = alloc_sized_next(p);
+				/* arena blocks are freed with their region */
+				if(!alloc_sized_is_arena(p))
+					free((union alloc_sized_hdr*)p - 1);
+				p = np;
+			}
+		}
+		alloc->sized[c] = NULL;
+		alloc->num_sized[c] = 0;
+	}
+}
+
+/** unmap the arena regions, of the super.  A thread alloc gives the
+ * rest of its current region to the super, for the next thread to
+ * carve from, after a reload. */
+static void
+arena_clear(struct alloc_cache* alloc)
+{
+	void* p, *np;
+	if(alloc->super) {
+		if(alloc->arena_cur && alloc->arena_avail >=
+			ALLOC_ARENA_SPARE_MIN) {
+			struct arena_spare* sp = (struct arena_spare*)
+				alloc->arena_cur;
+			sp->avail = alloc->arena_avail;
+			lock_quick_lock(&alloc->super->lock);
+			sp->next = alloc->super->arena_spare;
+			alloc->super->arena_spare = sp;
+			lock_quick_unlock(&alloc->super->lock);
+		}
+		alloc->arena_cur = NULL;
+		alloc->arena_avail = 0;
+		return;
+	}
+	alloc->arena_cur = NULL;
+	alloc->arena_avail = 0;
+	alloc->arena_spare = NULL;
+	p = alloc->arena_list;
+	while(p) {
+		np = *(void**)p;
+#ifdef HAVE_MMAP
+		munmap(p, ALLOC_ARENA_SIZE);
+#endif
+		p = np;
+	}
+	alloc->arena_list = NULL;
+	alloc->arena_mapped = 0;
+	alloc->arena_huge = 0;
+	alloc->arena_thp = 0;
+}
+
 void 
 alloc_clear(struct alloc_cache* alloc)
 {
@@ -132,6 +262,10 @@ alloc_clear(struct alloc_cache* alloc)
 	struct regional* r, *nr;
 	if(!alloc)
 		return;
+	alloc_retired_free(alloc, 0);
+	free(alloc->retired);
+	alloc->retired = NULL;
+	alloc->max_retired = 0;
 	if(!alloc->super) {
 		lock_quick_destroy(&alloc->lock);
 	}
@@ -158,6 +292,8 @@ alloc_clear(struct alloc_cache* alloc)
 	}
 	alloc->quar = 0;
 	alloc->num_quar = 0;
+	sized_clear(alloc);
+	arena_clear(alloc);
 	r = alloc->reg_list;
 	while(r) {
 		nr = (struct regional*)r->next;
@@ -166,6 +302,12 @@ alloc_clear(struct alloc_cache* alloc)
 	}
 	alloc->reg_list = NULL;
 	alloc->num_reg_blocks = 0;
+	if(!alloc->super) {
+		free(alloc->read_seq);
+		alloc->read_seq = NULL;
+		alloc->num_read_seq = 0;
+	}
+	alloc->read_section = NULL;
 }
 
 uint64_t
@@ -277,17 +419,295 @@ alloc_special_release(struct alloc_cache* alloc, alloc_special_t* mem)
 	}
 }
 
+/** how many blocks of class c to cache locally */
+static size_t
+sized_local_max(size_t c)
+{
+	size_t n;
+	if(c < ALLOC_SIZED_FIRST_BIG)
+		return ALLOC_SIZED_MAX;
+	n = ALLOC_SIZED_MAX_BYTES / alloc_sized_class[c];
+	return (n < ALLOC_SIZED_MAX)?n:ALLOC_SIZED_MAX;
+}
+
+/** how many blocks of class c the super keeps at most */
+static size_t
+sized_super_max(size_t c)
+{
+	size_t n;
+	if(c < ALLOC_SIZED_FIRST_BIG)
+		return ALLOC_SIZED_SUPER_MAX;
+	n = ALLOC_SIZED_SUPER_MAX_BYTES / alloc_sized_class[c];
+	return (n < ALLOC_SIZED_SUPER_MAX)?n:ALLOC_SIZED_SUPER_MAX;
+}
+
+/** find the size class for the size, that includes the header */
+static size_t
+sized_find_class(size_t size)
+{
+	size_t c;
+	for(c=0; c<ALLOC_SIZED_CLASSES; c++)
+		if(size <= alloc_sized_class[c])
+			return c;
+	return ALLOC_SIZED_LARGE;
+}
+
+size_t
+alloc_sized_size(size_t size)
+{
+	size_t c = sized_find_class(size + sizeof(union alloc_sized_hdr));
+	if(c == ALLOC_SIZED_LARGE)
+		return size + sizeof(union alloc_sized_hdr);
+	return alloc_sized_class[c];
+}
+
+/** get a batch of blocks of class c from the super, one lock per batch */
+static void
+sized_from_super(struct alloc_cache* alloc, size_t c)
+{
+	struct alloc_cache* super = alloc->super;
+	void* p, *last = NULL;
+	size_t n = 0, max = sized_local_max(c)/2;
+	log_assert(alloc->sized[c] == NULL);
+	lock_quick_lock(&super->lock);
+	p = super->sized[c];
+	while(p && n < max) {
+		last = p;
+		p = alloc_sized_next(p);
+		n++;
+	}
+	if(n > 0) {
+		alloc_sized_next(last) = NULL;
+		alloc->sized[c] = super->sized[c];
+		alloc->num_sized[c] = n;
+		super->sized[c] = p;
+		super->num_sized[c] -= n;
+	}
+	lock_quick_unlock(&super->lock);
+}
+
+/** move a batch of blocks of class c to the super, one lock per batch.
+ * If the super has enough already, they are freed. */
+static void
+sized_to_super(struct alloc_cache* alloc, size_t c)
+{
+	struct alloc_cache* super = alloc->super;
+	void* first = alloc->sized[c], *last = first, *p;
+	size_t i, n = sized_local_max(c)/2;
+	log_assert(alloc->num_sized[c] >= n);
+	for(i=1; i<n; i++)
+		last = alloc_sized_next(last);
+	alloc->sized[c] = alloc_sized_next(last);
+	alloc->num_sized[c] -= n;
+	alloc_sized_next(last) = NULL;
+
+	lock_quick_lock(&super->lock);
+	if(super->num_sized[c] + n <= sized_super_max(c)) {
+		alloc_sized_next(last) = super->sized[c];
+		super->sized[c] = first;
+		super->num_sized[c] += n;
+		first = NULL;
+	}
+	while(first) {
+		p = alloc_sized_next(first);
+		if(alloc_sized_is_arena(first)) {
+			/* cannot be freed, the super keeps it */
+			alloc_sized_next(first) = super->sized[c];
+			super->sized[c] = first;
+			super->num_sized[c]++;
+		} else	free((union alloc_sized_hdr*)first - 1);
+		first = p;
+	}
+	lock_quick_unlock(&super->lock);
+}
+
+/** map a region for the arena, with huge pages if possible.
+ * @param top: the super alloc, with stats.
+ * @return region of ALLOC_ARENA_SIZE or NULL if it could not be mapped. */
+static char*
+arena_map(struct alloc_cache* top)
+{
+#if defined(HAVE_MMAP) && defined(MAP_ANONYMOUS)
+	char* p;
+	size_t off;
+#ifdef MAP_HUGETLB
+#  ifdef MAP_HUGE_2MB
+	p = (char*)mmap(NULL, ALLOC_ARENA_SIZE, PROT_READ|PROT_WRITE,
+		MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB|MAP_HUGE_2MB, -1, 0);
+#  else
+	p = (char*)mmap(NULL, ALLOC_ARENA_SIZE, PROT_READ|PROT_WRITE,
+		MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB, -1, 0);
+#  endif
+	if(p != (char*)MAP_FAILED) {
+		top->arena_huge += ALLOC_ARENA_SIZE;
+		return p;
+	}
+#endif /* MAP_HUGETLB */
+	/* map twice the size and trim it to a huge page boundary, so
+	 * that transparent huge pages can be used for the region */
+	p = (char*)mmap(NULL, 2*ALLOC_ARENA_SIZE, PROT_READ|PROT_WRITE,
+		MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+	if(p == (char*)MAP_FAILED)
+		return NULL;
+	off = (ALLOC_ARENA_SIZE - ((size_t)p & (ALLOC_ARENA_SIZE-1))) &
+		(ALLOC_ARENA_SIZE-1);
+	if(off)
+		munmap(p, off);
+	munmap(p+off+ALLOC_ARENA_SIZE, ALLOC_ARENA_SIZE-off);
+	p += off;
+#if defined(HAVE_MADVISE) && defined(MADV_HUGEPAGE)
+	if(madvise(p, ALLOC_ARENA_SIZE, MADV_HUGEPAGE) == 0)
+		top->arena_thp += ALLOC_ARENA_SIZE;
+#endif
+	return p;
+#else
+	(void)top;
+	return NULL;
+#endif /* HAVE_MMAP */
+}
+
+/** carve a block from the arena region of the alloc, and map a new
+ * region when it is used up.  The super is locked for that, unless this
+ * is the super.  If no region can be mapped, the arena is turned off.
+ * @return block or NULL if none (use malloc). */
+static void*
+arena_carve(struct alloc_cache* alloc, size_t size)
+{
+	struct alloc_cache* top = alloc->super?alloc->super:alloc;
+	struct arena_spare* sp;
+	char* p;
+	if(size > alloc->arena_avail) {
+		if(alloc->super)
+			lock_quick_lock(&top->lock);
+		if((sp = top->arena_spare)) {
+			/* continue in the region a cleared alloc left over */
+			top->arena_spare = sp->next;
+			alloc->arena_cur = (char*)sp;
+			alloc->arena_avail = sp->avail;
+		} else if((p = arena_map(top))) {
+			*(void**)p = top->arena_list;
+			top->arena_list = p;
+			top->arena_mapped += ALLOC_ARENA_SIZE;
+			alloc->arena_cur = p + ALLOC_ARENA_START;
+			alloc->arena_avail = ALLOC_ARENA_SIZE-ALLOC_ARENA_START;
+		} else if(top->use_arena) {
+			log_warn("could not map huge page arena, using malloc");
+			top->use_arena = 0;
+		}
+		if(alloc->super)
+			lock_quick_unlock(&top->lock);
+		if(size > alloc->arena_avail)
+			return NULL;
+	}
+	p = alloc->arena_cur;
+	alloc->arena_cur += size;
+	alloc->arena_avail -= size;
+	return p;
+}
+
+/** take a block of class c from the free list of the alloc, or carve
+ * it from the arena.  The superalloc must be locked by the caller.
+ * @return block or NULL if none (use malloc). */
+static void*
+sized_take(struct alloc_cache* alloc, size_t c)
+{
+	union alloc_sized_hdr* h;
+	void* mem;
+	if((mem = alloc->sized[c])) {
+		alloc->sized[c] = alloc_sized_next(mem);
+		alloc->num_sized[c]--;
+		return mem;
+	}
+	if(c < ALLOC_SIZED_FIRST_BIG && (alloc->super?
+		alloc->super:alloc)->use_arena &&
+		(h = (union alloc_sized_hdr*)arena_carve(alloc,
+		alloc_sized_class[c]))) {
+		h->cls = c | ALLOC_SIZED_ARENA;
+		return h+1;
+	}
+	return NULL;
+}
+
+void*
+alloc_sized_obtain(struct alloc_cache* alloc, size_t size)
+{
+	size_t c = sized_find_class(size + sizeof(union alloc_sized_hdr));
+	union alloc_sized_hdr* h;
+	void* mem;
+	if(c == ALLOC_SIZED_LARGE) {
+		h = (union alloc_sized_hdr*)malloc(size +
+			sizeof(union alloc_sized_hdr));
+	} else {
+		if(alloc && !alloc->super) {
+			lock_quick_lock(&alloc->lock); /* superalloc needs locking */
+			mem = sized_take(alloc, c);
+			lock_quick_unlock(&alloc->lock);
+			if(mem)
+				return mem;
+		} else if(alloc) {
+			if(!alloc->sized[c])
+				sized_from_super(alloc, c);
+			if((mem = sized_take(alloc, c)))
+				return mem;
+		}
+		h = (union alloc_sized_hdr*)malloc(alloc_sized_class[c]);
+	}
+	if(!h)
+		return NULL;
+	h->cls = c;
+	return h+1;
+}
+
+void
+alloc_sized_release(struct alloc_cache* alloc, void* mem)
+{
+	union alloc_sized_hdr* h;
+	size_t c;
+	if(!mem)
+		return;
+	h = (union alloc_sized_hdr*)mem - 1;
+	c = h->cls & ~ALLOC_SIZED_ARENA;
+	log_assert(c <= ALLOC_SIZED_LARGE);
+	if(!alloc || c == ALLOC_SIZED_LARGE) {
+		/* arena blocks come from an alloc, and go back to one */
+		log_assert(!(h->cls & ALLOC_SIZED_ARENA));
+		free(h);
+		return;
+	}
+	if(!alloc->super) {
+		lock_quick_lock(&alloc->lock); /* superalloc needs locking */
+		if(alloc->num_sized[c] >= sized_super_max(c) &&
+			!(h->cls & ALLOC_SIZED_ARENA)) {
+			lock_quick_unlock(&alloc->lock);
+			free(h);
+			return;
+		}
+	} else if(alloc->num_sized[c] >= sized_local_max(c)) {
+		sized_to_super(alloc, c);
+	}
+	alloc_sized_next(mem) = alloc->sized[c];
+	alloc->sized[c] = mem;
+	alloc->num_sized[c]++;
+	if(!alloc->super) {
+		lock_quick_unlock(&alloc->lock);
+	}
+}
+
 void 
 alloc_stats(struct alloc_cache* alloc)
 {
-	log_info("%salloc: %d in cache, %d blocks.", alloc->super?"":"sup",
-		(int)alloc->num_quar, (int)alloc->num_reg_blocks);
+	size_t c, n = 0;
+	for(c=0; c<ALLOC_SIZED_CLASSES; c++)
+		n += alloc->num_sized[c];
+	log_info("%salloc: %d in cache, %d sized, %d blocks.",
+		alloc->super?"":"sup", (int)alloc->num_quar, (int)n,
+		(int)alloc->num_reg_blocks);
 }
 
 size_t alloc_get_mem(struct alloc_cache* alloc)
 {
 	alloc_special_t* p;
-	size_t s = sizeof(*alloc);
+	size_t c, s = sizeof(*alloc);
 	if(!alloc->super) { 
 		lock_quick_lock(&alloc->lock); /* superalloc needs locking */
 	}
@@ -296,23 +716,50 @@ size_t alloc_get_mem(struct alloc_cache* alloc)
 		s += lock_get_mem(&p->entry.lock);
 	}
 	s += alloc->num_reg_blocks * ALLOC_REG_SIZE;
+	for(c=0; c<ALLOC_SIZED_CLASSES; c++)
+		s += alloc->num_sized[c] * alloc_sized_class[c];
 	if(!alloc->super) {
 		lock_quick_unlock(&alloc->lock);
 	}
 	return s;
 }
 
+void
+alloc_set_arena(struct alloc_cache* super, int use)
+{
+	log_assert(!super->super);
+	lock_quick_lock(&super->lock);
+	super->use_arena = use;
+	lock_quick_unlock(&super->lock);
+}
+
+void
+alloc_arena_stats(struct alloc_cache* super, size_t* mapped, size_t* huge,
+	size_t* thp)
+{
+	lock_quick_lock(&super->lock);
+	*mapped = super->arena_mapped;
+	*huge = super->arena_huge;
+	*thp = super->arena_thp;
+	lock_quick_unlock(&super->lock);
+}
+
 struct regional* 
 alloc_reg_obtain(struct alloc_cache* alloc)
 {
+	struct regional* r;
 	if(alloc->num_reg_blocks > 0) {
-		struct regional* r = alloc->reg_list;
+		r = alloc->reg_list;
 		alloc->reg_list = (struct regional*)r->next;
 		r->next = NULL;
 		alloc->num_reg_blocks--;
+		r->alloc = alloc;
 		return r;
 	}
-	return regional_create_custom(ALLOC_REG_SIZE);
+	r = regional_create_custom(ALLOC_REG_SIZE);
+	if(r)
+		r->alloc = alloc;
+	return r;
 }
 
 void 
@@ -330,6 +777,184 @@ alloc_reg_release(struct alloc_cache* alloc, struct regional* r)
 	alloc->num_reg_blocks++;
 }
 
+int
+alloc_set_readers(struct alloc_cache* alloc, int num)
+{
+	log_assert(!alloc->super);
+	free(alloc->read_seq);
+	alloc->read_seq = NULL;
+	alloc->num_read_seq = 0;
+#ifdef LOCK_RW_HAVE_VERSION
+	if(num > 0) {
+		alloc->read_seq = (uint32_t*)calloc((size_t)num,
+			sizeof(uint32_t)*ALLOC_READ_STRIDE);
+		if(!alloc->read_seq)
+			return 0;
+		alloc->num_read_seq = num;
+	}
+#else
+	(void)num;
+#endif
+	return 1;
+}
+
+int
+alloc_read_begin(struct alloc_cache* alloc)
+{
+#ifdef LOCK_RW_HAVE_VERSION
+	uint32_t* s = alloc->read_section;
+	if(!s)
+		return 0;
+	/* odd, in a read section; the store has to be visible before the
+	 * cache is read, that is what alloc_read_wait checks */
+	__atomic_store_n(s, *s+1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	return 1;
+#else
+	(void)alloc;
+	return 0;
+#endif
+}
+
+void
+alloc_read_end(struct alloc_cache* alloc)
+{
+#ifdef LOCK_RW_HAVE_VERSION
+	uint32_t* s = alloc->read_section;
+	if(s)
+		__atomic_store_n(s, *s+1, __ATOMIC_RELEASE);
+#else
+	(void)alloc;
+#endif
+}
+
+void
+alloc_read_wait(struct alloc_cache* alloc)
+{
+#ifdef LOCK_RW_HAVE_VERSION
+	struct alloc_cache* s = alloc->super?alloc->super:alloc;
+	uint32_t v;
+	int i, spins;
+	if(!s->read_seq)
+		return;
+	/* the unlink has to be visible before the counters are read */
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	for(i=0; i<s->num_read_seq; i++) {
+		uint32_t* c = &s->read_seq[i*ALLOC_READ_STRIDE];
+		v = __atomic_load_n(c, __ATOMIC_ACQUIRE);
+		if(!(v&1))
+			continue;
+		/* wait for that read section to end, readers do not block
+		 * inside it, so this is short */
+		spins = 0;
+		while(__atomic_load_n(c, __ATOMIC_ACQUIRE) == v) {
+			if(++spins > 100)
+				(void)sched_yield();
+		}
+	}
+#else
+	(void)alloc;
+#endif
+}
+
+/** free a retired block, the reads have ended */
+static void
+retired_release_one(struct alloc_cache* alloc, void* mem, int kind)
+{
+	if(kind == ALLOC_RETIRE_SPECIAL) {
+		ub_packed_rrset_name_free((alloc_special_t*)mem);
+		alloc_special_release(alloc, (alloc_special_t*)mem);
+	} else if(kind == ALLOC_RETIRE_SIZED)
+		alloc_sized_release(alloc, mem);
+	else	free(mem);
+}
+
+/** free the blocks of a retired list */
+static void
+retired_release(struct alloc_cache* alloc, struct alloc_retired* r, size_t n)
+{
+	size_t i;
+	for(i=0; i<n; i++)
+		retired_release_one(alloc, r[i].mem, r[i].kind);
+}
+
+void
+alloc_retire(struct alloc_cache* alloc, void* mem, int kind)
+{
+	struct alloc_cache* s = alloc->super?alloc->super:alloc;
+	struct alloc_retired* r;
+	if(!mem)
+		return;
+	if(!s->read_seq) {
+		retired_release_one(alloc, mem, kind);
+		return;
+	}
+	if(!alloc->super)
+		lock_quick_lock(&alloc->lock);
+	if(alloc->num_retired == alloc->max_retired) {
+		size_t max = alloc->max_retired?alloc->max_retired*2:
+			ALLOC_RETIRE_BATCH;
+		r = (struct alloc_retired*)realloc(alloc->retired,
+			max*sizeof(*r));
+		if(!r) {
+			/* out of memory, wait for the readers here */
+			if(!alloc->super)
+				lock_quick_unlock(&alloc->lock);
+			alloc_read_wait(alloc);
+			retired_release_one(alloc, mem, kind);
+			return;
+		}
+		alloc->retired = r;
+		alloc->max_retired = max;
+	}
+	alloc->retired[alloc->num_retired].mem = mem;
+	alloc->retired[alloc->num_retired].kind = kind;
+	lock_atomic_store(&alloc->num_retired, alloc->num_retired+1);
+	if(!alloc->super)
+		lock_quick_unlock(&alloc->lock);
+}
+
+/** take the retired list of the super */
+static struct alloc_retired*
+retired_take_super(struct alloc_cache* super, size_t* n)
+{
+	struct alloc_retired* r;
+	if(lock_atomic_load(&super->num_retired) == 0) {
+		*n = 0;
+		return NULL;
+	}
+	lock_quick_lock(&super->lock);
+	r = super->retired;
+	*n = super->num_retired;
+	super->retired = NULL;
+	lock_atomic_store(&super->num_retired, 0);
+	super->max_retired = 0;
+	lock_quick_unlock(&super->lock);
+	return r;
+}
+
+void
+alloc_retired_free(struct alloc_cache* alloc, size_t min)
+{
+	struct alloc_cache* s = alloc->super?alloc->super:alloc;
+	struct alloc_retired* sr;
+	size_t sn = lock_atomic_load(&s->num_retired);
+	if(alloc->super)
+		sn += alloc->num_retired;
+	if(sn == 0 || sn < min)
+		return;
+	/* the blocks on the lists have been unlinked, after the wait
+	 * no reader can see them */
+	sr = retired_take_super(s, &sn);
+	alloc_read_wait(alloc);
+	if(alloc->super) {
+		retired_release(alloc, alloc->retired, alloc->num_retired);
+		alloc->num_retired = 0;
+	}
+	retired_release(alloc, sr, sn);
+	free(sr);
+}
+
 void 
 alloc_set_id_cleanup(struct alloc_cache* alloc, void (*cleanup)(void*),
         void* arg)
@@ -42,6 +42,22 @@
  *	o Avoid locking costs of getting global lock to call malloc().
  *	o The packed rrset type needs to be kept on special freelists,
  *	  so that they are reused for other packet rrset allocations.
+ *	o The cache data (packed rrset data, reply info) is kept in size
+ *	  classes on freelists.  Blocks that a thread frees with its own
+ *	  alloc, such as parsed messages it did not cache, stay on its
+ *	  freelist for reuse by that thread.  The caches free the
+ *	  blocks of evicted entries to the superalloc, under its lock, like
+ *	  the special rrset keys, and threads take them back in batches.
+ *	o The chunks and large objects of the regionals that are handed
+ *	  out for query state are kept on the same size class freelists,
+ *	  so that large answers do not malloc and free on every query.
+ *	o Optionally the cache blocks are carved from regions that are
+ *	  backed by huge pages, to lower the number of TLB misses.
+ *	o Threads that read the rrset cache without locks mark their read
+ *	  sections.  The rrset keys and data that the rrset cache deletes
+ *	  are put on a retired list, and freed in batches, outside of the
+ *	  hash locks, after those sections have ended, so a reader does not
+ *	  touch freed memory.
  *
  */
 
@@ -51,6 +67,7 @@
 #include "util/locks.h"
 struct ub_packed_rrset_key;
 struct regional;
+struct arena_spare;
 
 /** The special type, packed rrset. Not allowed to be used for other memory */
 typedef struct ub_packed_rrset_key alloc_special_t;
@@ -65,6 +82,39 @@ typedef struct ub_packed_rrset_key alloc_special_t;
 /** how many blocks to cache locally. */
 #define ALLOC_SPECIAL_MAX 10
 
+/** number of size classes for sized blocks */
+#define ALLOC_SIZED_CLASSES 30
+/** how many sized blocks of every class to cache locally. */
+#define ALLOC_SIZED_MAX 64
+/** how many sized blocks of every class the super keeps at most */
+#define ALLOC_SIZED_SUPER_MAX 4096
+/** for the big classes (regional chunks), the bytes cached locally per
+ * class, this limits the number of blocks below ALLOC_SIZED_MAX */
+#define ALLOC_SIZED_MAX_BYTES (256*1024)
+/** for the big classes, the bytes the super keeps at most per class */
+#define ALLOC_SIZED_SUPER_MAX_BYTES (16*1024*1024)
+/** size of the regions of the arena, one 2 MB huge page */
+#define ALLOC_ARENA_SIZE (2*1024*1024)
+/** spacing of the read section counters, so they are on a cache line */
+#define ALLOC_READ_STRIDE 16
+/** number of retired blocks after which the cache update frees them */
+#define ALLOC_RETIRE_BATCH 64
+
+/** retired block is malloced */
+#define ALLOC_RETIRE_MALLOC 0
+/** retired block is from alloc_sized_obtain */
+#define ALLOC_RETIRE_SIZED 1
+/** retired block is the special type, its name is freed with it */
+#define ALLOC_RETIRE_SPECIAL 2
+
+/** block that is freed when the reads without locks have ended */
+struct alloc_retired {
+	/** the memory */
+	void* mem;
+	/** how it was allocated, ALLOC_RETIRE_MALLOC, _SIZED, _SPECIAL */
+	int kind;
+};
+
 /**
  * Structure that provides allocation. Use one per thread.
  * The one on top has a NULL super pointer.
@@ -95,6 +145,46 @@ struct alloc_cache {
 	size_t num_reg_blocks;
 	/** linked list of regional blocks, using regional->next */
 	struct regional* reg_list;
+
+	/** free lists of sized blocks, per size class. Linked through
+	 * the first bytes of the block. */
+	void* sized[ALLOC_SIZED_CLASSES];
+	/** number of blocks in the sized free lists */
+	size_t num_sized[ALLOC_SIZED_CLASSES];
+
+	/** if the sized blocks of the cache are carved from the arena
+	 * of huge page regions.  Only used in the super. */
+	int use_arena;
+	/** position in the current arena region to carve blocks from */
+	char* arena_cur;
+	/** bytes left in the current arena region */
+	size_t arena_avail;
+	/** super: list of arena regions, linked through the first bytes */
+	void* arena_list;
+	/** super: rests of regions from cleared allocs, to carve from */
+	struct arena_spare* arena_spare;
+	/** super: bytes mapped for the arena regions */
+	size_t arena_mapped;
+	/** super: bytes of the regions with explicit huge pages (hugetlb) */
+	size_t arena_huge;
+	/** super: bytes of the regions advised for transparent huge pages */
+	size_t arena_thp;
+
+	/** super: read section counters of the threads, one per cache
+	 * line, odd while the thread reads the cache without locks.
+	 * NULL if the threads do not read without locks. */
+	uint32_t* read_seq;
+	/** super: number of read section counters */
+	int num_read_seq;
+	/** the read section counter of this thread, or NULL */
+	uint32_t* read_section;
+	/** blocks that readers without locks can still see, freed after
+	 * their reads have ended.  In the super it is locked. */
+	struct alloc_retired* retired;
+	/** number of retired blocks */
+	size_t num_retired;
+	/** size of the retired array */
+	size_t max_retired;
 };
 
 /**
@@ -131,6 +221,55 @@ alloc_special_t* alloc_special_obtain(struct alloc_cache* alloc);
  */
 void alloc_special_release(struct alloc_cache* alloc, alloc_special_t* mem);
 
+/**
+ * Get a block of memory from the size class that fits size.  The block
+ * is taken from the free list of the class, in batches from the super,
+ * or malloced.  Blocks larger than the largest class are malloced.
+ * If alloc is the superalloc, it is locked.
+ * @param alloc: where to alloc it, if NULL malloc is used.
+ * @param size: number of bytes wanted.
+ * @return memory block, not zeroed, aligned like malloc, or NULL on
+ *    alloc failure.  Free it with alloc_sized_release.
+ */
+void* alloc_sized_obtain(struct alloc_cache* alloc, size_t size);
+
+/**
+ * Return a block from alloc_sized_obtain.  It can be returned to any
+ * alloc, also from another thread than the one that obtained it.
+ * Batches of blocks move to the super when the local list is full.
+ * If alloc is the superalloc, it is locked.
+ * @param alloc: where to put it, if NULL the block is freed.
+ * @param mem: block to free, or NULL.
+ */
+void alloc_sized_release(struct alloc_cache* alloc, void* mem);
+
+/**
+ * The number of bytes that a block from alloc_sized_obtain uses.
+ * @param size: the number of bytes requested.
+ * @return the size of the class, including overhead.
+ */
+size_t alloc_sized_size(size_t size);
+
+/**
+ * Carve the sized blocks for the cache from an arena of 2 MB regions,
+ * that are mapped with explicit huge pages, or advised to use
+ * transparent huge pages.  If regions cannot be mapped, blocks are
+ * malloced.  The arena is freed when the super is cleared.
+ * @param super: the super alloc.
+ * @param use: if true the arena is used for new blocks.
+ */
+void alloc_set_arena(struct alloc_cache* super, int use);
+
+/**
+ * Get the memory layout of the arena.
+ * @param super: the super alloc.
+ * @param mapped: bytes mapped for the arena.
+ * @param huge: bytes of that with explicit huge pages.
+ * @param thp: bytes of that advised for transparent huge pages.
+ */
+void alloc_arena_stats(struct alloc_cache* super, size_t* mapped,
+	size_t* huge, size_t* thp);
+
 /**
  * Set ID number of special type to a fresh new ID number.
  * In case of ID number overflow, the rrset cache has to be cleared.
@@ -153,7 +292,9 @@ size_t alloc_get_mem(struct alloc_cache* alloc);
 void alloc_stats(struct alloc_cache* alloc);
 
 /**
- * Get a new regional for query states
+ * Get a new regional for query states.  The regional takes its extra
+ * chunks and large objects from the size classes of the alloc, so it
+ * must be used and released by the thread that owns the alloc.
  * @param alloc: where to alloc it.
  * @return regional for use or NULL on alloc failure.
  */
@@ -166,6 +307,60 @@ struct regional* alloc_reg_obtain(struct alloc_cache* alloc);
  */
 void alloc_reg_release(struct alloc_cache* alloc, struct regional* r);
 
+/**
+ * Set up the read section counters in the super, for the threads that
+ * are inited with alloc_init afterwards.  Does nothing if the locks do
+ * not support reads without locking.
+ * @param alloc: the super alloc.
+ * @param num: number of threads, 0 to remove them.
+ * @return false on malloc failure.
+ */
+int alloc_set_readers(struct alloc_cache* alloc, int num);
+
+/**
+ * Start a read of the cache without locks.
+ * @param alloc: the alloc of the thread.
+ * @return false if the thread has no read section counter.
+ */
+int alloc_read_begin(struct alloc_cache* alloc);
+
+/**
+ * End a read of the cache without locks.
+ * @param alloc: the alloc of the thread.
+ */
+void alloc_read_end(struct alloc_cache* alloc);
+
+/**
+ * Wait until the reads without locks, that are in progress, have ended.
+ * Call before memory that such readers can see is freed, after it has
+ * been unlinked.
+ * @param alloc: the alloc, or its super.
+ */
+void alloc_read_wait(struct alloc_cache* alloc);
+
+/**
+ * Free memory that readers without locks can still see, once their
+ * reads have ended.  The block is put on the retired list of the alloc,
+ * so it can be called with the hash table locks held, the wait for the
+ * readers is done by alloc_retired_free.  If there are no such readers
+ * the block is freed at once.
+ * @param alloc: the alloc of the thread, or the super.
+ * @param mem: the block, it has been unlinked.
+ * @param kind: ALLOC_RETIRE_MALLOC, ALLOC_RETIRE_SIZED for a block from
+ *	alloc_sized_obtain, or ALLOC_RETIRE_SPECIAL for the special type,
+ *	that is returned with alloc_special_release.
+ */
+void alloc_retire(struct alloc_cache* alloc, void* mem, int kind);
+
+/**
+ * Free the retired blocks of the alloc and its super, after the reads
+ * without locks that are in progress have ended.  Do not call it with
+ * hash table locks held.
+ * @param alloc: the alloc of the thread, or the super.
+ * @param min: only if there are at least this many retired blocks.
+ */
+void alloc_retired_free(struct alloc_cache* alloc, size_t min);
+
 /**
  * Set cleanup on ID overflow callback function. This should remove all
  * RRset ID references from the program. Clear the caches.
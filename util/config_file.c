@@ -100,6 +100,7 @@ config_create(void)
 	cfg->tcp_upstream = 0;
 	cfg->ssl_service_key = NULL;
 	cfg->ssl_service_pem = NULL;
+	cfg->ssl_session_ticket_keys = NULL;
 	cfg->ssl_port = 443;
 	cfg->ssl_upstream = 0;
 	cfg->use_syslog = 1;
@@ -123,10 +124,26 @@ config_create(void)
 	cfg->outgoing_num_tcp = 2; /* leaves 64-52=12 for: 4if,1stop,thread4 */
 	cfg->incoming_num_tcp = 2; 
 #endif
+	cfg->tcp_idle_timeout = 30000;
+	cfg->tcp_fastopen = 0;
+	cfg->tcp_upstream_fastopen = 0;
+	cfg->rrl_ratelimit = 0;
+	cfg->rrl_slip = 2;
+	cfg->rrl_ipv4_prefix = 24;
+	cfg->rrl_ipv6_prefix = 56;
+	cfg->rrl_size = 4096;
+	cfg->upstream_zone_ratelimit = 0;
+	cfg->upstream_server_ratelimit = 0;
+	cfg->upstream_ratelimit_size = 4*1024*1024;
+	cfg->region_presize = 0;
+	cfg->cache_hugepages = 0;
+	cfg->cache_admission_filter = 0;
+	cfg->cache_expiry_scan = 0;
 	cfg->edns_buffer_size = 4096; /* 4k from rfc recommendation */
 	cfg->msg_buffer_size = 65552; /* 64 k + a small margin */
 	cfg->msg_cache_size = 4 * 1024 * 1024;
 	cfg->msg_cache_slabs = 4;
+	cfg->msg_cache_l1_slots = 0;
 	cfg->jostle_time = 200;
 	cfg->rrset_cache_size = 4 * 1024 * 1024;
 	cfg->rrset_cache_slabs = 4;
@@ -136,6 +153,8 @@ config_create(void)
 	cfg->max_ttl = 3600 * 24;
 	cfg->prefetch = 0;
 	cfg->prefetch_key = 0;
+	cfg->prefetch_popular = 0;
+	cfg->prefetch_popular_rate = 100;
 	cfg->infra_cache_slabs = 4;
 	cfg->infra_cache_numhosts = 10000;
 	cfg->delay_close = 0;
@@ -352,6 +371,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_YNO("ssl-upstream:", ssl_upstream)
 	else S_STR("ssl-service-key:", ssl_service_key)
 	else S_STR("ssl-service-pem:", ssl_service_pem)
+	else S_STRLIST("ssl-session-ticket-keys:", ssl_session_ticket_keys)
 	else S_NUMBER_NONZERO("ssl-port:", ssl_port)
 	else S_YNO("interface-automatic:", if_automatic)
 	else S_YNO("do-daemonize:", do_daemonize)
@@ -359,10 +379,26 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_NUMBER_NONZERO("outgoing-range:", outgoing_num_ports)
 	else S_SIZET_OR_ZERO("outgoing-num-tcp:", outgoing_num_tcp)
 	else S_SIZET_OR_ZERO("incoming-num-tcp:", incoming_num_tcp)
+	else S_NUMBER_OR_ZERO("tcp-idle-timeout:", tcp_idle_timeout)
+	else S_YNO("tcp-fastopen:", tcp_fastopen)
+	else S_YNO("tcp-upstream-fastopen:", tcp_upstream_fastopen)
+	else S_NUMBER_OR_ZERO("rrl-ratelimit:", rrl_ratelimit)
+	else S_NUMBER_OR_ZERO("rrl-slip:", rrl_slip)
+	else S_NUMBER_OR_ZERO("rrl-ipv4-prefix:", rrl_ipv4_prefix)
+	else S_NUMBER_OR_ZERO("rrl-ipv6-prefix:", rrl_ipv6_prefix)
+	else S_SIZET_NONZERO("rrl-size:", rrl_size)
+	else S_NUMBER_OR_ZERO("upstream-zone-ratelimit:", upstream_zone_ratelimit)
+	else S_NUMBER_OR_ZERO("upstream-server-ratelimit:", upstream_server_ratelimit)
+	else S_MEMSIZE("upstream-ratelimit-size:", upstream_ratelimit_size)
+	else S_MEMSIZE("region-presize:", region_presize)
+	else S_YNO("cache-hugepages:", cache_hugepages)
+	else S_YNO("cache-admission-filter:", cache_admission_filter)
+	else S_NUMBER_OR_ZERO("cache-expiry-scan:", cache_expiry_scan)
 	else S_SIZET_NONZERO("edns-buffer-size:", edns_buffer_size)
 	else S_SIZET_NONZERO("msg-buffer-size:", msg_buffer_size)
 	else S_MEMSIZE("msg-cache-size:", msg_cache_size)
 	else S_POW2("msg-cache-slabs:", msg_cache_slabs)
+	else S_SIZET_OR_ZERO("msg-cache-l1-slots:", msg_cache_l1_slots)
 	else S_SIZET_NONZERO("num-queries-per-thread:",num_queries_per_thread)
 	else S_SIZET_OR_ZERO("jostle-timeout:", jostle_time)
 	else S_MEMSIZE("so-rcvbuf:", so_rcvbuf)
@@ -372,6 +408,8 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_POW2("rrset-cache-slabs:", rrset_cache_slabs)
 	else S_YNO("prefetch:", prefetch)
 	else S_YNO("prefetch-key:", prefetch_key)
+	else S_SIZET_OR_ZERO("prefetch-popular:", prefetch_popular)
+	else S_NUMBER_NONZERO("prefetch-popular-rate:", prefetch_popular_rate)
 	else if(strcmp(opt, "cache-max-ttl:") == 0)
 	{ IS_NUMBER_OR_ZERO; cfg->max_ttl = atoi(val); MAX_TTL=(time_t)cfg->max_ttl;}
 	else if(strcmp(opt, "cache-min-ttl:") == 0)
@@ -606,10 +644,26 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "outgoing-range", outgoing_num_ports)
 	else O_DEC(opt, "outgoing-num-tcp", outgoing_num_tcp)
 	else O_DEC(opt, "incoming-num-tcp", incoming_num_tcp)
+	else O_DEC(opt, "tcp-idle-timeout", tcp_idle_timeout)
+	else O_YNO(opt, "tcp-fastopen", tcp_fastopen)
+	else O_YNO(opt, "tcp-upstream-fastopen", tcp_upstream_fastopen)
+	else O_DEC(opt, "rrl-ratelimit", rrl_ratelimit)
+	else O_DEC(opt, "rrl-slip", rrl_slip)
+	else O_DEC(opt, "rrl-ipv4-prefix", rrl_ipv4_prefix)
+	else O_DEC(opt, "rrl-ipv6-prefix", rrl_ipv6_prefix)
+	else O_UNS(opt, "rrl-size", rrl_size)
+	else O_DEC(opt, "upstream-zone-ratelimit", upstream_zone_ratelimit)
+	else O_DEC(opt, "upstream-server-ratelimit", upstream_server_ratelimit)
+	else O_MEM(opt, "upstream-ratelimit-size", upstream_ratelimit_size)
+	else O_MEM(opt, "region-presize", region_presize)
+	else O_YNO(opt, "cache-hugepages", cache_hugepages)
+	else O_YNO(opt, "cache-admission-filter", cache_admission_filter)
+	else O_DEC(opt, "cache-expiry-scan", cache_expiry_scan)
 	else O_DEC(opt, "edns-buffer-size", edns_buffer_size)
 	else O_DEC(opt, "msg-buffer-size", msg_buffer_size)
 	else O_MEM(opt, "msg-cache-size", msg_cache_size)
 	else O_DEC(opt, "msg-cache-slabs", msg_cache_slabs)
+	else O_UNS(opt, "msg-cache-l1-slots", msg_cache_l1_slots)
 	else O_DEC(opt, "num-queries-per-thread", num_queries_per_thread)
 	else O_UNS(opt, "jostle-timeout", jostle_time)
 	else O_MEM(opt, "so-rcvbuf", so_rcvbuf)
@@ -618,6 +672,8 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_MEM(opt, "rrset-cache-size", rrset_cache_size)
 	else O_DEC(opt, "rrset-cache-slabs", rrset_cache_slabs)
 	else O_YNO(opt, "prefetch-key", prefetch_key)
+	else O_UNS(opt, "prefetch-popular", prefetch_popular)
+	else O_DEC(opt, "prefetch-popular-rate", prefetch_popular_rate)
 	else O_YNO(opt, "prefetch", prefetch)
 	else O_DEC(opt, "cache-max-ttl", max_ttl)
 	else O_DEC(opt, "cache-min-ttl", min_ttl)
@@ -633,6 +689,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_YNO(opt, "ssl-upstream", ssl_upstream)
 	else O_STR(opt, "ssl-service-key", ssl_service_key)
 	else O_STR(opt, "ssl-service-pem", ssl_service_pem)
+	else O_LST(opt, "ssl-session-ticket-keys", ssl_session_ticket_keys)
 	else O_DEC(opt, "ssl-port", ssl_port)
 	else O_YNO(opt, "do-daemonize", do_daemonize)
 	else O_STR(opt, "chroot", chrootdir)
@@ -858,6 +915,7 @@ config_delete(struct config_file* cfg)
 	free(cfg->target_fetch_policy);
 	free(cfg->ssl_service_key);
 	free(cfg->ssl_service_pem);
+	config_delstrlist(cfg->ssl_session_ticket_keys);
 	if(cfg->ifs) {
 		int i;
 		for(i=0; i<cfg->num_ifs; i++)
@@ -83,6 +83,8 @@ struct config_file {
 	char* ssl_service_key;
 	/** public key file for dnstcp-ssl service */
 	char* ssl_service_pem;
+	/** files with the session ticket keys for the ssl service */
+	struct config_strlist* ssl_session_ticket_keys;
 	/** port on which to provide ssl service */
 	int ssl_port;
 	/** if outgoing tcp connections use SSL */
@@ -94,6 +96,36 @@ struct config_file {
 	size_t outgoing_num_tcp;
 	/** number of incoming tcp buffers per (per thread) */
 	size_t incoming_num_tcp;
+	/** timeout for idle incoming tcp connections, in msec */
+	int tcp_idle_timeout;
+	/** if TCP fast open is enabled on the incoming tcp sockets */
+	int tcp_fastopen;
+	/** if TCP fast open is tried for outgoing tcp connections */
+	int tcp_upstream_fastopen;
+	/** responses per second per client prefix and query, 0 is off */
+	int rrl_ratelimit;
+	/** every slip-th rate limited query gets a TC answer, 0 drops all */
+	int rrl_slip;
+	/** prefix length to group IPv4 clients for rate limiting */
+	int rrl_ipv4_prefix;
+	/** prefix length to group IPv6 clients for rate limiting */
+	int rrl_ipv6_prefix;
+	/** number of counters per row of the rate limit sketch */
+	size_t rrl_size;
+	/** queries per second to a delegation point zone, 0 is no limit */
+	int upstream_zone_ratelimit;
+	/** queries per second to an upstream server, 0 is no limit */
+	int upstream_server_ratelimit;
+	/** memory for the upstream query rates, in bytes */
+	size_t upstream_ratelimit_size;
+	/** bytes to reserve in the region of queries with large (DNSSEC) answers, 0 is off */
+	size_t region_presize;
+	/** if the cache memory is carved from huge page regions */
+	int cache_hugepages;
+	/** if the msg and rrset caches use the TinyLFU admission filter */
+	int cache_admission_filter;
+	/** msec between expiry scan slices of the msg and rrset caches, 0 is off */
+	int cache_expiry_scan;
 	/** allowed udp port numbers, array with 0 if not allowed */
 	int* outgoing_avail_ports;
 
@@ -105,6 +137,8 @@ struct config_file {
 	size_t msg_cache_size;
 	/** slabs in the message cache. */
 	size_t msg_cache_slabs;
+	/** number of slots in the per thread answer cache, 0 is off */
+	size_t msg_cache_l1_slots;
 	/** number of queries every thread can service */
 	size_t num_queries_per_thread;
 	/** number of msec to wait before items can be jostled out */
@@ -187,6 +221,10 @@ struct config_file {
 	int prefetch;
 	/** if prefetching of DNSKEYs should be performed. */
 	int prefetch_key;
+	/** number of popular queries tracked for prefetch, 0 is off */
+	size_t prefetch_popular;
+	/** max number of popular prefetches per second per thread */
+	int prefetch_popular_rate;
 
 	/** chrootdir, if not "" or chroot will be done */
 	char* chrootdir;
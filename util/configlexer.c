@@ -363,8 +363,8 @@ static void yy_fatal_error (yyconst char msg[]  );
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 146
-#define YY_END_OF_BUFFER 147
+#define YY_NUM_RULES 165
+#define YY_END_OF_BUFFER 166
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -372,160 +372,235 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[1383] =
+static yyconst flex_int16_t yy_accept[2071] =
     {   0,
-        1,    1,  128,  128,  132,  132,  136,  136,  140,  140,
-        1,    1,  147,  144,    1,  126,  126,  145,    2,  145,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  128,
-      129,  129,  130,  145,  132,  133,  133,  134,  145,  139,
-      136,  137,  137,  138,  145,  140,  141,  141,  142,  145,
-      143,  127,    2,  131,  145,  143,  144,    0,    1,    2,
-        2,    2,    2,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  128,    0,  132,    0,  139,    0,  136,  140,    0,
-      143,    0,    2,    2,  143,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      143,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  143,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,   65,  144,  144,
-
-      144,  144,  144,    6,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  143,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  143,
-      144,  144,  144,  144,   29,  144,  144,  144,  144,  144,
-      144,   12,   13,  144,   15,   14,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  121,  144,  144,  144,  144,  144,    3,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  143,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  135,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-       32,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-       33,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,   80,  135,
-
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,   79,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,   63,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,   20,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,   30,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-
-      144,  144,  144,  144,  144,  144,   31,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,   22,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,   26,  144,   27,  144,  144,  144,   66,  144,
-       67,  144,   64,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,    5,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-
-      144,   82,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,   23,  144,  144,  144,  144,
-      107,  106,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,   34,  144,  144,  144,  144,  144,  144,  144,  144,
-       69,   68,  144,  144,  144,  144,  144,  144,  103,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,   50,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-
-       54,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  105,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,    4,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      100,  144,  144,  144,  144,  144,  144,  144,  115,  101,
-      144,   21,  144,  144,  144,  144,   71,  144,   72,   70,
-      144,  144,  144,  144,  144,  144,   78,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  102,  144,  144,  144,
-
-      144,  125,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,   62,  144,  144,  144,  144,  144,  144,
-      144,  144,   28,  144,  144,   17,  144,  144,  144,   16,
-      144,   87,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,   41,   42,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,   73,  144,  144,  144,
-      144,  144,   77,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,   81,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  120,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-
-      144,  144,  144,  144,  144,   91,  144,   95,  144,  144,
-      144,  144,   76,  144,  144,  113,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,   94,
-      144,  144,  144,  144,   43,   44,  144,   49,   96,  144,
-      108,  104,  144,  144,   37,  144,   98,  144,  144,  144,
-      144,  144,    7,  144,   61,  112,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-       83,  144,  144,  122,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,   97,  144,   36,   38,
-
-      144,  144,  144,  144,  144,   60,  144,  144,  144,  144,
-      116,   18,   19,  144,  144,  144,  144,  144,  144,   58,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  118,
-      144,  144,   35,  144,  144,  144,  144,  144,  144,   11,
-      144,  144,  144,  144,  144,  144,  144,   10,  144,  144,
-       39,  144,  124,  117,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,   90,   89,  144,  119,  114,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,   45,
-      144,  123,  144,  144,  144,  144,   40,  144,  144,  144,
-       84,   86,  144,  144,  144,   88,  144,  144,  144,  144,
-
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-       24,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  111,  144,  144,  144,  144,  144,  144,
-      144,   25,  144,    9,  144,  144,  109,   51,  144,  144,
-      144,   93,  144,   74,  144,  144,  144,   53,   57,   52,
-      144,   46,  144,    8,  144,  144,   92,  144,  144,  144,
-       56,  144,   47,  144,  110,  144,  144,   85,   75,   55,
-       48,  144,  144,  144,  144,   59,  144,  144,  144,  144,
-       99,    0
+        1,    1,  147,  147,  151,  151,  155,  155,  159,  159,
+        1,    1,  166,  163,    1,  145,  145,  164,    2,  164,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  147,
+      148,  148,  149,  164,  151,  152,  152,  153,  164,  158,
+      155,  156,  156,  157,  164,  159,  160,  160,  161,  164,
+      162,  146,    2,  150,  164,  162,  163,    0,    1,    2,
+        2,    2,    2,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  147,    0,  151,    0,  158,    0,  155,  159,    0,
+      162,    0,    2,    2,  162,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      162,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  162,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,   84,  163,  163,
+
+      163,  163,  163,    6,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  162,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  162,
+      163,  163,  163,  163,   29,  163,  163,  163,  163,  163,
+      163,   12,   13,  163,   15,   14,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  140,  163,  163,  163,  163,  163,    3,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  162,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  154,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+       32,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+       33,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,   99,  154,
+
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,   98,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,   82,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,   20,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,   30,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+
+      163,  163,  163,  163,  163,  163,   31,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,   22,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,   26,  163,   27,  163,  163,  163,   85,  163,
+       86,  163,   83,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,    5,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+
+      163,  101,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,   23,  163,  163,  163,  163,
+      126,  125,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,   34,  163,  163,  163,  163,  163,  163,  163,  163,
+       88,   87,  163,  163,  163,  163,  163,  163,  122,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,   51,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+
+       71,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  124,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,    4,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      119,  163,  163,  163,  163,  163,  163,  163,  134,  120,
+      163,   21,  163,  163,  163,  163,   90,  163,   91,   89,
+      163,  163,  163,  163,  163,  163,   97,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  121,  163,  163,  163,
+
+      163,  144,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,   79,  163,  163,  163,  163,  163,  163,
+      163,  163,   28,  163,  163,   17,  163,  163,  163,   16,
+      163,  106,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,   42,   43,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,   92,  163,  163,  163,
+      163,  163,   96,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  100,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  139,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+
+      163,  163,  163,  163,  163,  110,  163,  114,  163,  163,
+      163,  163,   95,  163,  163,  132,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  113,
+      163,  163,  163,  163,   44,   45,  163,   50,  115,  163,
+      127,  123,  163,  163,   37,  163,  117,  163,  163,  163,
+      163,  163,    7,  163,   78,  131,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      102,  163,  163,  141,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  116,  163,   36,   38,
+
+      163,  163,  163,  163,  163,   77,  163,  163,  163,  163,
+      135,   18,   19,  163,  163,  163,  163,  163,  163,   75,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  137,
+      163,  163,   35,  163,  163,  163,  163,  163,  163,   11,
+      163,  163,  163,  163,  163,  163,  163,   10,  163,  163,
+       40,  163,  143,  136,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  109,  108,  163,  138,  133,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,   46,
+      163,  142,  163,  163,  163,  163,   41,  163,  163,  163,
+      103,  105,  163,  163,  163,  107,  163,  163,  163,  163,
+
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+       24,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  130,  163,  163,  163,  163,  163,  163,
+      163,   25,  163,    9,  163,  163,  128,   68,  163,  163,
+      163,  112,  163,   93,  163,  163,  163,   70,   74,   69,
+      163,   47,  163,    8,  163,  163,  111,  163,  163,  163,
+       73,  163,   48,  163,  129,  163,  163,  104,   94,   72,
+       49,  163,  163,  163,  163,   76,  163,  163,  163,  163,
+      118,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,   52,  163,  163,
+
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,   52,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,   67,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,   67,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,   53,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,   53,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+       54,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,   54,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,   55,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+       55,  163,  163,  163,  163,  163,  163,  163,  163,   56,
+      163,  163,  163,  163,  163,  163,  163,  163,   56,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,   57,  163,  163,  163,  163,  163,
+
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+       57,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,   58,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,   58,  163,  163,  163,  163,  163,  163,  163,
+      163,   59,  163,  163,  163,  163,  163,  163,  163,  163,
+       59,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,   60,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+
+      163,  163,  163,  163,  163,  163,  163,  163,   60,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,   61,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+       61,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,   62,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+
+      163,  163,  163,  163,  163,  163,  163,  163,   62,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,   63,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,   63,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,   64,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+       64,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,   65,  163,  163,  163,  163,  163,  163,
+
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,   65,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,   66,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,   66,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,   80,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,   80,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+
+      163,  163,  163,  163,  163,  163,  163,  163,   81,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+       81,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,   39,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,   39,    0
     } ;
 
 static yyconst flex_int32_t yy_ec[256] =
@@ -534,16 +609,16 @@ static yyconst flex_int32_t yy_ec[256] =
         1,    1,    4,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    2,    1,    5,    6,    1,    1,    1,    7,    1,
-        1,    1,    1,    1,    8,    1,    1,    1,    1,    1,
-        9,   10,    1,   11,    1,    1,    1,   12,    1,    1,
+        1,    1,    1,    1,    8,    1,    1,    1,    9,    1,
+       10,   11,    1,   12,    1,    1,    1,   13,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,   13,    1,    1,    1,    1,   14,   15,   16,   17,
+        1,   14,    1,    1,    1,    1,   15,   16,   17,   18,
 
-       18,   19,   20,   21,   22,   23,   24,   25,   26,   27,
-       28,   29,   30,   31,   32,   33,   34,   35,   36,   37,
-       38,   39,    1,    1,    1,    1,    1,    1,    1,    1,
+       19,   20,   21,   22,   23,   24,   25,   26,   27,   28,
+       29,   30,   31,   32,   33,   34,   35,   36,   37,   38,
+       39,   40,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -560,952 +635,1250 @@ static yyconst flex_int32_t yy_ec[256] =
         1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_int32_t yy_meta[40] =
+static yyconst flex_int32_t yy_meta[41] =
     {   0,
-        1,    2,    3,    4,    5,    1,    6,    1,    1,    1,
-        1,    7,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_int16_t yy_base[1397] =
+static yyconst flex_int16_t yy_base[2071] =
     {   0,
-        0,    0,   37,   40,   44,   51,   63,   75,   56,   68,
-       87,  108, 2653, 2569,   50, 2760, 2760, 2760,  129,   94,
-       70,  104,  122,   90,   92,  115,  126,   95,   84,  132,
-      135,  138,   50,  146,  148,  157,  167,  160,  151, 2566,
-     2760, 2760, 2760,   70, 2404, 2760, 2760, 2760,   42, 2139,
-     1931, 2760, 2760, 2760,  189, 1601, 2760, 2760, 2760,  195,
-     1479, 2760,  199, 2760,  203,  111,  635,  209,  120,    0,
-      220,    0,    0,  103,  141,  149,  202,  189,  182,  204,
-      206,  210,  218,  215,  217,  221,  222,  223,  225,  228,
-      235,  248,  165,  244,  247,  233,  245,  252,  246,  251,
-
-      258,  260,  261,  262,  267,  263,  270,  271,  158,  274,
-      276,  280,  277,  278,  282,  286,  283,   49,  287,  291,
-      288,  588,  304,  558,  307,  386,  316,  354,  297,  320,
-      236,  324,  328,    0,  321,  309,  330,  323,  226,  326,
-      327,  334,  331,  337,  348,  339,  342,  344,  333,  346,
-      353,  345,  351,  355,  354,  360,  363,  371,  373,  379,
-      375,  382,  383,  381,  380,  392,  393,  399,  400,  396,
-      402,  384,  405,  385,  406,  397,  409,  410,  413,  418,
-      421,  419,  420,  417,  428,  425,  426,  438,  445,  430,
-      431,  434,  442,  446,  447,  448,  451,  454,  455,  457,
-
-      458,  464,  461,  466,  467,  468,  473,  476,  474,  478,
-      484,  490,  475,  483,  486,  487,  491,  493,  494,  496,
-      502,  503,  504,  505,  509,  499,  510,  512,  526,  514,
-      527,  515,  519,  531,  537,  533,  541,  539,  543,  549,
-      545,  546,  547,  548,  553,  555,  561,  566,  557,  559,
-      567,  570,  568,  590,  560,  576,  577,  580,  586,  583,
-      596,  587,  595,  597,  613,  594,  611,  615,  619,  618,
-      584,  621,  622,  624,  517,  623,  628,  630,  631,  627,
-      629,  634,  649,  645,  646,  648,  647,  654,  661,  657,
-      658,  659,  662,  663,  665,  668,  672, 2760,  674,  669,
-
-      676,  677,  679, 2760,  680,  681,  682,  683,  685,  692,
-      694,  695,  697,  698,  699,  703,  704,  705,  725,  707,
-      706,  716,  709,  734,  713,  736,  715,  728,  732,  723,
-      739,  743,  710,  744,  745,  746,  754,  752,  753,  755,
-      757,  758,  762,  766,  765,  772,  773,  777,  779,  787,
-      784,  789,  790,  781,  791,  793,  799,  800,  798,  792,
-      806,  805,  795,  808,  813,  807,  822,  815,  818,  819,
-      826,  827,  828,  830,  829,  837,  836,  835,  844,  834,
-      843,  848,  849,  850,  851,  860,  857,  858,  863,  869,
-      870,  865,  871,  874,  875,  876,  877,  878,  879,  883,
-
-      885,  886,  894,  880,  890,  896,  902,  904,  887,  905,
-      908,  909,  910,  911,  919,  912,  921,  913,  923,  926,
-      929,  934,  925,  935, 2760,  945,  939,  941,  933,  759,
-      927, 2760, 2760,  947, 2760, 2760,  948,  949,  950,  961,
-      965,  958,  952,  960,  959,  974,  968,  978,  966,  986,
-      988,  971,  980,  982,  989,  992,  990,  994,  998,  996,
-     1004, 1007, 1006, 1008, 1010, 1011, 1013, 1015, 1016, 1022,
-     1017, 1029, 1026, 2760, 1027, 1028, 1032, 1034, 1035, 2760,
-     1036, 1039, 1037, 1040, 1041, 1047, 1043, 1050, 1048, 1051,
-     1053, 1055, 1059, 1056, 1061, 1073, 1074, 1064, 1072, 1077,
-
-     1071, 1079, 1086, 1085, 1087, 1089, 1095, 1091, 1094, 1097,
-     1098, 1099, 1100, 1101, 1104, 1126, 1106, 1107, 1108, 1109,
-     1114, 1115, 1116, 1117, 1132, 1138, 1140, 1120, 1141, 1147,
-     1149, 1143, 1152, 1150, 1156, 1157, 2760, 1163, 1159, 1160,
-     1165, 1167, 1168, 1112, 1170, 1171, 1173, 1174, 1175, 1182,
-     2760, 1180, 1183, 1181, 1185, 1186, 1192, 1194, 1204, 1200,
-     2760, 1207, 1208, 1210, 1211, 1198, 1214, 1215, 1216, 1219,
-     1222, 1223, 1225, 1230, 1232, 1220, 1234, 1227, 1233, 1235,
-     1240, 1242, 1243, 1244, 1246, 1250, 1256, 1259, 1257, 1264,
-     1258, 1260, 1266, 1269, 1267, 1270, 1268, 1271, 2760,  175,
-
-     1275, 1273, 1280, 1281, 1291, 1290, 1283, 1284, 1294, 1292,
-     1293, 1282, 1303, 1304, 1305, 1306, 1309, 1310, 1312, 1313,
-     1316, 1318, 1319, 1320, 1321, 1323, 1324, 1329, 1326, 1327,
-     1330, 2760, 1343, 1336, 1337, 1346, 1348, 1356, 1349, 1352,
-     1354, 1362, 1358, 1364, 1367, 1360, 1370, 1371, 1373, 1374,
-     1380, 1382, 1378, 1381, 1384, 1386, 2760, 1390, 1388, 1389,
-     1391, 1395, 1396, 1399, 1401, 1406, 1409, 1410, 1412, 2760,
-     1415, 1416, 1417, 1423, 1420, 1427, 1424, 1433, 1428, 1430,
-     1434, 1438, 1437, 1439, 1444, 2760, 1446, 1452, 1449, 1458,
-     1450, 1456, 1457, 1461, 1462, 1463, 1469, 1465, 1467, 1466,
-
-     1470, 1472, 1473, 1476, 1474, 1478, 2760, 1496, 1477, 1481,
-     1488, 1489, 1480, 1501, 1490, 1502, 1504, 1509, 1506, 1510,
-     1512, 1511, 1513, 1514, 1517, 1520, 1522, 1528, 1534, 1535,
-     1536, 2760, 1539, 1540, 1527, 1542, 1549, 1547, 1550, 1551,
-     1552, 1553, 1554, 1562, 1555, 1556, 1558, 1563, 1559, 1564,
-     1565, 1566, 1571, 1579, 1568, 1584, 1586, 1588, 1589, 1591,
-     1590, 1597, 2760, 1596, 2760, 1598, 1599, 1607, 2760, 1605,
-     2760, 1609, 2760, 1612, 1616, 1611, 1613, 1618, 1619, 1621,
-     1622, 1624, 1627, 1628, 1629, 1631, 1630, 2760, 1636, 1632,
-     1640, 1637, 1643, 1644, 1645, 1648, 1656, 1652, 1655, 1659,
-
-     1660, 2760, 1662, 1661, 1665, 1675, 1673, 1671, 1676, 1677,
-     1678, 1679, 1680, 1682, 1687, 1688, 1684, 1690, 1691, 1696,
-     1694, 1698, 1699, 1700, 1701, 2760, 1703, 1709, 1712, 1711,
-     2760, 2760, 1714, 1723, 1725, 1715, 1728, 1717, 1729, 1733,
-     1739, 1744, 1732, 1735, 1740, 1745, 1746, 1747, 1749, 1751,
-     1754, 2760, 1760, 1756, 1762, 1763, 1753, 1766, 1764, 1775,
-     2760, 2760, 1768, 1770, 1779, 1780, 1782, 1785, 2760, 1781,
-     1786, 1787, 1788, 1789, 1791, 1795, 1796, 1805, 1802, 1807,
-     1808, 1814, 1810, 1806, 1815, 1813, 1826, 2760, 1823, 1828,
-     1834, 1817, 1830, 1831, 1836, 1833, 1840, 1842, 1848, 1844,
-
-     2760, 1850, 1837, 1857, 1846, 1859, 1860, 1867, 1854, 1856,
-     1863, 1864, 1865, 1870, 1872, 1874, 1877, 2760, 1878, 1880,
-     1881, 1882, 1885, 1888, 1890, 1892, 1893, 2760, 1895, 1904,
-     1901, 1903, 1906, 1902, 1908, 1911, 1912, 1913, 1915, 1916,
-     1919, 1924, 1925, 1934, 1926, 1929, 1940, 1938, 1949, 1950,
-     1939, 1957, 1942, 1955, 1946, 1953, 1961, 1960, 1967, 1963,
-     2760, 1965, 1970, 1972, 1973, 1976, 1974, 1977, 2760, 2760,
-     1983, 2760, 1984, 1987, 1988, 1989, 2760, 1991, 2760, 2760,
-     1992, 1999, 1993, 2000, 1964, 2003, 2760, 2004, 2007, 2008,
-     2012, 2013, 2014, 2016, 2015, 2017, 2760, 2018, 2019, 2020,
-
-     2022, 2760, 2029, 2035, 2024, 2036, 2040, 2039, 2046, 2045,
-     2032, 2053, 2049, 2760, 2047, 2055, 2057, 2058, 2059, 2060,
-     2064, 2065, 2760, 2067, 2074, 2760, 2075, 2061, 2076, 2760,
-     2078, 2760, 2080, 2082, 2085, 2090, 2087, 2098, 2083, 2091,
-     2099, 2093, 2101, 2103, 2760, 2760, 2105, 2109, 2112, 2110,
-     2115, 2117, 2116, 2118, 2119, 2124, 2760, 2125, 2127, 2126,
-     2128, 2129, 2760, 2133, 2134, 2135, 2138, 2141, 2153, 2155,
-     2144, 2159, 2161, 2156, 2163, 2165, 2166, 2760, 2167, 2169,
-     2170, 2174, 2176, 2130, 2177, 2181, 2179, 2171, 2184, 2760,
-     2187, 2188, 2191, 2193, 2195, 2196, 2198, 2199, 2200, 2203,
-
-     2204, 2206, 2209, 2210, 2213, 2760, 2211, 2760, 2216, 2226,
-     2229, 2232, 2760, 2220, 2222, 2760, 2236, 2237, 2244, 2245,
-     2247, 2252, 2248, 2238, 2255, 2240, 2256, 2262, 2263, 2760,
-     2230, 2265, 2264, 2266, 2760, 2760, 2273, 2760, 2760, 2276,
-     2760, 2760, 2277, 2279, 2760, 2281, 2760, 2288, 2284, 2271,
-     2267, 2286, 2760, 2293, 2760, 2760, 2290, 2294, 2297, 2298,
-     2300, 2302, 2305, 2306, 2307, 2308, 2309, 2310, 2312, 2314,
-     2315, 2228, 2316, 2317, 2319, 2323, 2326, 2328, 2329, 2339,
-     2760, 2327, 2340, 2760, 2347, 2342, 2335, 2331, 2348, 2352,
-     2353, 2355, 2361, 2358, 2357, 2359, 2760, 2362, 2760, 2760,
-
-     2360, 2364, 2370, 2363, 2365, 2760, 2375, 2371, 2385, 2387,
-     2760, 2760, 2760, 2388, 2377, 2382, 2392, 2393, 2394, 2760,
-     2395, 2396, 2400, 2403, 2407, 2409, 2416, 2413, 2415, 2760,
-     2417, 2419, 2760, 2420, 2421, 2424, 2426, 2427, 2429, 2760,
-     2425, 2430, 2437, 2432, 2440, 2442, 2443, 2760, 2445, 2446,
-     2760, 2452, 2760, 2760, 2447, 2455, 2457, 2462, 2464, 2453,
-     2458, 2470, 2469, 2473, 2760, 2760, 2474, 2760, 2760, 2466,
-     2475, 2476, 2478, 2481, 2482, 2484, 2486, 2489, 2488, 2760,
-     2490, 2760, 2491, 2500, 2492, 2494, 2760, 2501, 2502, 2505,
-     2760, 2760, 2506, 2515, 2513, 2760, 2518, 2517, 2519, 2520,
-
-     2525, 2527, 2521, 2528, 2531, 2529, 2507, 2532, 2541, 2543,
-     2760, 2545, 2542, 2546, 2550, 2553, 2554, 2555, 2556, 2558,
-     2559, 2561, 2563, 2760, 2564, 2565, 2575, 2580, 2584, 2572,
-     2586, 2760, 2587, 2760, 2590, 2591, 2760, 2760, 2592, 2594,
-     2597, 2760, 2598, 2760, 2581, 2605, 2595, 2760, 2760, 2760,
-     2607, 2760, 2608, 2760, 2610, 2611, 2760, 2613, 2615, 2617,
-     2760, 2619, 2760, 2621, 2760, 2622, 2623, 2760, 2760, 2760,
-     2760, 2625, 2627, 2633, 2628, 2760, 2630, 2635, 2636, 2639,
-     2760, 2760, 2668, 2675, 2682, 2689, 2696,   94, 2703, 2710,
-     2717, 2724, 2731, 2738, 2745, 2752
-
+        0,   41,   82,    0,  123,    0,  164,    0,  205,    0,
+      246,    0,    0,  861, 1555,  290,    0,    0,  287,  328,
+      902,  943,  984, 1025, 1066, 1107, 1148, 1189, 1230, 1271,
+     1312, 1353, 1394, 1435, 1537, 1493, 1543, 1122,  685,  656,
+        0,    0,    0,  369,  697,    0,    0,    0,  410,  779,
+      659,    0,    0,    0,  451,  738,    0,    0,    0,  492,
+      820,    0,  533,    0,  574,  303,    0,    0,    0,  615,
+        0,    0, 1478,  355,  395,  420,  478,  504,  549,  592,
+      628,  665, 1599,  715,  840,  883,  914,  969, 1009, 1041,
+     1467, 1063, 1046, 1610, 1175, 1072, 1084, 1102, 1132, 1134,
+
+     1172, 1175, 1200, 1225, 1242, 1214, 1250, 1288, 1288, 1325,
+     1334, 1391, 1381, 1637, 1408, 1418, 1444, 1444, 1486, 1507,
+     1503,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 1493, 1545, 1650, 1681, 1683, 1743, 1754,
+     1757, 1666, 1773, 1785, 1485, 1780, 1763, 1778, 1761, 1781,
+     1781, 1773, 1773, 1165, 1771, 1785, 1790, 1772, 1777, 1800,
+     1794, 1498, 1802, 1788, 1777, 1805, 1795, 1807, 1808, 1796,
+     1798, 1785, 1800, 1785, 1800, 1794, 1790, 1806, 1790,  709,
+     1819, 1794, 1813, 1809, 1823, 1799, 1818, 1470, 1826, 1603,
+     1809, 1803, 1815, 1830, 1820, 1811, 1809, 1820, 1804, 1827,
+
+     1830, 1831, 1817, 1819, 1832, 1832, 1828, 1844, 1825, 1839,
+     1836, 1848, 1823, 1826, 1824, 1833, 1846, 1830, 1845, 1838,
+     1857, 1849, 1841, 1201, 1845, 1834, 1843, 1845,  766, 1859,
+     1856, 1242, 1845, 1852, 1863, 1858, 1863, 1850, 1846, 1873,
+     1848, 1864,  888, 1856,  751, 1862, 1878, 1868, 1853, 1855,
+     1862, 1550, 1863, 1460, 1863, 1870, 1859, 1862, 1867, 1863,
+     1890, 1865, 1871, 1872, 1894, 1869, 1876, 1886,  812, 1872,
+     1877, 1878, 1881, 1894, 1893, 1880, 1885, 1648, 1891, 1896,
+     1898, 1894, 1910, 1899, 1902, 1902, 1895, 1908, 1916, 1890,
+     1903, 1901, 1910, 1914, 1911, 1896, 1917,    0, 1918, 1899,
+
+     1913, 1913, 1911,    0, 1904, 1905, 1912, 1922, 1920, 1935,
+     1912, 1909, 1911, 1929, 1919, 1930, 1920, 1918, 1494, 1918,
+     1923, 1306, 1920, 1940, 1917, 1942, 1929, 1933, 1931, 1928,
+     1926, 1944, 1941, 1932, 1937, 1949, 1960, 1943, 1938, 1944,
+     1959, 1947, 1948, 1958, 1947, 1960, 1951, 1966, 1967, 1973,
+     1969, 1970, 1976, 1950, 1967, 1969, 1980, 1971, 1971, 1957,
+     1984, 1974, 1966, 1542, 1980, 1964, 1989, 1975, 1982, 1650,
+     1981, 1974, 1983, 1973, 1978, 1997, 1986, 1990, 1991, 1990,
+     1978, 1983, 1993, 1996, 1995, 1347, 2007, 1993, 1666, 1388,
+     2001, 1985, 2003, 1988, 1989, 1989, 1989, 2006, 2002, 1997,
+
+     1995, 1999, 2021, 1997, 2016, 2014, 2014, 2004, 2002, 2009,
+     2016, 2019, 2018, 2021, 2022, 2010, 2022, 2021, 2017, 2027,
+     2030, 2030, 2014,  933,    0, 2042, 2033, 2026, 2021, 2032,
+     2026,    0,    0, 2025,    0,    0, 2034, 2038, 2041, 2052,
+     1478, 2042, 2030, 2024, 2047, 2052, 2045, 2052, 2039, 2054,
+     2053, 2052, 2038, 2040, 2052, 2060, 2047, 2045, 2059, 2066,
+     2072, 2073, 2065, 2063, 2062, 2063, 2054, 2068, 2067, 2076,
+     2068, 2083, 2059,    0, 2076, 2066, 2080, 2067,  972,    0,
+     2062, 2079, 2064, 2066, 2065, 2068, 2080, 2086, 2073, 2073,
+     2084, 2080, 2089, 2076, 2083, 2104, 2095, 2081, 2089, 2097,
+
+     2082, 2103, 2111, 2103, 2089, 2095, 2115, 2090, 2112, 2113,
+     2098, 2110, 2096, 2092, 2103, 1498, 2114, 2104, 2095, 2106,
+     2108, 2102, 2110, 2119, 2132, 1510, 2122, 2114, 2117, 2129,
+     2126, 2124, 2119, 2115, 2136, 2132,    0, 2143, 2135, 2120,
+     2127, 2136, 2123, 2134, 2125, 2140, 2126, 2133, 2139, 2155,
+        0, 2131, 2133, 2137, 2148, 2149, 2150, 2147, 2156, 2164,
+        0, 1429, 1260, 2156, 2145, 2141, 2159, 2142, 2159, 2160,
+     2160, 2151, 2162, 2170, 2161, 2153, 2169, 2155, 2155, 2155,
+     2163, 2172, 2173, 2161, 2177, 2170, 2188, 2189, 2169, 2186,
+     2167, 2173, 2176, 2193, 2172, 2182, 2173, 2168,    0,    0,
+
+     2180, 2180, 2176, 2203, 2204, 2194, 2186, 2187, 2197, 2188,
+     2189, 2186, 2207, 2189, 2199, 2204, 2191, 2206, 2193, 2209,
+     2205, 2200, 2201, 2205, 2199, 2198, 2202, 2215, 2207, 2203,
+     2215,    0, 2231, 2212, 2219, 2208, 2224, 1629, 2211, 2218,
+     2223, 2239, 2233, 2230, 2231, 2236, 2229, 2234, 2226, 2223,
+     2248, 2249, 2239, 2241, 1508, 2235,    0, 2243, 2233, 2231,
+     2236, 2232, 2244, 2239, 2236, 2230, 2257, 2242, 2259,    0,
+     2256, 2255, 2242, 2263, 2243, 2265, 2260, 2267, 2247, 2263,
+     2261, 2265, 2253, 2266, 2266,    0, 2280, 2281, 2271, 2283,
+     2269, 2260, 2269, 2282, 2262, 2260, 2290, 2265, 2266, 2269,
+
+     2287, 2269, 2265, 2273, 2269, 2288,    0, 1678, 2268, 2277,
+     2291, 2279, 2278, 2295, 2282, 2282, 2288, 2288, 2285, 2300,
+     2299, 2302, 2290, 2300, 2295, 2305, 2291, 2308, 2320, 2321,
+     2315,    0, 2318, 2313, 2305, 2301, 1679, 2322, 2303, 2304,
+     2298, 2306, 2320, 2333, 2309, 2310, 2311, 2312, 2318, 2312,
+     2319, 2334, 2331, 2333, 2325, 2330, 2320, 2342, 2337, 2339,
+     2324, 2351,    0, 2328,    0, 2342, 2347, 2355,    0, 2351,
+        0, 2352,    0, 2349, 2352, 2339, 2330, 2351, 2342, 2359,
+     2339, 2359, 2339, 2351, 2359, 2345, 2360,    0, 2348, 2353,
+     2367, 2349, 2350, 2351, 2370, 2368, 2380, 2355, 2362, 2378,
+
+     2372,    0, 2374, 2355, 2378, 2388, 2382, 2366, 2366, 2366,
+     2382, 2365, 2384, 2391, 2386, 2374, 2373, 2374, 2381, 2384,
+     2384, 2404, 2379, 2380, 2380,    0, 2387, 2396, 1293, 2388,
+        0,    0, 2406, 2403, 2402, 2392, 2400, 2391, 1670, 2402,
+     2418, 2414, 2394, 2402, 2398, 2403, 2393, 2401, 2419, 2405,
+     2404,    0, 2429, 2406, 2431, 2420, 2407, 2434, 2416, 1671,
+        0,    0, 2422, 2418, 2414, 2414, 2418, 2417,    0, 2416,
+     2433, 2433, 2434, 2435, 2432, 2419, 2428, 2445, 2431, 2434,
+     2435, 2454, 2437, 2432, 2445, 2453, 2454,    0, 2445, 2456,
+     2462, 2436, 2439, 2439, 2461, 2441, 2463, 2464, 2470, 2462,
+
+        0, 2472, 2449, 2474, 2444, 2471, 2470, 2478, 1537, 2453,
+     2454, 2455, 2455, 2478, 2452, 2478, 2460,    0, 2472, 2483,
+     2468, 2477, 2476, 2460, 2486, 2462, 2473,    0, 2485, 2497,
+     2472, 2486, 2495, 2490, 2487, 2477, 2483, 2480, 2485, 2495,
+     2493, 2504, 1670, 2505, 2484, 2492, 2513, 2509, 1689, 2515,
+     2498, 2517, 2500, 2509, 2502, 2490, 2522, 2495, 2524, 2507,
+        0, 2517, 2522, 2523, 2517, 2519, 2519, 2517,    0,    0,
+     2515,    0, 1684, 2510, 2520, 2521,    0, 2532,    0,    0,
+     2518, 2539, 2517, 2534, 2534, 2538,    0, 2531, 2519, 2539,
+     2520, 2530, 2531, 2532, 2530, 2526,    0, 2542, 2546, 2531,
+
+     2541,    0, 2537, 2553, 2527, 2549, 2553, 2551, 2552, 2540,
+     2539, 2566, 2556,    0, 2543, 2549, 2565, 2553, 1678, 2564,
+     2558, 2556,    0, 2564, 2565,    0, 2558, 2552, 2557,    0,
+     2568,    0, 2569, 2551, 2568, 2579, 2570, 2581, 2562, 2578,
+     2578, 2571, 2586, 2578,    0,    0, 2578, 2589, 2588, 2578,
+     2586, 2588, 2578, 2589, 2569, 2577,    0, 2573, 2579, 2578,
+     2588, 2580,    0, 2603, 2600, 2591, 2592, 2605, 2608, 2609,
+     2596, 2611, 2612, 2593, 2614, 2615, 2596,    0, 2611, 2618,
+     2599, 2620, 2602, 2615, 2619, 1688, 2624, 2605, 2626,    0,
+     2627, 2601, 2627, 2620, 2618, 2626, 2607, 2620, 2613, 2630,
+
+     2621, 2628, 2629, 2645, 2636,    0, 2621,    0, 2633, 2642,
+     2650, 1015,    0, 2630, 2634,    0, 2644, 2643, 2650, 2646,
+     2648, 2653, 2648, 2634, 2651, 2636, 2652, 2664, 2653,    0,
+     2644, 2656, 2654, 2661,    0,    0, 2663,    0,    0, 2666,
+        0,    0, 2661, 2668,    0, 2669,    0, 2675, 2669, 2655,
+     2650, 2668,    0, 2675,    0,    0, 2670, 2674, 2663, 2673,
+     2680, 2681, 2682, 2670, 2665, 2672, 2673, 2674, 2667, 2689,
+     2680, 2664, 2671, 2679, 2669, 2680, 2677, 2691, 2692, 2699,
+        0, 2681, 2699,    0, 2702, 2693, 2688, 2686, 2687, 2690,
+     2688, 2709, 2715, 2695, 2692, 2692,    0, 2694,    0,    0,
+
+     2694, 2712, 2717, 2702, 2700,    0, 2720, 2701, 2722, 2723,
+        0,    0,    0, 2722, 2702, 2716, 2721, 2722, 2720,    0,
+     2714, 2725, 2726, 2717, 2734, 2735, 2741, 2737, 2738,    0,
+     2733, 2727,    0, 2737, 2728, 2733, 2734, 2743, 2736,    0,
+     2727, 2728, 2749, 2740, 2751, 2743, 2747,    0, 2744, 2741,
+        0, 2756,    0,    0, 2736, 2756, 2755, 2760, 2761, 2743,
+     2748, 2769, 2765, 2761,    0,    0, 2760,    0,    0, 2748,
+     2760, 2750, 2769, 2755, 2767, 2753, 2748, 2766, 2756,    0,
+     2774,    0, 2760, 2780, 2776, 2772,    0, 2773, 2771, 2759,
+        0,    0, 2780, 2785, 2778,    0, 2783, 2780, 2771, 2776,
+
+     2793, 2784, 2778, 2776, 2788, 2792, 2772, 2780, 2801, 2796,
+        0, 2803, 2783, 2782, 2806, 2807, 2788, 2796, 2789, 2811,
+     2799, 2813, 2794,    0, 2800, 2810, 2817, 2818, 2819, 2814,
+     2821,    0, 2820,    0, 2823, 2818,    0,    0, 2816, 2826,
+     2821,    0, 2822,    0, 2808, 2830, 2826,    0,    0,    0,
+     2832,    0, 2828,    0, 2834, 2819,    0, 2817, 2837, 2838,
+        0, 2839,    0, 2840,    0, 2828, 2840,    0,    0,    0,
+        0, 2838, 2823, 2845, 2836,    0, 2831, 2833, 2829, 2850,
+        0, 1556, 2834, 2857, 1682, 2848, 2841, 2849, 2861, 2836,
+     2848, 2845, 2854, 2845, 2840, 2842, 2864,    0, 1557, 2848,
+
+     2871, 1684, 2862, 2855, 2863, 2875, 2850, 2862, 2859, 2868,
+     2859, 2854, 2856, 2878,    0, 1510, 2866, 2885,  792, 2875,
+      832, 2862, 2873, 2868, 2870, 2891, 2866, 2878, 2885, 2878,
+     2885, 2871, 2898, 2882, 2889, 2870, 2877, 2898,    0, 1518,
+     2886, 2905,  833, 2895, 1119, 2882, 2893, 2888, 2890, 2911,
+     2886, 2898, 2905, 2898, 2905, 2891, 2918, 2902, 2909, 2890,
+     2897, 2918,    0, 1561, 2902, 2925, 1557, 2919, 2902, 2902,
+     2908, 2908, 2920, 2912, 2928,    0, 1564, 2912, 2935, 1562,
+     2929, 2912, 2912, 2918, 2918, 2930, 2922, 2938,    0, 1569,
+     2922, 2945, 1567, 2924, 2922, 2922, 2925, 2939, 2944, 2933,
+
+     1698, 2941, 2947, 2930, 2930, 2936, 2936, 2948, 2940, 2956,
+        0, 1583, 2940, 2963, 1571, 2942, 2940, 2940, 2943, 2957,
+     2962, 2951, 1700, 2959, 2965, 2948, 2948, 2954, 2954, 2966,
+     2958, 2974,    0, 1576, 1683, 2980, 2957, 2975, 2957, 2973,
+     2967, 2971, 2968, 2973, 2963, 2985,    0, 1580, 1688, 2991,
+     2968, 2986, 2968, 2984, 2978, 2982, 2979, 2984, 2974, 2996,
+        0, 1584, 1689, 3002, 1324, 2985, 2989, 2983, 3001,    0,
+     1585, 1694, 3007, 1365, 2990, 2994, 2988, 3006,    0, 1591,
+     1697, 3012, 1595, 2991, 2986, 3012, 3016, 2995, 2994, 3008,
+     3008, 3006, 2992, 3018,    0, 1592, 1698, 3024, 1599, 3003,
+
+     2998, 3024, 3028, 3007, 3006, 3020, 3020, 3018, 3004, 3030,
+        0, 1606, 1699, 3036, 1607, 3015, 3010, 1427, 3039, 3018,
+     3017, 3031, 3031, 3029, 3015, 3041,    0, 1614, 1700, 3047,
+     1618, 3026, 3021, 1717, 3050, 3029, 3028, 3042, 3042, 3040,
+     3026, 3052,    0, 1615, 1708, 3058, 1622, 1712, 3027, 3049,
+     3056,    0, 1629, 1710, 3062, 1630, 1714, 3031, 3053, 3060,
+        0,  876, 3041, 3041, 3044, 3058, 3063, 3052, 3072, 3041,
+     3053, 3055, 3065, 3077, 3054, 3072, 3054, 3070, 3064, 3068,
+     3065, 3070, 3060, 3082,    0,  917, 3063, 3063, 3066, 3080,
+     3085, 3074, 3094, 3063, 3075, 3077, 3087, 3099, 3076, 3094,
+
+     3076, 3092, 3086, 3090, 3087, 3092, 3082, 3104,    0,  958,
+     3085, 3085, 3088, 3102, 3107, 3096, 3116, 1706, 3106, 3094,
+     3091, 3109, 3097, 3122, 3099, 3117, 3099, 3115, 3109, 3113,
+     3110, 3115, 3105, 3127,    0,  999, 3108, 3108, 3111, 3125,
+     3130, 3119, 3139, 1709, 3129, 3117, 3114, 3132, 3120, 3145,
+     3122, 3140, 3122, 3138, 3132, 3136, 3133, 3138, 3128, 3150,
+        0, 1040, 3131, 3131, 3134, 3148, 3153, 3142, 3162, 1624,
+     3156, 3138, 3154, 3148, 3152, 3149, 3154, 3144, 3171, 3147,
+     3158, 3142, 3164, 3171,    0, 1081, 3152, 3152, 3155, 3169,
+     3174, 3163, 3183, 1627, 3177, 3159, 3175, 3169, 3173, 3170,
+
+     3175, 3165, 3192, 3168, 3179, 3163, 3185, 3192,    0, 1646,
+     1723, 3183, 3178, 3180, 3201, 3180, 3179, 3193, 3180, 3191,
+     3175, 3197, 3204,    0, 1647, 1724, 3195, 3190, 3192, 3213,
+     3192, 3191, 3205, 3192, 3203, 3187, 3209, 3216,    0, 3215,
+     3214, 3210, 3214, 3226, 1725, 3200, 3215, 3218, 3208, 3224,
+     3219, 3222, 3209, 3230,    0, 3229, 3228, 3224, 3228, 3240,
+     1726, 3214, 3229, 3232, 3222, 3238, 3233, 3236, 3223, 3244,
+        0, 3243, 3242, 3238, 3242, 3254, 1655, 3245, 3237, 3242,
+     3233, 3234, 3245, 3240, 3242, 3263, 3252, 3250, 3248, 3241,
+     3257, 3245, 3265,    0, 3264, 3263, 3259, 3263, 3275, 1658,
+
+     3266, 3258, 3263, 3254, 3255, 3266, 3261, 3263, 3284, 3273,
+     3271, 3269, 3262, 3278, 3266, 3286,    0, 3285, 3284, 3280,
+     3284, 3296, 1526, 3267, 3276, 3284, 3276, 3270, 3302, 3278,
+     3295, 3298, 3286, 3302,    0, 3301, 3300, 3296, 3300, 3312,
+     1527, 3283, 3292, 3300, 3292, 3286, 3318, 3294, 3311, 3314,
+     3302, 3318,    0, 3300, 1735, 3313, 3315, 3301, 3319, 3315,
+     1747, 1731, 3309, 3309, 3305, 3315, 3327, 3311, 3331,    0,
+     3313, 1740, 3326, 3328, 3314, 3332, 3328, 1749, 1739, 3322,
+     3322, 3318, 3328, 3340, 3324, 3344,    0, 3326, 1747, 3339,
+     3341, 3327, 3345, 3341, 1759, 1743, 3335, 3335, 3331, 3341,
+
+     3353, 3337, 1763, 3338, 3356, 3338, 3354, 3361,    0, 3343,
+     1755, 3356, 3358, 3344, 3362, 3358, 1767, 1752, 3352, 3352,
+     3348, 3358, 3370, 3354, 1771, 3355, 3373, 3355, 3371, 3378,
+        0, 3359, 3372, 3386, 1769, 3380, 3379, 3375, 3379, 3391,
+     1755, 3391, 3393, 3369, 3377, 3375, 3371, 3373, 3394,    0,
+     3375, 3388, 3402, 1773, 3396, 3395, 3391, 3395, 3407, 1761,
+     3407, 3409, 3385, 3393, 3391, 3387, 3389, 3410,    0, 3451
     } ;
 
-static yyconst flex_int16_t yy_def[1397] =
+static yyconst flex_int16_t yy_def[2071] =
     {   0,
-     1382,    1, 1383, 1383, 1384, 1384, 1385, 1385, 1386, 1386,
-     1387, 1387, 1382, 1388, 1382, 1382, 1382, 1382, 1389, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1390,
-     1382, 1382, 1382, 1390, 1391, 1382, 1382, 1382, 1391, 1392,
-     1382, 1382, 1382, 1382, 1392, 1393, 1382, 1382, 1382, 1393,
-     1394, 1382, 1395, 1382, 1394, 1394, 1388, 1388, 1382, 1396,
-     1389, 1396, 1389, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1390, 1390, 1391, 1391, 1392, 1392, 1382, 1393, 1393,
-     1394, 1394, 1395, 1395, 1394, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1394, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1394, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1382, 1388, 1388,
-
-     1388, 1388, 1388, 1382, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1394, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1394,
-     1388, 1388, 1388, 1388, 1382, 1388, 1388, 1388, 1388, 1388,
-     1388, 1382, 1382, 1388, 1382, 1382, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1382, 1388, 1388, 1388, 1388, 1388, 1382,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1394,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1382, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1382, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1382, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1382, 1394,
-
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1382, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1382, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1382,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1382, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-
-     1388, 1388, 1388, 1388, 1388, 1388, 1382, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1382, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1382, 1388, 1382, 1388, 1388, 1388, 1382, 1388,
-     1382, 1388, 1382, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1382, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-
-     1388, 1382, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1382, 1388, 1388, 1388, 1388,
-     1382, 1382, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1382, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1382, 1382, 1388, 1388, 1388, 1388, 1388, 1388, 1382, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1382, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-
-     1382, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1382, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1382, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1382, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1382, 1382,
-     1388, 1382, 1388, 1388, 1388, 1388, 1382, 1388, 1382, 1382,
-     1388, 1388, 1388, 1388, 1388, 1388, 1382, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1382, 1388, 1388, 1388,
-
-     1388, 1382, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1382, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1382, 1388, 1388, 1382, 1388, 1388, 1388, 1382,
-     1388, 1382, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1382, 1382, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1382, 1388, 1388, 1388,
-     1388, 1388, 1382, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1382, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1382,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-
-     1388, 1388, 1388, 1388, 1388, 1382, 1388, 1382, 1388, 1388,
-     1388, 1388, 1382, 1388, 1388, 1382, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1382,
-     1388, 1388, 1388, 1388, 1382, 1382, 1388, 1382, 1382, 1388,
-     1382, 1382, 1388, 1388, 1382, 1388, 1382, 1388, 1388, 1388,
-     1388, 1388, 1382, 1388, 1382, 1382, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1382, 1388, 1388, 1382, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1382, 1388, 1382, 1382,
-
-     1388, 1388, 1388, 1388, 1388, 1382, 1388, 1388, 1388, 1388,
-     1382, 1382, 1382, 1388, 1388, 1388, 1388, 1388, 1388, 1382,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1382,
-     1388, 1388, 1382, 1388, 1388, 1388, 1388, 1388, 1388, 1382,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1382, 1388, 1388,
-     1382, 1388, 1382, 1382, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1388, 1382, 1382, 1388, 1382, 1382, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1382,
-     1388, 1382, 1388, 1388, 1388, 1388, 1382, 1388, 1388, 1388,
-     1382, 1382, 1388, 1388, 1388, 1382, 1388, 1388, 1388, 1388,
-
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1382, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1388, 1382, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1382, 1388, 1382, 1388, 1388, 1382, 1382, 1388, 1388,
-     1388, 1382, 1388, 1382, 1388, 1388, 1388, 1382, 1382, 1382,
-     1388, 1382, 1388, 1382, 1388, 1388, 1382, 1388, 1388, 1388,
-     1382, 1388, 1382, 1388, 1382, 1388, 1388, 1382, 1382, 1382,
-     1382, 1388, 1388, 1388, 1388, 1382, 1388, 1388, 1388, 1388,
-     1382,    0, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382
-
+     2070, 2070, 2070,    3, 2070,    5, 2070,    7, 2070,    9,
+     2070,   11, 2070, 2070, 2070, 2070,   16,   16, 2070, 2070,
+     2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070,
+     2070, 2070, 2070, 2070,   14,   14,   14,   14,   14, 2070,
+       16,   16,   16, 2070, 2070,   16,   16,   16, 2070, 2070,
+     2070,   16,   16,   16, 2070, 2070,   16,   16,   16, 2070,
+     2070,   16, 2070,   16, 2070,   61,   14,   20,   15, 2070,
+       19,   70,   19,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   40,   44,   45,   49,   50,   55,   51,   56,   60,
+       61,   65,   63,   63,   61,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       61,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   61,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   16,   14,   14,
+
+       14,   14,   14,   16,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   61,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   61,
+       14,   14,   14,   14,   16,   14,   14,   14,   14,   14,
+       14,   16,   16,   14,   16,   16,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   16,   14,   14,   14,   14,   14,   16,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   61,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   16,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       16,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       16,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   16,   61,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   16,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   16,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   16,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   16,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   16,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   16,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   16,   14,   16,   14,   14,   14,   16,   14,
+       16,   14,   16,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   16,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   16,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   16,   14,   14,   14,   14,
+       16,   16,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   16,   14,   14,   14,   14,   14,   14,   14,   14,
+       16,   16,   14,   14,   14,   14,   14,   14,   16,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   16,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       16,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   16,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   16,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       16,   14,   14,   14,   14,   14,   14,   14,   16,   16,
+       14,   16,   14,   14,   14,   14,   16,   14,   16,   16,
+       14,   14,   14,   14,   14,   14,   16,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   16,   14,   14,   14,
+
+       14,   16,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   16,   14,   14,   14,   14,   14,   14,
+       14,   14,   16,   14,   14,   16,   14,   14,   14,   16,
+       14,   16,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   16,   16,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   16,   14,   14,   14,
+       14,   14,   16,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   16,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   16,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   16,   14,   16,   14,   14,
+       14,   14,   16,   14,   14,   16,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   16,
+       14,   14,   14,   14,   16,   16,   14,   16,   16,   14,
+       16,   16,   14,   14,   16,   14,   16,   14,   14,   14,
+       14,   14,   16,   14,   16,   16,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       16,   14,   14,   16,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   16,   14,   16,   16,
+
+       14,   14,   14,   14,   14,   16,   14,   14,   14,   14,
+       16,   16,   16,   14,   14,   14,   14,   14,   14,   16,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   16,
+       14,   14,   16,   14,   14,   14,   14,   14,   14,   16,
+       14,   14,   14,   14,   14,   14,   14,   16,   14,   14,
+       16,   14,   16,   16,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   16,   16,   14,   16,   16,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   16,
+       14,   16,   14,   14,   14,   14,   16,   14,   14,   14,
+       16,   16,   14,   14,   14,   16,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       16,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   16,   14,   14,   14,   14,   14,   14,
+       14,   16,   14,   16,   14,   14,   16,   16,   14,   14,
+       14,   16,   14,   16,   14,   14,   14,   16,   16,   16,
+       14,   16,   14,   16,   14,   14,   16,   14,   14,   14,
+       16,   14,   16,   14,   16,   14,   14,   16,   16,   16,
+       16,   14,   14,   14,   14,   16,   14,   14,   14,   14,
+       16,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   16,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   16,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2070,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14, 2070,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14, 2070,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2070,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2070,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14, 2070,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14, 2070,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2070,   14,   14,   14,   14,   14,   14,   14,   14, 2070,
+       14,   14,   14,   14,   14,   14,   14,   14, 2070,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2070,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2070,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14, 2070,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14, 2070,   14,   14,   14,   14,   14,   14,   14,
+       14, 2070,   14,   14,   14,   14,   14,   14,   14,   14,
+     2070,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2070,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14, 2070,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2070,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2070,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2070,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14, 2070,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 2070,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2070,   22,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2070,   22,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2070,   22,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 2070,   22,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14, 2070,   22,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14, 2070,   22,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14, 2070,   34,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14, 2070,
+       34,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14, 2070,   34,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14, 2070,   34,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+     2070,   31,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14, 2070,
+       31,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14, 2070,    0
     } ;
 
-static yyconst flex_int16_t yy_nxt[2800] =
-    {   0,
+static yyconst flex_int16_t yy_nxt[3492] =
+    {   13,
        14,   15,   16,   17,   18,   19,   18,   14,   14,   14,
-       14,   18,   20,   21,   14,   22,   23,   24,   25,   14,
-       26,   27,   28,   29,   30,   31,   32,   33,   34,   14,
-       35,   36,   37,   38,   39,   14,   14,   14,   14,   41,
-       42,   43,   41,   42,   43,  124,   46,   47,  124,   44,
-       48,   69,   44,   46,   47,   70,   49,   48,   57,   58,
-       59,   68,   68,   49,   51,   52,   53,   54,   60,   18,
-       57,   58,   59,  122,  122,   55,   51,   52,   53,   54,
-       60,   18,   68,  103,  187,   74,   75,   55,   15,   16,
-       17,   62,   63,   64,   67,   67,   68,   67,   67,   65,
-
-       67,   94,   68,   76,   68,   67,   84,   68,   66,   15,
-       16,   17,   62,   63,   64,   68,   68,   77,  136,   86,
-       65,   69,   93,  132,   78,   70,   85,   68,   87,   66,
-       72,   79,   72,   72,   68,   72,   88,  135,   68,   80,
-       72,   73,   89,   81,   68,   90,   82,   68,   96,   83,
-       68,  100,   91,   68,   92,  101,   97,  137,   68,   95,
-       68,   68,   98,   68,  120,  108,   99,  104,  121,   68,
-       68,  102,   68,  105,  111,  109,  106,   68,  110,   68,
-      115,  138,  116,  107,  112,  177,  118,  132,  113,  114,
-      126,  119,  126,  126,   68,  126,  158,  117,  129,  129,
-
-       72,   68,   72,   72,  131,   72,  131,  131,  141,  131,
-       67,  134,   67,   67,   68,   67,   68,  139,   68,  140,
-       67,   72,   68,   72,   72,  145,   72,   68,  142,   68,
-       68,   72,   73,   68,   68,   68,  143,   68,   68,  151,
-       68,  147,  152,  146,  144,   68,  195,   68,  132,  148,
-      154,  149,  150,  155,  153,  157,   68,   68,   68,   68,
-       68,  159,  161,   68,   68,  166,  162,  156,  165,  163,
-       68,  164,   68,   68,   68,   68,  167,  168,  171,   68,
-      173,  160,   68,   68,  174,  169,   68,  180,   68,   68,
-       68,  182,   68,  170,   68,   68,  176,  172,   68,   68,
-
-       68,  181,  175,   68,  188,  178,  179,  122,  122,  130,
-      124,  183,  184,  124,  185,  189,  186,  126,  190,  126,
-      126,   68,  126,  129,  129,  131,  192,  131,  131,   72,
-      131,   72,   72,  132,   72,   68,  191,  193,   68,   68,
-      134,  198,   68,   68,  201,   68,   68,  199,  200,   68,
-      194,   68,  207,  196,   68,  128,   68,   68,   68,  197,
-       68,  209,  211,   68,  202,   68,   68,   68,  210,  203,
-      212,  213,   68,  208,  204,   68,  219,  218,  214,  215,
-      205,  206,  216,   68,  217,   68,  222,   68,  223,  224,
-      226,   68,   68,   68,   68,   68,   68,   68,  127,  229,
-
-      225,  221,  227,  220,   68,   68,  231,  232,   68,   68,
-      230,   68,   68,  228,   68,  233,  235,   68,   68,  237,
-      234,   68,   68,  236,  239,   68,  238,  241,  245,   68,
-       68,   68,   68,   68,  247,  249,  248,   68,   68,  251,
-       68,  240,   68,  132,  255,  252,   68,  242,  243,  244,
-       68,  246,  254,  260,   68,  257,  250,   68,   68,   68,
-       68,  256,  259,   68,  261,  258,   68,   68,  253,   68,
-       68,  267,  266,   68,  264,  262,   68,  268,   68,   68,
-       68,  263,  271,  274,  272,   68,   68,   68,   68,  269,
-       68,  276,  265,  270,  273,   68,   68,  278,   68,   68,
-
-      275,  277,   68,   68,  283,   68,   68,  279,   68,  287,
-      285,   68,  282,  280,   68,   68,   68,   68,  288,  281,
-      286,   68,   68,  284,   68,  298,   68,   68,  289,   68,
-      292,   68,  293,  355,  290,  294,  295,  291,   68,   68,
-      296,  297,  299,   68,  300,   68,  302,  301,  304,   68,
-      305,   68,  303,   68,  306,   68,  309,   68,   68,   68,
-       68,   68,  312,  311,  313,   68,  307,   68,  319,   68,
-      125,   68,   68,   68,  314,  308,  318,  310,   68,   68,
-       68,  315,   68,  320,  316,  324,  317,  334,   68,  132,
-      321,  322,   68,  323,  326,   68,   68,  335,   68,   68,
-
-      123,  325,   68,  340,  327,  328,   68,   68,   68,   68,
-      336,  337,  351,  338,  329,  339,  330,  331,  332,  341,
-      344,  333,  342,   68,  343,   68,  345,   68,  348,  349,
-       68,   68,  347,   68,   68,   68,   68,  346,  354,   68,
-       68,   68,   68,   68,  361,  362,   68,   68,  353,  352,
-      350,  358,  360,  356,  357,  363,  364,   68,   68,   68,
-       68,   68,  366,  365,  359,  367,   68,  369,  370,   68,
-       68,   68,  368,   68,   68,   68,  375,   68,  374,  372,
-       68,   68,  376,  373,   68,  378,   68,  379,   68,   68,
-      371,   68,   68,   68,   68,   68,  381,   68,  382,  389,
-
-      387,  377,  380,  383,   68,  388,   68,   68,  386,   68,
-       68,   68,  384,  385,  393,   68,   68,   68,   68,   68,
-      395,   68,   68,  405,  390,   68,  394,   68,   68,  391,
-      392,  417,  396,  406,  404,   68,  397,   68,  398,  403,
-       68,  407,  411,  399,   68,  400,   68,  408,   68,  410,
-      409,   68,  412,  401,  414,   68,   68,   68,  132,  413,
-      416,  421,  420,  402,   68,   68,   68,   68,  425,   68,
-       68,   68,  419,  415,   68,  418,  422,   68,   68,  520,
-      424,  428,  426,  423,   68,   68,  427,  430,  432,   68,
-      433,   68,  429,   68,  434,  435,   68,  437,  431,   68,
-
-      436,   68,   68,   68,   68,   68,  441,   68,  439,  440,
-       68,   68,   68,  445,  438,  443,  442,   68,   68,   68,
-       68,  447,  446,  448,  444,   68,  451,   68,  449,  453,
-       68,   68,  450,  455,   68,  456,  454,  452,   68,   68,
-       68,   68,   68,  458,  463,  460,   68,   68,   68,   68,
-      465,  467,  459,  462,  464,   68,   68,  457,  461,  466,
-       68,   68,   68,   68,  475,  471,  470,  473,  472,   68,
-       68,  474,   68,  468,  469,   68,  479,   68,  477,  476,
-      480,   68,   68,   68,  481,  483,   68,   68,   68,   68,
-       68,   68,   68,  478,  488,   68,  482,   68,   68,   68,
-
-      489,  493,   68,  495,  484,  485,   68,  486,   68,  487,
-      490,  494,  496,  492,   68,  491,   68,   68,  499,  497,
-       68,   68,   68,   68,   68,   68,  502,  501,  504,  503,
-      500,   68,  498,   68,  508,   68,  505,   68,  132,   68,
-      507,   68,  506,  510,  511,   68,   68,   68,  514,  509,
-      512,   68,  516,   68,  521,  517,  515,   68,  513,   68,
-       68,   68,   68,  519,   68,  518,  525,  524,  526,  523,
-       68,   68,   68,   68,  536,  533,  522,   68,   68,  527,
-       68,  528,  534,   68,  529,  537,   68,  538,  543,  530,
-       68,  539,   68,  540,   68,  531,  532,  535,   68,  541,
-
-       68,   68,   68,  542,   68,  547,   68,  551,   68,  546,
-       68,  552,  544,  545,  553,  550,   68,  548,   68,   68,
-       68,  554,   68,   68,  549,   68,  555,   68,   68,   68,
-      556,  557,  559,  561,   68,  560,  563,  562,   68,   68,
-       68,   68,  565,  558,   68,  567,   68,   68,   68,   68,
-      569,   68,   68,   68,  566,   68,  572,  564,  570,   68,
-       68,  568,   68,   68,  577,   68,  578,   68,   68,  571,
-      573,   68,  574,   68,  581,  575,   68,  583,  579,  576,
-      586,  582,  580,   68,   68,   68,   68,  585,  584,   68,
-      587,   68,  592,  593,  590,  588,  589,   68,   68,   68,
-
-      594,   68,  597,   68,  591,  599,   68,   68,  600,  132,
-       68,   68,   68,   68,  596,  602,   68,  595,   68,   68,
-       68,   68,  611,  598,   68,  601,   68,   68,   68,   68,
-      605,  603,   68,  640,  612,  618,  614,  604,   68,  619,
-      615,  606,  617,  607,   68,  613,  625,  608,  616,  609,
-       68,  620,   68,   68,  610,   68,  621,  624,  622,   68,
-      627,   68,   68,  629,   68,  626,  628,  632,   68,   68,
-      634,   68,   68,  633,  635,   68,  623,   68,  630,   68,
-       68,  631,   68,   68,  638,   68,   68,   68,  642,  646,
-      637,  636,   68,   68,   68,   68,  645,   68,   68,  639,
-
-      644,  641,  650,  651,   68,  643,   68,  655,  649,  652,
-       68,  647,   68,  648,  656,  653,   68,  654,  657,   68,
-       68,  658,   68,   68,  659,  660,   68,   68,   68,  663,
-      662,   68,   68,  665,   68,   68,  666,   68,  661,   68,
-      667,  670,   68,  669,   68,   68,   68,   68,  664,  673,
-      672,  668,   68,  671,   68,   68,   68,  674,   68,  678,
-      679,  681,   68,  683,  675,  677,  684,  676,   68,   68,
-       68,   68,   68,  682,  680,  686,   68,  690,   68,   68,
-       68,   68,   68,   68,  685,   68,  688,   68,  698,  687,
-      689,  692,   68,   68,   68,   68,   68,  691,  699,  693,
-
-      696,  695,   68,   68,   68,   68,   68,  700,  694,  701,
-      702,  703,  697,  706,  707,   68,   68,   68,   68,  704,
-      705,   68,   68,  710,   68,   68,  709,  712,   68,  714,
-       68,   68,   68,   68,  708,   68,   68,  715,   68,   68,
-      711,   68,   68,  713,  718,  716,  717,  722,   68,   68,
-      726,  725,  719,  723,  721,   68,  720,  728,   68,  724,
-       68,   68,  727,  731,   68,  730,   68,  732,   68,  736,
-       68,  737,   68,  740,   68,  735,   68,  734,  729,   68,
-      733,  738,   68,   68,  739,   68,   68,  745,  742,  746,
-       68,  741,   68,   68,   68,  747,   68,  748,   68,  743,
-
-       68,   68,   68,   68,  744,  749,  754,   68,   68,  753,
-      750,   68,  751,   68,  752,  755,  759,  757,   68,  756,
-      763,   68,   68,  765,   68,  760,  758,   68,   68,   68,
-      766,  761,   68,  767,  769,   68,   68,  764,  771,   68,
-       68,  772,   68,  762,  773,   68,   68,  775,  768,   68,
-       68,   68,  770,  781,  776,  777,   68,  779,   68,  782,
-      774,   68,   68,  780,   68,  784,  783,  778,   68,   68,
-       68,  785,  788,   68,   68,   68,  791,   68,   68,   68,
-      787,   68,   68,  795,   68,   68,   68,  786,   68,   68,
-       68,  132,   68,   68,  789,  800,  794,  792,  790,  793,
-
-       68,   68,   68,  801,  796,  805,  798,  802,   68,  799,
-      797,  804,  807,   68,   68,  803,   68,  808,   68,  806,
-      809,   68,   68,   68,   68,   68,   68,  814,  816,   68,
-      811,  815,   68,  810,   68,  818,  812,  813,  820,   68,
-       68,  823,  824,  817,  819,  822,   68,   68,   68,  825,
-      826,   68,   68,  828,   68,  821,  830,  827,  832,   68,
-      831,   68,   68,   68,   68,   68,   68,   68,   68,  838,
-       68,   68,  837,  829,   68,   68,   68,   68,   68,  846,
-       68,  833,  834,   68,  836,  843,  839,  840,  847,  841,
-      835,   68,  845,  849,  842,  848,   68,  844,   68,  852,
-
-       68,   68,   68,   68,  856,  850,  853,  854,   68,   68,
-       68,   68,  859,  130,  860,  858,  861,   68,  851,   68,
-      862,   68,  855,   68,   68,   68,  857,  863,   68,  864,
-       68,   68,  869,   68,   68,  867,   68,  871,  865,   68,
-       68,   68,   68,   68,   68,  874,  868,  876,   68,   68,
-      866,  873,   68,  879,  870,   68,   68,   68,  878,  883,
-       68,  872,  875,  885,   68,  884,  877,   68,   68,  880,
-      888,   68,   68,   68,   68,  881,  882,   68,  889,  890,
-      892,  887,  893,   68,  886,   68,  894,   68,   68,   68,
-       68,   68,   68,  901,   68,  898,   68,  900,  891,   68,
-
-       68,  895,   68,   68,  902,  909,   68,  896,   68,  897,
-       68,   68,   68,   68,  899,   68,  904,  906,  903,  908,
-      907,   68,  905,   68,   68,  918,   68,   68,  914,   68,
-      913,  910,  911,  915,  912,   68,  916,   68,  919,  917,
-       68,   68,  920,  921,   68,   68,  927,   68,  923,  922,
-      924,   68,   68,  925,  926,  928,   68,   68,   68,   68,
-      930,   68,  935,   68,  929,   68,   68,  938,   68,  940,
-      931,  932,   68,  943,   68,   68,   68,  934,   68,  936,
-       68,  941,   68,  933,  937,  942,  939,   68,  947,  944,
-      945,   68,   68,   68,   68,  948,  946,   68,   68,   68,
-
-       68,   68,  954,   68,  955,  956,  957,   68,   68,  949,
-      951,  950,  958,  953,   68,  952,  961,   68,   68,   68,
-       68,  965,   68,  960,  969,   68,   68,   68,  962,   68,
-      959,  963,  964,  968,  966,   68,  967,  970,   68,  972,
-       68,  973,   68,   68,  971,   68,   68,  977,   68,   68,
-      974,  979,   68,  980,   68,  981,   68,  983,   68,  982,
-       68,  975,   68,  976,  985,  978,   68,  984,   68,   68,
-      987,   68,   68,  988,  989,   68,   68,   68,  990,   68,
-      991,  997,   68,  986,   68,  992,   68,  999,  993,   68,
-       68, 1002,   68,   68,   68,  994,  995,   68,  996, 1001,
-
-       68, 1004,   68, 1007,   68,   68, 1005,   68, 1003, 1000,
-      998, 1011, 1010,   68,   68,   68,   68, 1014,   68, 1015,
-       68, 1009, 1013,   68,   68,   68, 1006,   68,   68, 1016,
-     1008,   68,  128, 1012, 1021, 1023,   68,   68,   68, 1018,
-     1022,   68, 1020, 1017, 1019, 1026,   68, 1029, 1024, 1030,
-       68,   68,   68, 1025,   68, 1028, 1031, 1033,   68, 1027,
-     1032,   68,   68, 1034, 1035,   68, 1036,   68, 1040,   68,
-     1038, 1037,   68,   68, 1042,   68,   68,   68, 1062,   68,
-     1044, 1045,   68, 1046,   68,   68,   68, 1043,   68,   68,
-     1039, 1047, 1049, 1048, 1041,   68,   68, 1052, 1050,   68,
-
-       68,   68, 1057,   68,   68,   68, 1059, 1051, 1053, 1055,
-     1056,   68,   68, 1061, 1063,   68,   68, 1054, 1058,   68,
-       68, 1066, 1060, 1064,   68,   68,   68,   68,   68,   68,
-       68,   68,   68, 1074,   68, 1073,   68, 1068, 1069, 1065,
-     1070,   68, 1071, 1076,   68, 1067, 1078,   68,   68, 1072,
-     1075,   68,   68, 1080, 1081, 1077, 1082,   68,   68,   68,
-     1086,   68, 1079, 1083, 1085,   68, 1087,   68, 1090,   68,
-       68,   68,   68,   68, 1094, 1084,   68,   68, 1088,   68,
-     1092, 1089, 1091, 1093, 1097, 1095,   68,   68,   68, 1096,
-       68, 1098,   68, 1100,   68,   68, 1102,   68, 1103,   68,
-
-     1099, 1106,   68,   68, 1101,   68, 1105, 1110, 1107, 1108,
-       68,   68, 1113,   68, 1109,   68, 1111,   68, 1112, 1104,
-     1116,   68,   68, 1114,   68, 1117, 1115,   68,   68,   68,
-       68,   68, 1119, 1120, 1118, 1122,   68,   68,   68,   68,
-       68,   68,   68, 1121, 1130,   68,   68,   68, 1149, 1131,
-       68,  127, 1128,   68, 1134, 1124,   68, 1123, 1126, 1127,
-     1132, 1125, 1129, 1133, 1135,   68, 1136,   68,   68, 1137,
-     1138,   68, 1139,   68, 1141,   68, 1142,   68,   68,   68,
-     1145,   68,   68,   68, 1144, 1147,   68, 1140,   68,   68,
-     1153,   68, 1150,   68, 1151, 1155,   68, 1143, 1156,   68,
-
-       68, 1146, 1154,   68, 1158,   68, 1148,   68,   68, 1152,
-       68,   68,   68, 1161, 1159,   68,   68, 1169,   68, 1160,
-     1165,   68,   68,   68, 1163,   68, 1157, 1167,   68, 1170,
-     1168, 1166,   68, 1164,   68, 1162, 1174, 1172,   68, 1173,
-       68,   68,   68, 1171,   68, 1175, 1178, 1177,   68,   68,
-       68, 1179,   68, 1176, 1180, 1181,   68,   68, 1192,   68,
-       68, 1182, 1183, 1184,   68, 1185, 1222,   68,   68, 1190,
-     1186, 1187, 1188, 1189,   68,   68,   68,   68,   68,   68,
-     1195, 1191, 1193,   68, 1194,   68, 1196, 1197,   68,   68,
-     1199,   68, 1200,   68, 1198, 1201,   68, 1202,   68, 1203,
-
-       68, 1204,   68, 1205, 1206,   68,   68, 1207, 1208,   68,
-       68, 1211,   68, 1212,   68, 1210, 1213,   68,   68,   68,
-       68,   68,   68, 1209,   68, 1220,   68,   68,   68,   68,
-     1214,   68, 1216, 1217, 1218,   68, 1221, 1215,   68,   68,
-       68,   68, 1224,   68, 1219, 1228, 1229,   68, 1223, 1226,
-     1230,   68,   68, 1232,   68, 1225, 1227, 1231, 1233,   68,
-       68, 1236, 1235, 1234,   68,   68, 1240,   68, 1241,   68,
-       68,   68,   68,   68,   68,   68,   68,   68, 1237, 1247,
-     1238, 1248,   68,   68, 1239, 1242, 1251,   68, 1243,   68,
-     1249, 1244, 1246, 1245,   68, 1250, 1253,   68, 1254,   68,
-
-       68, 1255, 1252, 1257,   68,   68,   68,   68,   68, 1258,
-     1259, 1256,   68, 1262, 1260,   68,  125, 1263, 1265,   68,
-     1266,   68, 1261, 1267, 1268,   68, 1269,   68,   68,   68,
-     1264,   68,   68,   68, 1270, 1272,   68,   68,   68,   68,
-     1276,   68,   68, 1271,   68, 1274, 1273, 1275, 1280,   68,
-     1277, 1282,   68, 1281,   68,   68, 1278,   68,   68,   68,
-     1284, 1279, 1283, 1287,   68,   68, 1285,   68, 1289,   68,
-       68, 1286, 1290, 1291,   68, 1292,   68, 1295,   68, 1288,
-     1296,   68,   68, 1293, 1294,   68,   68,   68,   68, 1297,
-       68, 1302, 1298,   68,   68, 1300,   68, 1299,   68, 1304,
-
-       68,   68,   68,   68,   68, 1309,   68, 1301, 1312, 1303,
-     1307, 1311,   68,   68,   68, 1313, 1305,   68,   68,   68,
-     1308, 1310, 1314, 1317, 1306,   68, 1315,   68, 1318,   68,
-       68,   68,   68,   68, 1319, 1320, 1324,   68, 1321,   68,
-       68,   68, 1316,   68,   68, 1330, 1329, 1323, 1325, 1326,
-     1322, 1328, 1332,   68,   68,   68, 1334,   68,   68, 1327,
-     1333, 1337,   68, 1331, 1338,   68,   68,   68,   68, 1342,
-       68,   68, 1344,   68, 1335,   68,   68,   68,  123, 1340,
-     1336,   68, 1347, 1343,   68, 1339, 1348,   68, 1341, 1351,
-     1346, 1349,   68,   68, 1345, 1350,   68, 1352,   68,   68,
-
-     1353, 1354,   68,   68,   68, 1357,   68,   68, 1355,   68,
-       68, 1362, 1356, 1360, 1358, 1359, 1361,   68, 1363,   68,
-       68, 1365,   68,   68, 1364,   68, 1368,   68, 1369,   68,
-     1370,   68, 1371,   68,   68,   68, 1373,   68, 1366,   68,
-       68, 1374,   68, 1367, 1376,   68, 1372,   68,   68, 1377,
-     1381,   68, 1382, 1382, 1382, 1382, 1382, 1378, 1382, 1375,
-     1382, 1379, 1382, 1382, 1382, 1382, 1382, 1380,   40,   40,
-       40,   40,   40,   40,   40,   45,   45,   45,   45,   45,
-       45,   45,   50,   50,   50,   50,   50,   50,   50,   56,
-       56,   56,   56,   56,   56,   56,   61,   61,   61,   61,
-
-       61,   61,   61,   71,   71, 1382,   71,   71,   71,   71,
-      122,  122, 1382, 1382, 1382,  122,  122,  124,  124, 1382,
-     1382,  124, 1382,  124,  126, 1382, 1382, 1382, 1382, 1382,
-      126,  129,  129, 1382, 1382, 1382,  129,  129,  131, 1382,
-     1382, 1382, 1382, 1382,  131,  133,  133, 1382,  133,  133,
-      133,  133,   72,   72, 1382,   72,   72,   72,   72,   13,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382
-
+       14,   14,   18,   20,   21,   14, 1918,   23,   24,   25,
+       14,   26,   27,   28,   29,   30, 2032,   32,   33, 1988,
+       14, 1810, 1416, 1490, 1762,   39,   14,   14,   14,   14,
+       13,   14,   15,   16,   17,   18,   19,   18,   14,   14,
+       14,   14,   14,   18,   20,   21,   14, 1936,   23,   24,
+       25,   14,   26,   27,   28,   29,   30, 2051,   32,   33,
+     2010,   14, 1825, 1440, 1512, 1786,   39,   14,   14,   14,
+       14,   13,   40,   40,   41,   42,   43,   40,   40,   40,
+       40,   40,   40,   40,   40,   44,   40,   40,   40,   40,
+
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   13,   45,   45,   46,   47,   45,   45,   48,
+       45,   45,   45,   45,   45,   45,   49,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   13,   50,   51,   52,   53,   54,   50,
+       18,   50,   50,   50,   50,   50,   50,   55,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       50,   50,   50,   50,   13,   56,   56,   57,   58,   59,
+       56,   56,   56,   56,   56,   56,   56,   56,   60,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   56,   56,   56,   13,   61,   15,   16,   17,
+       62,   63,   64,   61,   61,   61,   61,   61,   61,   65,
+       61,   61,   61,   61,   61,   61,   61,   61,   66,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+       61,   61,   61,   61,   61,   61,   13,   71,   72,   13,
+       72,   72,   71,   72,   71,   71,   71,   71,   71,   72,
+
+       73,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   13,   67,   67,
+      135,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   13,  122,
+      122,  136,  122,  122,  122,  122,  122,  122,  122,  122,
+      122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
+      122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
+
+      122,  122,  122,  122,  122,  122,  122,  122,  122,   13,
+      124,  124,  137,  124,  124,  124,  124,  124,  124,  124,
+      124,  124,  124,  124,  124,  124,  124,  124,  124,  124,
+      124,  124,  124,  124,  124,  124,  124,  124,  124,  124,
+      124,  124,  124,  124,  124,  124,  124,  124,  124,  124,
+       13,  126,  126,  138,  126,  126,  126,  126,  126,  126,
+      126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+      126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+      126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+      126,   13,  129,  129,  139,  129,  129,  129,  129,  129,
+
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,   13,  133,   72,  140,   72,   72,  133,   72,
+      133,  133,  133,  133,  133,  133,  134,  133,  133,  133,
+      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
+      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
+      133,  133,  133,   13,  131,  131,  141,  131,  131,  131,
+      131,  131,  131,  131,  131,  131,  131,  131,  131,  131,
+      131,  131,  131,  131,  131,  131,  131,  131,  131,  131,
+
+      131,  131,  131,  131,  131,  131,  131,  131,  131,  131,
+      131,  131,  131,  131,   13,   72,   72,  142,   72,   72,
+       72,   72,   72,   72,   72,   72,   72,   72,   72,   72,
+       72,   72,   72,   72,   72,   72,   72,   72,   72,   72,
+       72,   72,   72,   72,   72,   72,   72,   72,   72,   72,
+       72,   72,   72,   72,   72,   13,  122,  122,   13,  143,
+      128,  122,  122,  122,  122,  122,  122,  122,  122,  123,
+      122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
+      122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
+      122,  122,  122,  122,  122,  122,   13,  124,  124,  120,
+
+      144,  124,  124,  121,  124,  124,  124,  124,  124,  124,
+      125,  124,  124,  124,  124,  124,  124,  124,  124,  124,
+      124,  124,  124,  124,  124,  124,  124,  124,  124,  124,
+      124,  124,  124,  124,  124,  124,  124,   13,  129,  129,
+      243,  244,  147,  129,  129,  129,  129,  129,  129,  129,
+      129,  130,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,   13,  126,
+      315,  296,  297,  316,  126,  317,  126,  126,  126,  126,
+      126,  126,  127,  126,  126,  126,  126,  126,  126,  126,
+
+      126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+      126,  126,  126,  126,  126,  126,  126,  126,  126,   13,
+      131,  315,  348,  349, 1420,  131,  317,  131,  131,  131,
+      131,  131,  131,  132,  131,  131,  131,  131,  131,  131,
+      131,  131,  131,  131,  131,  131,  131,  131,  131,  131,
+      131,  131,  131,  131,  131,  131,  131,  131,  131,  131,
+       13,   67,  315,  485, 1422, 1444,   67,  317,   67,   67,
+       67,   67,   67,  148,   68,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+
+       67,   13,   67,  118,  312, 1663,  313,   67,  119,   67,
+       67,   67,   67,   67,  149,   68,   67,   67,   74,   75,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   76,   67,   67,   67,
+       67,   67,   13,   67,  118,  150, 1687,  514,   67,  119,
+       67,   67,   67,   67,   67,  515,   68,   77,   67,   67,
+       67,   67,   67,   67,   78,   67,   67,   67,   67,   67,
+       67,   79,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   13,   67,  118,  151, 1711,  569,   67,
+      119,   67,   67,   67,   67,   67,  570,   68,   67,   67,
+
+       67,   67,   80,   67,   67,   67,   81,   67,   67,   82,
+       67,   67,   83,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   13,   67,  118,  152, 1737, 1175,
+       67,  119,   67,   67,   67,   67,   67, 1176,   68,   67,
+       67,   67,   84,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   85,   67,   67,   13,   67,  118,  153, 1763,
+      157,   67,  119,   67,   67,   67,   67,   67,  158,   68,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   86,   67,   67,   67,   67,   67,
+
+       67,   67,   67,   67,   67,   67,   13,   67,  118,  163,
+     1787,  164,   67,  119,   67,   67,   67,   67,   67,  165,
+       68,   87,   67,   67,   67,   67,   67,   67,   67,   88,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   13,   67,  118,
+      485, 1446,  166,   67,  119,   67,   67,   67,   67,   67,
+      167,   68,   67,   67,   67,   89,   67,   67,   90,   67,
+       67,   67,   67,   67,   67,   91,   67,   92,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   13,   67,
+      215,  161,  168,  216,   67,  162,   67,   67,   67,   67,
+
+       67,  169,   68,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   93,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   13,
+       67,  290,  173,  170,  291,   67,  174,   67,   67,   67,
+       67,   67,  171,   68,   67,   67,   67,   67,   94,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       13,   67,  300,  172,  658,  301,   67,  659,   67,   67,
+       67,   67,   67,  175,   68,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   95,
+
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   13,   67,  405,  176,  915,  177,   67,  916,   67,
+       67,   67,   67,   67,  406,   68,   96,   67,   67,   67,
+       67,   67,   67,   67,   97,   67,   67,   67,   67,   67,
+       98,   67,   67,   67,   99,   67,   67,   67,   67,   67,
+       67,   67,   13,   67,  473, 1538, 1566,  178,   67,  474,
+       67,   67,   67,   67,   67,  179,   68,  100,   67,   67,
+       67,  101,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,  102,   67,   67,
+       67,   67,   67,   13,   67,  479, 1552, 1575,  180,   67,
+
+      480,   67,   67,   67,   67,   67,  181,   68,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,  103,   67,
+       67,   67,   67,   67,   13,   67,  656, 1587, 1619,  184,
+       67,  657,   67,   67,   67,   67,   67,  185,   68,   67,
+       67,   67,   67,   67,   67,   67,   67,  104,   67,   67,
+       67,   67,   67,  105,   67,   67,  106,   67,   67,   67,
+       67,   67,   67,  107,   67,  327,  328,  252,  186,   71,
+      187,   71,   71,  154,   71,  329,  155,  330,  331,  332,
+       71,   71,  333,  527,  133,  528,  133,  133,  529,  133,
+
+      156,  253,  202,  530,  188,  224,  133,  203,  398,  531,
+      532,  111,  204,  399,  606,  400,  607,  225,  205,  206,
+      608,  112,  609,  401,  620,  113,  114,  610,  111,  621,
+      749,  622,  189,  402,  190,  750,  111,  751,  112,  752,
+     1878, 1901, 1417,  114, 1924, 1942,  112, 1846, 1862,  623,
+     1441,  114,  424,  424,   13,  108,   69,  115,  448,  116,
+       70,  191,  990,  449,  991,  109,  324,  450,  110,  992,
+      115,  115, 1383, 1400,  117,  115, 1468, 1465,  115, 1386,
+     1478, 1481,  325,  115, 1403, 1491, 1468,  117,  117, 1386,
+     1481,  321,  117, 1403,  108,  117,  321,  115,  108, 1513,
+
+      117, 1494,  108,  108,  109, 1516,  145, 1535,  109,  108,
+      108, 1549,  109,  109,  117, 1563, 1572, 1584,  255,  109,
+      109, 1600, 1581, 1597,  108,  146, 1538, 1566,  159, 1616,
+     1552, 1575,  108,  108,  109,  256,  731, 1613, 1538, 1566,
+     1632,  732,  109,  109, 1616, 1629, 1645,  108,  160, 1552,
+     1575,  182, 1632, 1538, 1648, 1771, 1719,  109, 1795, 1745,
+     1654, 1552, 1657, 1671, 1811, 1826, 1695,  456,  192, 1878,
+      358,  183, 1901,  198,  109,  109, 1846, 1645, 1654, 1862,
+      199,  424,  477,  359,  424,  801,  830,  945,  193,  457,
+      802,  831,  924,  946, 1024,  925, 1031,  478, 1052, 1025,
+
+     1092, 1032, 1151, 1093, 1386, 1502, 1403, 1524, 1536, 1053,
+     1030,  194, 1030, 1550, 1564,  178,  321, 1152,  321, 1573,
+      178,  178, 1582, 1598, 1614, 1630,  178, 1603, 1635,  178,
+      178,  178,  178, 1646, 1649, 1655, 1658, 1567, 1719, 1576,
+      178, 1745,  178, 1812, 1827, 1671, 1846, 1862, 1695,  176,
+      176,  424,  424, 1956, 1962,  753, 1979,  174, 1973,  657,
+     1963,  657,  174,  753,  195, 1990, 1996,  753, 1980,  174,
+     2004,  657, 1997, 2012, 2018, 1970,  753,  174, 2026,  657,
+     2042, 2019,  196, 1987,  296, 2036, 2061,  839,  296, 2055,
+      197,  200,  201,  839,  207,  208,  209,  210,  211,  212,
+
+      213,  214,  217,  218,  219,  220,  221,  222,  223,  226,
+      227,  228,  229,  230,  231,  232,  233,  234,  235,  236,
+      237,  238,  239,  240,  241,  242,  245,  246,  247,  248,
+      249,  250,  251,  254,  257,  258,  259,  260,  261,  262,
+      263,  264,  265,  266,  267,  268,  269,  270,  271,  272,
+      273,  274,  275,  276,  277,  278,  279,  280,  281,  282,
+      283,  284,  285,  286,  287,  288,  289,  292,  293,  294,
+      295,  298,  299,  302,  303,  304,  305,  306,  307,  308,
+      309,  310,  311,  314,  318,  319,  320,  321,  322,  323,
+      326,  334,  335,  336,  337,  338,  339,  340,  341,  342,
+
+      343,  344,  345,  346,  347,  350,  351,  352,  353,  354,
+      355,  356,  357,  360,  361,  362,  363,  364,  365,  366,
+      367,  368,  369,  370,  371,  372,  373,  374,  375,  376,
+      377,  378,  379,  380,  381,  382,  383,  384,  385,  386,
+      387,  388,  389,  390,  391,  392,  393,  394,  395,  396,
+      397,  403,  404,  407,  408,  409,  410,  411,  412,  413,
+      414,  415,  416,  417,  418,  419,  420,  421,  422,  423,
+      424,  425,  426,  427,  428,  429,  430,  431,  432,  433,
+      434,  435,  436,  437,  438,  439,  440,  441,  442,  443,
+      444,  445,  446,  447,  451,  452,  453,  454,  455,  458,
+
+      459,  460,  461,  462,  463,  464,  465,  466,  467,  468,
+      469,  470,  471,  472,  475,  476,  481,  482,  483,  484,
+      485,  486,  487,  488,  489,  490,  491,  492,  493,  494,
+      495,  496,  497,  498,  499,  500,  501,  502,  503,  504,
+      505,  506,  507,  508,  509,  510,  511,  512,  513,  516,
+      517,  518,  519,  520,  521,  522,  523,  524,  525,  526,
+      533,  534,  535,  536,  537,  538,  539,  540,  541,  542,
+      543,  544,  545,  546,  547,  548,  549,  550,  551,  552,
+      553,  554,  555,  556,  557,  558,  559,  560,  561,  562,
+      563,  564,  565,  566,  567,  568,  571,  572,  573,  574,
+
+      575,  576,  577,  578,  579,  580,  581,  582,  583,  584,
+      585,  586,  587,  588,  589,  590,  591,  592,  593,  594,
+      595,  596,  597,  598,  599,  600,  601,  602,  603,  604,
+      605,  611,  612,  613,  614,  615,  616,  617,  618,  619,
+      624,  625,  626,  627,  628,  629,  630,  631,  632,  633,
+      634,  635,  636,  637,  638,  639,  640,  641,  642,  643,
+      644,  645,  646,  647,  648,  649,  650,  651,  652,  653,
+      654,  655,  660,  661,  662,  663,  664,  665,  666,  667,
+      668,  669,  670,  671,  672,  673,  674,  675,  676,  677,
+      678,  679,  680,  681,  682,  683,  684,  685,  686,  687,
+
+      688,  689,  690,  691,  692,  693,  694,  695,  696,  697,
+      698,  699,  700,  701,  702,  703,  704,  705,  706,  707,
+      708,  709,  710,  711,  712,  713,  714,  715,  716,  717,
+      718,  719,  720,  721,  722,  723,  724,  725,  726,  727,
+      728,  729,  730,  733,  734,  735,  736,  737,  738,  739,
+      740,  741,  742,  743,  744,  745,  746,  747,  748,  753,
+      754,  755,  756,  757,  758,  759,  760,  761,  762,  763,
+      764,  765,  766,  767,  768,  769,  770,  771,  772,  773,
+      774,  775,  776,  777,  778,  779,  780,  781,  782,  783,
+      784,  785,  786,  787,  788,  789,  790,  791,  792,  793,
+
+      794,  795,  796,  797,  798,  799,  800,  803,  804,  805,
+      806,  807,  808,  809,  810,  811,  812,  813,  814,  815,
+      816,  817,  818,  819,  820,  821,  822,  823,  824,  825,
+      826,  827,  828,  829,  832,  833,  834,  835,  836,  837,
+      838,  839,  840,  841,  842,  843,  844,  845,  846,  847,
+      848,  849,  850,  851,  852,  853,  854,  855,  856,  857,
+      858,  859,  860,  861,  862,  863,  864,  865,  866,  867,
+      868,  869,  870,  871,  872,  873,  874,  875,  876,  877,
+      878,  879,  880,  881,  882,  883,  884,  885,  886,  887,
+      888,  889,  890,  891,  892,  893,  894,  895,  896,  897,
+
+      898,  899,  900,  901,  902,  903,  904,  905,  906,  907,
+      908,  909,  910,  911,  912,  913,  914,  917,  918,  919,
+      920,  921,  922,  923,  926,  927,  928,  929,  930,  931,
+      932,  933,  934,  935,  936,  937,  938,  939,  940,  941,
+      942,  943,  944,  947,  948,  949,  950,  951,  952,  953,
+      954,  955,  956,  957,  958,  959,  960,  961,  962,  963,
+      964,  965,  966,  967,  968,  969,  970,  971,  972,  973,
+      974,  975,  976,  977,  978,  979,  980,  981,  982,  983,
+      984,  985,  986,  987,  988,  989,  993,  994,  995,  996,
+      997,  998,  999, 1000, 1001, 1002, 1003, 1004, 1005, 1006,
+
+     1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016,
+     1017, 1018, 1019, 1020, 1021, 1022, 1023, 1026, 1027, 1028,
+     1029, 1030, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040,
+     1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050,
+     1051, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062,
+     1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072,
+     1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082,
+     1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1094,
+     1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104,
+     1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114,
+
+     1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124,
+     1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134,
+     1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144,
+     1145, 1146, 1147, 1148, 1149, 1150, 1153, 1154, 1155, 1156,
+     1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166,
+     1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1177, 1178,
+     1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188,
+     1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198,
+     1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208,
+     1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218,
+
+     1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228,
+     1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238,
+     1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248,
+     1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258,
+     1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268,
+     1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278,
+     1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288,
+     1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298,
+     1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308,
+     1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318,
+
+     1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328,
+     1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338,
+     1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348,
+     1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358,
+     1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368,
+     1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378,
+     1379, 1380, 1381, 1384, 1385, 1387, 1388, 1389, 1390, 1391,
+     1392, 1393, 1394, 1395, 1396, 1397, 1398, 1401, 1402, 1404,
+     1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414,
+     1415, 1418, 1419, 1421, 1423, 1424, 1425, 1426, 1427, 1428,
+
+     1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438,
+     1439, 1442, 1443, 1445, 1447, 1448, 1449, 1450, 1451, 1452,
+     1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462,
+     1463, 1466, 1467, 1469, 1470, 1471, 1472, 1473, 1474, 1475,
+     1476, 1479, 1480, 1482, 1483, 1484, 1485, 1486, 1487, 1488,
+     1489, 1492, 1493, 1495, 1496, 1497, 1498, 1499, 1500, 1501,
+     1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1514,
+     1515, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1525, 1526,
+     1527, 1528, 1529, 1530, 1531, 1532, 1533, 1537, 1538, 1539,
+     1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1551, 1552,
+
+     1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1565,
+     1567, 1568, 1569, 1570, 1574, 1576, 1577, 1578, 1579, 1583,
+     1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594,
+     1595, 1599, 1601, 1602, 1603, 1604, 1605, 1606, 1607, 1608,
+     1609, 1610, 1611, 1615, 1617, 1618, 1620, 1621, 1622, 1623,
+     1624, 1625, 1626, 1627, 1631, 1633, 1634, 1636, 1637, 1638,
+     1639, 1640, 1641, 1642, 1643, 1647, 1650, 1651, 1652, 1656,
+     1659, 1660, 1661, 1664, 1665, 1666, 1667, 1668, 1669, 1670,
+     1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680,
+     1681, 1682, 1683, 1684, 1685, 1688, 1689, 1690, 1691, 1692,
+
+     1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702,
+     1703, 1704, 1705, 1706, 1707, 1708, 1709, 1712, 1713, 1714,
+     1715, 1716, 1717, 1718, 1720, 1721, 1722, 1723, 1724, 1725,
+     1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735,
+     1738, 1739, 1740, 1741, 1742, 1743, 1744, 1746, 1747, 1748,
+     1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758,
+     1759, 1760, 1761, 1764, 1765, 1766, 1767, 1768, 1769, 1770,
+     1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781,
+     1782, 1783, 1784, 1785, 1788, 1789, 1790, 1791, 1792, 1793,
+     1794, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804,
+
+     1805, 1806, 1807, 1808, 1809, 1813, 1814, 1815, 1816, 1817,
+     1818, 1819, 1820, 1821, 1822, 1823, 1824, 1828, 1829, 1830,
+     1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839, 1841,
+     1842, 1843, 1844, 1845, 1847, 1848, 1849, 1850, 1851, 1852,
+     1853, 1854, 1855, 1857, 1858, 1859, 1860, 1861, 1863, 1864,
+     1865, 1866, 1867, 1868, 1869, 1870, 1871, 1873, 1874, 1875,
+     1876, 1877, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886,
+     1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1896, 1897,
+     1898, 1899, 1900, 1902, 1903, 1904, 1905, 1906, 1907, 1908,
+     1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1919,
+
+     1920, 1921, 1922, 1923, 1925, 1926, 1927, 1928, 1929, 1930,
+     1931, 1932, 1933, 1934, 1935, 1937, 1938, 1939, 1940, 1941,
+     1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952,
+     1953, 1955, 1957, 1958, 1959, 1960, 1961, 1964, 1965, 1966,
+     1967, 1968, 1969, 1970, 1972, 1974, 1975, 1976, 1977, 1978,
+     1981, 1982, 1983, 1984, 1985, 1986, 1987, 1989, 1991, 1992,
+     1993, 1994, 1995, 1998, 1999, 2000, 2001, 2002, 2003, 2005,
+     2006, 2007, 2008, 2009, 2011, 2013, 2014, 2015, 2016, 2017,
+     2020, 2021, 2022, 2023, 2024, 2025, 2027, 2028, 2029, 2030,
+     2031, 2033, 2034, 2035, 2037, 2038, 2039, 2040, 2041, 2043,
+
+     2044, 2045, 2046, 2047, 2048, 2049, 2050, 2052, 2053, 2054,
+     2056, 2057, 2058, 2059, 2060, 2062, 2063, 2064, 2065, 2066,
+     2067, 2068, 2069,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070,
+     2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070,
+     2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070,
+     2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070,
+     2070
     } ;
 
-static yyconst flex_int16_t yy_chk[2800] =
-    {   0,
+static yyconst flex_int16_t yy_chk[3492] =
+    {   1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    3,
-        3,    3,    4,    4,    4,   49,    5,    5,   49,    3,
-        5,   15,    4,    6,    6,   15,    5,    6,    9,    9,
-        9,  118,   33,    6,    7,    7,    7,    7,    9,    7,
-       10,   10,   10,   44,   44,    7,    8,    8,    8,    8,
-       10,    8,   21,   33,  118,   21,   21,    8,   11,   11,
-       11,   11,   11,   11, 1388,   20,   29,   20,   20,   11,
-
-       20,   29,   24,   21,   25,   20,   24,   28,   11,   12,
-       12,   12,   12,   12,   12,   74,   22,   22,   74,   25,
-       12,   69,   28,   66,   22,   69,   24,   26,   26,   12,
-       19,   22,   19,   19,   23,   19,   26,   66,   27,   23,
-       19,   19,   27,   23,   30,   27,   23,   31,   31,   23,
-       32,   32,   27,   75,   27,   32,   31,   75,   34,   30,
-       35,   76,   31,   39,   39,   35,   31,   34,   39,   36,
-      109,   32,   38,   34,   36,   35,   34,   93,   35,   37,
-       37,   76,   37,   34,   36,  109,   38,  600,   36,   36,
-       55,   38,   55,   55,   79,   55,   93,   37,   60,   60,
-
-       63,   78,   63,   63,   65,   63,   65,   65,   79,   65,
-       68,   63,   68,   68,   77,   68,   80,   77,   81,   78,
-       68,   71,   82,   71,   71,   83,   71,   84,   80,   85,
-       83,   71,   71,   86,   87,   88,   81,   89,  139,   88,
-       90,   84,   89,   83,   82,   96,  139,   91,  131,   85,
-       91,   86,   87,   91,   90,   92,   94,   97,   99,   95,
-       92,   94,   95,  100,   98,   99,   95,   91,   98,   96,
-      101,   97,  102,  103,  104,  106,  100,  101,  104,  105,
-      106,   94,  107,  108,  106,  102,  110,  112,  111,  113,
-      114,  114,  112,  103,  115,  117,  108,  105,  116,  119,
-
-      121,  113,  107,  120,  119,  110,  111,  123,  123,  129,
-      125,  114,  115,  125,  116,  120,  117,  127,  121,  127,
-      127,  136,  127,  130,  130,  132,  136,  132,  132,  133,
-      132,  133,  133,  135,  133,  138,  135,  137,  140,  141,
-      133,  142,  137,  143,  144,  149,  142,  142,  143,  144,
-      138,  146,  146,  140,  147,  128,  148,  152,  150,  141,
-      145,  148,  150,  153,  145,  151,  155,  154,  149,  145,
-      151,  152,  156,  147,  145,  157,  157,  156,  153,  154,
-      145,  145,  154,  158,  155,  159,  160,  161,  161,  162,
-      163,  160,  165,  164,  162,  163,  172,  174,  126,  166,
-
-      162,  159,  164,  158,  166,  167,  168,  169,  170,  176,
-      167,  168,  169,  165,  171,  170,  172,  173,  175,  174,
-      171,  177,  178,  173,  176,  179,  175,  178,  181,  184,
-      180,  182,  183,  181,  183,  185,  184,  186,  187,  187,
-      185,  177,  190,  191,  190,  188,  192,  179,  180,  180,
-      188,  182,  189,  194,  193,  191,  186,  189,  194,  195,
-      196,  190,  193,  197,  195,  192,  198,  199,  188,  200,
-      201,  201,  200,  203,  198,  196,  202,  202,  204,  205,
-      206,  197,  205,  208,  206,  207,  209,  213,  208,  203,
-      210,  210,  199,  204,  207,  214,  211,  212,  215,  216,
-
-      209,  211,  212,  217,  217,  218,  219,  213,  220,  221,
-      219,  226,  216,  214,  221,  222,  223,  224,  222,  215,
-      220,  225,  227,  218,  228,  230,  230,  232,  223,  275,
-      225,  233,  226,  275,  224,  227,  228,  224,  229,  231,
-      229,  229,  231,  234,  232,  236,  233,  232,  235,  235,
-      236,  238,  234,  237,  237,  239,  240,  241,  242,  243,
-      244,  240,  243,  242,  243,  245,  238,  246,  247,  249,
-      124,  250,  255,  247,  244,  239,  246,  241,  248,  251,
-      253,  245,  252,  248,  245,  252,  245,  255,  256,  257,
-      249,  250,  258,  251,  253,  260,  271,  256,  259,  262,
-
-      122,  252,  254,  261,  254,  254,  266,  263,  261,  264,
-      257,  258,  271,  259,  254,  260,  254,  254,  254,  262,
-      265,  254,  263,  267,  264,  265,  266,  268,  269,  269,
-      270,  269,  268,  272,  273,  276,  274,  267,  274,  280,
-      277,  281,  278,  279,  280,  281,  282,   67,  273,  272,
-      270,  278,  279,  276,  277,  282,  283,  284,  285,  287,
-      286,  283,  285,  284,  278,  286,  288,  288,  289,  290,
-      291,  292,  287,  289,  293,  294,  294,  295,  293,  291,
-      296,  300,  295,  292,  297,  297,  299,  299,  301,  302,
-      290,  303,  305,  306,  307,  308,  301,  309,  302,  310,
-
-      308,  296,  300,  303,  310,  309,  311,  312,  307,  313,
-      314,  315,  305,  306,  314,  316,  317,  318,  321,  320,
-      316,  323,  333,  322,  311,  325,  315,  327,  322,  312,
-      313,  333,  317,  322,  321,  330,  318,  319,  319,  320,
-      328,  323,  327,  319,  329,  319,  324,  324,  326,  326,
-      325,  331,  328,  319,  330,  332,  334,  335,  336,  329,
-      332,  337,  336,  319,  338,  339,  337,  340,  341,  341,
-      342,  430,  335,  331,  343,  334,  338,  345,  344,  430,
-      340,  344,  342,  339,  346,  347,  343,  346,  348,  348,
-      349,  349,  345,  354,  350,  351,  351,  353,  347,  350,
-
-      352,  352,  353,  355,  360,  356,  357,  363,  355,  356,
-      359,  357,  358,  361,  354,  359,  358,  362,  361,  366,
-      364,  363,  362,  364,  360,  365,  365,  368,  364,  367,
-      369,  370,  364,  369,  367,  370,  368,  366,  371,  372,
-      373,  375,  374,  371,  376,  373,  380,  378,  377,  376,
-      378,  380,  372,  375,  377,  381,  379,  370,  374,  379,
-      382,  383,  384,  385,  387,  384,  383,  386,  385,  387,
-      388,  386,  386,  381,  382,  389,  390,  392,  389,  388,
-      390,  390,  391,  393,  391,  393,  394,  395,  396,  397,
-      398,  399,  404,  389,  398,  400,  392,  401,  402,  409,
-
-      399,  403,  405,  405,  394,  395,  403,  396,  406,  397,
-      400,  404,  406,  402,  407,  401,  408,  410,  409,  407,
-      411,  412,  413,  414,  416,  418,  412,  411,  414,  413,
-      410,  415,  408,  417,  418,  419,  415,  423,  420,  431,
-      417,  421,  416,  420,  421,  429,  422,  424,  424,  419,
-      422,  427,  426,  428,  431,  427,  424,  426,  423,  434,
-      437,  438,  439,  429,  443,  428,  439,  438,  440,  437,
-      442,  445,  444,  440,  445,  442,  434,  441,  449,  441,
-      447,  441,  443,  452,  441,  446,  446,  447,  452,  441,
-      448,  448,  453,  449,  454,  441,  441,  444,  450,  450,
-
-      451,  455,  457,  451,  456,  456,  458,  460,  460,  455,
-      459,  461,  453,  454,  462,  459,  461,  457,  463,  462,
-      464,  463,  465,  466,  458,  467,  464,  468,  469,  471,
-      465,  466,  468,  470,  470,  469,  472,  471,  473,  475,
-      476,  472,  475,  467,  477,  477,  478,  479,  481,  483,
-      479,  482,  484,  485,  476,  487,  482,  473,  479,  486,
-      489,  478,  488,  490,  487,  491,  488,  492,  494,  481,
-      483,  493,  484,  495,  491,  485,  498,  493,  489,  486,
-      496,  492,  490,  501,  499,  496,  497,  495,  494,  500,
-      497,  502,  502,  503,  500,  498,  499,  504,  503,  505,
-
-      504,  506,  507,  508,  501,  509,  509,  507,  510,  510,
-      511,  512,  513,  514,  506,  512,  515,  505,  517,  518,
-      519,  520,  517,  508,  544,  511,  521,  522,  523,  524,
-      515,  513,  528,  544,  518,  524,  520,  514,  516,  525,
-      521,  516,  523,  516,  525,  519,  528,  516,  522,  516,
-      526,  526,  527,  529,  516,  532,  526,  527,  526,  530,
-      530,  531,  534,  532,  533,  529,  531,  535,  535,  536,
-      538,  539,  540,  536,  539,  538,  526,  541,  533,  542,
-      543,  534,  545,  546,  542,  547,  548,  549,  546,  550,
-      541,  540,  552,  554,  550,  553,  549,  555,  556,  543,
-
-      548,  545,  555,  556,  557,  547,  558,  560,  554,  557,
-      566,  552,  560,  553,  562,  558,  559,  559,  562,  562,
-      563,  563,  564,  565,  563,  564,  567,  568,  569,  567,
-      566,  570,  576,  569,  571,  572,  570,  573,  565,  578,
-      571,  574,  574,  573,  575,  579,  577,  580,  568,  577,
-      576,  572,  581,  575,  582,  583,  584,  578,  585,  582,
-      583,  585,  586,  587,  579,  581,  588,  580,  587,  589,
-      591,  588,  592,  586,  584,  590,  590,  594,  593,  595,
-      597,  594,  596,  598,  589,  602,  592,  601,  604,  591,
-      593,  596,  603,  604,  612,  607,  608,  595,  605,  597,
-
-      602,  601,  606,  605,  610,  611,  609,  606,  598,  607,
-      608,  609,  603,  612,  613,  613,  614,  615,  616,  610,
-      611,  617,  618,  616,  619,  620,  615,  618,  621,  620,
-      622,  623,  624,  625,  614,  626,  627,  621,  629,  630,
-      617,  628,  631,  619,  624,  622,  623,  628,  634,  635,
-      633,  631,  625,  629,  627,  633,  626,  635,  636,  630,
-      637,  639,  634,  638,  640,  637,  641,  638,  638,  642,
-      643,  643,  646,  646,  642,  641,  644,  640,  636,  645,
-      639,  644,  647,  648,  645,  649,  650,  651,  648,  652,
-      653,  647,  651,  654,  652,  653,  655,  654,  656,  649,
-
-      659,  660,  658,  661,  650,  655,  658,  662,  663,  656,
-      655,  664,  655,  665,  655,  659,  663,  661,  666,  660,
-      667,  667,  668,  669,  669,  664,  662,  671,  672,  673,
-      671,  665,  675,  672,  674,  674,  677,  668,  676,  676,
-      679,  677,  680,  666,  678,  678,  681,  680,  673,  683,
-      682,  684,  675,  687,  681,  682,  685,  684,  687,  688,
-      679,  689,  691,  685,  688,  690,  689,  683,  692,  693,
-      690,  691,  694,  694,  695,  696,  697,  698,  700,  699,
-      693,  697,  701,  701,  702,  703,  705,  692,  704,  709,
-      706,   61,  713,  710,  695,  706,  700,  698,  696,  699,
-
-      711,  712,  715,  708,  702,  711,  704,  708,  708,  705,
-      703,  710,  713,  714,  716,  709,  717,  714,  719,  712,
-      715,  718,  720,  722,  721,  723,  724,  720,  722,  725,
-      717,  721,  726,  716,  727,  724,  718,  719,  726,  735,
-      728,  729,  730,  723,  725,  728,  729,  730,  731,  731,
-      733,  733,  734,  735,  736,  727,  737,  734,  738,  738,
-      737,  737,  739,  740,  741,  742,  743,  745,  746,  744,
-      747,  749,  743,  736,  744,  748,  750,  751,  752,  752,
-      755,  739,  740,  753,  742,  749,  745,  746,  753,  747,
-      741,  754,  751,  755,  748,  754,  756,  750,  757,  758,
-
-      758,  759,  761,  760,  762,  756,  759,  760,  764,  762,
-      766,  767,  767,   56,  768,  766,  770,  770,  757,  768,
-      772,  772,  761,  776,  774,  777,  764,  774,  775,  775,
-      778,  779,  780,  780,  781,  778,  782,  782,  776,  783,
-      784,  785,  787,  786,  790,  785,  779,  787,  789,  792,
-      777,  784,  791,  791,  781,  793,  794,  795,  790,  795,
-      796,  783,  786,  797,  798,  796,  789,  799,  797,  792,
-      800,  800,  801,  804,  803,  793,  794,  805,  801,  803,
-      805,  799,  806,  808,  798,  807,  807,  806,  809,  810,
-      811,  812,  813,  814,  814,  811,  817,  813,  804,  815,
-
-      816,  808,  818,  819,  815,  822,  821,  809,  820,  810,
-      822,  823,  824,  825,  812,  827,  817,  819,  816,  821,
-      820,  828,  818,  830,  829,  833,  833,  836,  828,  838,
-      827,  823,  824,  829,  825,  834,  829,  835,  834,  830,
-      837,  839,  835,  836,  843,  840,  841,  844,  838,  837,
-      839,  841,  845,  839,  840,  842,  842,  846,  847,  848,
-      844,  849,  849,  850,  843,  857,  851,  853,  854,  855,
-      845,  846,  853,  858,  855,  856,  859,  848,  858,  850,
-      863,  856,  864,  847,  851,  857,  854,  860,  863,  859,
-      860,  865,  866,  870,  867,  864,  860,  868,  871,  872,
-
-      873,  874,  871,  875,  872,  873,  874,  876,  877,  865,
-      867,  866,  875,  870,  879,  868,  878,  878,  884,  880,
-      881,  882,  883,  877,  886,  886,  882,  885,  879,  892,
-      876,  880,  881,  885,  883,  889,  884,  887,  887,  890,
-      890,  891,  893,  894,  889,  896,  891,  895,  895,  903,
-      892,  897,  897,  898,  898,  899,  900,  902,  905,  900,
-      899,  893,  902,  894,  904,  896,  909,  903,  910,  904,
-      906,  906,  907,  907,  908,  911,  912,  913,  909,  908,
-      909,  914,  914,  905,  915,  909,  916,  916,  910,  917,
-      919,  920,  920,  921,  922,  911,  912,  923,  913,  919,
-
-      924,  922,  925,  925,  926,  927,  923,  929,  921,  917,
-      915,  930,  929,  931,  934,  932,  930,  933,  933,  934,
-      935,  927,  932,  936,  937,  938,  924,  939,  940,  935,
-      926,  941,   51,  931,  940,  942,  942,  943,  945,  937,
-      941,  946,  939,  936,  938,  944,  944,  947,  943,  948,
-      948,  951,  947,  943,  953,  946,  949,  950,  955,  945,
-      949,  949,  950,  951,  952,  956,  953,  954,  957,  952,
-      955,  954,  958,  957,  959,  960,  985,  962,  985,  959,
-      962,  963,  963,  964,  964,  965,  967,  960,  966,  968,
-      956,  965,  967,  966,  958,  971,  973,  973,  968,  974,
-
-      975,  976,  978,  978,  981,  983,  982,  971,  973,  975,
-      976,  982,  984,  984,  986,  986,  988,  974,  981,  989,
-      990,  990,  983,  988,  991,  992,  993,  995,  994,  996,
-      998,  999, 1000,  999, 1001,  998, 1005,  992,  993,  989,
-      994, 1003,  995, 1001, 1011,  991, 1004, 1004, 1006,  996,
-     1000, 1008, 1007, 1006, 1007, 1003, 1008, 1010, 1009, 1015,
-     1012, 1013, 1005, 1009, 1011, 1012, 1013, 1016, 1017, 1017,
-     1018, 1019, 1020, 1028, 1020, 1010, 1021, 1022, 1015, 1024,
-     1019, 1016, 1018, 1019, 1024, 1021, 1025, 1027, 1029, 1022,
-     1031, 1025, 1033, 1028, 1034, 1039, 1031, 1035, 1033, 1037,
-
-     1027, 1036, 1036, 1040, 1029, 1042, 1035, 1040, 1037, 1038,
-     1038, 1041, 1043, 1043, 1039, 1044, 1041, 1047, 1042, 1034,
-     1048, 1048, 1050, 1044, 1049, 1049, 1047, 1051, 1053, 1052,
-     1054, 1055, 1051, 1052, 1050, 1054, 1056, 1058, 1060, 1059,
-     1061, 1062, 1084, 1053, 1064, 1064, 1065, 1066, 1084, 1065,
-     1067,   50, 1061, 1068, 1068, 1056, 1071, 1055, 1059, 1060,
-     1066, 1058, 1062, 1067, 1069, 1069, 1070, 1070, 1074, 1071,
-     1072, 1072, 1073, 1073, 1075, 1075, 1076, 1076, 1077, 1079,
-     1080, 1080, 1081, 1088, 1079, 1082, 1082, 1074, 1083, 1085,
-     1087, 1087, 1085, 1086, 1086, 1089, 1089, 1077, 1091, 1091,
-
-     1092, 1081, 1088, 1093, 1093, 1094, 1083, 1095, 1096, 1086,
-     1097, 1098, 1099, 1096, 1094, 1100, 1101, 1104, 1102, 1095,
-     1100, 1103, 1104, 1107, 1098, 1105, 1092, 1102, 1109, 1105,
-     1103, 1101, 1114, 1099, 1115, 1097, 1111, 1109, 1110, 1110,
-     1172, 1111, 1131, 1107, 1112, 1112, 1115, 1114, 1117, 1118,
-     1124, 1117, 1126, 1112, 1118, 1119, 1119, 1120, 1131, 1121,
-     1123, 1120, 1121, 1122, 1122, 1123, 1172, 1125, 1127, 1128,
-     1124, 1125, 1126, 1127, 1128, 1129, 1133, 1132, 1134, 1151,
-     1134, 1129, 1132, 1150, 1133, 1137, 1137, 1140, 1140, 1143,
-     1144, 1144, 1146, 1146, 1143, 1148, 1149, 1149, 1152, 1150,
-
-     1148, 1151, 1157, 1152, 1154, 1154, 1158, 1157, 1158, 1159,
-     1160, 1161, 1161, 1162, 1162, 1160, 1163, 1163, 1164, 1165,
-     1166, 1167, 1168, 1159, 1169, 1170, 1170, 1171, 1173, 1174,
-     1164, 1175, 1166, 1167, 1168, 1176, 1171, 1165, 1177, 1182,
-     1178, 1179, 1174, 1188, 1169, 1178, 1179, 1187, 1173, 1176,
-     1180, 1180, 1183, 1183, 1186, 1175, 1177, 1182, 1185, 1185,
-     1189, 1188, 1187, 1186, 1190, 1191, 1192, 1192, 1193, 1195,
-     1194, 1196, 1201, 1193, 1198, 1204, 1202, 1205, 1189, 1202,
-     1190, 1203, 1203, 1208, 1191, 1194, 1207, 1207, 1195, 1215,
-     1204, 1196, 1201, 1198, 1216, 1205, 1209, 1209, 1210, 1210,
-
-     1214, 1214, 1208, 1216, 1217, 1218, 1219, 1221, 1222, 1217,
-     1218, 1215, 1223, 1222, 1219, 1224,   45, 1223, 1225, 1225,
-     1226, 1226, 1221, 1227, 1228, 1228, 1229, 1229, 1227, 1231,
-     1224, 1232, 1234, 1235, 1231, 1234, 1236, 1241, 1237, 1238,
-     1238, 1239, 1242, 1232, 1244, 1236, 1235, 1237, 1243, 1243,
-     1239, 1245, 1245, 1244, 1246, 1247, 1241, 1249, 1250, 1255,
-     1247, 1242, 1246, 1252, 1252, 1260, 1249, 1256, 1256, 1257,
-     1261, 1250, 1257, 1258, 1258, 1259, 1259, 1262, 1270, 1255,
-     1263, 1263, 1262, 1260, 1261, 1264, 1267, 1271, 1272, 1264,
-     1273, 1273, 1267, 1274, 1275, 1271, 1276, 1270, 1277, 1275,
-
-     1279, 1278, 1281, 1283, 1285, 1281, 1286, 1272, 1285, 1274,
-     1278, 1284, 1284, 1288, 1289, 1286, 1276, 1290, 1293, 1307,
-     1279, 1283, 1288, 1293, 1277, 1295, 1289, 1294, 1294, 1298,
-     1297, 1299, 1300, 1303, 1295, 1297, 1301, 1301, 1298, 1302,
-     1304, 1306, 1290, 1305, 1308, 1307, 1306, 1300, 1302, 1303,
-     1299, 1305, 1309, 1309, 1313, 1310, 1312, 1312, 1314, 1304,
-     1310, 1315, 1315, 1308, 1316, 1316, 1317, 1318, 1319, 1320,
-     1320, 1321, 1322, 1322, 1313, 1323, 1325, 1326,   40, 1318,
-     1314,   14, 1326, 1321, 1330, 1317, 1327, 1327, 1319, 1330,
-     1325, 1328, 1328, 1345, 1323, 1329, 1329, 1331, 1331, 1333,
-
-     1333, 1335, 1335, 1336, 1339, 1340, 1340, 1347, 1336, 1341,
-     1343, 1347, 1339, 1345, 1341, 1343, 1346, 1346, 1351, 1351,
-     1353, 1355, 1355, 1356, 1353, 1358, 1359, 1359, 1360, 1360,
-     1362, 1362, 1364, 1364, 1366, 1367, 1367, 1372, 1356, 1373,
-     1375, 1372, 1377, 1358, 1374, 1374, 1366, 1378, 1379, 1375,
-     1380, 1380,   13,    0,    0,    0,    0, 1377,    0, 1373,
-        0, 1378,    0,    0,    0,    0,    0, 1379, 1383, 1383,
-     1383, 1383, 1383, 1383, 1383, 1384, 1384, 1384, 1384, 1384,
-     1384, 1384, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1386,
-     1386, 1386, 1386, 1386, 1386, 1386, 1387, 1387, 1387, 1387,
-
-     1387, 1387, 1387, 1389, 1389,    0, 1389, 1389, 1389, 1389,
-     1390, 1390,    0,    0,    0, 1390, 1390, 1391, 1391,    0,
-        0, 1391,    0, 1391, 1392,    0,    0,    0,    0,    0,
-     1392, 1393, 1393,    0,    0,    0, 1393, 1393, 1394,    0,
-        0,    0,    0,    0, 1394, 1395, 1395,    0, 1395, 1395,
-     1395, 1395, 1396, 1396,    0, 1396, 1396, 1396, 1396, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382
-
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+        2,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+
+        7,    7,    7,    7,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   19,   19,   19,   16,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   20,   20,   20,
+       66,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   44,   44,
+       44,   74,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   49,
+       49,   49,   75,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       55,   55,   55,   76,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   60,   60,   60,   77,   60,   60,   60,   60,   60,
+
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   63,   63,   63,   78,   63,   63,   63,   63,
+       63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
+       63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
+       63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
+       63,   63,   63,   65,   65,   65,   79,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   70,   70,   70,   80,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   40,   40,   40,   51,   81,
+       51,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   45,   45,   45,   39,
+
+       82,   45,   45,   39,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   56,   56,   56,
+      180,  180,   84,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   50,   50,
+      245,  229,  229,  245,   50,  245,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   61,
+       61, 1419,  269,  269, 1419,   61, 1419,   61,   61,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+       14,   14, 1443, 1421, 1421, 1443,   14, 1443,   14,   14,
+       14,   14,   14,   85,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   21,   21, 1662,  243, 1662,  243,   21, 1662,   21,
+       21,   21,   21,   21,   86,   21,   21,   21,   21,   21,
+       21,   21,   21,   21,   21,   21,   21,   21,   21,   21,
+       21,   21,   21,   21,   21,   21,   21,   21,   21,   21,
+       21,   21,   22,   22, 1686,   87, 1686,  424,   22, 1686,
+       22,   22,   22,   22,   22,  424,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   23,   23, 1710,   88, 1710,  479,   23,
+     1710,   23,   23,   23,   23,   23,  479,   23,   23,   23,
+
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   24,   24, 1736,   89, 1736, 1112,
+       24, 1736,   24,   24,   24,   24,   24, 1112,   24,   24,
+       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
+       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
+       24,   24,   24,   24,   24,   25,   25, 1762,   90, 1762,
+       92,   25, 1762,   25,   25,   25,   25,   25,   93,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+
+       25,   25,   25,   25,   25,   25,   26,   26, 1786,   96,
+     1786,   97,   26, 1786,   26,   26,   26,   26,   26,   98,
+       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
+       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
+       26,   26,   26,   26,   26,   26,   26,   27,   27,   38,
+     1445, 1445,   99,   27,   38,   27,   27,   27,   27,   27,
+      100,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   28,   28,
+      154,   95,  101,  154,   28,   95,   28,   28,   28,   28,
+
+       28,  102,   28,   28,   28,   28,   28,   28,   28,   28,
+       28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
+       28,   28,   28,   28,   28,   28,   28,   28,   28,   29,
+       29,  224,  106,  103,  224,   29,  106,   29,   29,   29,
+       29,   29,  104,   29,   29,   29,   29,   29,   29,   29,
+       29,   29,   29,   29,   29,   29,   29,   29,   29,   29,
+       29,   29,   29,   29,   29,   29,   29,   29,   29,   29,
+       30,   30,  232,  105,  563,  232,   30,  563,   30,   30,
+       30,   30,   30,  107,   30,   30,   30,   30,   30,   30,
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+
+       30,   30,   30,   30,   30,   30,   30,   30,   30,   30,
+       30,   31,   31,  322,  108,  829,  109,   31,  829,   31,
+       31,   31,   31,   31,  322,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+       31,   31,   32,   32,  386, 1565, 1565,  110,   32,  386,
+       32,   32,   32,   32,   32,  111,   32,   32,   32,   32,
+       32,   32,   32,   32,   32,   32,   32,   32,   32,   32,
+       32,   32,   32,   32,   32,   32,   32,   32,   32,   32,
+       32,   32,   32,   33,   33,  390, 1574, 1574,  112,   33,
+
+      390,   33,   33,   33,   33,   33,  113,   33,   33,   33,
+       33,   33,   33,   33,   33,   33,   33,   33,   33,   33,
+       33,   33,   33,   33,   33,   33,   33,   33,   33,   33,
+       33,   33,   33,   33,   34,   34,  562, 1618, 1618,  115,
+       34,  562,   34,   34,   34,   34,   34,  116,   34,   34,
+       34,   34,   34,   34,   34,   34,   34,   34,   34,   34,
+       34,   34,   34,   34,   34,   34,   34,   34,   34,   34,
+       34,   34,   34,   34,   34,  254,  254,  188,  117,   73,
+      118,   73,   73,   91,   73,  254,   91,  254,  254,  254,
+       73,   73,  254,  441,  134,  441,  134,  134,  441,  134,
+
+       91,  188,  145,  441,  119,  162,  134,  145,  319,  441,
+      441,   36,  145,  319,  516,  319,  516,  162,  145,  145,
+      516,   36,  516,  319,  526,   36,   36,  516, 1416,  526,
+      655,  526,  120,  319,  121,  655, 1440,  655, 1416,  655,
+     1923, 1941, 1416, 1416, 1923, 1941, 1440, 1923, 1941,  526,
+     1440, 1440, 1923, 1941,   15,   35,   15,   37,  364,   37,
+       15,  135,  909,  364,  909,   35,  252,  364,   35,  909,
+     1382, 1399, 1382, 1399,   37, 1464, 1467, 1464, 1477, 1467,
+     1477, 1480,  252, 1490, 1480, 1490, 1493, 1382, 1399, 1493,
+     1515, 1467, 1464, 1515, 1534, 1477, 1480, 1512, 1548, 1512,
+
+     1490, 1493, 1562, 1571, 1534, 1515,   83, 1534, 1548, 1580,
+     1596, 1548, 1562, 1571, 1512, 1562, 1571, 1583,  190, 1580,
+     1596, 1599, 1580, 1596, 1612,   83, 1583, 1583,   94, 1615,
+     1599, 1599, 1628, 1644, 1612,  190,  638, 1612, 1615, 1615,
+     1631,  638, 1628, 1644, 1647, 1628, 1644, 1653,   94, 1631,
+     1631,  114, 1656, 1647, 1647, 1770, 1770, 1653, 1794, 1794,
+     1653, 1656, 1656, 1770, 1810, 1825, 1794,  370,  136, 1877,
+      278,  114, 1900,  142, 1810, 1825, 1877, 1810, 1825, 1900,
+      142, 1877,  389,  278, 1900,  708,  737,  860,  137,  370,
+      708,  737,  839,  860,  943,  839,  949,  389,  973,  943,
+
+     1019,  949, 1086, 1019, 1385, 1501, 1402, 1523, 1535,  973,
+     1501,  138, 1523, 1549, 1563, 1535, 1385, 1086, 1402, 1572,
+     1549, 1563, 1581, 1597, 1613, 1629, 1572, 1634, 1634, 1581,
+     1597, 1613, 1629, 1645, 1648, 1654, 1657, 1648, 1718, 1657,
+     1645, 1744, 1654, 1811, 1826, 1718, 1845, 1861, 1744, 1811,
+     1826, 1845, 1861, 1955, 1961, 1962, 1978, 1955, 1972, 1961,
+     1962, 1978, 1972, 1979,  139, 1989, 1995, 1996, 1979, 1989,
+     2003, 1995, 1996, 2011, 2017, 2003, 2018, 2011, 2025, 2017,
+     2041, 2018,  140, 2025, 2035, 2035, 2060, 2041, 2054, 2054,
+      141,  143,  144, 2060,  146,  147,  148,  149,  150,  151,
+
+      152,  153,  155,  156,  157,  158,  159,  160,  161,  163,
+      164,  165,  166,  167,  168,  169,  170,  171,  172,  173,
+      174,  175,  176,  177,  178,  179,  181,  182,  183,  184,
+      185,  186,  187,  189,  191,  192,  193,  194,  195,  196,
+      197,  198,  199,  200,  201,  202,  203,  204,  205,  206,
+      207,  208,  209,  210,  211,  212,  213,  214,  215,  216,
+      217,  218,  219,  220,  221,  222,  223,  225,  226,  227,
+      228,  230,  231,  233,  234,  235,  236,  237,  238,  239,
+      240,  241,  242,  244,  246,  247,  248,  249,  250,  251,
+      253,  255,  256,  257,  258,  259,  260,  261,  262,  263,
+
+      264,  265,  266,  267,  268,  270,  271,  272,  273,  274,
+      275,  276,  277,  279,  280,  281,  282,  283,  284,  285,
+      286,  287,  288,  289,  290,  291,  292,  293,  294,  295,
+      296,  297,  299,  300,  301,  302,  303,  305,  306,  307,
+      308,  309,  310,  311,  312,  313,  314,  315,  316,  317,
+      318,  320,  321,  323,  324,  325,  326,  327,  328,  329,
+      330,  331,  332,  333,  334,  335,  336,  337,  338,  339,
+      340,  341,  342,  343,  344,  345,  346,  347,  348,  349,
+      350,  351,  352,  353,  354,  355,  356,  357,  358,  359,
+      360,  361,  362,  363,  365,  366,  367,  368,  369,  371,
+
+      372,  373,  374,  375,  376,  377,  378,  379,  380,  381,
+      382,  383,  384,  385,  387,  388,  391,  392,  393,  394,
+      395,  396,  397,  398,  399,  400,  401,  402,  403,  404,
+      405,  406,  407,  408,  409,  410,  411,  412,  413,  414,
+      415,  416,  417,  418,  419,  420,  421,  422,  423,  426,
+      427,  428,  429,  430,  431,  434,  437,  438,  439,  440,
+      442,  443,  444,  445,  446,  447,  448,  449,  450,  451,
+      452,  453,  454,  455,  456,  457,  458,  459,  460,  461,
+      462,  463,  464,  465,  466,  467,  468,  469,  470,  471,
+      472,  473,  475,  476,  477,  478,  481,  482,  483,  484,
+
+      485,  486,  487,  488,  489,  490,  491,  492,  493,  494,
+      495,  496,  497,  498,  499,  500,  501,  502,  503,  504,
+      505,  506,  507,  508,  509,  510,  511,  512,  513,  514,
+      515,  517,  518,  519,  520,  521,  522,  523,  524,  525,
+      527,  528,  529,  530,  531,  532,  533,  534,  535,  536,
+      538,  539,  540,  541,  542,  543,  544,  545,  546,  547,
+      548,  549,  550,  552,  553,  554,  555,  556,  557,  558,
+      559,  560,  564,  565,  566,  567,  568,  569,  570,  571,
+      572,  573,  574,  575,  576,  577,  578,  579,  580,  581,
+      582,  583,  584,  585,  586,  587,  588,  589,  590,  591,
+
+      592,  593,  594,  595,  596,  597,  598,  601,  602,  603,
+      604,  605,  606,  607,  608,  609,  610,  611,  612,  613,
+      614,  615,  616,  617,  618,  619,  620,  621,  622,  623,
+      624,  625,  626,  627,  628,  629,  630,  631,  633,  634,
+      635,  636,  637,  639,  640,  641,  642,  643,  644,  645,
+      646,  647,  648,  649,  650,  651,  652,  653,  654,  656,
+      658,  659,  660,  661,  662,  663,  664,  665,  666,  667,
+      668,  669,  671,  672,  673,  674,  675,  676,  677,  678,
+      679,  680,  681,  682,  683,  684,  685,  687,  688,  689,
+      690,  691,  692,  693,  694,  695,  696,  697,  698,  699,
+
+      700,  701,  702,  703,  704,  705,  706,  709,  710,  711,
+      712,  713,  714,  715,  716,  717,  718,  719,  720,  721,
+      722,  723,  724,  725,  726,  727,  728,  729,  730,  731,
+      733,  734,  735,  736,  738,  739,  740,  741,  742,  743,
+      744,  745,  746,  747,  748,  749,  750,  751,  752,  753,
+      754,  755,  756,  757,  758,  759,  760,  761,  762,  764,
+      766,  767,  768,  770,  772,  774,  775,  776,  777,  778,
+      779,  780,  781,  782,  783,  784,  785,  786,  787,  789,
+      790,  791,  792,  793,  794,  795,  796,  797,  798,  799,
+      800,  801,  803,  804,  805,  806,  807,  808,  809,  810,
+
+      811,  812,  813,  814,  815,  816,  817,  818,  819,  820,
+      821,  822,  823,  824,  825,  827,  828,  830,  833,  834,
+      835,  836,  837,  838,  840,  841,  842,  843,  844,  845,
+      846,  847,  848,  849,  850,  851,  853,  854,  855,  856,
+      857,  858,  859,  863,  864,  865,  866,  867,  868,  870,
+      871,  872,  873,  874,  875,  876,  877,  878,  879,  880,
+      881,  882,  883,  884,  885,  886,  887,  889,  890,  891,
+      892,  893,  894,  895,  896,  897,  898,  899,  900,  902,
+      903,  904,  905,  906,  907,  908,  910,  911,  912,  913,
+      914,  915,  916,  917,  919,  920,  921,  922,  923,  924,
+
+      925,  926,  927,  929,  930,  931,  932,  933,  934,  935,
+      936,  937,  938,  939,  940,  941,  942,  944,  945,  946,
+      947,  948,  950,  951,  952,  953,  954,  955,  956,  957,
+      958,  959,  960,  962,  963,  964,  965,  966,  967,  968,
+      971,  974,  975,  976,  978,  981,  982,  983,  984,  985,
+      986,  988,  989,  990,  991,  992,  993,  994,  995,  996,
+      998,  999, 1000, 1001, 1003, 1004, 1005, 1006, 1007, 1008,
+     1009, 1010, 1011, 1012, 1013, 1015, 1016, 1017, 1018, 1020,
+     1021, 1022, 1024, 1025, 1027, 1028, 1029, 1031, 1033, 1034,
+     1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044,
+
+     1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056,
+     1058, 1059, 1060, 1061, 1062, 1064, 1065, 1066, 1067, 1068,
+     1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1079,
+     1080, 1081, 1082, 1083, 1084, 1085, 1087, 1088, 1089, 1091,
+     1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101,
+     1102, 1103, 1104, 1105, 1107, 1109, 1110, 1111, 1114, 1115,
+     1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126,
+     1127, 1128, 1129, 1131, 1132, 1133, 1134, 1137, 1140, 1143,
+     1144, 1146, 1148, 1149, 1150, 1151, 1152, 1154, 1157, 1158,
+     1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168,
+
+     1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178,
+     1179, 1180, 1182, 1183, 1185, 1186, 1187, 1188, 1189, 1190,
+     1191, 1192, 1193, 1194, 1195, 1196, 1198, 1201, 1202, 1203,
+     1204, 1205, 1207, 1208, 1209, 1210, 1214, 1215, 1216, 1217,
+     1218, 1219, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228,
+     1229, 1231, 1232, 1234, 1235, 1236, 1237, 1238, 1239, 1241,
+     1242, 1243, 1244, 1245, 1246, 1247, 1249, 1250, 1252, 1255,
+     1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1267,
+     1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279,
+     1281, 1283, 1284, 1285, 1286, 1288, 1289, 1290, 1293, 1294,
+
+     1295, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305,
+     1306, 1307, 1308, 1309, 1310, 1312, 1313, 1314, 1315, 1316,
+     1317, 1318, 1319, 1320, 1321, 1322, 1323, 1325, 1326, 1327,
+     1328, 1329, 1330, 1331, 1333, 1335, 1336, 1339, 1340, 1341,
+     1343, 1345, 1346, 1347, 1351, 1353, 1355, 1356, 1358, 1359,
+     1360, 1362, 1364, 1366, 1367, 1372, 1373, 1374, 1375, 1377,
+     1378, 1379, 1380, 1383, 1384, 1386, 1387, 1388, 1389, 1390,
+     1391, 1392, 1393, 1394, 1395, 1396, 1397, 1400, 1401, 1403,
+     1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413,
+     1414, 1417, 1418, 1420, 1422, 1423, 1424, 1425, 1426, 1427,
+
+     1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437,
+     1438, 1441, 1442, 1444, 1446, 1447, 1448, 1449, 1450, 1451,
+     1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461,
+     1462, 1465, 1466, 1468, 1469, 1470, 1471, 1472, 1473, 1474,
+     1475, 1478, 1479, 1481, 1482, 1483, 1484, 1485, 1486, 1487,
+     1488, 1491, 1492, 1494, 1495, 1496, 1497, 1498, 1499, 1500,
+     1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1513,
+     1514, 1516, 1517, 1518, 1519, 1520, 1521, 1522, 1524, 1525,
+     1526, 1527, 1528, 1529, 1530, 1531, 1532, 1536, 1537, 1538,
+     1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1550, 1551,
+
+     1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1564,
+     1566, 1567, 1568, 1569, 1573, 1575, 1576, 1577, 1578, 1582,
+     1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593,
+     1594, 1598, 1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607,
+     1608, 1609, 1610, 1614, 1616, 1617, 1619, 1620, 1621, 1622,
+     1623, 1624, 1625, 1626, 1630, 1632, 1633, 1635, 1636, 1637,
+     1638, 1639, 1640, 1641, 1642, 1646, 1649, 1650, 1651, 1655,
+     1658, 1659, 1660, 1663, 1664, 1665, 1666, 1667, 1668, 1669,
+     1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679,
+     1680, 1681, 1682, 1683, 1684, 1687, 1688, 1689, 1690, 1691,
+
+     1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701,
+     1702, 1703, 1704, 1705, 1706, 1707, 1708, 1711, 1712, 1713,
+     1714, 1715, 1716, 1717, 1719, 1720, 1721, 1722, 1723, 1724,
+     1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734,
+     1737, 1738, 1739, 1740, 1741, 1742, 1743, 1745, 1746, 1747,
+     1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757,
+     1758, 1759, 1760, 1763, 1764, 1765, 1766, 1767, 1768, 1769,
+     1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780,
+     1781, 1782, 1783, 1784, 1787, 1788, 1789, 1790, 1791, 1792,
+     1793, 1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803,
+
+     1804, 1805, 1806, 1807, 1808, 1812, 1813, 1814, 1815, 1816,
+     1817, 1818, 1819, 1820, 1821, 1822, 1823, 1827, 1828, 1829,
+     1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1840,
+     1841, 1842, 1843, 1844, 1846, 1847, 1848, 1849, 1850, 1851,
+     1852, 1853, 1854, 1856, 1857, 1858, 1859, 1860, 1862, 1863,
+     1864, 1865, 1866, 1867, 1868, 1869, 1870, 1872, 1873, 1874,
+     1875, 1876, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885,
+     1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1895, 1896,
+     1897, 1898, 1899, 1901, 1902, 1903, 1904, 1905, 1906, 1907,
+     1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1918,
+
+     1919, 1920, 1921, 1922, 1924, 1925, 1926, 1927, 1928, 1929,
+     1930, 1931, 1932, 1933, 1934, 1936, 1937, 1938, 1939, 1940,
+     1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951,
+     1952, 1954, 1956, 1957, 1958, 1959, 1960, 1963, 1964, 1965,
+     1966, 1967, 1968, 1969, 1971, 1973, 1974, 1975, 1976, 1977,
+     1980, 1981, 1982, 1983, 1984, 1985, 1986, 1988, 1990, 1991,
+     1992, 1993, 1994, 1997, 1998, 1999, 2000, 2001, 2002, 2004,
+     2005, 2006, 2007, 2008, 2010, 2012, 2013, 2014, 2015, 2016,
+     2019, 2020, 2021, 2022, 2023, 2024, 2026, 2027, 2028, 2029,
+     2030, 2032, 2033, 2034, 2036, 2037, 2038, 2039, 2040, 2042,
+
+     2043, 2044, 2045, 2046, 2047, 2048, 2049, 2051, 2052, 2053,
+     2055, 2056, 2057, 2058, 2059, 2061, 2062, 2063, 2064, 2065,
+     2066, 2067, 2068,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070,
+     2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070,
+     2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070,
+     2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070,
+     2070
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1707,7 +2080,7 @@ static void config_end_include(void)
 #define YY_NO_INPUT 1
 #endif
 
-#line 1709 "<stdout>"
+#line 2082 "<stdout>"
 
 #define INITIAL 0
 #define quotedstring 1
@@ -1894,7 +2267,7 @@ YY_DECL
     
 #line 198 "./util/configlexer.lex"
 
-#line 1896 "<stdout>"
+#line 2269 "<stdout>"
 
 	if ( !(yy_init) )
 		{
@@ -1953,13 +2326,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1383 )
+				if ( yy_current_state >= 2071 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 2760 );
+		while ( yy_base[yy_current_state] != 3451 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -2179,474 +2552,569 @@ YY_RULE_SETUP
 case 39:
 YY_RULE_SETUP
 #line 240 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_CACHE_SIZE) }
+{ YDVAR(1, VAR_MSG_CACHE_L1_SLOTS) }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
 #line 241 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_CACHE_SLABS) }
+{ YDVAR(1, VAR_RRSET_CACHE_SIZE) }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
 #line 242 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MAX_TTL) }
+{ YDVAR(1, VAR_RRSET_CACHE_SLABS) }
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
 #line 243 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MIN_TTL) }
+{ YDVAR(1, VAR_CACHE_MAX_TTL) }
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
 #line 244 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_HOST_TTL) }
+{ YDVAR(1, VAR_CACHE_MIN_TTL) }
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
 #line 245 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_LAME_TTL) }
+{ YDVAR(1, VAR_INFRA_HOST_TTL) }
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
 #line 246 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_SLABS) }
+{ YDVAR(1, VAR_INFRA_LAME_TTL) }
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
 #line 247 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_NUMHOSTS) }
+{ YDVAR(1, VAR_INFRA_CACHE_SLABS) }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
 #line 248 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_LAME_SIZE) }
+{ YDVAR(1, VAR_INFRA_CACHE_NUMHOSTS) }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
 #line 249 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NUM_QUERIES_PER_THREAD) }
+{ YDVAR(1, VAR_INFRA_CACHE_LAME_SIZE) }
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
 #line 250 "./util/configlexer.lex"
-{ YDVAR(1, VAR_JOSTLE_TIMEOUT) }
+{ YDVAR(1, VAR_NUM_QUERIES_PER_THREAD) }
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
 #line 251 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DELAY_CLOSE) }
+{ YDVAR(1, VAR_JOSTLE_TIMEOUT) }
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
 #line 252 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TARGET_FETCH_POLICY) }
+{ YDVAR(1, VAR_DELAY_CLOSE) }
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
 #line 253 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_SHORT_BUFSIZE) }
+{ YDVAR(1, VAR_TCP_IDLE_TIMEOUT) }
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
 #line 254 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_LARGE_QUERIES) }
+{ YDVAR(1, VAR_TCP_FASTOPEN) }
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
 #line 255 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_GLUE) }
+{ YDVAR(1, VAR_TCP_UPSTREAM_FASTOPEN) }
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
 #line 256 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_DNSSEC_STRIPPED) }
+{ YDVAR(1, VAR_RRL_RATELIMIT) }
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
 #line 257 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_BELOW_NXDOMAIN) }
+{ YDVAR(1, VAR_RRL_SLIP) }
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
 #line 258 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_REFERRAL_PATH) }
+{ YDVAR(1, VAR_RRL_IPV4_PREFIX) }
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
 #line 259 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_CAPS_FOR_ID) }
+{ YDVAR(1, VAR_RRL_IPV6_PREFIX) }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
 #line 260 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UNWANTED_REPLY_THRESHOLD) }
+{ YDVAR(1, VAR_RRL_SIZE) }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
 #line 261 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PRIVATE_ADDRESS) }
+{ YDVAR(1, VAR_UPSTREAM_ZONE_RATELIMIT) }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
 #line 262 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PRIVATE_DOMAIN) }
+{ YDVAR(1, VAR_UPSTREAM_SERVER_RATELIMIT) }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
 #line 263 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PREFETCH_KEY) }
+{ YDVAR(1, VAR_UPSTREAM_RATELIMIT_SIZE) }
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
 #line 264 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PREFETCH) }
+{ YDVAR(1, VAR_REGION_PRESIZE) }
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
 #line 265 "./util/configlexer.lex"
-{ YDVAR(0, VAR_STUB_ZONE) }
+{ YDVAR(1, VAR_CACHE_HUGEPAGES) }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
 #line 266 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NAME) }
+{ YDVAR(1, VAR_CACHE_ADMISSION_FILTER) }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
 #line 267 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_ADDR) }
+{ YDVAR(1, VAR_CACHE_EXPIRY_SCAN) }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
 #line 268 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_HOST) }
+{ YDVAR(1, VAR_SSL_SESSION_TICKET_KEYS) }
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
 #line 269 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_PRIME) }
+{ YDVAR(1, VAR_TARGET_FETCH_POLICY) }
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
 #line 270 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_FIRST) }
+{ YDVAR(1, VAR_HARDEN_SHORT_BUFSIZE) }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
 #line 271 "./util/configlexer.lex"
-{ YDVAR(0, VAR_FORWARD_ZONE) }
+{ YDVAR(1, VAR_HARDEN_LARGE_QUERIES) }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
 #line 272 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_ADDR) }
+{ YDVAR(1, VAR_HARDEN_GLUE) }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
 #line 273 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_HOST) }
+{ YDVAR(1, VAR_HARDEN_DNSSEC_STRIPPED) }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
 #line 274 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_FIRST) }
+{ YDVAR(1, VAR_HARDEN_BELOW_NXDOMAIN) }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
 #line 275 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_NOT_QUERY_ADDRESS) }
+{ YDVAR(1, VAR_HARDEN_REFERRAL_PATH) }
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
 #line 276 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_NOT_QUERY_LOCALHOST) }
+{ YDVAR(1, VAR_USE_CAPS_FOR_ID) }
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
 #line 277 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL) }
+{ YDVAR(1, VAR_UNWANTED_REPLY_THRESHOLD) }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
 #line 278 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_IDENTITY) }
+{ YDVAR(1, VAR_PRIVATE_ADDRESS) }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
 #line 279 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_VERSION) }
+{ YDVAR(1, VAR_PRIVATE_DOMAIN) }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
 #line 280 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IDENTITY) }
+{ YDVAR(1, VAR_PREFETCH_KEY) }
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
 #line 281 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VERSION) }
+{ YDVAR(1, VAR_PREFETCH_POPULAR) }
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
 #line 282 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MODULE_CONF) }
+{ YDVAR(1, VAR_PREFETCH_POPULAR_RATE) }
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
 #line 283 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DLV_ANCHOR) }
+{ YDVAR(1, VAR_PREFETCH) }
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
 #line 284 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DLV_ANCHOR_FILE) }
+{ YDVAR(0, VAR_STUB_ZONE) }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
 #line 285 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR_FILE) }
+{ YDVAR(1, VAR_NAME) }
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
 #line 286 "./util/configlexer.lex"
-{ YDVAR(1, VAR_AUTO_TRUST_ANCHOR_FILE) }
+{ YDVAR(1, VAR_STUB_ADDR) }
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
 #line 287 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUSTED_KEYS_FILE) }
+{ YDVAR(1, VAR_STUB_HOST) }
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
 #line 288 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR) }
+{ YDVAR(1, VAR_STUB_PRIME) }
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
 #line 289 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_OVERRIDE_DATE) }
+{ YDVAR(1, VAR_STUB_FIRST) }
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
 #line 290 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_SIG_SKEW_MIN) }
+{ YDVAR(0, VAR_FORWARD_ZONE) }
 	YY_BREAK
 case 90:
 YY_RULE_SETUP
 #line 291 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_SIG_SKEW_MAX) }
+{ YDVAR(1, VAR_FORWARD_ADDR) }
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
 #line 292 "./util/configlexer.lex"
-{ YDVAR(1, VAR_BOGUS_TTL) }
+{ YDVAR(1, VAR_FORWARD_HOST) }
 	YY_BREAK
 case 92:
 YY_RULE_SETUP
 #line 293 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_CLEAN_ADDITIONAL) }
+{ YDVAR(1, VAR_FORWARD_FIRST) }
 	YY_BREAK
 case 93:
 YY_RULE_SETUP
 #line 294 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_PERMISSIVE_MODE) }
+{ YDVAR(1, VAR_DO_NOT_QUERY_ADDRESS) }
 	YY_BREAK
 case 94:
 YY_RULE_SETUP
 #line 295 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IGNORE_CD_FLAG) }
+{ YDVAR(1, VAR_DO_NOT_QUERY_LOCALHOST) }
 	YY_BREAK
 case 95:
 YY_RULE_SETUP
 #line 296 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_LOG_LEVEL) }
+{ YDVAR(2, VAR_ACCESS_CONTROL) }
 	YY_BREAK
 case 96:
 YY_RULE_SETUP
 #line 297 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEY_CACHE_SIZE) }
+{ YDVAR(1, VAR_HIDE_IDENTITY) }
 	YY_BREAK
 case 97:
 YY_RULE_SETUP
 #line 298 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEY_CACHE_SLABS) }
+{ YDVAR(1, VAR_HIDE_VERSION) }
 	YY_BREAK
 case 98:
 YY_RULE_SETUP
 #line 299 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NEG_CACHE_SIZE) }
+{ YDVAR(1, VAR_IDENTITY) }
 	YY_BREAK
 case 99:
 YY_RULE_SETUP
 #line 300 "./util/configlexer.lex"
-{ 
-				  YDVAR(1, VAR_VAL_NSEC3_KEYSIZE_ITERATIONS) }
+{ YDVAR(1, VAR_VERSION) }
 	YY_BREAK
 case 100:
 YY_RULE_SETUP
-#line 302 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ADD_HOLDDOWN) }
+#line 301 "./util/configlexer.lex"
+{ YDVAR(1, VAR_MODULE_CONF) }
 	YY_BREAK
 case 101:
 YY_RULE_SETUP
-#line 303 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DEL_HOLDDOWN) }
+#line 302 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DLV_ANCHOR) }
 	YY_BREAK
 case 102:
 YY_RULE_SETUP
-#line 304 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEEP_MISSING) }
+#line 303 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DLV_ANCHOR_FILE) }
 	YY_BREAK
 case 103:
 YY_RULE_SETUP
-#line 305 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_SYSLOG) }
+#line 304 "./util/configlexer.lex"
+{ YDVAR(1, VAR_TRUST_ANCHOR_FILE) }
 	YY_BREAK
 case 104:
 YY_RULE_SETUP
-#line 306 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_TIME_ASCII) }
+#line 305 "./util/configlexer.lex"
+{ YDVAR(1, VAR_AUTO_TRUST_ANCHOR_FILE) }
 	YY_BREAK
 case 105:
 YY_RULE_SETUP
-#line 307 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_QUERIES) }
+#line 306 "./util/configlexer.lex"
+{ YDVAR(1, VAR_TRUSTED_KEYS_FILE) }
 	YY_BREAK
 case 106:
 YY_RULE_SETUP
-#line 308 "./util/configlexer.lex"
-{ YDVAR(2, VAR_LOCAL_ZONE) }
+#line 307 "./util/configlexer.lex"
+{ YDVAR(1, VAR_TRUST_ANCHOR) }
 	YY_BREAK
 case 107:
 YY_RULE_SETUP
-#line 309 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOCAL_DATA) }
+#line 308 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_OVERRIDE_DATE) }
 	YY_BREAK
 case 108:
 YY_RULE_SETUP
-#line 310 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOCAL_DATA_PTR) }
+#line 309 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_SIG_SKEW_MIN) }
 	YY_BREAK
 case 109:
 YY_RULE_SETUP
-#line 311 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STATISTICS_INTERVAL) }
+#line 310 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_SIG_SKEW_MAX) }
 	YY_BREAK
 case 110:
 YY_RULE_SETUP
-#line 312 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STATISTICS_CUMULATIVE) }
+#line 311 "./util/configlexer.lex"
+{ YDVAR(1, VAR_BOGUS_TTL) }
 	YY_BREAK
 case 111:
 YY_RULE_SETUP
-#line 313 "./util/configlexer.lex"
-{ YDVAR(1, VAR_EXTENDED_STATISTICS) }
+#line 312 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_CLEAN_ADDITIONAL) }
 	YY_BREAK
 case 112:
 YY_RULE_SETUP
-#line 314 "./util/configlexer.lex"
-{ YDVAR(0, VAR_REMOTE_CONTROL) }
+#line 313 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_PERMISSIVE_MODE) }
 	YY_BREAK
 case 113:
 YY_RULE_SETUP
-#line 315 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_ENABLE) }
+#line 314 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IGNORE_CD_FLAG) }
 	YY_BREAK
 case 114:
 YY_RULE_SETUP
-#line 316 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_INTERFACE) }
+#line 315 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_LOG_LEVEL) }
 	YY_BREAK
 case 115:
 YY_RULE_SETUP
-#line 317 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_PORT) }
+#line 316 "./util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_SIZE) }
 	YY_BREAK
 case 116:
 YY_RULE_SETUP
-#line 318 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVER_KEY_FILE) }
+#line 317 "./util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_SLABS) }
 	YY_BREAK
 case 117:
 YY_RULE_SETUP
-#line 319 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVER_CERT_FILE) }
+#line 318 "./util/configlexer.lex"
+{ YDVAR(1, VAR_NEG_CACHE_SIZE) }
 	YY_BREAK
 case 118:
 YY_RULE_SETUP
-#line 320 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_KEY_FILE) }
+#line 319 "./util/configlexer.lex"
+{ 
+				  YDVAR(1, VAR_VAL_NSEC3_KEYSIZE_ITERATIONS) }
 	YY_BREAK
 case 119:
 YY_RULE_SETUP
 #line 321 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_CERT_FILE) }
+{ YDVAR(1, VAR_ADD_HOLDDOWN) }
 	YY_BREAK
 case 120:
 YY_RULE_SETUP
 #line 322 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PYTHON_SCRIPT) }
+{ YDVAR(1, VAR_DEL_HOLDDOWN) }
 	YY_BREAK
 case 121:
 YY_RULE_SETUP
 #line 323 "./util/configlexer.lex"
-{ YDVAR(0, VAR_PYTHON) }
+{ YDVAR(1, VAR_KEEP_MISSING) }
 	YY_BREAK
 case 122:
 YY_RULE_SETUP
 #line 324 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DOMAIN_INSECURE) }
+{ YDVAR(1, VAR_USE_SYSLOG) }
 	YY_BREAK
 case 123:
 YY_RULE_SETUP
 #line 325 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MINIMAL_RESPONSES) }
+{ YDVAR(1, VAR_LOG_TIME_ASCII) }
 	YY_BREAK
 case 124:
 YY_RULE_SETUP
 #line 326 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_ROUNDROBIN) }
+{ YDVAR(1, VAR_LOG_QUERIES) }
 	YY_BREAK
 case 125:
 YY_RULE_SETUP
 #line 327 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_UDP_SIZE) }
+{ YDVAR(2, VAR_LOCAL_ZONE) }
 	YY_BREAK
 case 126:
-/* rule 126 can match eol */
 YY_RULE_SETUP
 #line 328 "./util/configlexer.lex"
-{ LEXOUT(("NL\n")); cfg_parser->line++; }
+{ YDVAR(1, VAR_LOCAL_DATA) }
 	YY_BREAK
-/* Quoted strings. Strip leading and ending quotes */
 case 127:
 YY_RULE_SETUP
+#line 329 "./util/configlexer.lex"
+{ YDVAR(1, VAR_LOCAL_DATA_PTR) }
+	YY_BREAK
+case 128:
+YY_RULE_SETUP
+#line 330 "./util/configlexer.lex"
+{ YDVAR(1, VAR_STATISTICS_INTERVAL) }
+	YY_BREAK
+case 129:
+YY_RULE_SETUP
 #line 331 "./util/configlexer.lex"
+{ YDVAR(1, VAR_STATISTICS_CUMULATIVE) }
+	YY_BREAK
+case 130:
+YY_RULE_SETUP
+#line 332 "./util/configlexer.lex"
+{ YDVAR(1, VAR_EXTENDED_STATISTICS) }
+	YY_BREAK
+case 131:
+YY_RULE_SETUP
+#line 333 "./util/configlexer.lex"
+{ YDVAR(0, VAR_REMOTE_CONTROL) }
+	YY_BREAK
+case 132:
+YY_RULE_SETUP
+#line 334 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CONTROL_ENABLE) }
+	YY_BREAK
+case 133:
+YY_RULE_SETUP
+#line 335 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CONTROL_INTERFACE) }
+	YY_BREAK
+case 134:
+YY_RULE_SETUP
+#line 336 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CONTROL_PORT) }
+	YY_BREAK
+case 135:
+YY_RULE_SETUP
+#line 337 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SERVER_KEY_FILE) }
+	YY_BREAK
+case 136:
+YY_RULE_SETUP
+#line 338 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SERVER_CERT_FILE) }
+	YY_BREAK
+case 137:
+YY_RULE_SETUP
+#line 339 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CONTROL_KEY_FILE) }
+	YY_BREAK
+case 138:
+YY_RULE_SETUP
+#line 340 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CONTROL_CERT_FILE) }
+	YY_BREAK
+case 139:
+YY_RULE_SETUP
+#line 341 "./util/configlexer.lex"
+{ YDVAR(1, VAR_PYTHON_SCRIPT) }
+	YY_BREAK
+case 140:
+YY_RULE_SETUP
+#line 342 "./util/configlexer.lex"
+{ YDVAR(0, VAR_PYTHON) }
+	YY_BREAK
+case 141:
+YY_RULE_SETUP
+#line 343 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DOMAIN_INSECURE) }
+	YY_BREAK
+case 142:
+YY_RULE_SETUP
+#line 344 "./util/configlexer.lex"
+{ YDVAR(1, VAR_MINIMAL_RESPONSES) }
+	YY_BREAK
+case 143:
+YY_RULE_SETUP
+#line 345 "./util/configlexer.lex"
+{ YDVAR(1, VAR_RRSET_ROUNDROBIN) }
+	YY_BREAK
+case 144:
+YY_RULE_SETUP
+#line 346 "./util/configlexer.lex"
+{ YDVAR(1, VAR_MAX_UDP_SIZE) }
+	YY_BREAK
+case 145:
+/* rule 145 can match eol */
+YY_RULE_SETUP
+#line 347 "./util/configlexer.lex"
+{ LEXOUT(("NL\n")); cfg_parser->line++; }
+	YY_BREAK
+/* Quoted strings. Strip leading and ending quotes */
+case 146:
+YY_RULE_SETUP
+#line 350 "./util/configlexer.lex"
 { BEGIN(quotedstring); LEXOUT(("QS ")); }
 	YY_BREAK
 case YY_STATE_EOF(quotedstring):
-#line 332 "./util/configlexer.lex"
+#line 351 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
 	if(--num_args == 0) { BEGIN(INITIAL); }
 	else		    { BEGIN(val); }
 }
 	YY_BREAK
-case 128:
+case 147:
 YY_RULE_SETUP
-#line 337 "./util/configlexer.lex"
+#line 356 "./util/configlexer.lex"
 { LEXOUT(("STR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 129:
-/* rule 129 can match eol */
+case 148:
+/* rule 148 can match eol */
 YY_RULE_SETUP
-#line 338 "./util/configlexer.lex"
+#line 357 "./util/configlexer.lex"
 { yyerror("newline inside quoted string, no end \""); 
 			  cfg_parser->line++; BEGIN(INITIAL); }
 	YY_BREAK
-case 130:
+case 149:
 YY_RULE_SETUP
-#line 340 "./util/configlexer.lex"
+#line 359 "./util/configlexer.lex"
 {
         LEXOUT(("QE "));
 	if(--num_args == 0) { BEGIN(INITIAL); }
@@ -2659,34 +3127,34 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* Single Quoted strings. Strip leading and ending quotes */
-case 131:
+case 150:
 YY_RULE_SETUP
-#line 352 "./util/configlexer.lex"
+#line 371 "./util/configlexer.lex"
 { BEGIN(singlequotedstr); LEXOUT(("SQS ")); }
 	YY_BREAK
 case YY_STATE_EOF(singlequotedstr):
-#line 353 "./util/configlexer.lex"
+#line 372 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
 	if(--num_args == 0) { BEGIN(INITIAL); }
 	else		    { BEGIN(val); }
 }
 	YY_BREAK
-case 132:
+case 151:
 YY_RULE_SETUP
-#line 358 "./util/configlexer.lex"
+#line 377 "./util/configlexer.lex"
 { LEXOUT(("STR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 133:
-/* rule 133 can match eol */
+case 152:
+/* rule 152 can match eol */
 YY_RULE_SETUP
-#line 359 "./util/configlexer.lex"
+#line 378 "./util/configlexer.lex"
 { yyerror("newline inside quoted string, no end '"); 
 			     cfg_parser->line++; BEGIN(INITIAL); }
 	YY_BREAK
-case 134:
+case 153:
 YY_RULE_SETUP
-#line 361 "./util/configlexer.lex"
+#line 380 "./util/configlexer.lex"
 {
         LEXOUT(("SQE "));
 	if(--num_args == 0) { BEGIN(INITIAL); }
@@ -2699,38 +3167,38 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* include: directive */
-case 135:
+case 154:
 YY_RULE_SETUP
-#line 373 "./util/configlexer.lex"
+#line 392 "./util/configlexer.lex"
 { 
 	LEXOUT(("v(%s) ", yytext)); inc_prev = YYSTATE; BEGIN(include); }
 	YY_BREAK
 case YY_STATE_EOF(include):
-#line 375 "./util/configlexer.lex"
+#line 394 "./util/configlexer.lex"
 {
         yyerror("EOF inside include directive");
         BEGIN(inc_prev);
 }
 	YY_BREAK
-case 136:
+case 155:
 YY_RULE_SETUP
-#line 379 "./util/configlexer.lex"
+#line 398 "./util/configlexer.lex"
 { LEXOUT(("ISP ")); /* ignore */ }
 	YY_BREAK
-case 137:
-/* rule 137 can match eol */
+case 156:
+/* rule 156 can match eol */
 YY_RULE_SETUP
-#line 380 "./util/configlexer.lex"
+#line 399 "./util/configlexer.lex"
 { LEXOUT(("NL\n")); cfg_parser->line++;}
 	YY_BREAK
-case 138:
+case 157:
 YY_RULE_SETUP
-#line 381 "./util/configlexer.lex"
+#line 400 "./util/configlexer.lex"
 { LEXOUT(("IQS ")); BEGIN(include_quoted); }
 	YY_BREAK
-case 139:
+case 158:
 YY_RULE_SETUP
-#line 382 "./util/configlexer.lex"
+#line 401 "./util/configlexer.lex"
 {
 	LEXOUT(("Iunquotedstr(%s) ", yytext));
 	config_start_include_glob(yytext);
@@ -2738,27 +3206,27 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 case YY_STATE_EOF(include_quoted):
-#line 387 "./util/configlexer.lex"
+#line 406 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
         BEGIN(inc_prev);
 }
 	YY_BREAK
-case 140:
+case 159:
 YY_RULE_SETUP
-#line 391 "./util/configlexer.lex"
+#line 410 "./util/configlexer.lex"
 { LEXOUT(("ISTR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 141:
-/* rule 141 can match eol */
+case 160:
+/* rule 160 can match eol */
 YY_RULE_SETUP
-#line 392 "./util/configlexer.lex"
+#line 411 "./util/configlexer.lex"
 { yyerror("newline before \" in include name"); 
 				  cfg_parser->line++; BEGIN(inc_prev); }
 	YY_BREAK
-case 142:
+case 161:
 YY_RULE_SETUP
-#line 394 "./util/configlexer.lex"
+#line 413 "./util/configlexer.lex"
 {
 	LEXOUT(("IQE "));
 	yytext[yyleng - 1] = '\0';
@@ -2768,7 +3236,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(val):
-#line 400 "./util/configlexer.lex"
+#line 419 "./util/configlexer.lex"
 {
 	LEXOUT(("LEXEOF "));
 	yy_set_bol(1); /* Set beginning of line, so "^" rules match.  */
@@ -2780,33 +3248,33 @@ case YY_STATE_EOF(val):
 	}
 }
 	YY_BREAK
-case 143:
+case 162:
 YY_RULE_SETUP
-#line 411 "./util/configlexer.lex"
+#line 430 "./util/configlexer.lex"
 { LEXOUT(("unquotedstr(%s) ", yytext)); 
 			if(--num_args == 0) { BEGIN(INITIAL); }
 			yylval.str = strdup(yytext); return STRING_ARG; }
 	YY_BREAK
-case 144:
+case 163:
 YY_RULE_SETUP
-#line 415 "./util/configlexer.lex"
+#line 434 "./util/configlexer.lex"
 {
 	ub_c_error_msg("unknown keyword '%s'", yytext);
 	}
 	YY_BREAK
-case 145:
+case 164:
 YY_RULE_SETUP
-#line 419 "./util/configlexer.lex"
+#line 438 "./util/configlexer.lex"
 {
 	ub_c_error_msg("stray '%s'", yytext);
 	}
 	YY_BREAK
-case 146:
+case 165:
 YY_RULE_SETUP
-#line 423 "./util/configlexer.lex"
+#line 442 "./util/configlexer.lex"
 ECHO;
 	YY_BREAK
-#line 2808 "<stdout>"
+#line 3276 "<stdout>"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -3096,7 +3564,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1383 )
+			if ( yy_current_state >= 2071 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -3124,11 +3592,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1383 )
+		if ( yy_current_state >= 2071 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 1382);
+	yy_is_jam = (yy_current_state == 2070);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -3761,7 +4229,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 423 "./util/configlexer.lex"
+#line 442 "./util/configlexer.lex"
 
 
 
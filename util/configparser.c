@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.6.1.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2012 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,13 +27,17 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.6.1"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -61,8 +66,7 @@
 
 
 
-/* Copy the first part of user declarations.  */
-/* Line 336 of yacc.c  */
+/* First part of user prologue.  */
 #line 38 "./util/configparser.y"
 
 #include "config.h"
@@ -90,378 +94,432 @@ extern struct config_parser_state* cfg_parser;
 #endif
 
 
-/* Line 336 of yacc.c  */
-#line 95 "util/configparser.c"
+#line 98 "util/configparser.c"
 
-# ifndef YY_NULL
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULL nullptr
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define YY_NULL 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
+#include "configparser.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_SPACE = 3,                      /* SPACE  */
+  YYSYMBOL_LETTER = 4,                     /* LETTER  */
+  YYSYMBOL_NEWLINE = 5,                    /* NEWLINE  */
+  YYSYMBOL_COMMENT = 6,                    /* COMMENT  */
+  YYSYMBOL_COLON = 7,                      /* COLON  */
+  YYSYMBOL_ANY = 8,                        /* ANY  */
+  YYSYMBOL_ZONESTR = 9,                    /* ZONESTR  */
+  YYSYMBOL_STRING_ARG = 10,                /* STRING_ARG  */
+  YYSYMBOL_VAR_SERVER = 11,                /* VAR_SERVER  */
+  YYSYMBOL_VAR_VERBOSITY = 12,             /* VAR_VERBOSITY  */
+  YYSYMBOL_VAR_NUM_THREADS = 13,           /* VAR_NUM_THREADS  */
+  YYSYMBOL_VAR_PORT = 14,                  /* VAR_PORT  */
+  YYSYMBOL_VAR_OUTGOING_RANGE = 15,        /* VAR_OUTGOING_RANGE  */
+  YYSYMBOL_VAR_INTERFACE = 16,             /* VAR_INTERFACE  */
+  YYSYMBOL_VAR_DO_IP4 = 17,                /* VAR_DO_IP4  */
+  YYSYMBOL_VAR_DO_IP6 = 18,                /* VAR_DO_IP6  */
+  YYSYMBOL_VAR_DO_UDP = 19,                /* VAR_DO_UDP  */
+  YYSYMBOL_VAR_DO_TCP = 20,                /* VAR_DO_TCP  */
+  YYSYMBOL_VAR_CHROOT = 21,                /* VAR_CHROOT  */
+  YYSYMBOL_VAR_USERNAME = 22,              /* VAR_USERNAME  */
+  YYSYMBOL_VAR_DIRECTORY = 23,             /* VAR_DIRECTORY  */
+  YYSYMBOL_VAR_LOGFILE = 24,               /* VAR_LOGFILE  */
+  YYSYMBOL_VAR_PIDFILE = 25,               /* VAR_PIDFILE  */
+  YYSYMBOL_VAR_MSG_CACHE_SIZE = 26,        /* VAR_MSG_CACHE_SIZE  */
+  YYSYMBOL_VAR_MSG_CACHE_SLABS = 27,       /* VAR_MSG_CACHE_SLABS  */
+  YYSYMBOL_VAR_NUM_QUERIES_PER_THREAD = 28, /* VAR_NUM_QUERIES_PER_THREAD  */
+  YYSYMBOL_VAR_RRSET_CACHE_SIZE = 29,      /* VAR_RRSET_CACHE_SIZE  */
+  YYSYMBOL_VAR_RRSET_CACHE_SLABS = 30,     /* VAR_RRSET_CACHE_SLABS  */
+  YYSYMBOL_VAR_OUTGOING_NUM_TCP = 31,      /* VAR_OUTGOING_NUM_TCP  */
+  YYSYMBOL_VAR_INFRA_HOST_TTL = 32,        /* VAR_INFRA_HOST_TTL  */
+  YYSYMBOL_VAR_INFRA_LAME_TTL = 33,        /* VAR_INFRA_LAME_TTL  */
+  YYSYMBOL_VAR_INFRA_CACHE_SLABS = 34,     /* VAR_INFRA_CACHE_SLABS  */
+  YYSYMBOL_VAR_INFRA_CACHE_NUMHOSTS = 35,  /* VAR_INFRA_CACHE_NUMHOSTS  */
+  YYSYMBOL_VAR_INFRA_CACHE_LAME_SIZE = 36, /* VAR_INFRA_CACHE_LAME_SIZE  */
+  YYSYMBOL_VAR_NAME = 37,                  /* VAR_NAME  */
+  YYSYMBOL_VAR_STUB_ZONE = 38,             /* VAR_STUB_ZONE  */
+  YYSYMBOL_VAR_STUB_HOST = 39,             /* VAR_STUB_HOST  */
+  YYSYMBOL_VAR_STUB_ADDR = 40,             /* VAR_STUB_ADDR  */
+  YYSYMBOL_VAR_TARGET_FETCH_POLICY = 41,   /* VAR_TARGET_FETCH_POLICY  */
+  YYSYMBOL_VAR_HARDEN_SHORT_BUFSIZE = 42,  /* VAR_HARDEN_SHORT_BUFSIZE  */
+  YYSYMBOL_VAR_HARDEN_LARGE_QUERIES = 43,  /* VAR_HARDEN_LARGE_QUERIES  */
+  YYSYMBOL_VAR_FORWARD_ZONE = 44,          /* VAR_FORWARD_ZONE  */
+  YYSYMBOL_VAR_FORWARD_HOST = 45,          /* VAR_FORWARD_HOST  */
+  YYSYMBOL_VAR_FORWARD_ADDR = 46,          /* VAR_FORWARD_ADDR  */
+  YYSYMBOL_VAR_DO_NOT_QUERY_ADDRESS = 47,  /* VAR_DO_NOT_QUERY_ADDRESS  */
+  YYSYMBOL_VAR_HIDE_IDENTITY = 48,         /* VAR_HIDE_IDENTITY  */
+  YYSYMBOL_VAR_HIDE_VERSION = 49,          /* VAR_HIDE_VERSION  */
+  YYSYMBOL_VAR_IDENTITY = 50,              /* VAR_IDENTITY  */
+  YYSYMBOL_VAR_VERSION = 51,               /* VAR_VERSION  */
+  YYSYMBOL_VAR_HARDEN_GLUE = 52,           /* VAR_HARDEN_GLUE  */
+  YYSYMBOL_VAR_MODULE_CONF = 53,           /* VAR_MODULE_CONF  */
+  YYSYMBOL_VAR_TRUST_ANCHOR_FILE = 54,     /* VAR_TRUST_ANCHOR_FILE  */
+  YYSYMBOL_VAR_TRUST_ANCHOR = 55,          /* VAR_TRUST_ANCHOR  */
+  YYSYMBOL_VAR_VAL_OVERRIDE_DATE = 56,     /* VAR_VAL_OVERRIDE_DATE  */
+  YYSYMBOL_VAR_BOGUS_TTL = 57,             /* VAR_BOGUS_TTL  */
+  YYSYMBOL_VAR_VAL_CLEAN_ADDITIONAL = 58,  /* VAR_VAL_CLEAN_ADDITIONAL  */
+  YYSYMBOL_VAR_VAL_PERMISSIVE_MODE = 59,   /* VAR_VAL_PERMISSIVE_MODE  */
+  YYSYMBOL_VAR_INCOMING_NUM_TCP = 60,      /* VAR_INCOMING_NUM_TCP  */
+  YYSYMBOL_VAR_MSG_BUFFER_SIZE = 61,       /* VAR_MSG_BUFFER_SIZE  */
+  YYSYMBOL_VAR_KEY_CACHE_SIZE = 62,        /* VAR_KEY_CACHE_SIZE  */
+  YYSYMBOL_VAR_KEY_CACHE_SLABS = 63,       /* VAR_KEY_CACHE_SLABS  */
+  YYSYMBOL_VAR_TRUSTED_KEYS_FILE = 64,     /* VAR_TRUSTED_KEYS_FILE  */
+  YYSYMBOL_VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 65, /* VAR_VAL_NSEC3_KEYSIZE_ITERATIONS  */
+  YYSYMBOL_VAR_USE_SYSLOG = 66,            /* VAR_USE_SYSLOG  */
+  YYSYMBOL_VAR_OUTGOING_INTERFACE = 67,    /* VAR_OUTGOING_INTERFACE  */
+  YYSYMBOL_VAR_ROOT_HINTS = 68,            /* VAR_ROOT_HINTS  */
+  YYSYMBOL_VAR_DO_NOT_QUERY_LOCALHOST = 69, /* VAR_DO_NOT_QUERY_LOCALHOST  */
+  YYSYMBOL_VAR_CACHE_MAX_TTL = 70,         /* VAR_CACHE_MAX_TTL  */
+  YYSYMBOL_VAR_HARDEN_DNSSEC_STRIPPED = 71, /* VAR_HARDEN_DNSSEC_STRIPPED  */
+  YYSYMBOL_VAR_ACCESS_CONTROL = 72,        /* VAR_ACCESS_CONTROL  */
+  YYSYMBOL_VAR_LOCAL_ZONE = 73,            /* VAR_LOCAL_ZONE  */
+  YYSYMBOL_VAR_LOCAL_DATA = 74,            /* VAR_LOCAL_DATA  */
+  YYSYMBOL_VAR_INTERFACE_AUTOMATIC = 75,   /* VAR_INTERFACE_AUTOMATIC  */
+  YYSYMBOL_VAR_STATISTICS_INTERVAL = 76,   /* VAR_STATISTICS_INTERVAL  */
+  YYSYMBOL_VAR_DO_DAEMONIZE = 77,          /* VAR_DO_DAEMONIZE  */
+  YYSYMBOL_VAR_USE_CAPS_FOR_ID = 78,       /* VAR_USE_CAPS_FOR_ID  */
+  YYSYMBOL_VAR_STATISTICS_CUMULATIVE = 79, /* VAR_STATISTICS_CUMULATIVE  */
+  YYSYMBOL_VAR_OUTGOING_PORT_PERMIT = 80,  /* VAR_OUTGOING_PORT_PERMIT  */
+  YYSYMBOL_VAR_OUTGOING_PORT_AVOID = 81,   /* VAR_OUTGOING_PORT_AVOID  */
+  YYSYMBOL_VAR_DLV_ANCHOR_FILE = 82,       /* VAR_DLV_ANCHOR_FILE  */
+  YYSYMBOL_VAR_DLV_ANCHOR = 83,            /* VAR_DLV_ANCHOR  */
+  YYSYMBOL_VAR_NEG_CACHE_SIZE = 84,        /* VAR_NEG_CACHE_SIZE  */
+  YYSYMBOL_VAR_HARDEN_REFERRAL_PATH = 85,  /* VAR_HARDEN_REFERRAL_PATH  */
+  YYSYMBOL_VAR_PRIVATE_ADDRESS = 86,       /* VAR_PRIVATE_ADDRESS  */
+  YYSYMBOL_VAR_PRIVATE_DOMAIN = 87,        /* VAR_PRIVATE_DOMAIN  */
+  YYSYMBOL_VAR_REMOTE_CONTROL = 88,        /* VAR_REMOTE_CONTROL  */
+  YYSYMBOL_VAR_CONTROL_ENABLE = 89,        /* VAR_CONTROL_ENABLE  */
+  YYSYMBOL_VAR_CONTROL_INTERFACE = 90,     /* VAR_CONTROL_INTERFACE  */
+  YYSYMBOL_VAR_CONTROL_PORT = 91,          /* VAR_CONTROL_PORT  */
+  YYSYMBOL_VAR_SERVER_KEY_FILE = 92,       /* VAR_SERVER_KEY_FILE  */
+  YYSYMBOL_VAR_SERVER_CERT_FILE = 93,      /* VAR_SERVER_CERT_FILE  */
+  YYSYMBOL_VAR_CONTROL_KEY_FILE = 94,      /* VAR_CONTROL_KEY_FILE  */
+  YYSYMBOL_VAR_CONTROL_CERT_FILE = 95,     /* VAR_CONTROL_CERT_FILE  */
+  YYSYMBOL_VAR_EXTENDED_STATISTICS = 96,   /* VAR_EXTENDED_STATISTICS  */
+  YYSYMBOL_VAR_LOCAL_DATA_PTR = 97,        /* VAR_LOCAL_DATA_PTR  */
+  YYSYMBOL_VAR_JOSTLE_TIMEOUT = 98,        /* VAR_JOSTLE_TIMEOUT  */
+  YYSYMBOL_VAR_STUB_PRIME = 99,            /* VAR_STUB_PRIME  */
+  YYSYMBOL_VAR_UNWANTED_REPLY_THRESHOLD = 100, /* VAR_UNWANTED_REPLY_THRESHOLD  */
+  YYSYMBOL_VAR_LOG_TIME_ASCII = 101,       /* VAR_LOG_TIME_ASCII  */
+  YYSYMBOL_VAR_DOMAIN_INSECURE = 102,      /* VAR_DOMAIN_INSECURE  */
+  YYSYMBOL_VAR_PYTHON = 103,               /* VAR_PYTHON  */
+  YYSYMBOL_VAR_PYTHON_SCRIPT = 104,        /* VAR_PYTHON_SCRIPT  */
+  YYSYMBOL_VAR_VAL_SIG_SKEW_MIN = 105,     /* VAR_VAL_SIG_SKEW_MIN  */
+  YYSYMBOL_VAR_VAL_SIG_SKEW_MAX = 106,     /* VAR_VAL_SIG_SKEW_MAX  */
+  YYSYMBOL_VAR_CACHE_MIN_TTL = 107,        /* VAR_CACHE_MIN_TTL  */
+  YYSYMBOL_VAR_VAL_LOG_LEVEL = 108,        /* VAR_VAL_LOG_LEVEL  */
+  YYSYMBOL_VAR_AUTO_TRUST_ANCHOR_FILE = 109, /* VAR_AUTO_TRUST_ANCHOR_FILE  */
+  YYSYMBOL_VAR_KEEP_MISSING = 110,         /* VAR_KEEP_MISSING  */
+  YYSYMBOL_VAR_ADD_HOLDDOWN = 111,         /* VAR_ADD_HOLDDOWN  */
+  YYSYMBOL_VAR_DEL_HOLDDOWN = 112,         /* VAR_DEL_HOLDDOWN  */
+  YYSYMBOL_VAR_SO_RCVBUF = 113,            /* VAR_SO_RCVBUF  */
+  YYSYMBOL_VAR_EDNS_BUFFER_SIZE = 114,     /* VAR_EDNS_BUFFER_SIZE  */
+  YYSYMBOL_VAR_PREFETCH = 115,             /* VAR_PREFETCH  */
+  YYSYMBOL_VAR_PREFETCH_KEY = 116,         /* VAR_PREFETCH_KEY  */
+  YYSYMBOL_VAR_SO_SNDBUF = 117,            /* VAR_SO_SNDBUF  */
+  YYSYMBOL_VAR_SO_REUSEPORT = 118,         /* VAR_SO_REUSEPORT  */
+  YYSYMBOL_VAR_HARDEN_BELOW_NXDOMAIN = 119, /* VAR_HARDEN_BELOW_NXDOMAIN  */
+  YYSYMBOL_VAR_IGNORE_CD_FLAG = 120,       /* VAR_IGNORE_CD_FLAG  */
+  YYSYMBOL_VAR_LOG_QUERIES = 121,          /* VAR_LOG_QUERIES  */
+  YYSYMBOL_VAR_TCP_UPSTREAM = 122,         /* VAR_TCP_UPSTREAM  */
+  YYSYMBOL_VAR_SSL_UPSTREAM = 123,         /* VAR_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_SSL_SERVICE_KEY = 124,      /* VAR_SSL_SERVICE_KEY  */
+  YYSYMBOL_VAR_SSL_SERVICE_PEM = 125,      /* VAR_SSL_SERVICE_PEM  */
+  YYSYMBOL_VAR_SSL_PORT = 126,             /* VAR_SSL_PORT  */
+  YYSYMBOL_VAR_FORWARD_FIRST = 127,        /* VAR_FORWARD_FIRST  */
+  YYSYMBOL_VAR_STUB_FIRST = 128,           /* VAR_STUB_FIRST  */
+  YYSYMBOL_VAR_MINIMAL_RESPONSES = 129,    /* VAR_MINIMAL_RESPONSES  */
+  YYSYMBOL_VAR_RRSET_ROUNDROBIN = 130,     /* VAR_RRSET_ROUNDROBIN  */
+  YYSYMBOL_VAR_MAX_UDP_SIZE = 131,         /* VAR_MAX_UDP_SIZE  */
+  YYSYMBOL_VAR_DELAY_CLOSE = 132,          /* VAR_DELAY_CLOSE  */
+  YYSYMBOL_VAR_TCP_IDLE_TIMEOUT = 133,     /* VAR_TCP_IDLE_TIMEOUT  */
+  YYSYMBOL_VAR_SSL_SESSION_TICKET_KEYS = 134, /* VAR_SSL_SESSION_TICKET_KEYS  */
+  YYSYMBOL_VAR_TCP_FASTOPEN = 135,         /* VAR_TCP_FASTOPEN  */
+  YYSYMBOL_VAR_TCP_UPSTREAM_FASTOPEN = 136, /* VAR_TCP_UPSTREAM_FASTOPEN  */
+  YYSYMBOL_VAR_RRL_RATELIMIT = 137,        /* VAR_RRL_RATELIMIT  */
+  YYSYMBOL_VAR_RRL_SLIP = 138,             /* VAR_RRL_SLIP  */
+  YYSYMBOL_VAR_RRL_IPV4_PREFIX = 139,      /* VAR_RRL_IPV4_PREFIX  */
+  YYSYMBOL_VAR_RRL_IPV6_PREFIX = 140,      /* VAR_RRL_IPV6_PREFIX  */
+  YYSYMBOL_VAR_RRL_SIZE = 141,             /* VAR_RRL_SIZE  */
+  YYSYMBOL_VAR_UPSTREAM_ZONE_RATELIMIT = 142, /* VAR_UPSTREAM_ZONE_RATELIMIT  */
+  YYSYMBOL_VAR_UPSTREAM_SERVER_RATELIMIT = 143, /* VAR_UPSTREAM_SERVER_RATELIMIT  */
+  YYSYMBOL_VAR_UPSTREAM_RATELIMIT_SIZE = 144, /* VAR_UPSTREAM_RATELIMIT_SIZE  */
+  YYSYMBOL_VAR_REGION_PRESIZE = 145,       /* VAR_REGION_PRESIZE  */
+  YYSYMBOL_VAR_CACHE_HUGEPAGES = 146,      /* VAR_CACHE_HUGEPAGES  */
+  YYSYMBOL_VAR_CACHE_ADMISSION_FILTER = 147, /* VAR_CACHE_ADMISSION_FILTER  */
+  YYSYMBOL_VAR_CACHE_EXPIRY_SCAN = 148,    /* VAR_CACHE_EXPIRY_SCAN  */
+  YYSYMBOL_VAR_PREFETCH_POPULAR = 149,     /* VAR_PREFETCH_POPULAR  */
+  YYSYMBOL_VAR_PREFETCH_POPULAR_RATE = 150, /* VAR_PREFETCH_POPULAR_RATE  */
+  YYSYMBOL_VAR_MSG_CACHE_L1_SLOTS = 151,   /* VAR_MSG_CACHE_L1_SLOTS  */
+  YYSYMBOL_YYACCEPT = 152,                 /* $accept  */
+  YYSYMBOL_toplevelvars = 153,             /* toplevelvars  */
+  YYSYMBOL_toplevelvar = 154,              /* toplevelvar  */
+  YYSYMBOL_serverstart = 155,              /* serverstart  */
+  YYSYMBOL_contents_server = 156,          /* contents_server  */
+  YYSYMBOL_content_server = 157,           /* content_server  */
+  YYSYMBOL_stubstart = 158,                /* stubstart  */
+  YYSYMBOL_contents_stub = 159,            /* contents_stub  */
+  YYSYMBOL_content_stub = 160,             /* content_stub  */
+  YYSYMBOL_forwardstart = 161,             /* forwardstart  */
+  YYSYMBOL_contents_forward = 162,         /* contents_forward  */
+  YYSYMBOL_content_forward = 163,          /* content_forward  */
+  YYSYMBOL_server_num_threads = 164,       /* server_num_threads  */
+  YYSYMBOL_server_verbosity = 165,         /* server_verbosity  */
+  YYSYMBOL_server_statistics_interval = 166, /* server_statistics_interval  */
+  YYSYMBOL_server_statistics_cumulative = 167, /* server_statistics_cumulative  */
+  YYSYMBOL_server_extended_statistics = 168, /* server_extended_statistics  */
+  YYSYMBOL_server_port = 169,              /* server_port  */
+  YYSYMBOL_server_interface = 170,         /* server_interface  */
+  YYSYMBOL_server_outgoing_interface = 171, /* server_outgoing_interface  */
+  YYSYMBOL_server_outgoing_range = 172,    /* server_outgoing_range  */
+  YYSYMBOL_server_outgoing_port_permit = 173, /* server_outgoing_port_permit  */
+  YYSYMBOL_server_outgoing_port_avoid = 174, /* server_outgoing_port_avoid  */
+  YYSYMBOL_server_outgoing_num_tcp = 175,  /* server_outgoing_num_tcp  */
+  YYSYMBOL_server_incoming_num_tcp = 176,  /* server_incoming_num_tcp  */
+  YYSYMBOL_server_interface_automatic = 177, /* server_interface_automatic  */
+  YYSYMBOL_server_do_ip4 = 178,            /* server_do_ip4  */
+  YYSYMBOL_server_do_ip6 = 179,            /* server_do_ip6  */
+  YYSYMBOL_server_do_udp = 180,            /* server_do_udp  */
+  YYSYMBOL_server_do_tcp = 181,            /* server_do_tcp  */
+  YYSYMBOL_server_tcp_upstream = 182,      /* server_tcp_upstream  */
+  YYSYMBOL_server_ssl_upstream = 183,      /* server_ssl_upstream  */
+  YYSYMBOL_server_ssl_service_key = 184,   /* server_ssl_service_key  */
+  YYSYMBOL_server_ssl_service_pem = 185,   /* server_ssl_service_pem  */
+  YYSYMBOL_server_ssl_session_ticket_keys = 186, /* server_ssl_session_ticket_keys  */
+  YYSYMBOL_server_ssl_port = 187,          /* server_ssl_port  */
+  YYSYMBOL_server_do_daemonize = 188,      /* server_do_daemonize  */
+  YYSYMBOL_server_use_syslog = 189,        /* server_use_syslog  */
+  YYSYMBOL_server_log_time_ascii = 190,    /* server_log_time_ascii  */
+  YYSYMBOL_server_log_queries = 191,       /* server_log_queries  */
+  YYSYMBOL_server_chroot = 192,            /* server_chroot  */
+  YYSYMBOL_server_username = 193,          /* server_username  */
+  YYSYMBOL_server_directory = 194,         /* server_directory  */
+  YYSYMBOL_server_logfile = 195,           /* server_logfile  */
+  YYSYMBOL_server_pidfile = 196,           /* server_pidfile  */
+  YYSYMBOL_server_root_hints = 197,        /* server_root_hints  */
+  YYSYMBOL_server_dlv_anchor_file = 198,   /* server_dlv_anchor_file  */
+  YYSYMBOL_server_dlv_anchor = 199,        /* server_dlv_anchor  */
+  YYSYMBOL_server_auto_trust_anchor_file = 200, /* server_auto_trust_anchor_file  */
+  YYSYMBOL_server_trust_anchor_file = 201, /* server_trust_anchor_file  */
+  YYSYMBOL_server_trusted_keys_file = 202, /* server_trusted_keys_file  */
+  YYSYMBOL_server_trust_anchor = 203,      /* server_trust_anchor  */
+  YYSYMBOL_server_domain_insecure = 204,   /* server_domain_insecure  */
+  YYSYMBOL_server_hide_identity = 205,     /* server_hide_identity  */
+  YYSYMBOL_server_hide_version = 206,      /* server_hide_version  */
+  YYSYMBOL_server_identity = 207,          /* server_identity  */
+  YYSYMBOL_server_version = 208,           /* server_version  */
+  YYSYMBOL_server_so_rcvbuf = 209,         /* server_so_rcvbuf  */
+  YYSYMBOL_server_so_sndbuf = 210,         /* server_so_sndbuf  */
+  YYSYMBOL_server_so_reuseport = 211,      /* server_so_reuseport  */
+  YYSYMBOL_server_edns_buffer_size = 212,  /* server_edns_buffer_size  */
+  YYSYMBOL_server_msg_buffer_size = 213,   /* server_msg_buffer_size  */
+  YYSYMBOL_server_msg_cache_size = 214,    /* server_msg_cache_size  */
+  YYSYMBOL_server_msg_cache_slabs = 215,   /* server_msg_cache_slabs  */
+  YYSYMBOL_server_msg_cache_l1_slots = 216, /* server_msg_cache_l1_slots  */
+  YYSYMBOL_server_num_queries_per_thread = 217, /* server_num_queries_per_thread  */
+  YYSYMBOL_server_jostle_timeout = 218,    /* server_jostle_timeout  */
+  YYSYMBOL_server_delay_close = 219,       /* server_delay_close  */
+  YYSYMBOL_server_tcp_idle_timeout = 220,  /* server_tcp_idle_timeout  */
+  YYSYMBOL_server_tcp_fastopen = 221,      /* server_tcp_fastopen  */
+  YYSYMBOL_server_tcp_upstream_fastopen = 222, /* server_tcp_upstream_fastopen  */
+  YYSYMBOL_server_rrl_ratelimit = 223,     /* server_rrl_ratelimit  */
+  YYSYMBOL_server_rrl_slip = 224,          /* server_rrl_slip  */
+  YYSYMBOL_server_rrl_ipv4_prefix = 225,   /* server_rrl_ipv4_prefix  */
+  YYSYMBOL_server_rrl_ipv6_prefix = 226,   /* server_rrl_ipv6_prefix  */
+  YYSYMBOL_server_rrl_size = 227,          /* server_rrl_size  */
+  YYSYMBOL_server_upstream_zone_ratelimit = 228, /* server_upstream_zone_ratelimit  */
+  YYSYMBOL_server_upstream_server_ratelimit = 229, /* server_upstream_server_ratelimit  */
+  YYSYMBOL_server_upstream_ratelimit_size = 230, /* server_upstream_ratelimit_size  */
+  YYSYMBOL_server_region_presize = 231,    /* server_region_presize  */
+  YYSYMBOL_server_cache_hugepages = 232,   /* server_cache_hugepages  */
+  YYSYMBOL_server_cache_admission_filter = 233, /* server_cache_admission_filter  */
+  YYSYMBOL_server_cache_expiry_scan = 234, /* server_cache_expiry_scan  */
+  YYSYMBOL_server_rrset_cache_size = 235,  /* server_rrset_cache_size  */
+  YYSYMBOL_server_rrset_cache_slabs = 236, /* server_rrset_cache_slabs  */
+  YYSYMBOL_server_infra_host_ttl = 237,    /* server_infra_host_ttl  */
+  YYSYMBOL_server_infra_lame_ttl = 238,    /* server_infra_lame_ttl  */
+  YYSYMBOL_server_infra_cache_numhosts = 239, /* server_infra_cache_numhosts  */
+  YYSYMBOL_server_infra_cache_lame_size = 240, /* server_infra_cache_lame_size  */
+  YYSYMBOL_server_infra_cache_slabs = 241, /* server_infra_cache_slabs  */
+  YYSYMBOL_server_target_fetch_policy = 242, /* server_target_fetch_policy  */
+  YYSYMBOL_server_harden_short_bufsize = 243, /* server_harden_short_bufsize  */
+  YYSYMBOL_server_harden_large_queries = 244, /* server_harden_large_queries  */
+  YYSYMBOL_server_harden_glue = 245,       /* server_harden_glue  */
+  YYSYMBOL_server_harden_dnssec_stripped = 246, /* server_harden_dnssec_stripped  */
+  YYSYMBOL_server_harden_below_nxdomain = 247, /* server_harden_below_nxdomain  */
+  YYSYMBOL_server_harden_referral_path = 248, /* server_harden_referral_path  */
+  YYSYMBOL_server_use_caps_for_id = 249,   /* server_use_caps_for_id  */
+  YYSYMBOL_server_private_address = 250,   /* server_private_address  */
+  YYSYMBOL_server_private_domain = 251,    /* server_private_domain  */
+  YYSYMBOL_server_prefetch = 252,          /* server_prefetch  */
+  YYSYMBOL_server_prefetch_key = 253,      /* server_prefetch_key  */
+  YYSYMBOL_server_prefetch_popular = 254,  /* server_prefetch_popular  */
+  YYSYMBOL_server_prefetch_popular_rate = 255, /* server_prefetch_popular_rate  */
+  YYSYMBOL_server_unwanted_reply_threshold = 256, /* server_unwanted_reply_threshold  */
+  YYSYMBOL_server_do_not_query_address = 257, /* server_do_not_query_address  */
+  YYSYMBOL_server_do_not_query_localhost = 258, /* server_do_not_query_localhost  */
+  YYSYMBOL_server_access_control = 259,    /* server_access_control  */
+  YYSYMBOL_server_module_conf = 260,       /* server_module_conf  */
+  YYSYMBOL_server_val_override_date = 261, /* server_val_override_date  */
+  YYSYMBOL_server_val_sig_skew_min = 262,  /* server_val_sig_skew_min  */
+  YYSYMBOL_server_val_sig_skew_max = 263,  /* server_val_sig_skew_max  */
+  YYSYMBOL_server_cache_max_ttl = 264,     /* server_cache_max_ttl  */
+  YYSYMBOL_server_cache_min_ttl = 265,     /* server_cache_min_ttl  */
+  YYSYMBOL_server_bogus_ttl = 266,         /* server_bogus_ttl  */
+  YYSYMBOL_server_val_clean_additional = 267, /* server_val_clean_additional  */
+  YYSYMBOL_server_val_permissive_mode = 268, /* server_val_permissive_mode  */
+  YYSYMBOL_server_ignore_cd_flag = 269,    /* server_ignore_cd_flag  */
+  YYSYMBOL_server_val_log_level = 270,     /* server_val_log_level  */
+  YYSYMBOL_server_val_nsec3_keysize_iterations = 271, /* server_val_nsec3_keysize_iterations  */
+  YYSYMBOL_server_add_holddown = 272,      /* server_add_holddown  */
+  YYSYMBOL_server_del_holddown = 273,      /* server_del_holddown  */
+  YYSYMBOL_server_keep_missing = 274,      /* server_keep_missing  */
+  YYSYMBOL_server_key_cache_size = 275,    /* server_key_cache_size  */
+  YYSYMBOL_server_key_cache_slabs = 276,   /* server_key_cache_slabs  */
+  YYSYMBOL_server_neg_cache_size = 277,    /* server_neg_cache_size  */
+  YYSYMBOL_server_local_zone = 278,        /* server_local_zone  */
+  YYSYMBOL_server_local_data = 279,        /* server_local_data  */
+  YYSYMBOL_server_local_data_ptr = 280,    /* server_local_data_ptr  */
+  YYSYMBOL_server_minimal_responses = 281, /* server_minimal_responses  */
+  YYSYMBOL_server_rrset_roundrobin = 282,  /* server_rrset_roundrobin  */
+  YYSYMBOL_server_max_udp_size = 283,      /* server_max_udp_size  */
+  YYSYMBOL_stub_name = 284,                /* stub_name  */
+  YYSYMBOL_stub_host = 285,                /* stub_host  */
+  YYSYMBOL_stub_addr = 286,                /* stub_addr  */
+  YYSYMBOL_stub_first = 287,               /* stub_first  */
+  YYSYMBOL_stub_prime = 288,               /* stub_prime  */
+  YYSYMBOL_forward_name = 289,             /* forward_name  */
+  YYSYMBOL_forward_host = 290,             /* forward_host  */
+  YYSYMBOL_forward_addr = 291,             /* forward_addr  */
+  YYSYMBOL_forward_first = 292,            /* forward_first  */
+  YYSYMBOL_rcstart = 293,                  /* rcstart  */
+  YYSYMBOL_contents_rc = 294,              /* contents_rc  */
+  YYSYMBOL_content_rc = 295,               /* content_rc  */
+  YYSYMBOL_rc_control_enable = 296,        /* rc_control_enable  */
+  YYSYMBOL_rc_control_port = 297,          /* rc_control_port  */
+  YYSYMBOL_rc_control_interface = 298,     /* rc_control_interface  */
+  YYSYMBOL_rc_server_key_file = 299,       /* rc_server_key_file  */
+  YYSYMBOL_rc_server_cert_file = 300,      /* rc_server_cert_file  */
+  YYSYMBOL_rc_control_key_file = 301,      /* rc_control_key_file  */
+  YYSYMBOL_rc_control_cert_file = 302,     /* rc_control_cert_file  */
+  YYSYMBOL_pythonstart = 303,              /* pythonstart  */
+  YYSYMBOL_contents_py = 304,              /* contents_py  */
+  YYSYMBOL_content_py = 305,               /* content_py  */
+  YYSYMBOL_py_script = 306                 /* py_script  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-/* In a future release of Bison, this section will be replaced
-   by #include "configparser.h".  */
-#ifndef YY_UTIL_CONFIGPARSER_H
-# define YY_UTIL_CONFIGPARSER_H
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-#if YYDEBUG
-extern int yydebug;
-#endif
 
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     SPACE = 258,
-     LETTER = 259,
-     NEWLINE = 260,
-     COMMENT = 261,
-     COLON = 262,
-     ANY = 263,
-     ZONESTR = 264,
-     STRING_ARG = 265,
-     VAR_SERVER = 266,
-     VAR_VERBOSITY = 267,
-     VAR_NUM_THREADS = 268,
-     VAR_PORT = 269,
-     VAR_OUTGOING_RANGE = 270,
-     VAR_INTERFACE = 271,
-     VAR_DO_IP4 = 272,
-     VAR_DO_IP6 = 273,
-     VAR_DO_UDP = 274,
-     VAR_DO_TCP = 275,
-     VAR_CHROOT = 276,
-     VAR_USERNAME = 277,
-     VAR_DIRECTORY = 278,
-     VAR_LOGFILE = 279,
-     VAR_PIDFILE = 280,
-     VAR_MSG_CACHE_SIZE = 281,
-     VAR_MSG_CACHE_SLABS = 282,
-     VAR_NUM_QUERIES_PER_THREAD = 283,
-     VAR_RRSET_CACHE_SIZE = 284,
-     VAR_RRSET_CACHE_SLABS = 285,
-     VAR_OUTGOING_NUM_TCP = 286,
-     VAR_INFRA_HOST_TTL = 287,
-     VAR_INFRA_LAME_TTL = 288,
-     VAR_INFRA_CACHE_SLABS = 289,
-     VAR_INFRA_CACHE_NUMHOSTS = 290,
-     VAR_INFRA_CACHE_LAME_SIZE = 291,
-     VAR_NAME = 292,
-     VAR_STUB_ZONE = 293,
-     VAR_STUB_HOST = 294,
-     VAR_STUB_ADDR = 295,
-     VAR_TARGET_FETCH_POLICY = 296,
-     VAR_HARDEN_SHORT_BUFSIZE = 297,
-     VAR_HARDEN_LARGE_QUERIES = 298,
-     VAR_FORWARD_ZONE = 299,
-     VAR_FORWARD_HOST = 300,
-     VAR_FORWARD_ADDR = 301,
-     VAR_DO_NOT_QUERY_ADDRESS = 302,
-     VAR_HIDE_IDENTITY = 303,
-     VAR_HIDE_VERSION = 304,
-     VAR_IDENTITY = 305,
-     VAR_VERSION = 306,
-     VAR_HARDEN_GLUE = 307,
-     VAR_MODULE_CONF = 308,
-     VAR_TRUST_ANCHOR_FILE = 309,
-     VAR_TRUST_ANCHOR = 310,
-     VAR_VAL_OVERRIDE_DATE = 311,
-     VAR_BOGUS_TTL = 312,
-     VAR_VAL_CLEAN_ADDITIONAL = 313,
-     VAR_VAL_PERMISSIVE_MODE = 314,
-     VAR_INCOMING_NUM_TCP = 315,
-     VAR_MSG_BUFFER_SIZE = 316,
-     VAR_KEY_CACHE_SIZE = 317,
-     VAR_KEY_CACHE_SLABS = 318,
-     VAR_TRUSTED_KEYS_FILE = 319,
-     VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 320,
-     VAR_USE_SYSLOG = 321,
-     VAR_OUTGOING_INTERFACE = 322,
-     VAR_ROOT_HINTS = 323,
-     VAR_DO_NOT_QUERY_LOCALHOST = 324,
-     VAR_CACHE_MAX_TTL = 325,
-     VAR_HARDEN_DNSSEC_STRIPPED = 326,
-     VAR_ACCESS_CONTROL = 327,
-     VAR_LOCAL_ZONE = 328,
-     VAR_LOCAL_DATA = 329,
-     VAR_INTERFACE_AUTOMATIC = 330,
-     VAR_STATISTICS_INTERVAL = 331,
-     VAR_DO_DAEMONIZE = 332,
-     VAR_USE_CAPS_FOR_ID = 333,
-     VAR_STATISTICS_CUMULATIVE = 334,
-     VAR_OUTGOING_PORT_PERMIT = 335,
-     VAR_OUTGOING_PORT_AVOID = 336,
-     VAR_DLV_ANCHOR_FILE = 337,
-     VAR_DLV_ANCHOR = 338,
-     VAR_NEG_CACHE_SIZE = 339,
-     VAR_HARDEN_REFERRAL_PATH = 340,
-     VAR_PRIVATE_ADDRESS = 341,
-     VAR_PRIVATE_DOMAIN = 342,
-     VAR_REMOTE_CONTROL = 343,
-     VAR_CONTROL_ENABLE = 344,
-     VAR_CONTROL_INTERFACE = 345,
-     VAR_CONTROL_PORT = 346,
-     VAR_SERVER_KEY_FILE = 347,
-     VAR_SERVER_CERT_FILE = 348,
-     VAR_CONTROL_KEY_FILE = 349,
-     VAR_CONTROL_CERT_FILE = 350,
-     VAR_EXTENDED_STATISTICS = 351,
-     VAR_LOCAL_DATA_PTR = 352,
-     VAR_JOSTLE_TIMEOUT = 353,
-     VAR_STUB_PRIME = 354,
-     VAR_UNWANTED_REPLY_THRESHOLD = 355,
-     VAR_LOG_TIME_ASCII = 356,
-     VAR_DOMAIN_INSECURE = 357,
-     VAR_PYTHON = 358,
-     VAR_PYTHON_SCRIPT = 359,
-     VAR_VAL_SIG_SKEW_MIN = 360,
-     VAR_VAL_SIG_SKEW_MAX = 361,
-     VAR_CACHE_MIN_TTL = 362,
-     VAR_VAL_LOG_LEVEL = 363,
-     VAR_AUTO_TRUST_ANCHOR_FILE = 364,
-     VAR_KEEP_MISSING = 365,
-     VAR_ADD_HOLDDOWN = 366,
-     VAR_DEL_HOLDDOWN = 367,
-     VAR_SO_RCVBUF = 368,
-     VAR_EDNS_BUFFER_SIZE = 369,
-     VAR_PREFETCH = 370,
-     VAR_PREFETCH_KEY = 371,
-     VAR_SO_SNDBUF = 372,
-     VAR_SO_REUSEPORT = 373,
-     VAR_HARDEN_BELOW_NXDOMAIN = 374,
-     VAR_IGNORE_CD_FLAG = 375,
-     VAR_LOG_QUERIES = 376,
-     VAR_TCP_UPSTREAM = 377,
-     VAR_SSL_UPSTREAM = 378,
-     VAR_SSL_SERVICE_KEY = 379,
-     VAR_SSL_SERVICE_PEM = 380,
-     VAR_SSL_PORT = 381,
-     VAR_FORWARD_FIRST = 382,
-     VAR_STUB_FIRST = 383,
-     VAR_MINIMAL_RESPONSES = 384,
-     VAR_RRSET_ROUNDROBIN = 385,
-     VAR_MAX_UDP_SIZE = 386,
-     VAR_DELAY_CLOSE = 387
-   };
-#endif
-/* Tokens.  */
-#define SPACE 258
-#define LETTER 259
-#define NEWLINE 260
-#define COMMENT 261
-#define COLON 262
-#define ANY 263
-#define ZONESTR 264
-#define STRING_ARG 265
-#define VAR_SERVER 266
-#define VAR_VERBOSITY 267
-#define VAR_NUM_THREADS 268
-#define VAR_PORT 269
-#define VAR_OUTGOING_RANGE 270
-#define VAR_INTERFACE 271
-#define VAR_DO_IP4 272
-#define VAR_DO_IP6 273
-#define VAR_DO_UDP 274
-#define VAR_DO_TCP 275
-#define VAR_CHROOT 276
-#define VAR_USERNAME 277
-#define VAR_DIRECTORY 278
-#define VAR_LOGFILE 279
-#define VAR_PIDFILE 280
-#define VAR_MSG_CACHE_SIZE 281
-#define VAR_MSG_CACHE_SLABS 282
-#define VAR_NUM_QUERIES_PER_THREAD 283
-#define VAR_RRSET_CACHE_SIZE 284
-#define VAR_RRSET_CACHE_SLABS 285
-#define VAR_OUTGOING_NUM_TCP 286
-#define VAR_INFRA_HOST_TTL 287
-#define VAR_INFRA_LAME_TTL 288
-#define VAR_INFRA_CACHE_SLABS 289
-#define VAR_INFRA_CACHE_NUMHOSTS 290
-#define VAR_INFRA_CACHE_LAME_SIZE 291
-#define VAR_NAME 292
-#define VAR_STUB_ZONE 293
-#define VAR_STUB_HOST 294
-#define VAR_STUB_ADDR 295
-#define VAR_TARGET_FETCH_POLICY 296
-#define VAR_HARDEN_SHORT_BUFSIZE 297
-#define VAR_HARDEN_LARGE_QUERIES 298
-#define VAR_FORWARD_ZONE 299
-#define VAR_FORWARD_HOST 300
-#define VAR_FORWARD_ADDR 301
-#define VAR_DO_NOT_QUERY_ADDRESS 302
-#define VAR_HIDE_IDENTITY 303
-#define VAR_HIDE_VERSION 304
-#define VAR_IDENTITY 305
-#define VAR_VERSION 306
-#define VAR_HARDEN_GLUE 307
-#define VAR_MODULE_CONF 308
-#define VAR_TRUST_ANCHOR_FILE 309
-#define VAR_TRUST_ANCHOR 310
-#define VAR_VAL_OVERRIDE_DATE 311
-#define VAR_BOGUS_TTL 312
-#define VAR_VAL_CLEAN_ADDITIONAL 313
-#define VAR_VAL_PERMISSIVE_MODE 314
-#define VAR_INCOMING_NUM_TCP 315
-#define VAR_MSG_BUFFER_SIZE 316
-#define VAR_KEY_CACHE_SIZE 317
-#define VAR_KEY_CACHE_SLABS 318
-#define VAR_TRUSTED_KEYS_FILE 319
-#define VAR_VAL_NSEC3_KEYSIZE_ITERATIONS 320
-#define VAR_USE_SYSLOG 321
-#define VAR_OUTGOING_INTERFACE 322
-#define VAR_ROOT_HINTS 323
-#define VAR_DO_NOT_QUERY_LOCALHOST 324
-#define VAR_CACHE_MAX_TTL 325
-#define VAR_HARDEN_DNSSEC_STRIPPED 326
-#define VAR_ACCESS_CONTROL 327
-#define VAR_LOCAL_ZONE 328
-#define VAR_LOCAL_DATA 329
-#define VAR_INTERFACE_AUTOMATIC 330
-#define VAR_STATISTICS_INTERVAL 331
-#define VAR_DO_DAEMONIZE 332
-#define VAR_USE_CAPS_FOR_ID 333
-#define VAR_STATISTICS_CUMULATIVE 334
-#define VAR_OUTGOING_PORT_PERMIT 335
-#define VAR_OUTGOING_PORT_AVOID 336
-#define VAR_DLV_ANCHOR_FILE 337
-#define VAR_DLV_ANCHOR 338
-#define VAR_NEG_CACHE_SIZE 339
-#define VAR_HARDEN_REFERRAL_PATH 340
-#define VAR_PRIVATE_ADDRESS 341
-#define VAR_PRIVATE_DOMAIN 342
-#define VAR_REMOTE_CONTROL 343
-#define VAR_CONTROL_ENABLE 344
-#define VAR_CONTROL_INTERFACE 345
-#define VAR_CONTROL_PORT 346
-#define VAR_SERVER_KEY_FILE 347
-#define VAR_SERVER_CERT_FILE 348
-#define VAR_CONTROL_KEY_FILE 349
-#define VAR_CONTROL_CERT_FILE 350
-#define VAR_EXTENDED_STATISTICS 351
-#define VAR_LOCAL_DATA_PTR 352
-#define VAR_JOSTLE_TIMEOUT 353
-#define VAR_STUB_PRIME 354
-#define VAR_UNWANTED_REPLY_THRESHOLD 355
-#define VAR_LOG_TIME_ASCII 356
-#define VAR_DOMAIN_INSECURE 357
-#define VAR_PYTHON 358
-#define VAR_PYTHON_SCRIPT 359
-#define VAR_VAL_SIG_SKEW_MIN 360
-#define VAR_VAL_SIG_SKEW_MAX 361
-#define VAR_CACHE_MIN_TTL 362
-#define VAR_VAL_LOG_LEVEL 363
-#define VAR_AUTO_TRUST_ANCHOR_FILE 364
-#define VAR_KEEP_MISSING 365
-#define VAR_ADD_HOLDDOWN 366
-#define VAR_DEL_HOLDDOWN 367
-#define VAR_SO_RCVBUF 368
-#define VAR_EDNS_BUFFER_SIZE 369
-#define VAR_PREFETCH 370
-#define VAR_PREFETCH_KEY 371
-#define VAR_SO_SNDBUF 372
-#define VAR_SO_REUSEPORT 373
-#define VAR_HARDEN_BELOW_NXDOMAIN 374
-#define VAR_IGNORE_CD_FLAG 375
-#define VAR_LOG_QUERIES 376
-#define VAR_TCP_UPSTREAM 377
-#define VAR_SSL_UPSTREAM 378
-#define VAR_SSL_SERVICE_KEY 379
-#define VAR_SSL_SERVICE_PEM 380
-#define VAR_SSL_PORT 381
-#define VAR_FORWARD_FIRST 382
-#define VAR_STUB_FIRST 383
-#define VAR_MINIMAL_RESPONSES 384
-#define VAR_RRSET_ROUNDROBIN 385
-#define VAR_MAX_UDP_SIZE 386
-#define VAR_DELAY_CLOSE 387
-
-
-
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
-{
-/* Line 350 of yacc.c  */
-#line 64 "./util/configparser.y"
 
-	char*	str;
 
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
-/* Line 350 of yacc.c  */
-#line 407 "util/configparser.c"
-} YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-extern YYSTYPE yylval;
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
 #else
-int yyparse ();
+typedef signed char yytype_int8;
 #endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void);
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-int yyparse ();
+typedef short yytype_int16;
 #endif
-#endif /* ! YYPARSE_PARAM */
-
-#endif /* !YY_UTIL_CONFIGPARSER_H  */
 
-/* Copy the second part of user declarations.  */
-
-/* Line 353 of yacc.c  */
-#line 435 "util/configparser.c"
-
-#ifdef short
-# undef short
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
 typedef unsigned char yytype_uint8;
-#endif
-
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-typedef signed char yytype_int8;
 #else
-typedef short int yytype_int8;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef unsigned short int yytype_uint16;
+typedef int yytype_uint16;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
-#else
-typedef short int yytype_int16;
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -469,55 +527,106 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int yyi)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (yyi)
-    int yyi;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return yyi;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -534,8 +643,7 @@ YYID (yyi)
 #    define alloca _alloca
 #   else
 #    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
 #     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
       /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
 #     ifndef EXIT_SUCCESS
@@ -547,8 +655,8 @@ YYID (yyi)
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -564,7 +672,7 @@ YYID (yyi)
 #  endif
 #  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
 #   ifndef EXIT_SUCCESS
 #    define EXIT_SUCCESS 0
@@ -572,40 +680,37 @@ YYID (yyi)
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -615,16 +720,16 @@ union yyalloc
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack_alloc, Stack)				\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack_alloc, Stack, yysize);			\
-	Stack = &yyptr->Stack_alloc;					\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
@@ -634,16 +739,16 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
-      while (YYID (0))
+      while (0)
 #  endif
 # endif
 #endif /* !YYCOPY_NEEDED */
@@ -651,25 +756,30 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  2
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   244
+#define YYLAST   282
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  133
+#define YYNTOKENS  152
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  136
+#define YYNNTS  155
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  259
-/* YYNRULES -- Number of states.  */
-#define YYNSTATES  380
+#define YYNRULES  297
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  437
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   387
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   406
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
 static const yytype_uint8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -710,158 +820,69 @@ static const yytype_uint8 yytranslate[] =
       95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
      105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
      115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,   129,   130,   131,   132
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint16 yyprhs[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,     0,     3,     4,     7,    10,    13,    16,    19,    22,
-      24,    27,    28,    30,    32,    34,    36,    38,    40,    42,
-      44,    46,    48,    50,    52,    54,    56,    58,    60,    62,
-      64,    66,    68,    70,    72,    74,    76,    78,    80,    82,
-      84,    86,    88,    90,    92,    94,    96,    98,   100,   102,
-     104,   106,   108,   110,   112,   114,   116,   118,   120,   122,
-     124,   126,   128,   130,   132,   134,   136,   138,   140,   142,
-     144,   146,   148,   150,   152,   154,   156,   158,   160,   162,
-     164,   166,   168,   170,   172,   174,   176,   178,   180,   182,
-     184,   186,   188,   190,   192,   194,   196,   198,   200,   202,
-     204,   206,   208,   210,   212,   214,   216,   218,   220,   222,
-     224,   226,   228,   230,   232,   235,   236,   238,   240,   242,
-     244,   246,   248,   251,   252,   254,   256,   258,   260,   263,
-     266,   269,   272,   275,   278,   281,   284,   287,   290,   293,
-     296,   299,   302,   305,   308,   311,   314,   317,   320,   323,
-     326,   329,   332,   335,   338,   341,   344,   347,   350,   353,
-     356,   359,   362,   365,   368,   371,   374,   377,   380,   383,
-     386,   389,   392,   395,   398,   401,   404,   407,   410,   413,
-     416,   419,   422,   425,   428,   431,   434,   437,   440,   443,
-     446,   449,   452,   455,   458,   461,   464,   467,   470,   473,
-     476,   479,   482,   485,   488,   492,   495,   498,   501,   504,
-     507,   510,   513,   516,   519,   522,   525,   528,   531,   534,
-     537,   540,   543,   546,   550,   553,   556,   559,   562,   565,
-     568,   571,   574,   577,   580,   583,   586,   589,   592,   594,
-     597,   598,   600,   602,   604,   606,   608,   610,   612,   615,
-     618,   621,   624,   627,   630,   633,   635,   638,   639,   641
+       0,   117,   117,   117,   118,   118,   119,   119,   120,   124,
+     129,   130,   131,   131,   131,   132,   132,   133,   133,   133,
+     134,   134,   134,   135,   135,   135,   136,   136,   137,   137,
+     138,   138,   139,   139,   140,   140,   141,   141,   142,   142,
+     143,   143,   144,   144,   144,   145,   145,   145,   146,   146,
+     146,   147,   147,   148,   148,   149,   149,   150,   150,   151,
+     151,   151,   152,   152,   153,   153,   154,   154,   154,   155,
+     155,   156,   156,   157,   157,   158,   158,   158,   159,   159,
+     160,   160,   161,   161,   162,   162,   163,   163,   164,   164,
+     164,   165,   165,   166,   166,   166,   167,   167,   167,   168,
+     168,   168,   169,   169,   169,   170,   170,   170,   171,   171,
+     171,   172,   172,   172,   173,   173,   174,   174,   174,   175,
+     175,   175,   176,   176,   177,   177,   178,   178,   179,   179,
+     180,   180,   182,   194,   195,   196,   196,   196,   196,   196,
+     198,   210,   211,   212,   212,   212,   212,   214,   223,   232,
+     243,   252,   261,   270,   283,   298,   307,   316,   325,   334,
+     343,   352,   361,   370,   379,   388,   397,   406,   413,   420,
+     428,   437,   446,   460,   469,   478,   485,   492,   499,   507,
+     514,   521,   528,   535,   543,   551,   559,   566,   573,   582,
+     591,   598,   605,   613,   621,   631,   644,   655,   663,   676,
+     685,   694,   703,   712,   721,   730,   740,   749,   758,   767,
+     776,   785,   794,   803,   812,   821,   830,   839,   848,   856,
+     869,   878,   886,   895,   903,   916,   923,   933,   943,   953,
+     963,   973,   983,   993,  1000,  1007,  1016,  1025,  1034,  1043,
+    1052,  1059,  1069,  1086,  1093,  1111,  1124,  1137,  1146,  1155,
+    1164,  1174,  1184,  1193,  1202,  1209,  1218,  1227,  1236,  1244,
+    1257,  1265,  1287,  1294,  1309,  1319,  1329,  1336,  1346,  1353,
+    1360,  1369,  1379,  1389,  1396,  1403,  1412,  1417,  1418,  1419,
+    1419,  1419,  1420,  1420,  1420,  1421,  1423,  1433,  1442,  1449,
+    1456,  1463,  1470,  1477,  1482,  1483,  1484,  1486
 };
+#endif
 
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int16 yyrhs[] =
-{
-     134,     0,    -1,    -1,   134,   135,    -1,   136,   137,    -1,
-     139,   140,    -1,   142,   143,    -1,   265,   266,    -1,   255,
-     256,    -1,    11,    -1,   137,   138,    -1,    -1,   145,    -1,
-     146,    -1,   150,    -1,   153,    -1,   159,    -1,   160,    -1,
-     161,    -1,   162,    -1,   151,    -1,   172,    -1,   173,    -1,
-     174,    -1,   175,    -1,   176,    -1,   194,    -1,   195,    -1,
-     196,    -1,   199,    -1,   200,    -1,   156,    -1,   201,    -1,
-     202,    -1,   205,    -1,   203,    -1,   204,    -1,   206,    -1,
-     207,    -1,   208,    -1,   219,    -1,   185,    -1,   186,    -1,
-     187,    -1,   188,    -1,   209,    -1,   222,    -1,   181,    -1,
-     183,    -1,   223,    -1,   228,    -1,   229,    -1,   230,    -1,
-     157,    -1,   193,    -1,   237,    -1,   238,    -1,   182,    -1,
-     233,    -1,   169,    -1,   152,    -1,   177,    -1,   220,    -1,
-     226,    -1,   210,    -1,   221,    -1,   240,    -1,   241,    -1,
-     158,    -1,   147,    -1,   168,    -1,   213,    -1,   148,    -1,
-     154,    -1,   155,    -1,   178,    -1,   179,    -1,   239,    -1,
-     212,    -1,   214,    -1,   215,    -1,   149,    -1,   242,    -1,
-     197,    -1,   218,    -1,   170,    -1,   184,    -1,   224,    -1,
-     225,    -1,   227,    -1,   232,    -1,   180,    -1,   234,    -1,
-     235,    -1,   236,    -1,   189,    -1,   192,    -1,   216,    -1,
-     217,    -1,   190,    -1,   211,    -1,   231,    -1,   171,    -1,
-     163,    -1,   164,    -1,   165,    -1,   166,    -1,   167,    -1,
-     243,    -1,   244,    -1,   245,    -1,   191,    -1,   198,    -1,
-      38,    -1,   140,   141,    -1,    -1,   246,    -1,   247,    -1,
-     248,    -1,   250,    -1,   249,    -1,    44,    -1,   143,   144,
-      -1,    -1,   251,    -1,   252,    -1,   253,    -1,   254,    -1,
-      13,    10,    -1,    12,    10,    -1,    76,    10,    -1,    79,
-      10,    -1,    96,    10,    -1,    14,    10,    -1,    16,    10,
-      -1,    67,    10,    -1,    15,    10,    -1,    80,    10,    -1,
-      81,    10,    -1,    31,    10,    -1,    60,    10,    -1,    75,
-      10,    -1,    17,    10,    -1,    18,    10,    -1,    19,    10,
-      -1,    20,    10,    -1,   122,    10,    -1,   123,    10,    -1,
-     124,    10,    -1,   125,    10,    -1,   126,    10,    -1,    77,
-      10,    -1,    66,    10,    -1,   101,    10,    -1,   121,    10,
-      -1,    21,    10,    -1,    22,    10,    -1,    23,    10,    -1,
-      24,    10,    -1,    25,    10,    -1,    68,    10,    -1,    82,
-      10,    -1,    83,    10,    -1,   109,    10,    -1,    54,    10,
-      -1,    64,    10,    -1,    55,    10,    -1,   102,    10,    -1,
-      48,    10,    -1,    49,    10,    -1,    50,    10,    -1,    51,
-      10,    -1,   113,    10,    -1,   117,    10,    -1,   118,    10,
-      -1,   114,    10,    -1,    61,    10,    -1,    26,    10,    -1,
-      27,    10,    -1,    28,    10,    -1,    98,    10,    -1,   132,
-      10,    -1,    29,    10,    -1,    30,    10,    -1,    32,    10,
-      -1,    33,    10,    -1,    35,    10,    -1,    36,    10,    -1,
-      34,    10,    -1,    41,    10,    -1,    42,    10,    -1,    43,
-      10,    -1,    52,    10,    -1,    71,    10,    -1,   119,    10,
-      -1,    85,    10,    -1,    78,    10,    -1,    86,    10,    -1,
-      87,    10,    -1,   115,    10,    -1,   116,    10,    -1,   100,
-      10,    -1,    47,    10,    -1,    69,    10,    -1,    72,    10,
-      10,    -1,    53,    10,    -1,    56,    10,    -1,   105,    10,
-      -1,   106,    10,    -1,    70,    10,    -1,   107,    10,    -1,
-      57,    10,    -1,    58,    10,    -1,    59,    10,    -1,   120,
-      10,    -1,   108,    10,    -1,    65,    10,    -1,   111,    10,
-      -1,   112,    10,    -1,   110,    10,    -1,    62,    10,    -1,
-      63,    10,    -1,    84,    10,    -1,    73,    10,    10,    -1,
-      74,    10,    -1,    97,    10,    -1,   129,    10,    -1,   130,
-      10,    -1,   131,    10,    -1,    37,    10,    -1,    39,    10,
-      -1,    40,    10,    -1,   128,    10,    -1,    99,    10,    -1,
-      37,    10,    -1,    45,    10,    -1,    46,    10,    -1,   127,
-      10,    -1,    88,    -1,   256,   257,    -1,    -1,   258,    -1,
-     260,    -1,   259,    -1,   261,    -1,   262,    -1,   263,    -1,
-     264,    -1,    89,    10,    -1,    91,    10,    -1,    90,    10,
-      -1,    92,    10,    -1,    93,    10,    -1,    94,    10,    -1,
-      95,    10,    -1,   103,    -1,   266,   267,    -1,    -1,   268,
-      -1,   104,    10,    -1
-};
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,   111,   111,   111,   112,   112,   113,   113,   114,   118,
-     123,   124,   125,   125,   125,   126,   126,   127,   127,   127,
-     128,   128,   128,   129,   129,   129,   130,   130,   131,   131,
-     132,   132,   133,   133,   134,   134,   135,   135,   136,   136,
-     137,   137,   138,   138,   138,   139,   139,   139,   140,   140,
-     140,   141,   141,   142,   142,   143,   143,   144,   144,   145,
-     145,   145,   146,   146,   147,   147,   148,   148,   148,   149,
-     149,   150,   150,   151,   151,   152,   152,   152,   153,   153,
-     154,   154,   155,   155,   156,   156,   157,   157,   158,   158,
-     158,   159,   159,   160,   160,   160,   161,   161,   161,   162,
-     162,   162,   163,   163,   163,   164,   164,   164,   165,   165,
-     165,   166,   166,   168,   180,   181,   182,   182,   182,   182,
-     182,   184,   196,   197,   198,   198,   198,   198,   200,   209,
-     218,   229,   238,   247,   256,   269,   284,   293,   302,   311,
-     320,   329,   338,   347,   356,   365,   374,   383,   392,   399,
-     406,   415,   424,   438,   447,   456,   463,   470,   477,   485,
-     492,   499,   506,   513,   521,   529,   537,   544,   551,   560,
-     569,   576,   583,   591,   599,   609,   622,   633,   641,   654,
-     663,   672,   681,   689,   702,   711,   719,   728,   736,   749,
-     756,   766,   776,   786,   796,   806,   816,   826,   833,   840,
-     849,   858,   867,   874,   884,   901,   908,   926,   939,   952,
-     961,   970,   979,   989,   999,  1008,  1017,  1024,  1033,  1042,
-    1051,  1059,  1072,  1080,  1102,  1109,  1124,  1134,  1144,  1151,
-    1161,  1168,  1175,  1184,  1194,  1204,  1211,  1218,  1227,  1232,
-    1233,  1234,  1234,  1234,  1235,  1235,  1235,  1236,  1238,  1248,
-    1257,  1264,  1271,  1278,  1285,  1292,  1297,  1298,  1299,  1301
-};
-#endif
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "SPACE", "LETTER", "NEWLINE", "COMMENT",
-  "COLON", "ANY", "ZONESTR", "STRING_ARG", "VAR_SERVER", "VAR_VERBOSITY",
-  "VAR_NUM_THREADS", "VAR_PORT", "VAR_OUTGOING_RANGE", "VAR_INTERFACE",
-  "VAR_DO_IP4", "VAR_DO_IP6", "VAR_DO_UDP", "VAR_DO_TCP", "VAR_CHROOT",
-  "VAR_USERNAME", "VAR_DIRECTORY", "VAR_LOGFILE", "VAR_PIDFILE",
-  "VAR_MSG_CACHE_SIZE", "VAR_MSG_CACHE_SLABS",
-  "VAR_NUM_QUERIES_PER_THREAD", "VAR_RRSET_CACHE_SIZE",
-  "VAR_RRSET_CACHE_SLABS", "VAR_OUTGOING_NUM_TCP", "VAR_INFRA_HOST_TTL",
-  "VAR_INFRA_LAME_TTL", "VAR_INFRA_CACHE_SLABS",
+  "\"end of file\"", "error", "\"invalid token\"", "SPACE", "LETTER",
+  "NEWLINE", "COMMENT", "COLON", "ANY", "ZONESTR", "STRING_ARG",
+  "VAR_SERVER", "VAR_VERBOSITY", "VAR_NUM_THREADS", "VAR_PORT",
+  "VAR_OUTGOING_RANGE", "VAR_INTERFACE", "VAR_DO_IP4", "VAR_DO_IP6",
+  "VAR_DO_UDP", "VAR_DO_TCP", "VAR_CHROOT", "VAR_USERNAME",
+  "VAR_DIRECTORY", "VAR_LOGFILE", "VAR_PIDFILE", "VAR_MSG_CACHE_SIZE",
+  "VAR_MSG_CACHE_SLABS", "VAR_NUM_QUERIES_PER_THREAD",
+  "VAR_RRSET_CACHE_SIZE", "VAR_RRSET_CACHE_SLABS", "VAR_OUTGOING_NUM_TCP",
+  "VAR_INFRA_HOST_TTL", "VAR_INFRA_LAME_TTL", "VAR_INFRA_CACHE_SLABS",
   "VAR_INFRA_CACHE_NUMHOSTS", "VAR_INFRA_CACHE_LAME_SIZE", "VAR_NAME",
   "VAR_STUB_ZONE", "VAR_STUB_HOST", "VAR_STUB_ADDR",
   "VAR_TARGET_FETCH_POLICY", "VAR_HARDEN_SHORT_BUFSIZE",
@@ -895,7 +916,15 @@ static const char *const yytname[] =
   "VAR_SSL_UPSTREAM", "VAR_SSL_SERVICE_KEY", "VAR_SSL_SERVICE_PEM",
   "VAR_SSL_PORT", "VAR_FORWARD_FIRST", "VAR_STUB_FIRST",
   "VAR_MINIMAL_RESPONSES", "VAR_RRSET_ROUNDROBIN", "VAR_MAX_UDP_SIZE",
-  "VAR_DELAY_CLOSE", "$accept", "toplevelvars", "toplevelvar",
+  "VAR_DELAY_CLOSE", "VAR_TCP_IDLE_TIMEOUT", "VAR_SSL_SESSION_TICKET_KEYS",
+  "VAR_TCP_FASTOPEN", "VAR_TCP_UPSTREAM_FASTOPEN", "VAR_RRL_RATELIMIT",
+  "VAR_RRL_SLIP", "VAR_RRL_IPV4_PREFIX", "VAR_RRL_IPV6_PREFIX",
+  "VAR_RRL_SIZE", "VAR_UPSTREAM_ZONE_RATELIMIT",
+  "VAR_UPSTREAM_SERVER_RATELIMIT", "VAR_UPSTREAM_RATELIMIT_SIZE",
+  "VAR_REGION_PRESIZE", "VAR_CACHE_HUGEPAGES",
+  "VAR_CACHE_ADMISSION_FILTER", "VAR_CACHE_EXPIRY_SCAN",
+  "VAR_PREFETCH_POPULAR", "VAR_PREFETCH_POPULAR_RATE",
+  "VAR_MSG_CACHE_L1_SLOTS", "$accept", "toplevelvars", "toplevelvar",
   "serverstart", "contents_server", "content_server", "stubstart",
   "contents_stub", "content_stub", "forwardstart", "contents_forward",
   "content_forward", "server_num_threads", "server_verbosity",
@@ -907,9 +936,10 @@ static const char *const yytname[] =
   "server_interface_automatic", "server_do_ip4", "server_do_ip6",
   "server_do_udp", "server_do_tcp", "server_tcp_upstream",
   "server_ssl_upstream", "server_ssl_service_key",
-  "server_ssl_service_pem", "server_ssl_port", "server_do_daemonize",
-  "server_use_syslog", "server_log_time_ascii", "server_log_queries",
-  "server_chroot", "server_username", "server_directory", "server_logfile",
+  "server_ssl_service_pem", "server_ssl_session_ticket_keys",
+  "server_ssl_port", "server_do_daemonize", "server_use_syslog",
+  "server_log_time_ascii", "server_log_queries", "server_chroot",
+  "server_username", "server_directory", "server_logfile",
   "server_pidfile", "server_root_hints", "server_dlv_anchor_file",
   "server_dlv_anchor", "server_auto_trust_anchor_file",
   "server_trust_anchor_file", "server_trusted_keys_file",
@@ -918,8 +948,15 @@ static const char *const yytname[] =
   "server_so_rcvbuf", "server_so_sndbuf", "server_so_reuseport",
   "server_edns_buffer_size", "server_msg_buffer_size",
   "server_msg_cache_size", "server_msg_cache_slabs",
-  "server_num_queries_per_thread", "server_jostle_timeout",
-  "server_delay_close", "server_rrset_cache_size",
+  "server_msg_cache_l1_slots", "server_num_queries_per_thread",
+  "server_jostle_timeout", "server_delay_close", "server_tcp_idle_timeout",
+  "server_tcp_fastopen", "server_tcp_upstream_fastopen",
+  "server_rrl_ratelimit", "server_rrl_slip", "server_rrl_ipv4_prefix",
+  "server_rrl_ipv6_prefix", "server_rrl_size",
+  "server_upstream_zone_ratelimit", "server_upstream_server_ratelimit",
+  "server_upstream_ratelimit_size", "server_region_presize",
+  "server_cache_hugepages", "server_cache_admission_filter",
+  "server_cache_expiry_scan", "server_rrset_cache_size",
   "server_rrset_cache_slabs", "server_infra_host_ttl",
   "server_infra_lame_ttl", "server_infra_cache_numhosts",
   "server_infra_cache_lame_size", "server_infra_cache_slabs",
@@ -928,7 +965,8 @@ static const char *const yytname[] =
   "server_harden_dnssec_stripped", "server_harden_below_nxdomain",
   "server_harden_referral_path", "server_use_caps_for_id",
   "server_private_address", "server_private_domain", "server_prefetch",
-  "server_prefetch_key", "server_unwanted_reply_threshold",
+  "server_prefetch_key", "server_prefetch_popular",
+  "server_prefetch_popular_rate", "server_unwanted_reply_threshold",
   "server_do_not_query_address", "server_do_not_query_localhost",
   "server_access_control", "server_module_conf",
   "server_val_override_date", "server_val_sig_skew_min",
@@ -946,175 +984,46 @@ static const char *const yytname[] =
   "contents_rc", "content_rc", "rc_control_enable", "rc_control_port",
   "rc_control_interface", "rc_server_key_file", "rc_server_cert_file",
   "rc_control_key_file", "rc_control_cert_file", "pythonstart",
-  "contents_py", "content_py", "py_script", YY_NULL
+  "contents_py", "content_py", "py_script", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint16 yyr1[] =
-{
-       0,   133,   134,   134,   135,   135,   135,   135,   135,   136,
-     137,   137,   138,   138,   138,   138,   138,   138,   138,   138,
-     138,   138,   138,   138,   138,   138,   138,   138,   138,   138,
-     138,   138,   138,   138,   138,   138,   138,   138,   138,   138,
-     138,   138,   138,   138,   138,   138,   138,   138,   138,   138,
-     138,   138,   138,   138,   138,   138,   138,   138,   138,   138,
-     138,   138,   138,   138,   138,   138,   138,   138,   138,   138,
-     138,   138,   138,   138,   138,   138,   138,   138,   138,   138,
-     138,   138,   138,   138,   138,   138,   138,   138,   138,   138,
-     138,   138,   138,   138,   138,   138,   138,   138,   138,   138,
-     138,   138,   138,   138,   138,   138,   138,   138,   138,   138,
-     138,   138,   138,   139,   140,   140,   141,   141,   141,   141,
-     141,   142,   143,   143,   144,   144,   144,   144,   145,   146,
-     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
-     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
-     167,   168,   169,   170,   171,   172,   173,   174,   175,   176,
-     177,   178,   179,   180,   181,   182,   183,   184,   185,   186,
-     187,   188,   189,   190,   191,   192,   193,   194,   195,   196,
-     197,   198,   199,   200,   201,   202,   203,   204,   205,   206,
-     207,   208,   209,   210,   211,   212,   213,   214,   215,   216,
-     217,   218,   219,   220,   221,   222,   223,   224,   225,   226,
-     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
-     247,   248,   249,   250,   251,   252,   253,   254,   255,   256,
-     256,   257,   257,   257,   257,   257,   257,   257,   258,   259,
-     260,   261,   262,   263,   264,   265,   266,   266,   267,   268
-};
+#define YYPACT_NINF (-80)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
-{
-       0,     2,     0,     2,     2,     2,     2,     2,     2,     1,
-       2,     0,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     2,     0,     1,     1,     1,     1,
-       1,     1,     2,     0,     1,     1,     1,     1,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     3,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     3,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     1,     2,
-       0,     1,     1,     1,     1,     1,     1,     1,     2,     2,
-       2,     2,     2,     2,     2,     1,     2,     0,     1,     2
-};
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-/* YYDEFACT[STATE-NAME] -- Default reduction number in state STATE-NUM.
-   Performed when YYTABLE doesn't specify something else to do.  Zero
-   means the default is an error.  */
-static const yytype_uint16 yydefact[] =
-{
-       2,     0,     1,     9,   113,   121,   238,   255,     3,    11,
-     115,   123,   240,   257,     4,     5,     6,     8,     7,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      10,    12,    13,    69,    72,    81,    14,    20,    60,    15,
-      73,    74,    31,    53,    68,    16,    17,    18,    19,   103,
-     104,   105,   106,   107,    70,    59,    85,   102,    21,    22,
-      23,    24,    25,    61,    75,    76,    91,    47,    57,    48,
-      86,    41,    42,    43,    44,    95,    99,   111,    96,    54,
-      26,    27,    28,    83,   112,    29,    30,    32,    33,    35,
-      36,    34,    37,    38,    39,    45,    64,   100,    78,    71,
-      79,    80,    97,    98,    84,    40,    62,    65,    46,    49,
-      87,    88,    63,    89,    50,    51,    52,   101,    90,    58,
-      92,    93,    94,    55,    56,    77,    66,    67,    82,   108,
-     109,   110,     0,     0,     0,     0,     0,   114,   116,   117,
-     118,   120,   119,     0,     0,     0,     0,   122,   124,   125,
-     126,   127,     0,     0,     0,     0,     0,     0,     0,   239,
-     241,   243,   242,   244,   245,   246,   247,     0,   256,   258,
-     129,   128,   133,   136,   134,   142,   143,   144,   145,   155,
-     156,   157,   158,   159,   177,   178,   179,   182,   183,   139,
-     184,   185,   188,   186,   187,   189,   190,   191,   202,   168,
-     169,   170,   171,   192,   205,   164,   166,   206,   211,   212,
-     213,   140,   176,   220,   221,   165,   216,   152,   135,   160,
-     203,   209,   193,     0,     0,   224,   141,   130,   151,   196,
-     131,   137,   138,   161,   162,   222,   195,   197,   198,   132,
-     225,   180,   201,   153,   167,   207,   208,   210,   215,   163,
-     219,   217,   218,   172,   175,   199,   200,   173,   174,   194,
-     214,   154,   146,   147,   148,   149,   150,   226,   227,   228,
-     181,   229,   230,   231,   233,   232,   234,   235,   236,   237,
-     248,   250,   249,   251,   252,   253,   254,   259,   204,   223
-};
+#define YYTABLE_NINF (-1)
 
-/* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int16 yydefgoto[] =
-{
-      -1,     1,     8,     9,    14,   120,    10,    15,   227,    11,
-      16,   237,   121,   122,   123,   124,   125,   126,   127,   128,
-     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
-     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
-     149,   150,   151,   152,   153,   154,   155,   156,   157,   158,
-     159,   160,   161,   162,   163,   164,   165,   166,   167,   168,
-     169,   170,   171,   172,   173,   174,   175,   176,   177,   178,
-     179,   180,   181,   182,   183,   184,   185,   186,   187,   188,
-     189,   190,   191,   192,   193,   194,   195,   196,   197,   198,
-     199,   200,   201,   202,   203,   204,   205,   206,   207,   208,
-     209,   210,   211,   212,   213,   214,   215,   216,   217,   218,
-     219,   220,   221,   228,   229,   230,   231,   232,   238,   239,
-     240,   241,    12,    17,   249,   250,   251,   252,   253,   254,
-     255,   256,    13,    18,   258,   259
-};
+#define yytable_value_is_error(Yyn) \
+  0
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -80
 static const yytype_int16 yypact[] =
 {
-     -80,   115,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
-     -80,   -80,   -80,   -80,   -12,    39,    46,    38,   -79,    16,
-      17,    18,    22,    23,    24,    67,    70,    71,    72,    77,
-     106,   111,   112,   113,   114,   124,   125,   126,   127,   129,
-     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
-     140,   141,   142,   144,   145,   146,   147,   148,   150,   151,
-     152,   153,   154,   155,   156,   158,   159,   160,   161,   162,
-     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
-     174,   175,   176,   177,   178,   179,   180,   181,   182,   183,
-     184,   185,   186,   187,   188,   189,   190,   191,   192,   194,
-     195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
-     205,   206,   207,   209,   210,   211,   212,   213,   214,   215,
+     -80,   140,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
+     -80,   -80,   -80,   -80,   -12,    42,    46,    53,   -79,    16,
+      17,    18,    22,    23,    24,    66,    67,    68,    70,    77,
+     105,   106,   139,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,   156,   157,   158,
+     159,   161,   162,   164,   165,   166,   167,   169,   170,   171,
+     172,   173,   175,   176,   177,   178,   179,   180,   181,   182,
+     183,   184,   185,   186,   187,   188,   189,   190,   191,   192,
+     193,   194,   195,   196,   197,   198,   199,   200,   201,   202,
+     203,   204,   205,   206,   207,   208,   209,   210,   211,   212,
+     213,   214,   215,   216,   217,   219,   220,   221,   222,   223,
+     224,   225,   226,   227,   228,   229,   230,   231,   232,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,   -80,
+     -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
+     -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
@@ -1125,22 +1034,75 @@ static const yytype_int16 yypact[] =
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
-     -80,   -80,   216,   217,   218,   219,   220,   -80,   -80,   -80,
-     -80,   -80,   -80,   221,   222,   223,   224,   -80,   -80,   -80,
-     -80,   -80,   225,   226,   227,   228,   229,   230,   231,   -80,
-     -80,   -80,   -80,   -80,   -80,   -80,   -80,   232,   -80,   -80,
+     254,   255,   256,   257,   258,   -80,   -80,   -80,   -80,   -80,
+     -80,   259,   260,   261,   262,   -80,   -80,   -80,   -80,   -80,
+     263,   264,   265,   266,   267,   268,   269,   -80,   -80,   -80,
+     -80,   -80,   -80,   -80,   -80,   270,   -80,   -80,   -80,   -80,
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
-     -80,   -80,   -80,   233,   234,   -80,   -80,   -80,   -80,   -80,
+     -80,   271,   272,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
-     -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80
+     -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
+     -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
+     -80,   -80,   -80,   -80,   -80,   -80,   -80
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       2,     0,     1,     9,   132,   140,   276,   293,     3,    11,
+     134,   142,   278,   295,     4,     5,     6,     8,     7,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    10,
+      12,    13,    69,    72,    81,    14,    20,    60,    15,    73,
+      74,    31,    53,    68,    16,    17,    18,    19,   103,   104,
+     105,   106,   114,   107,    70,    59,    85,   102,    21,    22,
+      23,    24,    25,    61,    75,    76,    91,    47,    57,    48,
+      86,    41,    42,    43,    44,    95,    99,   111,    96,    54,
+      26,    27,   131,    28,    83,   112,   113,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,    29,    30,    32,    33,    35,    36,    34,    37,    38,
+      39,    45,    64,   100,    78,    71,    79,    80,    97,    98,
+     129,   130,    84,    40,    62,    65,    46,    49,    87,    88,
+      63,    89,    50,    51,    52,   101,    90,    58,    92,    93,
+      94,    55,    56,    77,    66,    67,    82,   108,   109,   110,
+       0,     0,     0,     0,     0,   133,   135,   136,   137,   139,
+     138,     0,     0,     0,     0,   141,   143,   144,   145,   146,
+       0,     0,     0,     0,     0,     0,     0,   277,   279,   281,
+     280,   282,   283,   284,   285,     0,   294,   296,   148,   147,
+     152,   155,   153,   161,   162,   163,   164,   175,   176,   177,
+     178,   179,   197,   198,   200,   218,   219,   158,   220,   221,
+     224,   222,   223,   225,   226,   227,   240,   188,   189,   190,
+     191,   228,   243,   184,   186,   244,   249,   250,   251,   159,
+     196,   258,   259,   185,   254,   172,   154,   180,   241,   247,
+     229,     0,     0,   262,   160,   149,   171,   232,   150,   156,
+     157,   181,   182,   260,   231,   233,   234,   151,   263,   201,
+     239,   173,   187,   245,   246,   248,   253,   183,   257,   255,
+     256,   192,   195,   235,   236,   193,   194,   230,   252,   174,
+     165,   166,   167,   168,   170,   264,   265,   266,   202,   203,
+     169,   204,   205,   206,   207,   208,   209,   210,   211,   212,
+     213,   214,   215,   216,   217,   237,   238,   199,   267,   268,
+     269,   271,   270,   272,   273,   274,   275,   286,   288,   287,
+     289,   290,   291,   292,   297,   242,   261
 };
 
 /* YYPGOTO[NTERM-NUM].  */
@@ -1159,48 +1121,68 @@ static const yytype_int8 yypgoto[] =
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
      -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
-     -80,   -80,   -80,   -80,   -80,   -80
+     -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
+     -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,   -80,
+     -80,   -80,   -80,   -80,   -80
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     1,     8,     9,    14,   139,    10,    15,   265,    11,
+      16,   275,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,   174,   175,   176,   177,
+     178,   179,   180,   181,   182,   183,   184,   185,   186,   187,
+     188,   189,   190,   191,   192,   193,   194,   195,   196,   197,
+     198,   199,   200,   201,   202,   203,   204,   205,   206,   207,
+     208,   209,   210,   211,   212,   213,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,   223,   224,   225,   226,   227,
+     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,   255,   256,   257,
+     258,   259,   266,   267,   268,   269,   270,   276,   277,   278,
+     279,    12,    17,   287,   288,   289,   290,   291,   292,   293,
+     294,    13,    18,   296,   297
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -1
-static const yytype_uint16 yytable[] =
+static const yytype_int16 yytable[] =
 {
       19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
       29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,   257,   260,   261,   262,    44,
-      45,    46,   263,   264,   265,    47,    48,    49,    50,    51,
+      39,    40,    41,    42,    43,   295,   298,   299,   300,    44,
+      45,    46,   301,   302,   303,    47,    48,    49,    50,    51,
       52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
       62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
       72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
-      82,    83,    84,    85,    86,    87,   222,   266,   223,   224,
-     267,   268,   269,   233,    88,    89,    90,   270,    91,    92,
-      93,   234,   235,    94,    95,    96,    97,    98,    99,   100,
+      82,    83,    84,    85,    86,    87,   304,   305,   306,   260,
+     307,   261,   262,   271,    88,    89,    90,   308,    91,    92,
+      93,   272,   273,    94,    95,    96,    97,    98,    99,   100,
      101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
-     111,   112,   113,   114,   115,     2,   271,   116,   117,   118,
-     119,   272,   273,   274,   275,     0,     3,   242,   243,   244,
-     245,   246,   247,   248,   276,   277,   278,   279,   225,   280,
-     281,   282,   283,   284,   285,   286,   287,   288,   289,   290,
-     291,   292,   293,     4,   294,   295,   296,   297,   298,     5,
-     299,   300,   301,   302,   303,   304,   305,   226,   306,   307,
-     308,   309,   310,   236,   311,   312,   313,   314,   315,   316,
-     317,   318,   319,   320,   321,   322,   323,   324,   325,   326,
-     327,   328,   329,   330,   331,   332,   333,   334,   335,   336,
-     337,   338,   339,     6,   340,   341,   342,   343,   344,   345,
-     346,   347,   348,   349,   350,   351,   352,   353,     7,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379
+     111,   112,   113,   114,   115,   309,   310,   116,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+       2,   263,   280,   281,   282,   283,   284,   285,   286,   311,
+       0,     3,   312,   313,   314,   315,   316,   317,   318,   319,
+     320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
+     264,   330,   331,   274,   332,   333,   334,   335,     4,   336,
+     337,   338,   339,   340,     5,   341,   342,   343,   344,   345,
+     346,   347,   348,   349,   350,   351,   352,   353,   354,   355,
+     356,   357,   358,   359,   360,   361,   362,   363,   364,   365,
+     366,   367,   368,   369,   370,   371,   372,   373,   374,   375,
+     376,   377,   378,   379,   380,   381,   382,   383,     6,   384,
+     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
+     395,   396,   397,     7,   398,   399,   400,   401,   402,   403,
+     404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
+     414,   415,   416,   417,   418,   419,   420,   421,   422,   423,
+     424,   425,   426,   427,   428,   429,   430,   431,   432,   433,
+     434,   435,   436
 };
 
-#define yypact_value_is_default(yystate) \
-  ((yystate) == (-80))
-
-#define yytable_value_is_error(yytable_value) \
-  YYID (0)
-
 static const yytype_int16 yycheck[] =
 {
       12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
@@ -1210,32 +1192,36 @@ static const yytype_int16 yycheck[] =
       52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
       62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
       72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
-      82,    83,    84,    85,    86,    87,    37,    10,    39,    40,
-      10,    10,    10,    37,    96,    97,    98,    10,   100,   101,
+      82,    83,    84,    85,    86,    87,    10,    10,    10,    37,
+      10,    39,    40,    37,    96,    97,    98,    10,   100,   101,
      102,    45,    46,   105,   106,   107,   108,   109,   110,   111,
      112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
-     122,   123,   124,   125,   126,     0,    10,   129,   130,   131,
-     132,    10,    10,    10,    10,    -1,    11,    89,    90,    91,
-      92,    93,    94,    95,    10,    10,    10,    10,    99,    10,
+     122,   123,   124,   125,   126,    10,    10,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+       0,    99,    89,    90,    91,    92,    93,    94,    95,    10,
+      -1,    11,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+     128,    10,    10,   127,    10,    10,    10,    10,    38,    10,
+      10,    10,    10,    10,    44,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    38,    10,    10,    10,    10,    10,    44,
-      10,    10,    10,    10,    10,    10,    10,   128,    10,    10,
-      10,    10,    10,   127,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    88,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,   103,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    88,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,    10,   103,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10
+      10,    10,    10
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint16 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
 {
-       0,   134,     0,    11,    38,    44,    88,   103,   135,   136,
-     139,   142,   255,   265,   137,   140,   143,   256,   266,    12,
+       0,   153,     0,    11,    38,    44,    88,   103,   154,   155,
+     158,   161,   293,   303,   156,   159,   162,   294,   304,    12,
       13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
       23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
       33,    34,    35,    36,    41,    42,    43,    47,    48,    49,
@@ -1246,8 +1232,8 @@ static const yytype_uint16 yystos[] =
       98,   100,   101,   102,   105,   106,   107,   108,   109,   110,
      111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
      121,   122,   123,   124,   125,   126,   129,   130,   131,   132,
-     138,   145,   146,   147,   148,   149,   150,   151,   152,   153,
-     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,   151,   157,
      164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
      174,   175,   176,   177,   178,   179,   180,   181,   182,   183,
      184,   185,   186,   187,   188,   189,   190,   191,   192,   193,
@@ -1256,10 +1242,14 @@ static const yytype_uint16 yystos[] =
      214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
      224,   225,   226,   227,   228,   229,   230,   231,   232,   233,
      234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,    37,    39,    40,    99,   128,   141,   246,   247,
-     248,   249,   250,    37,    45,    46,   127,   144,   251,   252,
-     253,   254,    89,    90,    91,    92,    93,    94,    95,   257,
-     258,   259,   260,   261,   262,   263,   264,   104,   267,   268,
+     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
+     254,   255,   256,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,   267,   268,   269,   270,   271,   272,   273,
+     274,   275,   276,   277,   278,   279,   280,   281,   282,   283,
+      37,    39,    40,    99,   128,   160,   284,   285,   286,   287,
+     288,    37,    45,    46,   127,   163,   289,   290,   291,   292,
+      89,    90,    91,    92,    93,    94,    95,   295,   296,   297,
+     298,   299,   300,   301,   302,   104,   305,   306,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
@@ -1271,99 +1261,116 @@ static const yytype_uint16 yystos[] =
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,    10,    10,    10
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
-
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  However,
-   YYFAIL appears to be in use.  Nevertheless, it is formally deprecated
-   in Bison 2.4.2's NEWS entry, where a plan to phase it out is
-   discussed.  */
-
-#define YYFAIL		goto yyerrlab
-#if defined YYFAIL
-  /* This is here to suppress warnings from the GCC cpp's
-     -Wunused-macros.  Normally we don't worry about that warning, but
-     some users do, and we want to make it easy for users to remove
-     YYFAIL uses, which will produce warnings from Bison 2.5.  */
-#endif
-
-#define YYRECOVERING()  (!!yyerrstatus)
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   152,   153,   153,   154,   154,   154,   154,   154,   155,
+     156,   156,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   158,   159,   159,   160,   160,   160,   160,   160,
+     161,   162,   162,   163,   163,   163,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   173,   174,   175,   176,
+     177,   178,   179,   180,   181,   182,   183,   184,   185,   186,
+     187,   188,   189,   190,   191,   192,   193,   194,   195,   196,
+     197,   198,   199,   200,   201,   202,   203,   204,   205,   206,
+     207,   208,   209,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,   220,   221,   222,   223,   224,   225,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,   248,   249,   250,   251,   252,   253,   254,   255,   256,
+     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
+     267,   268,   269,   270,   271,   272,   273,   274,   275,   276,
+     277,   278,   279,   280,   281,   282,   283,   284,   285,   286,
+     287,   288,   289,   290,   291,   292,   293,   294,   294,   295,
+     295,   295,   295,   295,   295,   295,   296,   297,   298,   299,
+     300,   301,   302,   303,   304,   304,   305,   306
+};
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
-   If N is 0, then set CURRENT to the empty location which ends
-   the previous symbol: RHS[0] (always defined).  */
-
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)                                \
-    do                                                                  \
-      if (YYID (N))                                                     \
-        {                                                               \
-          (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
-          (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
-          (Current).last_line    = YYRHSLOC (Rhs, N).last_line;         \
-          (Current).last_column  = YYRHSLOC (Rhs, N).last_column;       \
-        }                                                               \
-      else                                                              \
-        {                                                               \
-          (Current).first_line   = (Current).last_line   =              \
-            YYRHSLOC (Rhs, 0).last_line;                                \
-          (Current).first_column = (Current).last_column =              \
-            YYRHSLOC (Rhs, 0).last_column;                              \
-        }                                                               \
-    while (YYID (0))
-#endif
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     0,     2,     2,     2,     2,     2,     2,     1,
+       2,     0,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     2,     0,     1,     1,     1,     1,     1,
+       1,     2,     0,     1,     1,     1,     1,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     3,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     3,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     0,     1,
+       1,     1,     1,     1,     1,     1,     2,     2,     2,     2,
+       2,     2,     2,     1,     2,     0,     1,     2
+};
 
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
 
+enum { YYENOMEM = -2 };
 
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
 
-/* This macro is provided for backward compatibility. */
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
+#define YYRECOVERING()  (!!yyerrstatus)
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (YYLEX_PARAM)
-#else
-# define YYLEX yylex ()
-#endif
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -1373,82 +1380,58 @@ while (YYID (0))
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
 static void
-yy_symbol_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1456,16 +1439,8 @@ yy_symbol_print (yyoutput, yytype, yyvaluep)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
-#else
 static void
-yy_stack_print (yybottom, yytop)
-    yytype_int16 *yybottom;
-    yytype_int16 *yytop;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1476,63 +1451,56 @@ yy_stack_print (yybottom, yytop)
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule)
-#else
 static void
-yy_reduce_print (yyvsp, yyrule)
-    YYSTYPE *yyvsp;
-    int yyrule;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       );
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -1548,351 +1516,77 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
 
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
 
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULL, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  YYSIZE_T yysize1;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULL;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - Assume YYFAIL is not used.  It's too flawed to consider.  See
-       <http://lists.gnu.org/archive/html/bison-patches/2009-12/msg00024.html>
-       for details.  YYERROR is fine as it does not invoke this
-       function.
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                yysize1 = yysize + yytnamerr (YY_NULL, yytname[yyx]);
-                if (! (yysize <= yysize1
-                       && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                  return 2;
-                yysize = yysize1;
-              }
-        }
-    }
-
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
-
-  yysize1 = yysize + yystrlen (yyformat);
-  if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-    return 2;
-  yysize = yysize1;
-
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
-
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
-#else
 static void
-yydestruct (yymsg, yytype, yyvaluep)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
-
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
-
-  switch (yytype)
-    {
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
 YYSTYPE yylval;
-
 /* Number of syntax errors so far.  */
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 int
 yyparse (void)
-#else
-int
-yyparse ()
-
-#endif
-#endif
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+    int yyerrstatus = 0;
 
-    /* The stacks and their tools:
-       `yyss': related to states.
-       `yyvs': related to semantic values.
-
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -1900,110 +1594,107 @@ yyparse ()
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yytoken = 0;
-  yyss = yyssa;
-  yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
 
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
-  yyssp = yyss;
-  yyvsp = yyvs;
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss_alloc, yyss);
-	YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -2014,18 +1705,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2053,13 +1755,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -2074,14 +1776,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -2094,18 +1796,17 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 9:
-/* Line 1787 of yacc.c  */
-#line 119 "./util/configparser.y"
-    { 
+  case 9: /* serverstart: VAR_SERVER  */
+#line 125 "./util/configparser.y"
+        { 
 		OUTYY(("\nP(server:)\n")); 
 	}
+#line 1805 "util/configparser.c"
     break;
 
-  case 113:
-/* Line 1787 of yacc.c  */
-#line 169 "./util/configparser.y"
-    {
+  case 132: /* stubstart: VAR_STUB_ZONE  */
+#line 183 "./util/configparser.y"
+        {
 		struct config_stub* s;
 		OUTYY(("\nP(stub_zone:)\n")); 
 		s = (struct config_stub*)calloc(1, sizeof(struct config_stub));
@@ -2115,12 +1816,12 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
+#line 1820 "util/configparser.c"
     break;
 
-  case 121:
-/* Line 1787 of yacc.c  */
-#line 185 "./util/configparser.y"
-    {
+  case 140: /* forwardstart: VAR_FORWARD_ZONE  */
+#line 199 "./util/configparser.y"
+        {
 		struct config_stub* s;
 		OUTYY(("\nP(forward_zone:)\n")); 
 		s = (struct config_stub*)calloc(1, sizeof(struct config_stub));
@@ -2130,87 +1831,87 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
+#line 1835 "util/configparser.c"
     break;
 
-  case 128:
-/* Line 1787 of yacc.c  */
-#line 201 "./util/configparser.y"
-    { 
-		OUTYY(("P(server_num_threads:%s)\n", (yyvsp[(2) - (2)].str))); 
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 147: /* server_num_threads: VAR_NUM_THREADS STRING_ARG  */
+#line 215 "./util/configparser.y"
+        { 
+		OUTYY(("P(server_num_threads:%s)\n", (yyvsp[0].str))); 
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->num_threads = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->num_threads = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 1847 "util/configparser.c"
     break;
 
-  case 129:
-/* Line 1787 of yacc.c  */
-#line 210 "./util/configparser.y"
-    { 
-		OUTYY(("P(server_verbosity:%s)\n", (yyvsp[(2) - (2)].str))); 
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 148: /* server_verbosity: VAR_VERBOSITY STRING_ARG  */
+#line 224 "./util/configparser.y"
+        { 
+		OUTYY(("P(server_verbosity:%s)\n", (yyvsp[0].str))); 
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->verbosity = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->verbosity = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 1859 "util/configparser.c"
     break;
 
-  case 130:
-/* Line 1787 of yacc.c  */
-#line 219 "./util/configparser.y"
-    { 
-		OUTYY(("P(server_statistics_interval:%s)\n", (yyvsp[(2) - (2)].str))); 
-		if(strcmp((yyvsp[(2) - (2)].str), "") == 0 || strcmp((yyvsp[(2) - (2)].str), "0") == 0)
+  case 149: /* server_statistics_interval: VAR_STATISTICS_INTERVAL STRING_ARG  */
+#line 233 "./util/configparser.y"
+        { 
+		OUTYY(("P(server_statistics_interval:%s)\n", (yyvsp[0].str))); 
+		if(strcmp((yyvsp[0].str), "") == 0 || strcmp((yyvsp[0].str), "0") == 0)
 			cfg_parser->cfg->stat_interval = 0;
-		else if(atoi((yyvsp[(2) - (2)].str)) == 0)
+		else if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->stat_interval = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->stat_interval = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 1873 "util/configparser.c"
     break;
 
-  case 131:
-/* Line 1787 of yacc.c  */
-#line 230 "./util/configparser.y"
-    {
-		OUTYY(("P(server_statistics_cumulative:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 150: /* server_statistics_cumulative: VAR_STATISTICS_CUMULATIVE STRING_ARG  */
+#line 244 "./util/configparser.y"
+        {
+		OUTYY(("P(server_statistics_cumulative:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->stat_cumulative = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->stat_cumulative = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 1885 "util/configparser.c"
     break;
 
-  case 132:
-/* Line 1787 of yacc.c  */
-#line 239 "./util/configparser.y"
-    {
-		OUTYY(("P(server_extended_statistics:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 151: /* server_extended_statistics: VAR_EXTENDED_STATISTICS STRING_ARG  */
+#line 253 "./util/configparser.y"
+        {
+		OUTYY(("P(server_extended_statistics:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->stat_extended = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->stat_extended = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 1897 "util/configparser.c"
     break;
 
-  case 133:
-/* Line 1787 of yacc.c  */
-#line 248 "./util/configparser.y"
-    {
-		OUTYY(("P(server_port:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 152: /* server_port: VAR_PORT STRING_ARG  */
+#line 262 "./util/configparser.y"
+        {
+		OUTYY(("P(server_port:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("port number expected");
-		else cfg_parser->cfg->port = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->port = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 1909 "util/configparser.c"
     break;
 
-  case 134:
-/* Line 1787 of yacc.c  */
-#line 257 "./util/configparser.y"
-    {
-		OUTYY(("P(server_interface:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 153: /* server_interface: VAR_INTERFACE STRING_ARG  */
+#line 271 "./util/configparser.y"
+        {
+		OUTYY(("P(server_interface:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->num_ifs == 0)
 			cfg_parser->cfg->ifs = calloc(1, sizeof(char*));
 		else 	cfg_parser->cfg->ifs = realloc(cfg_parser->cfg->ifs,
@@ -2218,15 +1919,15 @@ yyreduce:
 		if(!cfg_parser->cfg->ifs)
 			yyerror("out of memory");
 		else
-			cfg_parser->cfg->ifs[cfg_parser->cfg->num_ifs++] = (yyvsp[(2) - (2)].str);
+			cfg_parser->cfg->ifs[cfg_parser->cfg->num_ifs++] = (yyvsp[0].str);
 	}
+#line 1925 "util/configparser.c"
     break;
 
-  case 135:
-/* Line 1787 of yacc.c  */
-#line 270 "./util/configparser.y"
-    {
-		OUTYY(("P(server_outgoing_interface:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 154: /* server_outgoing_interface: VAR_OUTGOING_INTERFACE STRING_ARG  */
+#line 284 "./util/configparser.y"
+        {
+		OUTYY(("P(server_outgoing_interface:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->num_out_ifs == 0)
 			cfg_parser->cfg->out_ifs = calloc(1, sizeof(char*));
 		else 	cfg_parser->cfg->out_ifs = realloc(
@@ -2236,1110 +1937,1338 @@ yyreduce:
 			yyerror("out of memory");
 		else
 			cfg_parser->cfg->out_ifs[
-				cfg_parser->cfg->num_out_ifs++] = (yyvsp[(2) - (2)].str);
+				cfg_parser->cfg->num_out_ifs++] = (yyvsp[0].str);
 	}
+#line 1943 "util/configparser.c"
     break;
 
-  case 136:
-/* Line 1787 of yacc.c  */
-#line 285 "./util/configparser.y"
-    {
-		OUTYY(("P(server_outgoing_range:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 155: /* server_outgoing_range: VAR_OUTGOING_RANGE STRING_ARG  */
+#line 299 "./util/configparser.y"
+        {
+		OUTYY(("P(server_outgoing_range:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->outgoing_num_ports = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->outgoing_num_ports = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 1955 "util/configparser.c"
     break;
 
-  case 137:
-/* Line 1787 of yacc.c  */
-#line 294 "./util/configparser.y"
-    {
-		OUTYY(("P(server_outgoing_port_permit:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_mark_ports((yyvsp[(2) - (2)].str), 1, 
+  case 156: /* server_outgoing_port_permit: VAR_OUTGOING_PORT_PERMIT STRING_ARG  */
+#line 308 "./util/configparser.y"
+        {
+		OUTYY(("P(server_outgoing_port_permit:%s)\n", (yyvsp[0].str)));
+		if(!cfg_mark_ports((yyvsp[0].str), 1, 
 			cfg_parser->cfg->outgoing_avail_ports, 65536))
 			yyerror("port number or range (\"low-high\") expected");
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 1967 "util/configparser.c"
     break;
 
-  case 138:
-/* Line 1787 of yacc.c  */
-#line 303 "./util/configparser.y"
-    {
-		OUTYY(("P(server_outgoing_port_avoid:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_mark_ports((yyvsp[(2) - (2)].str), 0, 
+  case 157: /* server_outgoing_port_avoid: VAR_OUTGOING_PORT_AVOID STRING_ARG  */
+#line 317 "./util/configparser.y"
+        {
+		OUTYY(("P(server_outgoing_port_avoid:%s)\n", (yyvsp[0].str)));
+		if(!cfg_mark_ports((yyvsp[0].str), 0, 
 			cfg_parser->cfg->outgoing_avail_ports, 65536))
 			yyerror("port number or range (\"low-high\") expected");
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 1979 "util/configparser.c"
     break;
 
-  case 139:
-/* Line 1787 of yacc.c  */
-#line 312 "./util/configparser.y"
-    {
-		OUTYY(("P(server_outgoing_num_tcp:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 158: /* server_outgoing_num_tcp: VAR_OUTGOING_NUM_TCP STRING_ARG  */
+#line 326 "./util/configparser.y"
+        {
+		OUTYY(("P(server_outgoing_num_tcp:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->outgoing_num_tcp = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->outgoing_num_tcp = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 1991 "util/configparser.c"
     break;
 
-  case 140:
-/* Line 1787 of yacc.c  */
-#line 321 "./util/configparser.y"
-    {
-		OUTYY(("P(server_incoming_num_tcp:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 159: /* server_incoming_num_tcp: VAR_INCOMING_NUM_TCP STRING_ARG  */
+#line 335 "./util/configparser.y"
+        {
+		OUTYY(("P(server_incoming_num_tcp:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->incoming_num_tcp = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->incoming_num_tcp = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2003 "util/configparser.c"
     break;
 
-  case 141:
-/* Line 1787 of yacc.c  */
-#line 330 "./util/configparser.y"
-    {
-		OUTYY(("P(server_interface_automatic:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 160: /* server_interface_automatic: VAR_INTERFACE_AUTOMATIC STRING_ARG  */
+#line 344 "./util/configparser.y"
+        {
+		OUTYY(("P(server_interface_automatic:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->if_automatic = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->if_automatic = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2015 "util/configparser.c"
     break;
 
-  case 142:
-/* Line 1787 of yacc.c  */
-#line 339 "./util/configparser.y"
-    {
-		OUTYY(("P(server_do_ip4:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 161: /* server_do_ip4: VAR_DO_IP4 STRING_ARG  */
+#line 353 "./util/configparser.y"
+        {
+		OUTYY(("P(server_do_ip4:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->do_ip4 = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->do_ip4 = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2027 "util/configparser.c"
     break;
 
-  case 143:
-/* Line 1787 of yacc.c  */
-#line 348 "./util/configparser.y"
-    {
-		OUTYY(("P(server_do_ip6:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 162: /* server_do_ip6: VAR_DO_IP6 STRING_ARG  */
+#line 362 "./util/configparser.y"
+        {
+		OUTYY(("P(server_do_ip6:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->do_ip6 = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->do_ip6 = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2039 "util/configparser.c"
     break;
 
-  case 144:
-/* Line 1787 of yacc.c  */
-#line 357 "./util/configparser.y"
-    {
-		OUTYY(("P(server_do_udp:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 163: /* server_do_udp: VAR_DO_UDP STRING_ARG  */
+#line 371 "./util/configparser.y"
+        {
+		OUTYY(("P(server_do_udp:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->do_udp = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->do_udp = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2051 "util/configparser.c"
     break;
 
-  case 145:
-/* Line 1787 of yacc.c  */
-#line 366 "./util/configparser.y"
-    {
-		OUTYY(("P(server_do_tcp:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 164: /* server_do_tcp: VAR_DO_TCP STRING_ARG  */
+#line 380 "./util/configparser.y"
+        {
+		OUTYY(("P(server_do_tcp:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->do_tcp = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->do_tcp = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2063 "util/configparser.c"
     break;
 
-  case 146:
-/* Line 1787 of yacc.c  */
-#line 375 "./util/configparser.y"
-    {
-		OUTYY(("P(server_tcp_upstream:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 165: /* server_tcp_upstream: VAR_TCP_UPSTREAM STRING_ARG  */
+#line 389 "./util/configparser.y"
+        {
+		OUTYY(("P(server_tcp_upstream:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->tcp_upstream = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->tcp_upstream = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2075 "util/configparser.c"
     break;
 
-  case 147:
-/* Line 1787 of yacc.c  */
-#line 384 "./util/configparser.y"
-    {
-		OUTYY(("P(server_ssl_upstream:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 166: /* server_ssl_upstream: VAR_SSL_UPSTREAM STRING_ARG  */
+#line 398 "./util/configparser.y"
+        {
+		OUTYY(("P(server_ssl_upstream:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->ssl_upstream = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->ssl_upstream = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2087 "util/configparser.c"
     break;
 
-  case 148:
-/* Line 1787 of yacc.c  */
-#line 393 "./util/configparser.y"
-    {
-		OUTYY(("P(server_ssl_service_key:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 167: /* server_ssl_service_key: VAR_SSL_SERVICE_KEY STRING_ARG  */
+#line 407 "./util/configparser.y"
+        {
+		OUTYY(("P(server_ssl_service_key:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ssl_service_key);
-		cfg_parser->cfg->ssl_service_key = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->ssl_service_key = (yyvsp[0].str);
 	}
+#line 2097 "util/configparser.c"
     break;
 
-  case 149:
-/* Line 1787 of yacc.c  */
-#line 400 "./util/configparser.y"
-    {
-		OUTYY(("P(server_ssl_service_pem:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 168: /* server_ssl_service_pem: VAR_SSL_SERVICE_PEM STRING_ARG  */
+#line 414 "./util/configparser.y"
+        {
+		OUTYY(("P(server_ssl_service_pem:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ssl_service_pem);
-		cfg_parser->cfg->ssl_service_pem = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->ssl_service_pem = (yyvsp[0].str);
 	}
+#line 2107 "util/configparser.c"
     break;
 
-  case 150:
-/* Line 1787 of yacc.c  */
-#line 407 "./util/configparser.y"
-    {
-		OUTYY(("P(server_ssl_port:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 169: /* server_ssl_session_ticket_keys: VAR_SSL_SESSION_TICKET_KEYS STRING_ARG  */
+#line 421 "./util/configparser.y"
+        {
+		OUTYY(("P(server_ssl_session_ticket_keys:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->
+			ssl_session_ticket_keys, (yyvsp[0].str)))
+			yyerror("out of memory");
+	}
+#line 2118 "util/configparser.c"
+    break;
+
+  case 170: /* server_ssl_port: VAR_SSL_PORT STRING_ARG  */
+#line 429 "./util/configparser.y"
+        {
+		OUTYY(("P(server_ssl_port:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("port number expected");
-		else cfg_parser->cfg->ssl_port = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->ssl_port = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2130 "util/configparser.c"
     break;
 
-  case 151:
-/* Line 1787 of yacc.c  */
-#line 416 "./util/configparser.y"
-    {
-		OUTYY(("P(server_do_daemonize:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 171: /* server_do_daemonize: VAR_DO_DAEMONIZE STRING_ARG  */
+#line 438 "./util/configparser.y"
+        {
+		OUTYY(("P(server_do_daemonize:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->do_daemonize = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->do_daemonize = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2142 "util/configparser.c"
     break;
 
-  case 152:
-/* Line 1787 of yacc.c  */
-#line 425 "./util/configparser.y"
-    {
-		OUTYY(("P(server_use_syslog:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 172: /* server_use_syslog: VAR_USE_SYSLOG STRING_ARG  */
+#line 447 "./util/configparser.y"
+        {
+		OUTYY(("P(server_use_syslog:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->use_syslog = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
+		else cfg_parser->cfg->use_syslog = (strcmp((yyvsp[0].str), "yes")==0);
 #if !defined(HAVE_SYSLOG_H) && !defined(UB_ON_WINDOWS)
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") == 0)
+		if(strcmp((yyvsp[0].str), "yes") == 0)
 			yyerror("no syslog services are available. "
 				"(reconfigure and compile to add)");
 #endif
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 2159 "util/configparser.c"
     break;
 
-  case 153:
-/* Line 1787 of yacc.c  */
-#line 439 "./util/configparser.y"
-    {
-		OUTYY(("P(server_log_time_ascii:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 173: /* server_log_time_ascii: VAR_LOG_TIME_ASCII STRING_ARG  */
+#line 461 "./util/configparser.y"
+        {
+		OUTYY(("P(server_log_time_ascii:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->log_time_ascii = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->log_time_ascii = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2171 "util/configparser.c"
     break;
 
-  case 154:
-/* Line 1787 of yacc.c  */
-#line 448 "./util/configparser.y"
-    {
-		OUTYY(("P(server_log_queries:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 174: /* server_log_queries: VAR_LOG_QUERIES STRING_ARG  */
+#line 470 "./util/configparser.y"
+        {
+		OUTYY(("P(server_log_queries:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->log_queries = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->log_queries = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2183 "util/configparser.c"
     break;
 
-  case 155:
-/* Line 1787 of yacc.c  */
-#line 457 "./util/configparser.y"
-    {
-		OUTYY(("P(server_chroot:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 175: /* server_chroot: VAR_CHROOT STRING_ARG  */
+#line 479 "./util/configparser.y"
+        {
+		OUTYY(("P(server_chroot:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->chrootdir);
-		cfg_parser->cfg->chrootdir = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->chrootdir = (yyvsp[0].str);
 	}
+#line 2193 "util/configparser.c"
     break;
 
-  case 156:
-/* Line 1787 of yacc.c  */
-#line 464 "./util/configparser.y"
-    {
-		OUTYY(("P(server_username:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 176: /* server_username: VAR_USERNAME STRING_ARG  */
+#line 486 "./util/configparser.y"
+        {
+		OUTYY(("P(server_username:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->username);
-		cfg_parser->cfg->username = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->username = (yyvsp[0].str);
 	}
+#line 2203 "util/configparser.c"
     break;
 
-  case 157:
-/* Line 1787 of yacc.c  */
-#line 471 "./util/configparser.y"
-    {
-		OUTYY(("P(server_directory:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 177: /* server_directory: VAR_DIRECTORY STRING_ARG  */
+#line 493 "./util/configparser.y"
+        {
+		OUTYY(("P(server_directory:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->directory);
-		cfg_parser->cfg->directory = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->directory = (yyvsp[0].str);
 	}
+#line 2213 "util/configparser.c"
     break;
 
-  case 158:
-/* Line 1787 of yacc.c  */
-#line 478 "./util/configparser.y"
-    {
-		OUTYY(("P(server_logfile:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 178: /* server_logfile: VAR_LOGFILE STRING_ARG  */
+#line 500 "./util/configparser.y"
+        {
+		OUTYY(("P(server_logfile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->logfile);
-		cfg_parser->cfg->logfile = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->logfile = (yyvsp[0].str);
 		cfg_parser->cfg->use_syslog = 0;
 	}
+#line 2224 "util/configparser.c"
     break;
 
-  case 159:
-/* Line 1787 of yacc.c  */
-#line 486 "./util/configparser.y"
-    {
-		OUTYY(("P(server_pidfile:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 179: /* server_pidfile: VAR_PIDFILE STRING_ARG  */
+#line 508 "./util/configparser.y"
+        {
+		OUTYY(("P(server_pidfile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->pidfile);
-		cfg_parser->cfg->pidfile = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->pidfile = (yyvsp[0].str);
 	}
+#line 2234 "util/configparser.c"
     break;
 
-  case 160:
-/* Line 1787 of yacc.c  */
-#line 493 "./util/configparser.y"
-    {
-		OUTYY(("P(server_root_hints:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->root_hints, (yyvsp[(2) - (2)].str)))
+  case 180: /* server_root_hints: VAR_ROOT_HINTS STRING_ARG  */
+#line 515 "./util/configparser.y"
+        {
+		OUTYY(("P(server_root_hints:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->root_hints, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 2244 "util/configparser.c"
     break;
 
-  case 161:
-/* Line 1787 of yacc.c  */
-#line 500 "./util/configparser.y"
-    {
-		OUTYY(("P(server_dlv_anchor_file:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 181: /* server_dlv_anchor_file: VAR_DLV_ANCHOR_FILE STRING_ARG  */
+#line 522 "./util/configparser.y"
+        {
+		OUTYY(("P(server_dlv_anchor_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dlv_anchor_file);
-		cfg_parser->cfg->dlv_anchor_file = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->dlv_anchor_file = (yyvsp[0].str);
 	}
+#line 2254 "util/configparser.c"
     break;
 
-  case 162:
-/* Line 1787 of yacc.c  */
-#line 507 "./util/configparser.y"
-    {
-		OUTYY(("P(server_dlv_anchor:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->dlv_anchor_list, (yyvsp[(2) - (2)].str)))
+  case 182: /* server_dlv_anchor: VAR_DLV_ANCHOR STRING_ARG  */
+#line 529 "./util/configparser.y"
+        {
+		OUTYY(("P(server_dlv_anchor:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->dlv_anchor_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 2264 "util/configparser.c"
     break;
 
-  case 163:
-/* Line 1787 of yacc.c  */
-#line 514 "./util/configparser.y"
-    {
-		OUTYY(("P(server_auto_trust_anchor_file:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 183: /* server_auto_trust_anchor_file: VAR_AUTO_TRUST_ANCHOR_FILE STRING_ARG  */
+#line 536 "./util/configparser.y"
+        {
+		OUTYY(("P(server_auto_trust_anchor_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
-			auto_trust_anchor_file_list, (yyvsp[(2) - (2)].str)))
+			auto_trust_anchor_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 2275 "util/configparser.c"
     break;
 
-  case 164:
-/* Line 1787 of yacc.c  */
-#line 522 "./util/configparser.y"
-    {
-		OUTYY(("P(server_trust_anchor_file:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 184: /* server_trust_anchor_file: VAR_TRUST_ANCHOR_FILE STRING_ARG  */
+#line 544 "./util/configparser.y"
+        {
+		OUTYY(("P(server_trust_anchor_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
-			trust_anchor_file_list, (yyvsp[(2) - (2)].str)))
+			trust_anchor_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 2286 "util/configparser.c"
     break;
 
-  case 165:
-/* Line 1787 of yacc.c  */
-#line 530 "./util/configparser.y"
-    {
-		OUTYY(("P(server_trusted_keys_file:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 185: /* server_trusted_keys_file: VAR_TRUSTED_KEYS_FILE STRING_ARG  */
+#line 552 "./util/configparser.y"
+        {
+		OUTYY(("P(server_trusted_keys_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
-			trusted_keys_file_list, (yyvsp[(2) - (2)].str)))
+			trusted_keys_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 2297 "util/configparser.c"
     break;
 
-  case 166:
-/* Line 1787 of yacc.c  */
-#line 538 "./util/configparser.y"
-    {
-		OUTYY(("P(server_trust_anchor:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->trust_anchor_list, (yyvsp[(2) - (2)].str)))
+  case 186: /* server_trust_anchor: VAR_TRUST_ANCHOR STRING_ARG  */
+#line 560 "./util/configparser.y"
+        {
+		OUTYY(("P(server_trust_anchor:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->trust_anchor_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 2307 "util/configparser.c"
     break;
 
-  case 167:
-/* Line 1787 of yacc.c  */
-#line 545 "./util/configparser.y"
-    {
-		OUTYY(("P(server_domain_insecure:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->domain_insecure, (yyvsp[(2) - (2)].str)))
+  case 187: /* server_domain_insecure: VAR_DOMAIN_INSECURE STRING_ARG  */
+#line 567 "./util/configparser.y"
+        {
+		OUTYY(("P(server_domain_insecure:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->domain_insecure, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 2317 "util/configparser.c"
     break;
 
-  case 168:
-/* Line 1787 of yacc.c  */
-#line 552 "./util/configparser.y"
-    {
-		OUTYY(("P(server_hide_identity:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 188: /* server_hide_identity: VAR_HIDE_IDENTITY STRING_ARG  */
+#line 574 "./util/configparser.y"
+        {
+		OUTYY(("P(server_hide_identity:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->hide_identity = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->hide_identity = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2329 "util/configparser.c"
     break;
 
-  case 169:
-/* Line 1787 of yacc.c  */
-#line 561 "./util/configparser.y"
-    {
-		OUTYY(("P(server_hide_version:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 189: /* server_hide_version: VAR_HIDE_VERSION STRING_ARG  */
+#line 583 "./util/configparser.y"
+        {
+		OUTYY(("P(server_hide_version:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->hide_version = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->hide_version = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2341 "util/configparser.c"
     break;
 
-  case 170:
-/* Line 1787 of yacc.c  */
-#line 570 "./util/configparser.y"
-    {
-		OUTYY(("P(server_identity:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 190: /* server_identity: VAR_IDENTITY STRING_ARG  */
+#line 592 "./util/configparser.y"
+        {
+		OUTYY(("P(server_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->identity);
-		cfg_parser->cfg->identity = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->identity = (yyvsp[0].str);
 	}
+#line 2351 "util/configparser.c"
     break;
 
-  case 171:
-/* Line 1787 of yacc.c  */
-#line 577 "./util/configparser.y"
-    {
-		OUTYY(("P(server_version:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 191: /* server_version: VAR_VERSION STRING_ARG  */
+#line 599 "./util/configparser.y"
+        {
+		OUTYY(("P(server_version:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->version);
-		cfg_parser->cfg->version = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->version = (yyvsp[0].str);
 	}
+#line 2361 "util/configparser.c"
     break;
 
-  case 172:
-/* Line 1787 of yacc.c  */
-#line 584 "./util/configparser.y"
-    {
-		OUTYY(("P(server_so_rcvbuf:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_parse_memsize((yyvsp[(2) - (2)].str), &cfg_parser->cfg->so_rcvbuf))
+  case 192: /* server_so_rcvbuf: VAR_SO_RCVBUF STRING_ARG  */
+#line 606 "./util/configparser.y"
+        {
+		OUTYY(("P(server_so_rcvbuf:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->so_rcvbuf))
 			yyerror("buffer size expected");
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 2372 "util/configparser.c"
     break;
 
-  case 173:
-/* Line 1787 of yacc.c  */
-#line 592 "./util/configparser.y"
-    {
-		OUTYY(("P(server_so_sndbuf:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_parse_memsize((yyvsp[(2) - (2)].str), &cfg_parser->cfg->so_sndbuf))
+  case 193: /* server_so_sndbuf: VAR_SO_SNDBUF STRING_ARG  */
+#line 614 "./util/configparser.y"
+        {
+		OUTYY(("P(server_so_sndbuf:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->so_sndbuf))
 			yyerror("buffer size expected");
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 2383 "util/configparser.c"
     break;
 
-  case 174:
-/* Line 1787 of yacc.c  */
-#line 600 "./util/configparser.y"
+  case 194: /* server_so_reuseport: VAR_SO_REUSEPORT STRING_ARG  */
+#line 622 "./util/configparser.y"
     {
-        OUTYY(("P(server_so_reuseport:%s)\n", (yyvsp[(2) - (2)].str)));
-        if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+        OUTYY(("P(server_so_reuseport:%s)\n", (yyvsp[0].str)));
+        if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
             yyerror("expected yes or no.");
         else cfg_parser->cfg->so_reuseport =
-            (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-        free((yyvsp[(2) - (2)].str));
+            (strcmp((yyvsp[0].str), "yes")==0);
+        free((yyvsp[0].str));
     }
+#line 2396 "util/configparser.c"
     break;
 
-  case 175:
-/* Line 1787 of yacc.c  */
-#line 610 "./util/configparser.y"
-    {
-		OUTYY(("P(server_edns_buffer_size:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 195: /* server_edns_buffer_size: VAR_EDNS_BUFFER_SIZE STRING_ARG  */
+#line 632 "./util/configparser.y"
+        {
+		OUTYY(("P(server_edns_buffer_size:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
-		else if (atoi((yyvsp[(2) - (2)].str)) < 12)
+		else if (atoi((yyvsp[0].str)) < 12)
 			yyerror("edns buffer size too small");
-		else if (atoi((yyvsp[(2) - (2)].str)) > 65535)
+		else if (atoi((yyvsp[0].str)) > 65535)
 			cfg_parser->cfg->edns_buffer_size = 65535;
-		else cfg_parser->cfg->edns_buffer_size = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->edns_buffer_size = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2412 "util/configparser.c"
     break;
 
-  case 176:
-/* Line 1787 of yacc.c  */
-#line 623 "./util/configparser.y"
-    {
-		OUTYY(("P(server_msg_buffer_size:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 196: /* server_msg_buffer_size: VAR_MSG_BUFFER_SIZE STRING_ARG  */
+#line 645 "./util/configparser.y"
+        {
+		OUTYY(("P(server_msg_buffer_size:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
-		else if (atoi((yyvsp[(2) - (2)].str)) < 4096)
+		else if (atoi((yyvsp[0].str)) < 4096)
 			yyerror("message buffer size too small (use 4096)");
-		else cfg_parser->cfg->msg_buffer_size = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->msg_buffer_size = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2426 "util/configparser.c"
     break;
 
-  case 177:
-/* Line 1787 of yacc.c  */
-#line 634 "./util/configparser.y"
-    {
-		OUTYY(("P(server_msg_cache_size:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_parse_memsize((yyvsp[(2) - (2)].str), &cfg_parser->cfg->msg_cache_size))
+  case 197: /* server_msg_cache_size: VAR_MSG_CACHE_SIZE STRING_ARG  */
+#line 656 "./util/configparser.y"
+        {
+		OUTYY(("P(server_msg_cache_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->msg_cache_size))
 			yyerror("memory size expected");
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 2437 "util/configparser.c"
     break;
 
-  case 178:
-/* Line 1787 of yacc.c  */
-#line 642 "./util/configparser.y"
-    {
-		OUTYY(("P(server_msg_cache_slabs:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 198: /* server_msg_cache_slabs: VAR_MSG_CACHE_SLABS STRING_ARG  */
+#line 664 "./util/configparser.y"
+        {
+		OUTYY(("P(server_msg_cache_slabs:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else {
-			cfg_parser->cfg->msg_cache_slabs = atoi((yyvsp[(2) - (2)].str));
+			cfg_parser->cfg->msg_cache_slabs = atoi((yyvsp[0].str));
 			if(!is_pow2(cfg_parser->cfg->msg_cache_slabs))
 				yyerror("must be a power of 2");
 		}
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 2453 "util/configparser.c"
     break;
 
-  case 179:
-/* Line 1787 of yacc.c  */
-#line 655 "./util/configparser.y"
-    {
-		OUTYY(("P(server_num_queries_per_thread:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 199: /* server_msg_cache_l1_slots: VAR_MSG_CACHE_L1_SLOTS STRING_ARG  */
+#line 677 "./util/configparser.y"
+        {
+		OUTYY(("P(server_msg_cache_l1_slots:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->num_queries_per_thread = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->msg_cache_l1_slots = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2465 "util/configparser.c"
     break;
 
-  case 180:
-/* Line 1787 of yacc.c  */
-#line 664 "./util/configparser.y"
-    {
-		OUTYY(("P(server_jostle_timeout:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 200: /* server_num_queries_per_thread: VAR_NUM_QUERIES_PER_THREAD STRING_ARG  */
+#line 686 "./util/configparser.y"
+        {
+		OUTYY(("P(server_num_queries_per_thread:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->jostle_time = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->num_queries_per_thread = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2477 "util/configparser.c"
     break;
 
-  case 181:
-/* Line 1787 of yacc.c  */
-#line 673 "./util/configparser.y"
-    {
-		OUTYY(("P(server_delay_close:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 201: /* server_jostle_timeout: VAR_JOSTLE_TIMEOUT STRING_ARG  */
+#line 695 "./util/configparser.y"
+        {
+		OUTYY(("P(server_jostle_timeout:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->delay_close = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->jostle_time = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2489 "util/configparser.c"
     break;
 
-  case 182:
-/* Line 1787 of yacc.c  */
-#line 682 "./util/configparser.y"
-    {
-		OUTYY(("P(server_rrset_cache_size:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_parse_memsize((yyvsp[(2) - (2)].str), &cfg_parser->cfg->rrset_cache_size))
+  case 202: /* server_delay_close: VAR_DELAY_CLOSE STRING_ARG  */
+#line 704 "./util/configparser.y"
+        {
+		OUTYY(("P(server_delay_close:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->delay_close = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2501 "util/configparser.c"
+    break;
+
+  case 203: /* server_tcp_idle_timeout: VAR_TCP_IDLE_TIMEOUT STRING_ARG  */
+#line 713 "./util/configparser.y"
+        {
+		OUTYY(("P(server_tcp_idle_timeout:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->tcp_idle_timeout = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2513 "util/configparser.c"
+    break;
+
+  case 204: /* server_tcp_fastopen: VAR_TCP_FASTOPEN STRING_ARG  */
+#line 722 "./util/configparser.y"
+        {
+		OUTYY(("P(server_tcp_fastopen:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->tcp_fastopen = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 2525 "util/configparser.c"
+    break;
+
+  case 205: /* server_tcp_upstream_fastopen: VAR_TCP_UPSTREAM_FASTOPEN STRING_ARG  */
+#line 731 "./util/configparser.y"
+        {
+		OUTYY(("P(server_tcp_upstream_fastopen:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->tcp_upstream_fastopen = 
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 2538 "util/configparser.c"
+    break;
+
+  case 206: /* server_rrl_ratelimit: VAR_RRL_RATELIMIT STRING_ARG  */
+#line 741 "./util/configparser.y"
+        {
+		OUTYY(("P(server_rrl_ratelimit:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->rrl_ratelimit = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2550 "util/configparser.c"
+    break;
+
+  case 207: /* server_rrl_slip: VAR_RRL_SLIP STRING_ARG  */
+#line 750 "./util/configparser.y"
+        {
+		OUTYY(("P(server_rrl_slip:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->rrl_slip = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2562 "util/configparser.c"
+    break;
+
+  case 208: /* server_rrl_ipv4_prefix: VAR_RRL_IPV4_PREFIX STRING_ARG  */
+#line 759 "./util/configparser.y"
+        {
+		OUTYY(("P(server_rrl_ipv4_prefix:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->rrl_ipv4_prefix = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2574 "util/configparser.c"
+    break;
+
+  case 209: /* server_rrl_ipv6_prefix: VAR_RRL_IPV6_PREFIX STRING_ARG  */
+#line 768 "./util/configparser.y"
+        {
+		OUTYY(("P(server_rrl_ipv6_prefix:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->rrl_ipv6_prefix = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2586 "util/configparser.c"
+    break;
+
+  case 210: /* server_rrl_size: VAR_RRL_SIZE STRING_ARG  */
+#line 777 "./util/configparser.y"
+        {
+		OUTYY(("P(server_rrl_size:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->rrl_size = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2598 "util/configparser.c"
+    break;
+
+  case 211: /* server_upstream_zone_ratelimit: VAR_UPSTREAM_ZONE_RATELIMIT STRING_ARG  */
+#line 786 "./util/configparser.y"
+        {
+		OUTYY(("P(server_upstream_zone_ratelimit:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->upstream_zone_ratelimit = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2610 "util/configparser.c"
+    break;
+
+  case 212: /* server_upstream_server_ratelimit: VAR_UPSTREAM_SERVER_RATELIMIT STRING_ARG  */
+#line 795 "./util/configparser.y"
+        {
+		OUTYY(("P(server_upstream_server_ratelimit:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->upstream_server_ratelimit = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2622 "util/configparser.c"
+    break;
+
+  case 213: /* server_upstream_ratelimit_size: VAR_UPSTREAM_RATELIMIT_SIZE STRING_ARG  */
+#line 804 "./util/configparser.y"
+        {
+		OUTYY(("P(server_upstream_ratelimit_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->
+			upstream_ratelimit_size))
 			yyerror("memory size expected");
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 2634 "util/configparser.c"
     break;
 
-  case 183:
-/* Line 1787 of yacc.c  */
-#line 690 "./util/configparser.y"
-    {
-		OUTYY(("P(server_rrset_cache_slabs:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 214: /* server_region_presize: VAR_REGION_PRESIZE STRING_ARG  */
+#line 813 "./util/configparser.y"
+        {
+		OUTYY(("P(server_region_presize:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->
+			region_presize))
+			yyerror("memory size expected");
+		free((yyvsp[0].str));
+	}
+#line 2646 "util/configparser.c"
+    break;
+
+  case 215: /* server_cache_hugepages: VAR_CACHE_HUGEPAGES STRING_ARG  */
+#line 822 "./util/configparser.y"
+        {
+		OUTYY(("P(server_cache_hugepages:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->cache_hugepages = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 2658 "util/configparser.c"
+    break;
+
+  case 216: /* server_cache_admission_filter: VAR_CACHE_ADMISSION_FILTER STRING_ARG  */
+#line 831 "./util/configparser.y"
+        {
+		OUTYY(("P(server_cache_admission_filter:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->cache_admission_filter = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 2670 "util/configparser.c"
+    break;
+
+  case 217: /* server_cache_expiry_scan: VAR_CACHE_EXPIRY_SCAN STRING_ARG  */
+#line 840 "./util/configparser.y"
+        {
+		OUTYY(("P(server_cache_expiry_scan:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->cache_expiry_scan = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2682 "util/configparser.c"
+    break;
+
+  case 218: /* server_rrset_cache_size: VAR_RRSET_CACHE_SIZE STRING_ARG  */
+#line 849 "./util/configparser.y"
+        {
+		OUTYY(("P(server_rrset_cache_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->rrset_cache_size))
+			yyerror("memory size expected");
+		free((yyvsp[0].str));
+	}
+#line 2693 "util/configparser.c"
+    break;
+
+  case 219: /* server_rrset_cache_slabs: VAR_RRSET_CACHE_SLABS STRING_ARG  */
+#line 857 "./util/configparser.y"
+        {
+		OUTYY(("P(server_rrset_cache_slabs:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else {
-			cfg_parser->cfg->rrset_cache_slabs = atoi((yyvsp[(2) - (2)].str));
+			cfg_parser->cfg->rrset_cache_slabs = atoi((yyvsp[0].str));
 			if(!is_pow2(cfg_parser->cfg->rrset_cache_slabs))
 				yyerror("must be a power of 2");
 		}
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 2709 "util/configparser.c"
     break;
 
-  case 184:
-/* Line 1787 of yacc.c  */
-#line 703 "./util/configparser.y"
-    {
-		OUTYY(("P(server_infra_host_ttl:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 220: /* server_infra_host_ttl: VAR_INFRA_HOST_TTL STRING_ARG  */
+#line 870 "./util/configparser.y"
+        {
+		OUTYY(("P(server_infra_host_ttl:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->host_ttl = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->host_ttl = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2721 "util/configparser.c"
     break;
 
-  case 185:
-/* Line 1787 of yacc.c  */
-#line 712 "./util/configparser.y"
-    {
-		OUTYY(("P(server_infra_lame_ttl:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 221: /* server_infra_lame_ttl: VAR_INFRA_LAME_TTL STRING_ARG  */
+#line 879 "./util/configparser.y"
+        {
+		OUTYY(("P(server_infra_lame_ttl:%s)\n", (yyvsp[0].str)));
 		verbose(VERB_DETAIL, "ignored infra-lame-ttl: %s (option "
-			"removed, use infra-host-ttl)", (yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+			"removed, use infra-host-ttl)", (yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2732 "util/configparser.c"
     break;
 
-  case 186:
-/* Line 1787 of yacc.c  */
-#line 720 "./util/configparser.y"
-    {
-		OUTYY(("P(server_infra_cache_numhosts:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 222: /* server_infra_cache_numhosts: VAR_INFRA_CACHE_NUMHOSTS STRING_ARG  */
+#line 887 "./util/configparser.y"
+        {
+		OUTYY(("P(server_infra_cache_numhosts:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->infra_cache_numhosts = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->infra_cache_numhosts = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2744 "util/configparser.c"
     break;
 
-  case 187:
-/* Line 1787 of yacc.c  */
-#line 729 "./util/configparser.y"
-    {
-		OUTYY(("P(server_infra_cache_lame_size:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 223: /* server_infra_cache_lame_size: VAR_INFRA_CACHE_LAME_SIZE STRING_ARG  */
+#line 896 "./util/configparser.y"
+        {
+		OUTYY(("P(server_infra_cache_lame_size:%s)\n", (yyvsp[0].str)));
 		verbose(VERB_DETAIL, "ignored infra-cache-lame-size: %s "
-			"(option removed, use infra-cache-numhosts)", (yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+			"(option removed, use infra-cache-numhosts)", (yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2755 "util/configparser.c"
     break;
 
-  case 188:
-/* Line 1787 of yacc.c  */
-#line 737 "./util/configparser.y"
-    {
-		OUTYY(("P(server_infra_cache_slabs:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 224: /* server_infra_cache_slabs: VAR_INFRA_CACHE_SLABS STRING_ARG  */
+#line 904 "./util/configparser.y"
+        {
+		OUTYY(("P(server_infra_cache_slabs:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else {
-			cfg_parser->cfg->infra_cache_slabs = atoi((yyvsp[(2) - (2)].str));
+			cfg_parser->cfg->infra_cache_slabs = atoi((yyvsp[0].str));
 			if(!is_pow2(cfg_parser->cfg->infra_cache_slabs))
 				yyerror("must be a power of 2");
 		}
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 2771 "util/configparser.c"
     break;
 
-  case 189:
-/* Line 1787 of yacc.c  */
-#line 750 "./util/configparser.y"
-    {
-		OUTYY(("P(server_target_fetch_policy:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 225: /* server_target_fetch_policy: VAR_TARGET_FETCH_POLICY STRING_ARG  */
+#line 917 "./util/configparser.y"
+        {
+		OUTYY(("P(server_target_fetch_policy:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->target_fetch_policy);
-		cfg_parser->cfg->target_fetch_policy = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->target_fetch_policy = (yyvsp[0].str);
 	}
+#line 2781 "util/configparser.c"
     break;
 
-  case 190:
-/* Line 1787 of yacc.c  */
-#line 757 "./util/configparser.y"
-    {
-		OUTYY(("P(server_harden_short_bufsize:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 226: /* server_harden_short_bufsize: VAR_HARDEN_SHORT_BUFSIZE STRING_ARG  */
+#line 924 "./util/configparser.y"
+        {
+		OUTYY(("P(server_harden_short_bufsize:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->harden_short_bufsize = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2794 "util/configparser.c"
     break;
 
-  case 191:
-/* Line 1787 of yacc.c  */
-#line 767 "./util/configparser.y"
-    {
-		OUTYY(("P(server_harden_large_queries:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 227: /* server_harden_large_queries: VAR_HARDEN_LARGE_QUERIES STRING_ARG  */
+#line 934 "./util/configparser.y"
+        {
+		OUTYY(("P(server_harden_large_queries:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->harden_large_queries = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2807 "util/configparser.c"
     break;
 
-  case 192:
-/* Line 1787 of yacc.c  */
-#line 777 "./util/configparser.y"
-    {
-		OUTYY(("P(server_harden_glue:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 228: /* server_harden_glue: VAR_HARDEN_GLUE STRING_ARG  */
+#line 944 "./util/configparser.y"
+        {
+		OUTYY(("P(server_harden_glue:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->harden_glue = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2820 "util/configparser.c"
     break;
 
-  case 193:
-/* Line 1787 of yacc.c  */
-#line 787 "./util/configparser.y"
-    {
-		OUTYY(("P(server_harden_dnssec_stripped:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 229: /* server_harden_dnssec_stripped: VAR_HARDEN_DNSSEC_STRIPPED STRING_ARG  */
+#line 954 "./util/configparser.y"
+        {
+		OUTYY(("P(server_harden_dnssec_stripped:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->harden_dnssec_stripped = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2833 "util/configparser.c"
     break;
 
-  case 194:
-/* Line 1787 of yacc.c  */
-#line 797 "./util/configparser.y"
-    {
-		OUTYY(("P(server_harden_below_nxdomain:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 230: /* server_harden_below_nxdomain: VAR_HARDEN_BELOW_NXDOMAIN STRING_ARG  */
+#line 964 "./util/configparser.y"
+        {
+		OUTYY(("P(server_harden_below_nxdomain:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->harden_below_nxdomain = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2846 "util/configparser.c"
     break;
 
-  case 195:
-/* Line 1787 of yacc.c  */
-#line 807 "./util/configparser.y"
-    {
-		OUTYY(("P(server_harden_referral_path:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 231: /* server_harden_referral_path: VAR_HARDEN_REFERRAL_PATH STRING_ARG  */
+#line 974 "./util/configparser.y"
+        {
+		OUTYY(("P(server_harden_referral_path:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->harden_referral_path = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2859 "util/configparser.c"
     break;
 
-  case 196:
-/* Line 1787 of yacc.c  */
-#line 817 "./util/configparser.y"
-    {
-		OUTYY(("P(server_use_caps_for_id:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 232: /* server_use_caps_for_id: VAR_USE_CAPS_FOR_ID STRING_ARG  */
+#line 984 "./util/configparser.y"
+        {
+		OUTYY(("P(server_use_caps_for_id:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->use_caps_bits_for_id = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2872 "util/configparser.c"
     break;
 
-  case 197:
-/* Line 1787 of yacc.c  */
-#line 827 "./util/configparser.y"
-    {
-		OUTYY(("P(server_private_address:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->private_address, (yyvsp[(2) - (2)].str)))
+  case 233: /* server_private_address: VAR_PRIVATE_ADDRESS STRING_ARG  */
+#line 994 "./util/configparser.y"
+        {
+		OUTYY(("P(server_private_address:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->private_address, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 2882 "util/configparser.c"
     break;
 
-  case 198:
-/* Line 1787 of yacc.c  */
-#line 834 "./util/configparser.y"
-    {
-		OUTYY(("P(server_private_domain:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->private_domain, (yyvsp[(2) - (2)].str)))
+  case 234: /* server_private_domain: VAR_PRIVATE_DOMAIN STRING_ARG  */
+#line 1001 "./util/configparser.y"
+        {
+		OUTYY(("P(server_private_domain:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->private_domain, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 2892 "util/configparser.c"
     break;
 
-  case 199:
-/* Line 1787 of yacc.c  */
-#line 841 "./util/configparser.y"
-    {
-		OUTYY(("P(server_prefetch:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 235: /* server_prefetch: VAR_PREFETCH STRING_ARG  */
+#line 1008 "./util/configparser.y"
+        {
+		OUTYY(("P(server_prefetch:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->prefetch = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->prefetch = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2904 "util/configparser.c"
     break;
 
-  case 200:
-/* Line 1787 of yacc.c  */
-#line 850 "./util/configparser.y"
-    {
-		OUTYY(("P(server_prefetch_key:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 236: /* server_prefetch_key: VAR_PREFETCH_KEY STRING_ARG  */
+#line 1017 "./util/configparser.y"
+        {
+		OUTYY(("P(server_prefetch_key:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->prefetch_key = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->prefetch_key = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2916 "util/configparser.c"
     break;
 
-  case 201:
-/* Line 1787 of yacc.c  */
-#line 859 "./util/configparser.y"
-    {
-		OUTYY(("P(server_unwanted_reply_threshold:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 237: /* server_prefetch_popular: VAR_PREFETCH_POPULAR STRING_ARG  */
+#line 1026 "./util/configparser.y"
+        {
+		OUTYY(("P(server_prefetch_popular:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->unwanted_threshold = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->prefetch_popular = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 2928 "util/configparser.c"
     break;
 
-  case 202:
-/* Line 1787 of yacc.c  */
-#line 868 "./util/configparser.y"
-    {
-		OUTYY(("P(server_do_not_query_address:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->donotqueryaddrs, (yyvsp[(2) - (2)].str)))
+  case 238: /* server_prefetch_popular_rate: VAR_PREFETCH_POPULAR_RATE STRING_ARG  */
+#line 1035 "./util/configparser.y"
+        {
+		OUTYY(("P(server_prefetch_popular_rate:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->prefetch_popular_rate = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2940 "util/configparser.c"
+    break;
+
+  case 239: /* server_unwanted_reply_threshold: VAR_UNWANTED_REPLY_THRESHOLD STRING_ARG  */
+#line 1044 "./util/configparser.y"
+        {
+		OUTYY(("P(server_unwanted_reply_threshold:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->unwanted_threshold = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2952 "util/configparser.c"
+    break;
+
+  case 240: /* server_do_not_query_address: VAR_DO_NOT_QUERY_ADDRESS STRING_ARG  */
+#line 1053 "./util/configparser.y"
+        {
+		OUTYY(("P(server_do_not_query_address:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->donotqueryaddrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 2962 "util/configparser.c"
     break;
 
-  case 203:
-/* Line 1787 of yacc.c  */
-#line 875 "./util/configparser.y"
-    {
-		OUTYY(("P(server_do_not_query_localhost:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 241: /* server_do_not_query_localhost: VAR_DO_NOT_QUERY_LOCALHOST STRING_ARG  */
+#line 1060 "./util/configparser.y"
+        {
+		OUTYY(("P(server_do_not_query_localhost:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->donotquery_localhost = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 2975 "util/configparser.c"
     break;
 
-  case 204:
-/* Line 1787 of yacc.c  */
-#line 885 "./util/configparser.y"
-    {
-		OUTYY(("P(server_access_control:%s %s)\n", (yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].str)));
-		if(strcmp((yyvsp[(3) - (3)].str), "deny")!=0 && strcmp((yyvsp[(3) - (3)].str), "refuse")!=0 &&
-			strcmp((yyvsp[(3) - (3)].str), "deny_non_local")!=0 &&
-			strcmp((yyvsp[(3) - (3)].str), "refuse_non_local")!=0 &&
-			strcmp((yyvsp[(3) - (3)].str), "allow")!=0 && 
-			strcmp((yyvsp[(3) - (3)].str), "allow_snoop")!=0) {
+  case 242: /* server_access_control: VAR_ACCESS_CONTROL STRING_ARG STRING_ARG  */
+#line 1070 "./util/configparser.y"
+        {
+		OUTYY(("P(server_access_control:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "deny")!=0 && strcmp((yyvsp[0].str), "refuse")!=0 &&
+			strcmp((yyvsp[0].str), "deny_non_local")!=0 &&
+			strcmp((yyvsp[0].str), "refuse_non_local")!=0 &&
+			strcmp((yyvsp[0].str), "allow")!=0 && 
+			strcmp((yyvsp[0].str), "allow_snoop")!=0) {
 			yyerror("expected deny, refuse, deny_non_local, "
 				"refuse_non_local, allow or allow_snoop "
 				"in access control action");
 		} else {
-			if(!cfg_str2list_insert(&cfg_parser->cfg->acls, (yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].str)))
+			if(!cfg_str2list_insert(&cfg_parser->cfg->acls, (yyvsp[-1].str), (yyvsp[0].str)))
 				fatal_exit("out of memory adding acl");
 		}
 	}
+#line 2995 "util/configparser.c"
     break;
 
-  case 205:
-/* Line 1787 of yacc.c  */
-#line 902 "./util/configparser.y"
-    {
-		OUTYY(("P(server_module_conf:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 243: /* server_module_conf: VAR_MODULE_CONF STRING_ARG  */
+#line 1087 "./util/configparser.y"
+        {
+		OUTYY(("P(server_module_conf:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->module_conf);
-		cfg_parser->cfg->module_conf = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->module_conf = (yyvsp[0].str);
 	}
+#line 3005 "util/configparser.c"
     break;
 
-  case 206:
-/* Line 1787 of yacc.c  */
-#line 909 "./util/configparser.y"
-    {
-		OUTYY(("P(server_val_override_date:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strlen((yyvsp[(2) - (2)].str)) == 0 || strcmp((yyvsp[(2) - (2)].str), "0") == 0) {
+  case 244: /* server_val_override_date: VAR_VAL_OVERRIDE_DATE STRING_ARG  */
+#line 1094 "./util/configparser.y"
+        {
+		OUTYY(("P(server_val_override_date:%s)\n", (yyvsp[0].str)));
+		if(strlen((yyvsp[0].str)) == 0 || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_date_override = 0;
-		} else if(strlen((yyvsp[(2) - (2)].str)) == 14) {
+		} else if(strlen((yyvsp[0].str)) == 14) {
 			cfg_parser->cfg->val_date_override = 
-				cfg_convert_timeval((yyvsp[(2) - (2)].str));
+				cfg_convert_timeval((yyvsp[0].str));
 			if(!cfg_parser->cfg->val_date_override)
 				yyerror("bad date/time specification");
 		} else {
-			if(atoi((yyvsp[(2) - (2)].str)) == 0)
+			if(atoi((yyvsp[0].str)) == 0)
 				yyerror("number expected");
-			cfg_parser->cfg->val_date_override = atoi((yyvsp[(2) - (2)].str));
+			cfg_parser->cfg->val_date_override = atoi((yyvsp[0].str));
 		}
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 3026 "util/configparser.c"
     break;
 
-  case 207:
-/* Line 1787 of yacc.c  */
-#line 927 "./util/configparser.y"
-    {
-		OUTYY(("P(server_val_sig_skew_min:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strlen((yyvsp[(2) - (2)].str)) == 0 || strcmp((yyvsp[(2) - (2)].str), "0") == 0) {
+  case 245: /* server_val_sig_skew_min: VAR_VAL_SIG_SKEW_MIN STRING_ARG  */
+#line 1112 "./util/configparser.y"
+        {
+		OUTYY(("P(server_val_sig_skew_min:%s)\n", (yyvsp[0].str)));
+		if(strlen((yyvsp[0].str)) == 0 || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_sig_skew_min = 0;
 		} else {
-			cfg_parser->cfg->val_sig_skew_min = atoi((yyvsp[(2) - (2)].str));
+			cfg_parser->cfg->val_sig_skew_min = atoi((yyvsp[0].str));
 			if(!cfg_parser->cfg->val_sig_skew_min)
 				yyerror("number expected");
 		}
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 3042 "util/configparser.c"
     break;
 
-  case 208:
-/* Line 1787 of yacc.c  */
-#line 940 "./util/configparser.y"
-    {
-		OUTYY(("P(server_val_sig_skew_max:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strlen((yyvsp[(2) - (2)].str)) == 0 || strcmp((yyvsp[(2) - (2)].str), "0") == 0) {
+  case 246: /* server_val_sig_skew_max: VAR_VAL_SIG_SKEW_MAX STRING_ARG  */
+#line 1125 "./util/configparser.y"
+        {
+		OUTYY(("P(server_val_sig_skew_max:%s)\n", (yyvsp[0].str)));
+		if(strlen((yyvsp[0].str)) == 0 || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_sig_skew_max = 0;
 		} else {
-			cfg_parser->cfg->val_sig_skew_max = atoi((yyvsp[(2) - (2)].str));
+			cfg_parser->cfg->val_sig_skew_max = atoi((yyvsp[0].str));
 			if(!cfg_parser->cfg->val_sig_skew_max)
 				yyerror("number expected");
 		}
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 3058 "util/configparser.c"
     break;
 
-  case 209:
-/* Line 1787 of yacc.c  */
-#line 953 "./util/configparser.y"
-    {
-		OUTYY(("P(server_cache_max_ttl:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 247: /* server_cache_max_ttl: VAR_CACHE_MAX_TTL STRING_ARG  */
+#line 1138 "./util/configparser.y"
+        {
+		OUTYY(("P(server_cache_max_ttl:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->max_ttl = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->max_ttl = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3070 "util/configparser.c"
     break;
 
-  case 210:
-/* Line 1787 of yacc.c  */
-#line 962 "./util/configparser.y"
-    {
-		OUTYY(("P(server_cache_min_ttl:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 248: /* server_cache_min_ttl: VAR_CACHE_MIN_TTL STRING_ARG  */
+#line 1147 "./util/configparser.y"
+        {
+		OUTYY(("P(server_cache_min_ttl:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->min_ttl = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->min_ttl = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3082 "util/configparser.c"
     break;
 
-  case 211:
-/* Line 1787 of yacc.c  */
-#line 971 "./util/configparser.y"
-    {
-		OUTYY(("P(server_bogus_ttl:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 249: /* server_bogus_ttl: VAR_BOGUS_TTL STRING_ARG  */
+#line 1156 "./util/configparser.y"
+        {
+		OUTYY(("P(server_bogus_ttl:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->bogus_ttl = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->bogus_ttl = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3094 "util/configparser.c"
     break;
 
-  case 212:
-/* Line 1787 of yacc.c  */
-#line 980 "./util/configparser.y"
-    {
-		OUTYY(("P(server_val_clean_additional:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 250: /* server_val_clean_additional: VAR_VAL_CLEAN_ADDITIONAL STRING_ARG  */
+#line 1165 "./util/configparser.y"
+        {
+		OUTYY(("P(server_val_clean_additional:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->val_clean_additional = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3107 "util/configparser.c"
     break;
 
-  case 213:
-/* Line 1787 of yacc.c  */
-#line 990 "./util/configparser.y"
-    {
-		OUTYY(("P(server_val_permissive_mode:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 251: /* server_val_permissive_mode: VAR_VAL_PERMISSIVE_MODE STRING_ARG  */
+#line 1175 "./util/configparser.y"
+        {
+		OUTYY(("P(server_val_permissive_mode:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->val_permissive_mode = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3120 "util/configparser.c"
     break;
 
-  case 214:
-/* Line 1787 of yacc.c  */
-#line 1000 "./util/configparser.y"
-    {
-		OUTYY(("P(server_ignore_cd_flag:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 252: /* server_ignore_cd_flag: VAR_IGNORE_CD_FLAG STRING_ARG  */
+#line 1185 "./util/configparser.y"
+        {
+		OUTYY(("P(server_ignore_cd_flag:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->ignore_cd = (strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->ignore_cd = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3132 "util/configparser.c"
     break;
 
-  case 215:
-/* Line 1787 of yacc.c  */
-#line 1009 "./util/configparser.y"
-    {
-		OUTYY(("P(server_val_log_level:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 253: /* server_val_log_level: VAR_VAL_LOG_LEVEL STRING_ARG  */
+#line 1194 "./util/configparser.y"
+        {
+		OUTYY(("P(server_val_log_level:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->val_log_level = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->val_log_level = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3144 "util/configparser.c"
     break;
 
-  case 216:
-/* Line 1787 of yacc.c  */
-#line 1018 "./util/configparser.y"
-    {
-		OUTYY(("P(server_val_nsec3_keysize_iterations:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 254: /* server_val_nsec3_keysize_iterations: VAR_VAL_NSEC3_KEYSIZE_ITERATIONS STRING_ARG  */
+#line 1203 "./util/configparser.y"
+        {
+		OUTYY(("P(server_val_nsec3_keysize_iterations:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->val_nsec3_key_iterations);
-		cfg_parser->cfg->val_nsec3_key_iterations = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->val_nsec3_key_iterations = (yyvsp[0].str);
 	}
+#line 3154 "util/configparser.c"
     break;
 
-  case 217:
-/* Line 1787 of yacc.c  */
-#line 1025 "./util/configparser.y"
-    {
-		OUTYY(("P(server_add_holddown:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 255: /* server_add_holddown: VAR_ADD_HOLDDOWN STRING_ARG  */
+#line 1210 "./util/configparser.y"
+        {
+		OUTYY(("P(server_add_holddown:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->add_holddown = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->add_holddown = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3166 "util/configparser.c"
     break;
 
-  case 218:
-/* Line 1787 of yacc.c  */
-#line 1034 "./util/configparser.y"
-    {
-		OUTYY(("P(server_del_holddown:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 256: /* server_del_holddown: VAR_DEL_HOLDDOWN STRING_ARG  */
+#line 1219 "./util/configparser.y"
+        {
+		OUTYY(("P(server_del_holddown:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->del_holddown = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->del_holddown = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3178 "util/configparser.c"
     break;
 
-  case 219:
-/* Line 1787 of yacc.c  */
-#line 1043 "./util/configparser.y"
-    {
-		OUTYY(("P(server_keep_missing:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0 && strcmp((yyvsp[(2) - (2)].str), "0") != 0)
+  case 257: /* server_keep_missing: VAR_KEEP_MISSING STRING_ARG  */
+#line 1228 "./util/configparser.y"
+        {
+		OUTYY(("P(server_keep_missing:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
-		else cfg_parser->cfg->keep_missing = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->keep_missing = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3190 "util/configparser.c"
     break;
 
-  case 220:
-/* Line 1787 of yacc.c  */
-#line 1052 "./util/configparser.y"
-    {
-		OUTYY(("P(server_key_cache_size:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_parse_memsize((yyvsp[(2) - (2)].str), &cfg_parser->cfg->key_cache_size))
+  case 258: /* server_key_cache_size: VAR_KEY_CACHE_SIZE STRING_ARG  */
+#line 1237 "./util/configparser.y"
+        {
+		OUTYY(("P(server_key_cache_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->key_cache_size))
 			yyerror("memory size expected");
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 3201 "util/configparser.c"
     break;
 
-  case 221:
-/* Line 1787 of yacc.c  */
-#line 1060 "./util/configparser.y"
-    {
-		OUTYY(("P(server_key_cache_slabs:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 259: /* server_key_cache_slabs: VAR_KEY_CACHE_SLABS STRING_ARG  */
+#line 1245 "./util/configparser.y"
+        {
+		OUTYY(("P(server_key_cache_slabs:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else {
-			cfg_parser->cfg->key_cache_slabs = atoi((yyvsp[(2) - (2)].str));
+			cfg_parser->cfg->key_cache_slabs = atoi((yyvsp[0].str));
 			if(!is_pow2(cfg_parser->cfg->key_cache_slabs))
 				yyerror("must be a power of 2");
 		}
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 3217 "util/configparser.c"
     break;
 
-  case 222:
-/* Line 1787 of yacc.c  */
-#line 1073 "./util/configparser.y"
-    {
-		OUTYY(("P(server_neg_cache_size:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_parse_memsize((yyvsp[(2) - (2)].str), &cfg_parser->cfg->neg_cache_size))
+  case 260: /* server_neg_cache_size: VAR_NEG_CACHE_SIZE STRING_ARG  */
+#line 1258 "./util/configparser.y"
+        {
+		OUTYY(("P(server_neg_cache_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->neg_cache_size))
 			yyerror("memory size expected");
-		free((yyvsp[(2) - (2)].str));
+		free((yyvsp[0].str));
 	}
+#line 3228 "util/configparser.c"
     break;
 
-  case 223:
-/* Line 1787 of yacc.c  */
-#line 1081 "./util/configparser.y"
-    {
-		OUTYY(("P(server_local_zone:%s %s)\n", (yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].str)));
-		if(strcmp((yyvsp[(3) - (3)].str), "static")!=0 && strcmp((yyvsp[(3) - (3)].str), "deny")!=0 &&
-		   strcmp((yyvsp[(3) - (3)].str), "refuse")!=0 && strcmp((yyvsp[(3) - (3)].str), "redirect")!=0 &&
-		   strcmp((yyvsp[(3) - (3)].str), "transparent")!=0 && strcmp((yyvsp[(3) - (3)].str), "nodefault")!=0
-		   && strcmp((yyvsp[(3) - (3)].str), "typetransparent")!=0)
+  case 261: /* server_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG  */
+#line 1266 "./util/configparser.y"
+        {
+		OUTYY(("P(server_local_zone:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "static")!=0 && strcmp((yyvsp[0].str), "deny")!=0 &&
+		   strcmp((yyvsp[0].str), "refuse")!=0 && strcmp((yyvsp[0].str), "redirect")!=0 &&
+		   strcmp((yyvsp[0].str), "transparent")!=0 && strcmp((yyvsp[0].str), "nodefault")!=0
+		   && strcmp((yyvsp[0].str), "typetransparent")!=0)
 			yyerror("local-zone type: expected static, deny, "
 				"refuse, redirect, transparent, "
 				"typetransparent or nodefault");
-		else if(strcmp((yyvsp[(3) - (3)].str), "nodefault")==0) {
+		else if(strcmp((yyvsp[0].str), "nodefault")==0) {
 			if(!cfg_strlist_insert(&cfg_parser->cfg->
-				local_zones_nodefault, (yyvsp[(2) - (3)].str)))
+				local_zones_nodefault, (yyvsp[-1].str)))
 				fatal_exit("out of memory adding local-zone");
-			free((yyvsp[(3) - (3)].str));
+			free((yyvsp[0].str));
 		} else {
 			if(!cfg_str2list_insert(&cfg_parser->cfg->local_zones, 
-				(yyvsp[(2) - (3)].str), (yyvsp[(3) - (3)].str)))
+				(yyvsp[-1].str), (yyvsp[0].str)))
 				fatal_exit("out of memory adding local-zone");
 		}
 	}
+#line 3253 "util/configparser.c"
     break;
 
-  case 224:
-/* Line 1787 of yacc.c  */
-#line 1103 "./util/configparser.y"
-    {
-		OUTYY(("P(server_local_data:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->local_data, (yyvsp[(2) - (2)].str)))
+  case 262: /* server_local_data: VAR_LOCAL_DATA STRING_ARG  */
+#line 1288 "./util/configparser.y"
+        {
+		OUTYY(("P(server_local_data:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->local_data, (yyvsp[0].str)))
 			fatal_exit("out of memory adding local-data");
 	}
+#line 3263 "util/configparser.c"
     break;
 
-  case 225:
-/* Line 1787 of yacc.c  */
-#line 1110 "./util/configparser.y"
-    {
+  case 263: /* server_local_data_ptr: VAR_LOCAL_DATA_PTR STRING_ARG  */
+#line 1295 "./util/configparser.y"
+        {
 		char* ptr;
-		OUTYY(("P(server_local_data_ptr:%s)\n", (yyvsp[(2) - (2)].str)));
-		ptr = cfg_ptr_reverse((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		OUTYY(("P(server_local_data_ptr:%s)\n", (yyvsp[0].str)));
+		ptr = cfg_ptr_reverse((yyvsp[0].str));
+		free((yyvsp[0].str));
 		if(ptr) {
 			if(!cfg_strlist_insert(&cfg_parser->cfg->
 				local_data, ptr))
@@ -3348,251 +3277,252 @@ yyreduce:
 			yyerror("local-data-ptr could not be reversed");
 		}
 	}
+#line 3281 "util/configparser.c"
     break;
 
-  case 226:
-/* Line 1787 of yacc.c  */
-#line 1125 "./util/configparser.y"
-    {
-		OUTYY(("P(server_minimal_responses:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 264: /* server_minimal_responses: VAR_MINIMAL_RESPONSES STRING_ARG  */
+#line 1310 "./util/configparser.y"
+        {
+		OUTYY(("P(server_minimal_responses:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->minimal_responses =
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3294 "util/configparser.c"
     break;
 
-  case 227:
-/* Line 1787 of yacc.c  */
-#line 1135 "./util/configparser.y"
-    {
-		OUTYY(("P(server_rrset_roundrobin:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 265: /* server_rrset_roundrobin: VAR_RRSET_ROUNDROBIN STRING_ARG  */
+#line 1320 "./util/configparser.y"
+        {
+		OUTYY(("P(server_rrset_roundrobin:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->rrset_roundrobin =
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3307 "util/configparser.c"
     break;
 
-  case 228:
-/* Line 1787 of yacc.c  */
-#line 1145 "./util/configparser.y"
-    {
-		OUTYY(("P(server_max_udp_size:%s)\n", (yyvsp[(2) - (2)].str)));
-		cfg_parser->cfg->max_udp_size = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+  case 266: /* server_max_udp_size: VAR_MAX_UDP_SIZE STRING_ARG  */
+#line 1330 "./util/configparser.y"
+        {
+		OUTYY(("P(server_max_udp_size:%s)\n", (yyvsp[0].str)));
+		cfg_parser->cfg->max_udp_size = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3317 "util/configparser.c"
     break;
 
-  case 229:
-/* Line 1787 of yacc.c  */
-#line 1152 "./util/configparser.y"
-    {
-		OUTYY(("P(name:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 267: /* stub_name: VAR_NAME STRING_ARG  */
+#line 1337 "./util/configparser.y"
+        {
+		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->stubs->name)
 			yyerror("stub name override, there must be one name "
 				"for one stub-zone");
 		free(cfg_parser->cfg->stubs->name);
-		cfg_parser->cfg->stubs->name = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->stubs->name = (yyvsp[0].str);
 	}
+#line 3330 "util/configparser.c"
     break;
 
-  case 230:
-/* Line 1787 of yacc.c  */
-#line 1162 "./util/configparser.y"
-    {
-		OUTYY(("P(stub-host:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->hosts, (yyvsp[(2) - (2)].str)))
+  case 268: /* stub_host: VAR_STUB_HOST STRING_ARG  */
+#line 1347 "./util/configparser.y"
+        {
+		OUTYY(("P(stub-host:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->hosts, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 3340 "util/configparser.c"
     break;
 
-  case 231:
-/* Line 1787 of yacc.c  */
-#line 1169 "./util/configparser.y"
-    {
-		OUTYY(("P(stub-addr:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->addrs, (yyvsp[(2) - (2)].str)))
+  case 269: /* stub_addr: VAR_STUB_ADDR STRING_ARG  */
+#line 1354 "./util/configparser.y"
+        {
+		OUTYY(("P(stub-addr:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->addrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 3350 "util/configparser.c"
     break;
 
-  case 232:
-/* Line 1787 of yacc.c  */
-#line 1176 "./util/configparser.y"
-    {
-		OUTYY(("P(stub-first:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 270: /* stub_first: VAR_STUB_FIRST STRING_ARG  */
+#line 1361 "./util/configparser.y"
+        {
+		OUTYY(("P(stub-first:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->stubs->isfirst=(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->stubs->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3362 "util/configparser.c"
     break;
 
-  case 233:
-/* Line 1787 of yacc.c  */
-#line 1185 "./util/configparser.y"
-    {
-		OUTYY(("P(stub-prime:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 271: /* stub_prime: VAR_STUB_PRIME STRING_ARG  */
+#line 1370 "./util/configparser.y"
+        {
+		OUTYY(("P(stub-prime:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->stubs->isprime = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3375 "util/configparser.c"
     break;
 
-  case 234:
-/* Line 1787 of yacc.c  */
-#line 1195 "./util/configparser.y"
-    {
-		OUTYY(("P(name:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 272: /* forward_name: VAR_NAME STRING_ARG  */
+#line 1380 "./util/configparser.y"
+        {
+		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->forwards->name)
 			yyerror("forward name override, there must be one "
 				"name for one forward-zone");
 		free(cfg_parser->cfg->forwards->name);
-		cfg_parser->cfg->forwards->name = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->forwards->name = (yyvsp[0].str);
 	}
+#line 3388 "util/configparser.c"
     break;
 
-  case 235:
-/* Line 1787 of yacc.c  */
-#line 1205 "./util/configparser.y"
-    {
-		OUTYY(("P(forward-host:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->hosts, (yyvsp[(2) - (2)].str)))
+  case 273: /* forward_host: VAR_FORWARD_HOST STRING_ARG  */
+#line 1390 "./util/configparser.y"
+        {
+		OUTYY(("P(forward-host:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->hosts, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 3398 "util/configparser.c"
     break;
 
-  case 236:
-/* Line 1787 of yacc.c  */
-#line 1212 "./util/configparser.y"
-    {
-		OUTYY(("P(forward-addr:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->addrs, (yyvsp[(2) - (2)].str)))
+  case 274: /* forward_addr: VAR_FORWARD_ADDR STRING_ARG  */
+#line 1397 "./util/configparser.y"
+        {
+		OUTYY(("P(forward-addr:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->addrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 3408 "util/configparser.c"
     break;
 
-  case 237:
-/* Line 1787 of yacc.c  */
-#line 1219 "./util/configparser.y"
-    {
-		OUTYY(("P(forward-first:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 275: /* forward_first: VAR_FORWARD_FIRST STRING_ARG  */
+#line 1404 "./util/configparser.y"
+        {
+		OUTYY(("P(forward-first:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->forwards->isfirst=(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->forwards->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3420 "util/configparser.c"
     break;
 
-  case 238:
-/* Line 1787 of yacc.c  */
-#line 1228 "./util/configparser.y"
-    { 
+  case 276: /* rcstart: VAR_REMOTE_CONTROL  */
+#line 1413 "./util/configparser.y"
+        { 
 		OUTYY(("\nP(remote-control:)\n")); 
 	}
+#line 3428 "util/configparser.c"
     break;
 
-  case 248:
-/* Line 1787 of yacc.c  */
-#line 1239 "./util/configparser.y"
-    {
-		OUTYY(("P(control_enable:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(strcmp((yyvsp[(2) - (2)].str), "yes") != 0 && strcmp((yyvsp[(2) - (2)].str), "no") != 0)
+  case 286: /* rc_control_enable: VAR_CONTROL_ENABLE STRING_ARG  */
+#line 1424 "./util/configparser.y"
+        {
+		OUTYY(("P(control_enable:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->remote_control_enable = 
-			(strcmp((yyvsp[(2) - (2)].str), "yes")==0);
-		free((yyvsp[(2) - (2)].str));
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
+#line 3441 "util/configparser.c"
     break;
 
-  case 249:
-/* Line 1787 of yacc.c  */
-#line 1249 "./util/configparser.y"
-    {
-		OUTYY(("P(control_port:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(atoi((yyvsp[(2) - (2)].str)) == 0)
+  case 287: /* rc_control_port: VAR_CONTROL_PORT STRING_ARG  */
+#line 1434 "./util/configparser.y"
+        {
+		OUTYY(("P(control_port:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("control port number expected");
-		else cfg_parser->cfg->control_port = atoi((yyvsp[(2) - (2)].str));
-		free((yyvsp[(2) - (2)].str));
+		else cfg_parser->cfg->control_port = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
+#line 3453 "util/configparser.c"
     break;
 
-  case 250:
-/* Line 1787 of yacc.c  */
-#line 1258 "./util/configparser.y"
-    {
-		OUTYY(("P(control_interface:%s)\n", (yyvsp[(2) - (2)].str)));
-		if(!cfg_strlist_insert(&cfg_parser->cfg->control_ifs, (yyvsp[(2) - (2)].str)))
+  case 288: /* rc_control_interface: VAR_CONTROL_INTERFACE STRING_ARG  */
+#line 1443 "./util/configparser.y"
+        {
+		OUTYY(("P(control_interface:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->control_ifs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
+#line 3463 "util/configparser.c"
     break;
 
-  case 251:
-/* Line 1787 of yacc.c  */
-#line 1265 "./util/configparser.y"
-    {
-		OUTYY(("P(rc_server_key_file:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 289: /* rc_server_key_file: VAR_SERVER_KEY_FILE STRING_ARG  */
+#line 1450 "./util/configparser.y"
+        {
+		OUTYY(("P(rc_server_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->server_key_file);
-		cfg_parser->cfg->server_key_file = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->server_key_file = (yyvsp[0].str);
 	}
+#line 3473 "util/configparser.c"
     break;
 
-  case 252:
-/* Line 1787 of yacc.c  */
-#line 1272 "./util/configparser.y"
-    {
-		OUTYY(("P(rc_server_cert_file:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 290: /* rc_server_cert_file: VAR_SERVER_CERT_FILE STRING_ARG  */
+#line 1457 "./util/configparser.y"
+        {
+		OUTYY(("P(rc_server_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->server_cert_file);
-		cfg_parser->cfg->server_cert_file = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->server_cert_file = (yyvsp[0].str);
 	}
+#line 3483 "util/configparser.c"
     break;
 
-  case 253:
-/* Line 1787 of yacc.c  */
-#line 1279 "./util/configparser.y"
-    {
-		OUTYY(("P(rc_control_key_file:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 291: /* rc_control_key_file: VAR_CONTROL_KEY_FILE STRING_ARG  */
+#line 1464 "./util/configparser.y"
+        {
+		OUTYY(("P(rc_control_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->control_key_file);
-		cfg_parser->cfg->control_key_file = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->control_key_file = (yyvsp[0].str);
 	}
+#line 3493 "util/configparser.c"
     break;
 
-  case 254:
-/* Line 1787 of yacc.c  */
-#line 1286 "./util/configparser.y"
-    {
-		OUTYY(("P(rc_control_cert_file:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 292: /* rc_control_cert_file: VAR_CONTROL_CERT_FILE STRING_ARG  */
+#line 1471 "./util/configparser.y"
+        {
+		OUTYY(("P(rc_control_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->control_cert_file);
-		cfg_parser->cfg->control_cert_file = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->control_cert_file = (yyvsp[0].str);
 	}
+#line 3503 "util/configparser.c"
     break;
 
-  case 255:
-/* Line 1787 of yacc.c  */
-#line 1293 "./util/configparser.y"
-    { 
+  case 293: /* pythonstart: VAR_PYTHON  */
+#line 1478 "./util/configparser.y"
+        { 
 		OUTYY(("\nP(python:)\n")); 
 	}
+#line 3511 "util/configparser.c"
     break;
 
-  case 259:
-/* Line 1787 of yacc.c  */
-#line 1302 "./util/configparser.y"
-    {
-		OUTYY(("P(python-script:%s)\n", (yyvsp[(2) - (2)].str)));
+  case 297: /* py_script: VAR_PYTHON_SCRIPT STRING_ARG  */
+#line 1487 "./util/configparser.y"
+        {
+		OUTYY(("P(python-script:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->python_script);
-		cfg_parser->cfg->python_script = (yyvsp[(2) - (2)].str);
+		cfg_parser->cfg->python_script = (yyvsp[0].str);
 	}
+#line 3521 "util/configparser.c"
     break;
 
 
-/* Line 1787 of yacc.c  */
-#line 3596 "util/configparser.c"
+#line 3525 "util/configparser.c"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -3606,96 +3536,58 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
-	 error, discard it.  */
+         error, discard it.  */
 
       if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
     }
 
   /* Else will try to reuse lookahead token after shifting the error
@@ -3707,14 +3599,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -3727,39 +3618,42 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -3770,26 +3664,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -3798,32 +3696,25 @@ yyreturn:
       yydestruct ("Cleanup: discarding lookahead",
                   yytoken, &yylval);
     }
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
-}
 
+  return yyresult;
+}
 
-/* Line 2048 of yacc.c  */
-#line 1307 "./util/configparser.y"
+#line 1492 "./util/configparser.y"
 
 
 /* parse helper routines could be here */
-
@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.6.1.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2012 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,13 +27,17 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
-#ifndef YY_UTIL_CONFIGPARSER_H
-# define YY_UTIL_CONFIGPARSER_H
-/* Enabling traces.  */
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
+# define YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
+/* Debug traces.  */
 #ifndef YYDEBUG
 # define YYDEBUG 0
 #endif
@@ -40,145 +45,172 @@
 extern int yydebug;
 #endif
 
-/* Tokens.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     SPACE = 258,
-     LETTER = 259,
-     NEWLINE = 260,
-     COMMENT = 261,
-     COLON = 262,
-     ANY = 263,
-     ZONESTR = 264,
-     STRING_ARG = 265,
-     VAR_SERVER = 266,
-     VAR_VERBOSITY = 267,
-     VAR_NUM_THREADS = 268,
-     VAR_PORT = 269,
-     VAR_OUTGOING_RANGE = 270,
-     VAR_INTERFACE = 271,
-     VAR_DO_IP4 = 272,
-     VAR_DO_IP6 = 273,
-     VAR_DO_UDP = 274,
-     VAR_DO_TCP = 275,
-     VAR_CHROOT = 276,
-     VAR_USERNAME = 277,
-     VAR_DIRECTORY = 278,
-     VAR_LOGFILE = 279,
-     VAR_PIDFILE = 280,
-     VAR_MSG_CACHE_SIZE = 281,
-     VAR_MSG_CACHE_SLABS = 282,
-     VAR_NUM_QUERIES_PER_THREAD = 283,
-     VAR_RRSET_CACHE_SIZE = 284,
-     VAR_RRSET_CACHE_SLABS = 285,
-     VAR_OUTGOING_NUM_TCP = 286,
-     VAR_INFRA_HOST_TTL = 287,
-     VAR_INFRA_LAME_TTL = 288,
-     VAR_INFRA_CACHE_SLABS = 289,
-     VAR_INFRA_CACHE_NUMHOSTS = 290,
-     VAR_INFRA_CACHE_LAME_SIZE = 291,
-     VAR_NAME = 292,
-     VAR_STUB_ZONE = 293,
-     VAR_STUB_HOST = 294,
-     VAR_STUB_ADDR = 295,
-     VAR_TARGET_FETCH_POLICY = 296,
-     VAR_HARDEN_SHORT_BUFSIZE = 297,
-     VAR_HARDEN_LARGE_QUERIES = 298,
-     VAR_FORWARD_ZONE = 299,
-     VAR_FORWARD_HOST = 300,
-     VAR_FORWARD_ADDR = 301,
-     VAR_DO_NOT_QUERY_ADDRESS = 302,
-     VAR_HIDE_IDENTITY = 303,
-     VAR_HIDE_VERSION = 304,
-     VAR_IDENTITY = 305,
-     VAR_VERSION = 306,
-     VAR_HARDEN_GLUE = 307,
-     VAR_MODULE_CONF = 308,
-     VAR_TRUST_ANCHOR_FILE = 309,
-     VAR_TRUST_ANCHOR = 310,
-     VAR_VAL_OVERRIDE_DATE = 311,
-     VAR_BOGUS_TTL = 312,
-     VAR_VAL_CLEAN_ADDITIONAL = 313,
-     VAR_VAL_PERMISSIVE_MODE = 314,
-     VAR_INCOMING_NUM_TCP = 315,
-     VAR_MSG_BUFFER_SIZE = 316,
-     VAR_KEY_CACHE_SIZE = 317,
-     VAR_KEY_CACHE_SLABS = 318,
-     VAR_TRUSTED_KEYS_FILE = 319,
-     VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 320,
-     VAR_USE_SYSLOG = 321,
-     VAR_OUTGOING_INTERFACE = 322,
-     VAR_ROOT_HINTS = 323,
-     VAR_DO_NOT_QUERY_LOCALHOST = 324,
-     VAR_CACHE_MAX_TTL = 325,
-     VAR_HARDEN_DNSSEC_STRIPPED = 326,
-     VAR_ACCESS_CONTROL = 327,
-     VAR_LOCAL_ZONE = 328,
-     VAR_LOCAL_DATA = 329,
-     VAR_INTERFACE_AUTOMATIC = 330,
-     VAR_STATISTICS_INTERVAL = 331,
-     VAR_DO_DAEMONIZE = 332,
-     VAR_USE_CAPS_FOR_ID = 333,
-     VAR_STATISTICS_CUMULATIVE = 334,
-     VAR_OUTGOING_PORT_PERMIT = 335,
-     VAR_OUTGOING_PORT_AVOID = 336,
-     VAR_DLV_ANCHOR_FILE = 337,
-     VAR_DLV_ANCHOR = 338,
-     VAR_NEG_CACHE_SIZE = 339,
-     VAR_HARDEN_REFERRAL_PATH = 340,
-     VAR_PRIVATE_ADDRESS = 341,
-     VAR_PRIVATE_DOMAIN = 342,
-     VAR_REMOTE_CONTROL = 343,
-     VAR_CONTROL_ENABLE = 344,
-     VAR_CONTROL_INTERFACE = 345,
-     VAR_CONTROL_PORT = 346,
-     VAR_SERVER_KEY_FILE = 347,
-     VAR_SERVER_CERT_FILE = 348,
-     VAR_CONTROL_KEY_FILE = 349,
-     VAR_CONTROL_CERT_FILE = 350,
-     VAR_EXTENDED_STATISTICS = 351,
-     VAR_LOCAL_DATA_PTR = 352,
-     VAR_JOSTLE_TIMEOUT = 353,
-     VAR_STUB_PRIME = 354,
-     VAR_UNWANTED_REPLY_THRESHOLD = 355,
-     VAR_LOG_TIME_ASCII = 356,
-     VAR_DOMAIN_INSECURE = 357,
-     VAR_PYTHON = 358,
-     VAR_PYTHON_SCRIPT = 359,
-     VAR_VAL_SIG_SKEW_MIN = 360,
-     VAR_VAL_SIG_SKEW_MAX = 361,
-     VAR_CACHE_MIN_TTL = 362,
-     VAR_VAL_LOG_LEVEL = 363,
-     VAR_AUTO_TRUST_ANCHOR_FILE = 364,
-     VAR_KEEP_MISSING = 365,
-     VAR_ADD_HOLDDOWN = 366,
-     VAR_DEL_HOLDDOWN = 367,
-     VAR_SO_RCVBUF = 368,
-     VAR_EDNS_BUFFER_SIZE = 369,
-     VAR_PREFETCH = 370,
-     VAR_PREFETCH_KEY = 371,
-     VAR_SO_SNDBUF = 372,
-     VAR_SO_REUSEPORT = 373,
-     VAR_HARDEN_BELOW_NXDOMAIN = 374,
-     VAR_IGNORE_CD_FLAG = 375,
-     VAR_LOG_QUERIES = 376,
-     VAR_TCP_UPSTREAM = 377,
-     VAR_SSL_UPSTREAM = 378,
-     VAR_SSL_SERVICE_KEY = 379,
-     VAR_SSL_SERVICE_PEM = 380,
-     VAR_SSL_PORT = 381,
-     VAR_FORWARD_FIRST = 382,
-     VAR_STUB_FIRST = 383,
-     VAR_MINIMAL_RESPONSES = 384,
-     VAR_RRSET_ROUNDROBIN = 385,
-     VAR_MAX_UDP_SIZE = 386,
-     VAR_DELAY_CLOSE = 387
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    SPACE = 258,                   /* SPACE  */
+    LETTER = 259,                  /* LETTER  */
+    NEWLINE = 260,                 /* NEWLINE  */
+    COMMENT = 261,                 /* COMMENT  */
+    COLON = 262,                   /* COLON  */
+    ANY = 263,                     /* ANY  */
+    ZONESTR = 264,                 /* ZONESTR  */
+    STRING_ARG = 265,              /* STRING_ARG  */
+    VAR_SERVER = 266,              /* VAR_SERVER  */
+    VAR_VERBOSITY = 267,           /* VAR_VERBOSITY  */
+    VAR_NUM_THREADS = 268,         /* VAR_NUM_THREADS  */
+    VAR_PORT = 269,                /* VAR_PORT  */
+    VAR_OUTGOING_RANGE = 270,      /* VAR_OUTGOING_RANGE  */
+    VAR_INTERFACE = 271,           /* VAR_INTERFACE  */
+    VAR_DO_IP4 = 272,              /* VAR_DO_IP4  */
+    VAR_DO_IP6 = 273,              /* VAR_DO_IP6  */
+    VAR_DO_UDP = 274,              /* VAR_DO_UDP  */
+    VAR_DO_TCP = 275,              /* VAR_DO_TCP  */
+    VAR_CHROOT = 276,              /* VAR_CHROOT  */
+    VAR_USERNAME = 277,            /* VAR_USERNAME  */
+    VAR_DIRECTORY = 278,           /* VAR_DIRECTORY  */
+    VAR_LOGFILE = 279,             /* VAR_LOGFILE  */
+    VAR_PIDFILE = 280,             /* VAR_PIDFILE  */
+    VAR_MSG_CACHE_SIZE = 281,      /* VAR_MSG_CACHE_SIZE  */
+    VAR_MSG_CACHE_SLABS = 282,     /* VAR_MSG_CACHE_SLABS  */
+    VAR_NUM_QUERIES_PER_THREAD = 283, /* VAR_NUM_QUERIES_PER_THREAD  */
+    VAR_RRSET_CACHE_SIZE = 284,    /* VAR_RRSET_CACHE_SIZE  */
+    VAR_RRSET_CACHE_SLABS = 285,   /* VAR_RRSET_CACHE_SLABS  */
+    VAR_OUTGOING_NUM_TCP = 286,    /* VAR_OUTGOING_NUM_TCP  */
+    VAR_INFRA_HOST_TTL = 287,      /* VAR_INFRA_HOST_TTL  */
+    VAR_INFRA_LAME_TTL = 288,      /* VAR_INFRA_LAME_TTL  */
+    VAR_INFRA_CACHE_SLABS = 289,   /* VAR_INFRA_CACHE_SLABS  */
+    VAR_INFRA_CACHE_NUMHOSTS = 290, /* VAR_INFRA_CACHE_NUMHOSTS  */
+    VAR_INFRA_CACHE_LAME_SIZE = 291, /* VAR_INFRA_CACHE_LAME_SIZE  */
+    VAR_NAME = 292,                /* VAR_NAME  */
+    VAR_STUB_ZONE = 293,           /* VAR_STUB_ZONE  */
+    VAR_STUB_HOST = 294,           /* VAR_STUB_HOST  */
+    VAR_STUB_ADDR = 295,           /* VAR_STUB_ADDR  */
+    VAR_TARGET_FETCH_POLICY = 296, /* VAR_TARGET_FETCH_POLICY  */
+    VAR_HARDEN_SHORT_BUFSIZE = 297, /* VAR_HARDEN_SHORT_BUFSIZE  */
+    VAR_HARDEN_LARGE_QUERIES = 298, /* VAR_HARDEN_LARGE_QUERIES  */
+    VAR_FORWARD_ZONE = 299,        /* VAR_FORWARD_ZONE  */
+    VAR_FORWARD_HOST = 300,        /* VAR_FORWARD_HOST  */
+    VAR_FORWARD_ADDR = 301,        /* VAR_FORWARD_ADDR  */
+    VAR_DO_NOT_QUERY_ADDRESS = 302, /* VAR_DO_NOT_QUERY_ADDRESS  */
+    VAR_HIDE_IDENTITY = 303,       /* VAR_HIDE_IDENTITY  */
+    VAR_HIDE_VERSION = 304,        /* VAR_HIDE_VERSION  */
+    VAR_IDENTITY = 305,            /* VAR_IDENTITY  */
+    VAR_VERSION = 306,             /* VAR_VERSION  */
+    VAR_HARDEN_GLUE = 307,         /* VAR_HARDEN_GLUE  */
+    VAR_MODULE_CONF = 308,         /* VAR_MODULE_CONF  */
+    VAR_TRUST_ANCHOR_FILE = 309,   /* VAR_TRUST_ANCHOR_FILE  */
+    VAR_TRUST_ANCHOR = 310,        /* VAR_TRUST_ANCHOR  */
+    VAR_VAL_OVERRIDE_DATE = 311,   /* VAR_VAL_OVERRIDE_DATE  */
+    VAR_BOGUS_TTL = 312,           /* VAR_BOGUS_TTL  */
+    VAR_VAL_CLEAN_ADDITIONAL = 313, /* VAR_VAL_CLEAN_ADDITIONAL  */
+    VAR_VAL_PERMISSIVE_MODE = 314, /* VAR_VAL_PERMISSIVE_MODE  */
+    VAR_INCOMING_NUM_TCP = 315,    /* VAR_INCOMING_NUM_TCP  */
+    VAR_MSG_BUFFER_SIZE = 316,     /* VAR_MSG_BUFFER_SIZE  */
+    VAR_KEY_CACHE_SIZE = 317,      /* VAR_KEY_CACHE_SIZE  */
+    VAR_KEY_CACHE_SLABS = 318,     /* VAR_KEY_CACHE_SLABS  */
+    VAR_TRUSTED_KEYS_FILE = 319,   /* VAR_TRUSTED_KEYS_FILE  */
+    VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 320, /* VAR_VAL_NSEC3_KEYSIZE_ITERATIONS  */
+    VAR_USE_SYSLOG = 321,          /* VAR_USE_SYSLOG  */
+    VAR_OUTGOING_INTERFACE = 322,  /* VAR_OUTGOING_INTERFACE  */
+    VAR_ROOT_HINTS = 323,          /* VAR_ROOT_HINTS  */
+    VAR_DO_NOT_QUERY_LOCALHOST = 324, /* VAR_DO_NOT_QUERY_LOCALHOST  */
+    VAR_CACHE_MAX_TTL = 325,       /* VAR_CACHE_MAX_TTL  */
+    VAR_HARDEN_DNSSEC_STRIPPED = 326, /* VAR_HARDEN_DNSSEC_STRIPPED  */
+    VAR_ACCESS_CONTROL = 327,      /* VAR_ACCESS_CONTROL  */
+    VAR_LOCAL_ZONE = 328,          /* VAR_LOCAL_ZONE  */
+    VAR_LOCAL_DATA = 329,          /* VAR_LOCAL_DATA  */
+    VAR_INTERFACE_AUTOMATIC = 330, /* VAR_INTERFACE_AUTOMATIC  */
+    VAR_STATISTICS_INTERVAL = 331, /* VAR_STATISTICS_INTERVAL  */
+    VAR_DO_DAEMONIZE = 332,        /* VAR_DO_DAEMONIZE  */
+    VAR_USE_CAPS_FOR_ID = 333,     /* VAR_USE_CAPS_FOR_ID  */
+    VAR_STATISTICS_CUMULATIVE = 334, /* VAR_STATISTICS_CUMULATIVE  */
+    VAR_OUTGOING_PORT_PERMIT = 335, /* VAR_OUTGOING_PORT_PERMIT  */
+    VAR_OUTGOING_PORT_AVOID = 336, /* VAR_OUTGOING_PORT_AVOID  */
+    VAR_DLV_ANCHOR_FILE = 337,     /* VAR_DLV_ANCHOR_FILE  */
+    VAR_DLV_ANCHOR = 338,          /* VAR_DLV_ANCHOR  */
+    VAR_NEG_CACHE_SIZE = 339,      /* VAR_NEG_CACHE_SIZE  */
+    VAR_HARDEN_REFERRAL_PATH = 340, /* VAR_HARDEN_REFERRAL_PATH  */
+    VAR_PRIVATE_ADDRESS = 341,     /* VAR_PRIVATE_ADDRESS  */
+    VAR_PRIVATE_DOMAIN = 342,      /* VAR_PRIVATE_DOMAIN  */
+    VAR_REMOTE_CONTROL = 343,      /* VAR_REMOTE_CONTROL  */
+    VAR_CONTROL_ENABLE = 344,      /* VAR_CONTROL_ENABLE  */
+    VAR_CONTROL_INTERFACE = 345,   /* VAR_CONTROL_INTERFACE  */
+    VAR_CONTROL_PORT = 346,        /* VAR_CONTROL_PORT  */
+    VAR_SERVER_KEY_FILE = 347,     /* VAR_SERVER_KEY_FILE  */
+    VAR_SERVER_CERT_FILE = 348,    /* VAR_SERVER_CERT_FILE  */
+    VAR_CONTROL_KEY_FILE = 349,    /* VAR_CONTROL_KEY_FILE  */
+    VAR_CONTROL_CERT_FILE = 350,   /* VAR_CONTROL_CERT_FILE  */
+    VAR_EXTENDED_STATISTICS = 351, /* VAR_EXTENDED_STATISTICS  */
+    VAR_LOCAL_DATA_PTR = 352,      /* VAR_LOCAL_DATA_PTR  */
+    VAR_JOSTLE_TIMEOUT = 353,      /* VAR_JOSTLE_TIMEOUT  */
+    VAR_STUB_PRIME = 354,          /* VAR_STUB_PRIME  */
+    VAR_UNWANTED_REPLY_THRESHOLD = 355, /* VAR_UNWANTED_REPLY_THRESHOLD  */
+    VAR_LOG_TIME_ASCII = 356,      /* VAR_LOG_TIME_ASCII  */
+    VAR_DOMAIN_INSECURE = 357,     /* VAR_DOMAIN_INSECURE  */
+    VAR_PYTHON = 358,              /* VAR_PYTHON  */
+    VAR_PYTHON_SCRIPT = 359,       /* VAR_PYTHON_SCRIPT  */
+    VAR_VAL_SIG_SKEW_MIN = 360,    /* VAR_VAL_SIG_SKEW_MIN  */
+    VAR_VAL_SIG_SKEW_MAX = 361,    /* VAR_VAL_SIG_SKEW_MAX  */
+    VAR_CACHE_MIN_TTL = 362,       /* VAR_CACHE_MIN_TTL  */
+    VAR_VAL_LOG_LEVEL = 363,       /* VAR_VAL_LOG_LEVEL  */
+    VAR_AUTO_TRUST_ANCHOR_FILE = 364, /* VAR_AUTO_TRUST_ANCHOR_FILE  */
+    VAR_KEEP_MISSING = 365,        /* VAR_KEEP_MISSING  */
+    VAR_ADD_HOLDDOWN = 366,        /* VAR_ADD_HOLDDOWN  */
+    VAR_DEL_HOLDDOWN = 367,        /* VAR_DEL_HOLDDOWN  */
+    VAR_SO_RCVBUF = 368,           /* VAR_SO_RCVBUF  */
+    VAR_EDNS_BUFFER_SIZE = 369,    /* VAR_EDNS_BUFFER_SIZE  */
+    VAR_PREFETCH = 370,            /* VAR_PREFETCH  */
+    VAR_PREFETCH_KEY = 371,        /* VAR_PREFETCH_KEY  */
+    VAR_SO_SNDBUF = 372,           /* VAR_SO_SNDBUF  */
+    VAR_SO_REUSEPORT = 373,        /* VAR_SO_REUSEPORT  */
+    VAR_HARDEN_BELOW_NXDOMAIN = 374, /* VAR_HARDEN_BELOW_NXDOMAIN  */
+    VAR_IGNORE_CD_FLAG = 375,      /* VAR_IGNORE_CD_FLAG  */
+    VAR_LOG_QUERIES = 376,         /* VAR_LOG_QUERIES  */
+    VAR_TCP_UPSTREAM = 377,        /* VAR_TCP_UPSTREAM  */
+    VAR_SSL_UPSTREAM = 378,        /* VAR_SSL_UPSTREAM  */
+    VAR_SSL_SERVICE_KEY = 379,     /* VAR_SSL_SERVICE_KEY  */
+    VAR_SSL_SERVICE_PEM = 380,     /* VAR_SSL_SERVICE_PEM  */
+    VAR_SSL_PORT = 381,            /* VAR_SSL_PORT  */
+    VAR_FORWARD_FIRST = 382,       /* VAR_FORWARD_FIRST  */
+    VAR_STUB_FIRST = 383,          /* VAR_STUB_FIRST  */
+    VAR_MINIMAL_RESPONSES = 384,   /* VAR_MINIMAL_RESPONSES  */
+    VAR_RRSET_ROUNDROBIN = 385,    /* VAR_RRSET_ROUNDROBIN  */
+    VAR_MAX_UDP_SIZE = 386,        /* VAR_MAX_UDP_SIZE  */
+    VAR_DELAY_CLOSE = 387,         /* VAR_DELAY_CLOSE  */
+    VAR_TCP_IDLE_TIMEOUT = 388,    /* VAR_TCP_IDLE_TIMEOUT  */
+    VAR_SSL_SESSION_TICKET_KEYS = 389, /* VAR_SSL_SESSION_TICKET_KEYS  */
+    VAR_TCP_FASTOPEN = 390,        /* VAR_TCP_FASTOPEN  */
+    VAR_TCP_UPSTREAM_FASTOPEN = 391, /* VAR_TCP_UPSTREAM_FASTOPEN  */
+    VAR_RRL_RATELIMIT = 392,       /* VAR_RRL_RATELIMIT  */
+    VAR_RRL_SLIP = 393,            /* VAR_RRL_SLIP  */
+    VAR_RRL_IPV4_PREFIX = 394,     /* VAR_RRL_IPV4_PREFIX  */
+    VAR_RRL_IPV6_PREFIX = 395,     /* VAR_RRL_IPV6_PREFIX  */
+    VAR_RRL_SIZE = 396,            /* VAR_RRL_SIZE  */
+    VAR_UPSTREAM_ZONE_RATELIMIT = 397, /* VAR_UPSTREAM_ZONE_RATELIMIT  */
+    VAR_UPSTREAM_SERVER_RATELIMIT = 398, /* VAR_UPSTREAM_SERVER_RATELIMIT  */
+    VAR_UPSTREAM_RATELIMIT_SIZE = 399, /* VAR_UPSTREAM_RATELIMIT_SIZE  */
+    VAR_REGION_PRESIZE = 400,      /* VAR_REGION_PRESIZE  */
+    VAR_CACHE_HUGEPAGES = 401,     /* VAR_CACHE_HUGEPAGES  */
+    VAR_CACHE_ADMISSION_FILTER = 402, /* VAR_CACHE_ADMISSION_FILTER  */
+    VAR_CACHE_EXPIRY_SCAN = 403,   /* VAR_CACHE_EXPIRY_SCAN  */
+    VAR_PREFETCH_POPULAR = 404,    /* VAR_PREFETCH_POPULAR  */
+    VAR_PREFETCH_POPULAR_RATE = 405, /* VAR_PREFETCH_POPULAR_RATE  */
+    VAR_MSG_CACHE_L1_SLOTS = 406   /* VAR_MSG_CACHE_L1_SLOTS  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define SPACE 258
 #define LETTER 259
 #define NEWLINE 260
@@ -309,40 +341,47 @@ extern int yydebug;
 #define VAR_RRSET_ROUNDROBIN 385
 #define VAR_MAX_UDP_SIZE 386
 #define VAR_DELAY_CLOSE 387
+#define VAR_TCP_IDLE_TIMEOUT 388
+#define VAR_SSL_SESSION_TICKET_KEYS 389
+#define VAR_TCP_FASTOPEN 390
+#define VAR_TCP_UPSTREAM_FASTOPEN 391
+#define VAR_RRL_RATELIMIT 392
+#define VAR_RRL_SLIP 393
+#define VAR_RRL_IPV4_PREFIX 394
+#define VAR_RRL_IPV6_PREFIX 395
+#define VAR_RRL_SIZE 396
+#define VAR_UPSTREAM_ZONE_RATELIMIT 397
+#define VAR_UPSTREAM_SERVER_RATELIMIT 398
+#define VAR_UPSTREAM_RATELIMIT_SIZE 399
+#define VAR_REGION_PRESIZE 400
+#define VAR_CACHE_HUGEPAGES 401
+#define VAR_CACHE_ADMISSION_FILTER 402
+#define VAR_CACHE_EXPIRY_SCAN 403
+#define VAR_PREFETCH_POPULAR 404
+#define VAR_PREFETCH_POPULAR_RATE 405
+#define VAR_MSG_CACHE_L1_SLOTS 406
 
-
-
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
+union YYSTYPE
 {
-/* Line 2049 of yacc.c  */
 #line 64 "./util/configparser.y"
 
 	char*	str;
 
+#line 373 "util/configparser.h"
 
-/* Line 2049 of yacc.c  */
-#line 326 "util/configparser.h"
-} YYSTYPE;
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
 # define YYSTYPE_IS_DECLARED 1
 #endif
 
+
 extern YYSTYPE yylval;
 
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
+
 int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
 
-#endif /* !YY_UTIL_CONFIGPARSER_H  */
+
+#endif /* !YY_YY_UTIL_CONFIGPARSER_H_INCLUDED  */
@@ -105,7 +105,13 @@ extern struct config_parser_state* cfg_parser;
 %token VAR_IGNORE_CD_FLAG VAR_LOG_QUERIES VAR_TCP_UPSTREAM VAR_SSL_UPSTREAM
 %token VAR_SSL_SERVICE_KEY VAR_SSL_SERVICE_PEM VAR_SSL_PORT VAR_FORWARD_FIRST
 %token VAR_STUB_FIRST VAR_MINIMAL_RESPONSES VAR_RRSET_ROUNDROBIN
-%token VAR_MAX_UDP_SIZE VAR_DELAY_CLOSE
+%token VAR_MAX_UDP_SIZE VAR_DELAY_CLOSE VAR_TCP_IDLE_TIMEOUT
+%token VAR_SSL_SESSION_TICKET_KEYS VAR_TCP_FASTOPEN VAR_TCP_UPSTREAM_FASTOPEN
+%token VAR_RRL_RATELIMIT VAR_RRL_SLIP VAR_RRL_IPV4_PREFIX VAR_RRL_IPV6_PREFIX
+%token VAR_RRL_SIZE VAR_UPSTREAM_ZONE_RATELIMIT VAR_UPSTREAM_SERVER_RATELIMIT
+%token VAR_UPSTREAM_RATELIMIT_SIZE VAR_REGION_PRESIZE VAR_CACHE_HUGEPAGES
+%token VAR_CACHE_ADMISSION_FILTER VAR_CACHE_EXPIRY_SCAN VAR_PREFETCH_POPULAR
+%token VAR_PREFETCH_POPULAR_RATE VAR_MSG_CACHE_L1_SLOTS
 
 %%
 toplevelvars: /* empty */ | toplevelvars toplevelvar ;
@@ -163,7 +169,15 @@ content_server: server_num_threads | server_verbosity | server_port |
 	server_log_queries | server_tcp_upstream | server_ssl_upstream |
 	server_ssl_service_key | server_ssl_service_pem | server_ssl_port |
 	server_minimal_responses | server_rrset_roundrobin | server_max_udp_size |
-    server_so_reuseport | server_delay_close
+    server_so_reuseport | server_delay_close | server_tcp_idle_timeout |
+    server_ssl_session_ticket_keys | server_tcp_fastopen |
+    server_tcp_upstream_fastopen | server_rrl_ratelimit | server_rrl_slip |
+    server_rrl_ipv4_prefix | server_rrl_ipv6_prefix | server_rrl_size |
+    server_upstream_zone_ratelimit | server_upstream_server_ratelimit |
+    server_upstream_ratelimit_size | server_region_presize |
+    server_cache_hugepages | server_cache_admission_filter |
+    server_cache_expiry_scan | server_prefetch_popular |
+    server_prefetch_popular_rate | server_msg_cache_l1_slots
 	;
 stubstart: VAR_STUB_ZONE
 	{
@@ -403,6 +417,14 @@ server_ssl_service_pem: VAR_SSL_SERVICE_PEM STRING_ARG
 		cfg_parser->cfg->ssl_service_pem = $2;
 	}
 	;
+server_ssl_session_ticket_keys: VAR_SSL_SESSION_TICKET_KEYS STRING_ARG
+	{
+		OUTYY(("P(server_ssl_session_ticket_keys:%s)\n", $2));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->
+			ssl_session_ticket_keys, $2))
+			yyerror("out of memory");
+	}
+	;
 server_ssl_port: VAR_SSL_PORT STRING_ARG
 	{
 		OUTYY(("P(server_ssl_port:%s)\n", $2));
@@ -651,6 +673,15 @@ server_msg_cache_slabs: VAR_MSG_CACHE_SLABS STRING_ARG
 		free($2);
 	}
 	;
+server_msg_cache_l1_slots: VAR_MSG_CACHE_L1_SLOTS STRING_ARG
+	{
+		OUTYY(("P(server_msg_cache_l1_slots:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->msg_cache_l1_slots = atoi($2);
+		free($2);
+	}
+	;
 server_num_queries_per_thread: VAR_NUM_QUERIES_PER_THREAD STRING_ARG
 	{
 		OUTYY(("P(server_num_queries_per_thread:%s)\n", $2));
@@ -678,6 +709,142 @@ server_delay_close: VAR_DELAY_CLOSE STRING_ARG
 		free($2);
 	}
 	;
+server_tcp_idle_timeout: VAR_TCP_IDLE_TIMEOUT STRING_ARG
+	{
+		OUTYY(("P(server_tcp_idle_timeout:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->tcp_idle_timeout = atoi($2);
+		free($2);
+	}
+	;
+server_tcp_fastopen: VAR_TCP_FASTOPEN STRING_ARG
+	{
+		OUTYY(("P(server_tcp_fastopen:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->tcp_fastopen = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_tcp_upstream_fastopen: VAR_TCP_UPSTREAM_FASTOPEN STRING_ARG
+	{
+		OUTYY(("P(server_tcp_upstream_fastopen:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->tcp_upstream_fastopen = 
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_rrl_ratelimit: VAR_RRL_RATELIMIT STRING_ARG
+	{
+		OUTYY(("P(server_rrl_ratelimit:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->rrl_ratelimit = atoi($2);
+		free($2);
+	}
+	;
+server_rrl_slip: VAR_RRL_SLIP STRING_ARG
+	{
+		OUTYY(("P(server_rrl_slip:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->rrl_slip = atoi($2);
+		free($2);
+	}
+	;
+server_rrl_ipv4_prefix: VAR_RRL_IPV4_PREFIX STRING_ARG
+	{
+		OUTYY(("P(server_rrl_ipv4_prefix:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->rrl_ipv4_prefix = atoi($2);
+		free($2);
+	}
+	;
+server_rrl_ipv6_prefix: VAR_RRL_IPV6_PREFIX STRING_ARG
+	{
+		OUTYY(("P(server_rrl_ipv6_prefix:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->rrl_ipv6_prefix = atoi($2);
+		free($2);
+	}
+	;
+server_rrl_size: VAR_RRL_SIZE STRING_ARG
+	{
+		OUTYY(("P(server_rrl_size:%s)\n", $2));
+		if(atoi($2) == 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->rrl_size = atoi($2);
+		free($2);
+	}
+	;
+server_upstream_zone_ratelimit: VAR_UPSTREAM_ZONE_RATELIMIT STRING_ARG
+	{
+		OUTYY(("P(server_upstream_zone_ratelimit:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->upstream_zone_ratelimit = atoi($2);
+		free($2);
+	}
+	;
+server_upstream_server_ratelimit: VAR_UPSTREAM_SERVER_RATELIMIT STRING_ARG
+	{
+		OUTYY(("P(server_upstream_server_ratelimit:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->upstream_server_ratelimit = atoi($2);
+		free($2);
+	}
+	;
+server_upstream_ratelimit_size: VAR_UPSTREAM_RATELIMIT_SIZE STRING_ARG
+	{
+		OUTYY(("P(server_upstream_ratelimit_size:%s)\n", $2));
+		if(!cfg_parse_memsize($2, &cfg_parser->cfg->
+			upstream_ratelimit_size))
+			yyerror("memory size expected");
+		free($2);
+	}
+	;
+server_region_presize: VAR_REGION_PRESIZE STRING_ARG
+	{
+		OUTYY(("P(server_region_presize:%s)\n", $2));
+		if(!cfg_parse_memsize($2, &cfg_parser->cfg->
+			region_presize))
+			yyerror("memory size expected");
+		free($2);
+	}
+	;
+server_cache_hugepages: VAR_CACHE_HUGEPAGES STRING_ARG
+	{
+		OUTYY(("P(server_cache_hugepages:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->cache_hugepages = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_cache_admission_filter: VAR_CACHE_ADMISSION_FILTER STRING_ARG
+	{
+		OUTYY(("P(server_cache_admission_filter:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->cache_admission_filter = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_cache_expiry_scan: VAR_CACHE_EXPIRY_SCAN STRING_ARG
+	{
+		OUTYY(("P(server_cache_expiry_scan:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->cache_expiry_scan = atoi($2);
+		free($2);
+	}
+	;
 server_rrset_cache_size: VAR_RRSET_CACHE_SIZE STRING_ARG
 	{
 		OUTYY(("P(server_rrset_cache_size:%s)\n", $2));
@@ -855,6 +1022,24 @@ server_prefetch_key: VAR_PREFETCH_KEY STRING_ARG
 		free($2);
 	}
 	;
+server_prefetch_popular: VAR_PREFETCH_POPULAR STRING_ARG
+	{
+		OUTYY(("P(server_prefetch_popular:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->prefetch_popular = atoi($2);
+		free($2);
+	}
+	;
+server_prefetch_popular_rate: VAR_PREFETCH_POPULAR_RATE STRING_ARG
+	{
+		OUTYY(("P(server_prefetch_popular_rate:%s)\n", $2));
+		if(atoi($2) == 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->prefetch_popular_rate = atoi($2);
+		free($2);
+	}
+	;
 server_unwanted_reply_threshold: VAR_UNWANTED_REPLY_THRESHOLD STRING_ARG
 	{
 		OUTYY(("P(server_unwanted_reply_threshold:%s)\n", $2));
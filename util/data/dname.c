@@ -44,8 +44,155 @@
 #include "util/data/dname.h"
 #include "util/data/msgparse.h"
 #include "util/log.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/keyhash.h"
 #include "ldns/sbuffer.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define DNAME_NEON 1
+#endif
+
+/** lowercase one byte, like tolower() in the C locale, without a branch */
+#define DNAME_LOWER(c) ((uint8_t)((c) | ((uint8_t)((c)-'A') < 26)<<5))
+
+/** 64bit word with the byte repeated in every byte */
+#define DNAME_REP8(c) (((uint64_t)0x0101010101010101ULL)*(uint8_t)(c))
+
+/**
+ * Lowercase 8 bytes in a word, the ascii uppercase letters are found
+ * with adds on the low 7 bits of every byte, that cannot carry into
+ * the next byte.
+ */
+static uint64_t
+lower_word(uint64_t x)
+{
+	uint64_t heptets = x & DNAME_REP8(0x7f);
+	uint64_t ge_a = heptets + DNAME_REP8(0x80-'A');
+	uint64_t gt_z = heptets + DNAME_REP8(0x7f-'Z');
+	uint64_t upper = (ge_a ^ gt_z) & ~x & DNAME_REP8(0x80);
+	return x | (upper>>2);
+}
+
+/**
+ * Copy bytes and lowercase them, a label at a time.  Uses vectors of
+ * 16 bytes, then words of 8, then single bytes; it never reads past len.
+ * @param to: destination, may be the same as from.
+ * @param from: source.
+ * @param len: number of bytes.
+ */
+static void
+lower_copy(uint8_t* to, const uint8_t* from, size_t len)
+{
+	uint64_t w;
+#ifdef __SSE2__
+	const __m128i a1 = _mm_set1_epi8('A'-1), z1 = _mm_set1_epi8('Z'+1);
+	const __m128i bit = _mm_set1_epi8(0x20);
+	while(len >= 16) {
+		__m128i x = _mm_loadu_si128((const __m128i*)from);
+		/* signed compares, bytes over 0x7f are negative */
+		__m128i m = _mm_and_si128(_mm_cmpgt_epi8(x, a1),
+			_mm_cmplt_epi8(x, z1));
+		_mm_storeu_si128((__m128i*)to, _mm_or_si128(x,
+			_mm_and_si128(m, bit)));
+		from += 16;
+		to += 16;
+		len -= 16;
+	}
+#elif defined(DNAME_NEON)
+	const uint8x16_t a = vdupq_n_u8('A'), n = vdupq_n_u8(26);
+	const uint8x16_t bit = vdupq_n_u8(0x20);
+	while(len >= 16) {
+		uint8x16_t x = vld1q_u8(from);
+		uint8x16_t m = vcltq_u8(vsubq_u8(x, a), n);
+		vst1q_u8(to, vorrq_u8(x, vandq_u8(m, bit)));
+		from += 16;
+		to += 16;
+		len -= 16;
+	}
+#endif
+	while(len >= 8) {
+		memmove(&w, from, sizeof(w));
+		w = lower_word(w);
+		memmove(to, &w, sizeof(w));
+		from += 8;
+		to += 8;
+		len -= 8;
+	}
+	while(len--) {
+		*to++ = DNAME_LOWER(*from);
+		from++;
+	}
+}
+
+/**
+ * See if bytes are equal when lowercased, a vector or word at a time.
+ * @param p1: bytes 1
+ * @param p2: bytes 2
+ * @param len: number of bytes.
+ * @return number of bytes at the start that are equal; len if all are.
+ */
+static size_t
+lower_equal_len(const uint8_t* p1, const uint8_t* p2, size_t len)
+{
+	size_t i = 0;
+	uint64_t w1, w2;
+#ifdef __SSE2__
+	const __m128i a1 = _mm_set1_epi8('A'-1), z1 = _mm_set1_epi8('Z'+1);
+	const __m128i bit = _mm_set1_epi8(0x20);
+	while(len-i >= 16) {
+		__m128i x = _mm_loadu_si128((const __m128i*)(p1+i));
+		__m128i y = _mm_loadu_si128((const __m128i*)(p2+i));
+		x = _mm_or_si128(x, _mm_and_si128(bit, _mm_and_si128(
+			_mm_cmpgt_epi8(x, a1), _mm_cmplt_epi8(x, z1))));
+		y = _mm_or_si128(y, _mm_and_si128(bit, _mm_and_si128(
+			_mm_cmpgt_epi8(y, a1), _mm_cmplt_epi8(y, z1))));
+		if(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) != 0xffff)
+			break;
+		i += 16;
+	}
+#elif defined(DNAME_NEON)
+	const uint8x16_t a = vdupq_n_u8('A'), n = vdupq_n_u8(26);
+	const uint8x16_t bit = vdupq_n_u8(0x20);
+	while(len-i >= 16) {
+		uint8x16_t x = vld1q_u8(p1+i), y = vld1q_u8(p2+i);
+		x = vorrq_u8(x, vandq_u8(vcltq_u8(vsubq_u8(x, a), n), bit));
+		y = vorrq_u8(y, vandq_u8(vcltq_u8(vsubq_u8(y, a), n), bit));
+		if(vminvq_u8(vceqq_u8(x, y)) != 0xff)
+			break;
+		i += 16;
+	}
+#endif
+	while(len-i >= 8) {
+		memmove(&w1, p1+i, sizeof(w1));
+		memmove(&w2, p2+i, sizeof(w2));
+		if(w1 != w2 && lower_word(w1) != lower_word(w2))
+			break;
+		i += 8;
+	}
+	/* find the byte that differs */
+	while(i < len && DNAME_LOWER(p1[i]) == DNAME_LOWER(p2[i]))
+		i++;
+	return i;
+}
+
+/**
+ * Compare labels in memory, lowercase while comparing.
+ * @param p1: label 1
+ * @param p2: label 2
+ * @param len: number of bytes to compare.
+ * @return: 0, -1, +1 comparison result.
+ */
+static int
+memlowercmp(uint8_t* p1, uint8_t* p2, uint8_t len)
+{
+	size_t i = lower_equal_len(p1, p2, len);
+	if(i == len)
+		return 0;
+	if(DNAME_LOWER(p1[i]) < DNAME_LOWER(p2[i]))
+		return -1;
+	return 1;
+}
 
 /* determine length of a dname in buffer, no compression pointers allowed */
 size_t
@@ -98,6 +245,7 @@ int
 query_dname_compare(register uint8_t* d1, register uint8_t* d2)
 {
 	register uint8_t lab1, lab2;
+	int c;
 	log_assert(d1 && d2);
 	lab1 = *d1++;
 	lab2 = *d2++;
@@ -111,17 +259,10 @@ query_dname_compare(register uint8_t* d1, register uint8_t* d2)
 		}
 		log_assert(lab1 == lab2 && lab1 != 0);
 		/* compare lowercased labels. */
-		while(lab1--) {
-			/* compare bytes first for speed */
-			if(*d1 != *d2 && 
-				tolower((int)*d1) != tolower((int)*d2)) {
-				if(tolower((int)*d1) < tolower((int)*d2))
-					return -1;
-				return 1;
-			}
-			d1++;
-			d2++;
-		}
+		if((c = memlowercmp(d1, d2, lab1)) != 0)
+			return c;
+		d1 += lab1;
+		d2 += lab1;
 		/* next pair of labels. */
 		lab1 = *d1++;
 		lab2 = *d2++;
@@ -137,10 +278,8 @@ query_dname_tolower(uint8_t* dname)
 	labellen = *dname;
 	while(labellen) {
 		dname++;
-		while(labellen--) {
-			*dname = (uint8_t)tolower((int)*dname);
-			dname++;
-		}
+		lower_copy(dname, dname, labellen);
+		dname += labellen;
 		labellen = *dname;
 	}
 }
@@ -166,10 +305,8 @@ pkt_dname_tolower(sldns_buffer* pkt, uint8_t* dname)
 		}
 		if(dname+lablen >= sldns_buffer_end(pkt))
 			return;
-		while(lablen--) {
-			*dname = (uint8_t)tolower((int)*dname);
-			dname++;
-		}
+		lower_copy(dname, dname, lablen);
+		dname += lablen;
 		if(dname >= sldns_buffer_end(pkt))
 			return;
 		lablen = *dname++;
@@ -231,6 +368,7 @@ int
 dname_pkt_compare(sldns_buffer* pkt, uint8_t* d1, uint8_t* d2)
 {
 	uint8_t len1, len2;
+	int c;
 	log_assert(pkt && d1 && d2);
 	len1 = *d1++;
 	len2 = *d2++;
@@ -255,13 +393,10 @@ dname_pkt_compare(sldns_buffer* pkt, uint8_t* d1, uint8_t* d2)
 		}
 		log_assert(len1 == len2 && len1 != 0);
 		/* compare labels */
-		while(len1--) {
-			if(tolower((int)*d1++) != tolower((int)*d2++)) {
-				if(tolower((int)d1[-1]) < tolower((int)d2[-1]))
-					return -1;
-				return 1;
-			}
-		}
+		if((c = memlowercmp(d1, d2, len1)) != 0)
+			return c;
+		d1 += len1;
+		d2 += len1;
 		len1 = *d1++;
 		len2 = *d2++;
 	}
@@ -271,33 +406,31 @@ dname_pkt_compare(sldns_buffer* pkt, uint8_t* d1, uint8_t* d2)
 hashvalue_t 
 dname_query_hash(uint8_t* dname, hashvalue_t h)
 {
-	uint8_t labuf[LDNS_MAX_LABELLEN+1];
-	uint8_t lablen;
-	int i;
-
-	/* preserve case of query, make hash label by label */
-	lablen = *dname++;
-	while(lablen) {
-		log_assert(lablen <= LDNS_MAX_LABELLEN);
-		labuf[0] = lablen;
-		i=0;
-		while(lablen--)
-			labuf[++i] = (uint8_t)tolower((int)*dname++);
-		h = hashlittle(labuf, labuf[0] + 1, h);
-		lablen = *dname++;
+	uint8_t buf[LDNS_MAX_DOMAINLEN+1];
+	uint8_t* p = dname;
+	size_t len;
+
+	/* preserve case of query, hash the lowercased name at once; the
+	 * label lengths are below 'A' and are not changed by it */
+	while(*p) {
+		log_assert(*p <= LDNS_MAX_LABELLEN);
+		p += *p + 1;
 	}
-
-	return h;
+	len = (size_t)(p - dname);
+	log_assert(len < sizeof(buf));
+	lower_copy(buf, dname, len);
+	return keyhash(buf, len, h);
 }
 
 hashvalue_t 
 dname_pkt_hash(sldns_buffer* pkt, uint8_t* dname, hashvalue_t h)
 {
-	uint8_t labuf[LDNS_MAX_LABELLEN+1];
+	uint8_t buf[LDNS_MAX_DOMAINLEN+1];
 	uint8_t lablen;
-	int i;
+	size_t len = 0;
 
-	/* preserve case of query, make hash label by label */
+	/* preserve case of query, decompress and lowercase the name, and
+	 * hash it at once, like dname_query_hash */
 	lablen = *dname++;
 	while(lablen) {
 		if(LABEL_IS_PTR(lablen)) {
@@ -307,15 +440,15 @@ dname_pkt_hash(sldns_buffer* pkt, uint8_t* dname, hashvalue_t h)
 			continue;
 		}
 		log_assert(lablen <= LDNS_MAX_LABELLEN);
-		labuf[0] = lablen;
-		i=0;
-		while(lablen--)
-			labuf[++i] = (uint8_t)tolower((int)*dname++);
-		h = hashlittle(labuf, labuf[0] + 1, h);
+		if(len + lablen + 1 >= sizeof(buf))
+			break; /* the parser checked the length already */
+		buf[len] = lablen;
+		lower_copy(buf+len+1, dname, lablen);
+		len += (size_t)lablen + 1;
+		dname += lablen;
 		lablen = *dname++;
 	}
-
-	return h;
+	return keyhash(buf, len, h);
 }
 
 void dname_pkt_copy(sldns_buffer* pkt, uint8_t* to, uint8_t* dname)
@@ -412,28 +545,6 @@ dname_count_size_labels(uint8_t* dname, size_t* size)
 	return labs;
 }
 
-/**
- * Compare labels in memory, lowercase while comparing.
- * @param p1: label 1
- * @param p2: label 2
- * @param len: number of bytes to compare.
- * @return: 0, -1, +1 comparison result.
- */
-static int
-memlowercmp(uint8_t* p1, uint8_t* p2, uint8_t len)
-{
-	while(len--) {
-		if(*p1 != *p2 && tolower((int)*p1) != tolower((int)*p2)) {
-			if(tolower((int)*p1) < tolower((int)*p2))
-				return -1;
-			return 1;
-		}
-		p1++;
-		p2++;
-	}
-	return 0;
-}
-
 int 
 dname_lab_cmp(uint8_t* d1, int labs1, uint8_t* d2, int labs2, int* mlabs)
 {
@@ -441,6 +552,7 @@ dname_lab_cmp(uint8_t* d1, int labs1, uint8_t* d2, int labs2, int* mlabs)
 	int atlabel = labs1;
 	int lastmlabs;
 	int lastdiff = 0;
+	int c;
 	/* first skip so that we compare same label. */
 	if(labs1 > labs2) {
 		while(atlabel > labs2) {
@@ -475,31 +587,12 @@ dname_lab_cmp(uint8_t* d1, int labs1, uint8_t* d2, int labs2, int* mlabs)
 			d1 += len1;
 			d2 += len2;
 		} else {
-			/* memlowercmp is inlined here; or just like
-			 * if((c=memlowercmp(d1, d2, len1)) != 0) { 
-			 *	lastdiff = c;
-			 *	lastmlabs = atlabel; } apart from d1++,d2++ */
-			while(len1) {
-				if(*d1 != *d2 && tolower((int)*d1) 
-					!= tolower((int)*d2)) {
-					if(tolower((int)*d1) < 
-						tolower((int)*d2)) {
-						lastdiff = -1;
-						lastmlabs = atlabel;
-						d1 += len1;
-						d2 += len1;
-						break;
-					}
-					lastdiff = 1;
-					lastmlabs = atlabel;
-					d1 += len1;
-					d2 += len1;
-					break; /* out of memlowercmp */
-				}
-				d1++;
-				d2++;
-				len1--;
+			if((c=memlowercmp(d1, d2, len1)) != 0) {
+				lastdiff = c;
+				lastmlabs = atlabel;
 			}
+			d1 += len1;
+			d2 += len1;
 		}
 		atlabel--;
 	}
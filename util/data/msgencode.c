@@ -40,6 +40,7 @@
  */
 
 #include "config.h"
+#include <ctype.h>
 #include "util/data/msgencode.h"
 #include "util/data/msgreply.h"
 #include "util/data/msgparse.h"
@@ -59,184 +60,234 @@
 
 /**
  * Data structure to help domain name compression in outgoing messages.
- * A tree of dnames and their offsets in the packet is kept.
- * It is kept sorted, not canonical, but by label at least, so that after
- * a lookup of a name you know its closest match, and the parent from that
- * closest match. These are possible compression targets.
- *
- * It is a binary tree, not a rbtree or balanced tree, as the effort
- * of keeping it balanced probably outweighs usefulness (given typical
- * DNS packet size).
+ * A node for every name suffix that is in the packet, with its offset.
+ * The nodes are kept in a hash table, by their parent node and their
+ * first label, so that the longest suffix of a name that is already in
+ * the packet is found by a lookup per label, from the top label down.
  */
 struct compress_tree_node {
-	/** left node in tree, all smaller to this */
-	struct compress_tree_node* left;
-	/** right node in tree, all larger than this */
-	struct compress_tree_node* right;
-
-	/** the parent node - not for tree, but zone parent. One less label */
+	/** the parent node, one label less; NULL for a top level label */
 	struct compress_tree_node* parent;
 	/** the domain name for this node. Pointer to uncompressed memory. */
 	uint8_t* dname;
-	/** number of labels in domain name, kept to help compare func. */
+	/** number of labels in domain name */
 	int labs;
+	/** hash of parent and first label, for the table */
+	uint32_t hash;
 	/** offset in packet that points to this dname */
 	size_t offset;
 };
 
+/** the initial number of slots in the compression table */
+#define COMPRESS_TABLE_START 64
+
 /**
- * Find domain name in tree, returns exact and closest match.
- * @param tree: root of tree.
- * @param dname: pointer to uncompressed dname.
- * @param labs: number of labels in domain name.
- * @param match: closest or exact match.
- *	guaranteed to be smaller or equal to the sought dname.
- *	can be null if the tree is empty.
- * @param matchlabels: number of labels that match with closest match.
- *	can be zero is there is no match.
- * @param insertpt: insert location for dname, if not found.
- * @return: 0 if no exact match.
+ * The compression table, open addressing with linear probing.  It is
+ * allocated in the region, and grows when it is half full.
+ */
+struct compress_table {
+	/** the slots, NULL if empty; NULL before the first name */
+	struct compress_tree_node** slots;
+	/** the number of slots minus one, the number is a power of two */
+	size_t mask;
+	/** the number of nodes in the table */
+	size_t num;
+};
+
+/**
+ * Hash of a node in the compression table.
+ * @param parent: the parent node.
+ * @param label: the first label of the name, with its length byte.
+ * @return hash value.
+ */
+static uint32_t
+compress_hash(struct compress_tree_node* parent, uint8_t* label)
+{
+	uint32_t h = (uint32_t)(size_t)parent;
+	uint8_t len = *label++;
+	h = (h ^ (h>>7)) * 0x9e3779b1 + len;
+	while(len--) {
+		uint8_t c = *label++;
+		if(c >= 'A' && c <= 'Z')
+			c |= 0x20;
+		h = (h ^ c) * 0x01000193;
+	}
+	return h ^ (h>>15);
+}
+
+/**
+ * See if the first labels of names are equal, lowercase while comparing.
+ * @param l1: label 1, with its length byte.
+ * @param l2: label 2, with its length byte.
+ * @return true if equal.
  */
 static int
-compress_tree_search(struct compress_tree_node** tree, uint8_t* dname,
-	int labs, struct compress_tree_node** match, int* matchlabels,
-	struct compress_tree_node*** insertpt)
+compress_label_equal(uint8_t* l1, uint8_t* l2)
 {
-	int c, n, closen=0;
-	struct compress_tree_node* p = *tree;
-	struct compress_tree_node* close = 0;
-	struct compress_tree_node** prev = tree;
-	while(p) {
-		if((c = dname_lab_cmp(dname, labs, p->dname, p->labs, &n)) 
-			== 0) {
-			*matchlabels = n;
-			*match = p;
-			return 1;
-		}
-		if(c<0) {
-			prev = &p->left;
-			p = p->left;
-		} else	{
-			closen = n;
-			close = p; /* p->dname is smaller than dname */
-			prev = &p->right;
-			p = p->right;
-		}
+	uint8_t len = *l1;
+	if(*l2 != len)
+		return 0;
+	while(len--) {
+		l1++;
+		l2++;
+		if(*l1 != *l2 && tolower((int)*l1) != tolower((int)*l2))
+			return 0;
 	}
-	*insertpt = prev;
-	*matchlabels = closen;
-	*match = close;
-	return 0;
+	return 1;
 }
 
 /**
- * Lookup a domain name in compression tree.
- * @param tree: root of tree (not the node with '.').
- * @param dname: pointer to uncompressed dname.
- * @param labs: number of labels in domain name.
- * @param insertpt: insert location for dname, if not found.
- * @return: 0 if not found or compress treenode with best compression.
+ * Find the node with the parent and the first label in the table.
+ * @param tab: the compression table.
+ * @param parent: the parent node, or NULL for a top level label.
+ * @param label: the label, with its length byte.
+ * @param hash: compress_hash of parent and label.
+ * @return the node or NULL.
  */
 static struct compress_tree_node*
-compress_tree_lookup(struct compress_tree_node** tree, uint8_t* dname,
-	int labs, struct compress_tree_node*** insertpt)
+compress_table_find(struct compress_table* tab,
+	struct compress_tree_node* parent, uint8_t* label, uint32_t hash)
 {
-	struct compress_tree_node* p;
-	int m;
-	if(labs <= 1)
-		return 0; /* do not compress root node */
-	if(compress_tree_search(tree, dname, labs, &p, &m, insertpt)) {
-		/* exact match */
-		return p;
+	size_t i = hash & tab->mask;
+	struct compress_tree_node* n;
+	while((n = tab->slots[i]) != NULL) {
+		if(n->hash == hash && n->parent == parent &&
+			compress_label_equal(n->dname, label))
+			return n;
+		i = (i+1) & tab->mask;
 	}
-	/* return some ancestor of p that compresses well. */
-	if(m>1) {
-		/* www.example.com. (labs=4) matched foo.example.com.(labs=4)
-		 * then matchcount = 3. need to go up. */
-		while(p && p->labs > m)
-			p = p->parent;
-		return p;
+	return NULL;
+}
+
+/**
+ * Put a node into the table, it has space.
+ * @param slots: the slots.
+ * @param mask: number of slots minus one.
+ * @param n: the node.
+ */
+static void
+compress_table_put(struct compress_tree_node** slots, size_t mask,
+	struct compress_tree_node* n)
+{
+	size_t i = n->hash & mask;
+	while(slots[i])
+		i = (i+1) & mask;
+	slots[i] = n;
+}
+
+/**
+ * Make room in the table for more nodes, allocates the first slots, or
+ * doubles the slots when it gets half full.
+ * @param tab: the compression table.
+ * @param add: the number of nodes that are going to be added.
+ * @param region: to allocate the slots.
+ * @return 0 on malloc failure.
+ */
+static int
+compress_table_room(struct compress_table* tab, size_t add,
+	struct regional* region)
+{
+	struct compress_tree_node** slots;
+	size_t i, size = tab->slots?tab->mask+1:COMPRESS_TABLE_START;
+	if(tab->slots && (tab->num+add)*2 <= size)
+		return 1;
+	while((tab->num+add)*2 > size)
+		size *= 2;
+	slots = (struct compress_tree_node**)regional_alloc_zero(region,
+		size*sizeof(*slots));
+	if(!slots)
+		return 0;
+	if(tab->slots) {
+		for(i=0; i<=tab->mask; i++)
+			if(tab->slots[i])
+				compress_table_put(slots, size-1,
+					tab->slots[i]);
 	}
-	return 0;
+	tab->slots = slots;
+	tab->mask = size-1;
+	return 1;
 }
 
 /**
- * Create node for domain name compression tree.
- * @param dname: pointer to uncompressed dname (stored in tree).
- * @param labs: number of labels in dname.
- * @param offset: offset into packet for dname.
- * @param region: how to allocate memory for new node.
- * @return new node or 0 on malloc failure.
+ * Lookup a domain name in the compression table.
+ * @param tab: the compression table.
+ * @param dname: pointer to uncompressed dname.
+ * @param labs: number of labels in domain name.
+ * @return: 0 if not found or compress treenode with best compression,
+ *	the longest suffix of dname that is in the packet.
  */
 static struct compress_tree_node*
-compress_tree_newnode(uint8_t* dname, int labs, size_t offset, 
-	struct regional* region)
+compress_tree_lookup(struct compress_table* tab, uint8_t* dname, int labs)
 {
-	struct compress_tree_node* n = (struct compress_tree_node*)
-		regional_alloc(region, sizeof(struct compress_tree_node));
-	if(!n) return 0;
-	n->left = 0;
-	n->right = 0;
-	n->parent = 0;
-	n->dname = dname;
-	n->labs = labs;
-	n->offset = offset;
-	return n;
+	uint8_t* label[LDNS_MAX_DOMAINLEN/2+1];
+	struct compress_tree_node* p = NULL, *n;
+	int i;
+	if(labs <= 1 || !tab->slots)
+		return 0; /* do not compress root node */
+	/* the labels, the root label is not stored in the table */
+	for(i=0; i<labs-1; i++) {
+		label[i] = dname;
+		dname += *dname + 1;
+	}
+	/* look up the suffixes from the top label down */
+	for(i=labs-2; i>=0; i--) {
+		if(!(n = compress_table_find(tab, p, label[i],
+			compress_hash(p, label[i]))))
+			break;
+		p = n;
+	}
+	return p;
 }
 
 /**
- * Store domain name and ancestors into compression tree.
- * @param dname: pointer to uncompressed dname (stored in tree).
+ * Store domain name and ancestors into compression table.
+ * @param dname: pointer to uncompressed dname (stored in table).
  * @param labs: number of labels in dname.
  * @param offset: offset into packet for dname.
  * @param region: how to allocate memory for new node.
  * @param closest: match from previous lookup, used to compress dname.
  *	may be NULL if no previous match.
- *	if the tree has an ancestor of dname already, this must be it.
- * @param insertpt: where to insert the dname in tree. 
+ *	if the table has an ancestor of dname already, this must be it.
+ * @param tab: the compression table.
  * @return: 0 on memory error.
  */
 static int
 compress_tree_store(uint8_t* dname, int labs, size_t offset, 
 	struct regional* region, struct compress_tree_node* closest, 
-	struct compress_tree_node** insertpt)
+	struct compress_table* tab)
 {
-	uint8_t lablen;
+	uint8_t* label[LDNS_MAX_DOMAINLEN/2+1];
+	size_t off[LDNS_MAX_DOMAINLEN/2+1];
 	struct compress_tree_node* newnode;
-	struct compress_tree_node* prevnode = NULL;
-	int uplabs = labs-1; /* does not store root in tree */
+	int i, uplabs = labs-1; /* does not store root in table */
 	if(closest) uplabs = labs - closest->labs;
 	log_assert(uplabs >= 0);
-	/* algorithms builds up a vine of dname-labels to hang into tree */
-	while(uplabs--) {
-		if(offset > PTR_MAX_OFFSET) {
-			/* insertion failed, drop vine */
-			return 1; /* compression pointer no longer useful */
-		}
-		if(!(newnode = compress_tree_newnode(dname, labs, offset, 
-			region))) {
-			/* insertion failed, drop vine */
-			return 0;
-		}
-
-		if(prevnode) {
-			/* chain nodes together, last one has one label more,
-			 * so is larger than newnode, thus goes right. */
-			newnode->right = prevnode;
-			prevnode->parent = newnode;
-		}
-
-		/* next label */
-		lablen = *dname++;
-		dname += lablen;
-		offset += lablen+1;
-		prevnode = newnode;
-		labs--;
+	if(uplabs == 0)
+		return 1;
+	/* the new suffixes, and their offsets */
+	for(i=0; i<uplabs; i++) {
+		label[i] = dname;
+		off[i] = offset;
+		offset += *dname + 1;
+		dname += *dname + 1;
 	}
-	/* if we have a vine, hang the vine into the tree */
-	if(prevnode) {
-		*insertpt = prevnode;
-		prevnode->parent = closest;
+	if(off[uplabs-1] > PTR_MAX_OFFSET)
+		return 1; /* compression pointer no longer useful */
+	if(!compress_table_room(tab, (size_t)uplabs, region))
+		return 0;
+	/* hang the new nodes under closest, from the top label down */
+	for(i=uplabs-1; i>=0; i--) {
+		if(!(newnode = (struct compress_tree_node*)regional_alloc(
+			region, sizeof(struct compress_tree_node))))
+			return 0;
+		newnode->parent = closest;
+		newnode->dname = label[i];
+		newnode->labs = labs - i;
+		newnode->hash = compress_hash(closest, label[i]);
+		newnode->offset = off[i];
+		compress_table_put(tab->slots, tab->mask, newnode);
+		tab->num++;
+		closest = newnode;
 	}
 	return 1;
 }
@@ -279,15 +330,14 @@ write_compressed_dname(sldns_buffer* pkt, uint8_t* dname, int labs,
 /** compress owner name of RR, return RETVAL_OUTMEM RETVAL_TRUNC */
 static int
 compress_owner(struct ub_packed_rrset_key* key, sldns_buffer* pkt, 
-	struct regional* region, struct compress_tree_node** tree, 
+	struct regional* region, struct compress_table* tree, 
 	size_t owner_pos, uint16_t* owner_ptr, int owner_labs)
 {
 	struct compress_tree_node* p;
-	struct compress_tree_node** insertpt;
 	if(!*owner_ptr) {
 		/* compress first time dname */
 		if((p = compress_tree_lookup(tree, key->rk.dname, 
-			owner_labs, &insertpt))) {
+			owner_labs))) {
 			if(p->labs == owner_labs) 
 				/* avoid ptr chains, since some software is
 				 * not capable of decoding ptr after a ptr. */
@@ -308,7 +358,7 @@ compress_owner(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 				*owner_ptr = htons(PTR_CREATE(owner_pos));
 		}
 		if(!compress_tree_store(key->rk.dname, owner_labs, 
-			owner_pos, region, p, insertpt))
+			owner_pos, region, p, tree))
 			return RETVAL_OUTMEM;
 	} else {
 		/* always compress 2nd-further RRs in RRset */
@@ -328,19 +378,18 @@ compress_owner(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 /** compress any domain name to the packet, return RETVAL_* */
 static int
 compress_any_dname(uint8_t* dname, sldns_buffer* pkt, int labs, 
-	struct regional* region, struct compress_tree_node** tree)
+	struct regional* region, struct compress_table* tree)
 {
 	struct compress_tree_node* p;
-	struct compress_tree_node** insertpt = NULL;
 	size_t pos = sldns_buffer_position(pkt);
-	if((p = compress_tree_lookup(tree, dname, labs, &insertpt))) {
+	if((p = compress_tree_lookup(tree, dname, labs))) {
 		if(!write_compressed_dname(pkt, dname, labs, p))
 			return RETVAL_TRUNC;
 	} else {
 		if(!dname_buffer_write(pkt, dname))
 			return RETVAL_TRUNC;
 	}
-	if(!compress_tree_store(dname, labs, pos, region, p, insertpt))
+	if(!compress_tree_store(dname, labs, pos, region, p, tree))
 		return RETVAL_OUTMEM;
 	return RETVAL_OK;
 }
@@ -359,7 +408,7 @@ type_rdata_compressable(struct ub_packed_rrset_key* key)
 /** compress domain names in rdata, return RETVAL_* */
 static int
 compress_rdata(sldns_buffer* pkt, uint8_t* rdata, size_t todolen, 
-	struct regional* region, struct compress_tree_node** tree, 
+	struct regional* region, struct compress_table* tree, 
 	const sldns_rr_descriptor* desc)
 {
 	int labs, r, rdf = 0;
@@ -438,11 +487,47 @@ rrset_belongs_in_reply(sldns_pkt_section s, uint16_t rrtype, uint16_t qtype,
 	return 1;
 }
 
+/**
+ * Write rrs from rrset data with wire headers in one piece, and fill in
+ * the owner pointers and ttls.
+ * @param pkt: the packet.
+ * @param d: the rrset data, with wire headers.
+ * @param from: first rr to write.
+ * @param to: one past the last rr to write.
+ * @param owner_ptr: compression pointer to the owner name, network order.
+ * @param timenow: the time now, for the ttls.
+ * @return false if it does not fit.
+ */
+static int
+write_wire_rrs(sldns_buffer* pkt, struct packed_rrset_data* d, size_t from,
+	size_t to, uint16_t owner_ptr, time_t timenow)
+{
+	uint32_t* offs = packed_rrset_offs(d);
+	int32_t* ttls = packed_rrset_ttls(d);
+	uint32_t start = offs[from] - PACKED_RRSET_WIRE_HDR;
+	size_t i, len = (size_t)(offs[to-1] + packed_rr_len(d, to-1) - start);
+	time_t ttl;
+	uint8_t* p;
+	if(sldns_buffer_remaining(pkt) < len)
+		return 0;
+	p = sldns_buffer_current(pkt);
+	memcpy(p, (uint8_t*)d + start, len);
+	for(i=from; i<to; i++) {
+		uint8_t* rr = p + (offs[i] - start) - PACKED_RRSET_WIRE_HDR;
+		memcpy(rr, &owner_ptr, 2);
+		ttl = d->ttl + (time_t)ttls[i];
+		sldns_write_uint32(rr+6, (ttl < timenow)?0:
+			(uint32_t)(ttl-timenow));
+	}
+	sldns_buffer_skip(pkt, (ssize_t)len);
+	return 1;
+}
+
 /** store rrset in buffer in wireformat, return RETVAL_* */
 static int
 packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt, 
 	uint16_t* num_rrs, time_t timenow, struct regional* region,
-	int do_data, int do_sig, struct compress_tree_node** tree,
+	int do_data, int do_sig, struct compress_table* tree,
 	sldns_pkt_section s, uint16_t qtype, int dnssec, size_t rr_offset)
 {
 	size_t i, j, owner_pos;
@@ -461,6 +546,15 @@ packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 	if(do_data) {
 		const sldns_rr_descriptor* c = type_rdata_compressable(key);
 		for(i=0; i<data->count; i++) {
+			/* the rest of the rrs in one piece, with pointers to
+			 * the owner written first */
+			if(i == 1 && data->wire && owner_ptr &&
+				rr_offset % data->count == 0) {
+				if(!write_wire_rrs(pkt, data, 1, data->count,
+					owner_ptr, timenow))
+					return RETVAL_TRUNC;
+				break;
+			}
 			/* rrset roundrobin */
 			j = (i + rr_offset) % data->count;
 			if((r=compress_owner(key, pkt, region, tree, 
@@ -469,20 +563,22 @@ packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 				return r;
 			sldns_buffer_write(pkt, &key->rk.type, 2);
 			sldns_buffer_write(pkt, &key->rk.rrset_class, 2);
-			if(data->rr_ttl[j] < timenow)
+			if(packed_rr_ttl(data, j) < timenow)
 				sldns_buffer_write_u32(pkt, 0);
 			else 	sldns_buffer_write_u32(pkt, 
-					data->rr_ttl[j]-timenow);
+					packed_rr_ttl(data, j)-timenow);
 			if(c) {
-				if((r=compress_rdata(pkt, data->rr_data[j],
-					data->rr_len[j], region, tree, c))
-					!= RETVAL_OK)
+				if((r=compress_rdata(pkt,
+					packed_rr_data(data, j),
+					packed_rr_len(data, j), region, tree,
+					c)) != RETVAL_OK)
 					return r;
 			} else {
-				if(sldns_buffer_remaining(pkt) < data->rr_len[j])
+				if(sldns_buffer_remaining(pkt) <
+					(size_t)packed_rr_len(data, j))
 					return RETVAL_TRUNC;
-				sldns_buffer_write(pkt, data->rr_data[j],
-					data->rr_len[j]);
+				sldns_buffer_write(pkt, packed_rr_data(data, j),
+					packed_rr_len(data, j));
 			}
 		}
 	}
@@ -490,9 +586,15 @@ packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 	if(do_sig && dnssec) {
 		size_t total = data->count+data->rrsig_count;
 		for(i=data->count; i<total; i++) {
+			if(data->wire && owner_ptr && owner_labs != 1) {
+				if(!write_wire_rrs(pkt, data, i, total,
+					owner_ptr, timenow))
+					return RETVAL_TRUNC;
+				break;
+			}
 			if(owner_ptr && owner_labs != 1) {
 				if(sldns_buffer_remaining(pkt) <
-					2+4+4+data->rr_len[i]) 
+					2+4+4+(size_t)packed_rr_len(data, i)) 
 					return RETVAL_TRUNC;
 				sldns_buffer_write(pkt, &owner_ptr, 2);
 			} else {
@@ -501,19 +603,19 @@ packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 					!= RETVAL_OK)
 					return r;
 				if(sldns_buffer_remaining(pkt) < 
-					4+4+data->rr_len[i])
+					4+4+(size_t)packed_rr_len(data, i))
 					return RETVAL_TRUNC;
 			}
 			sldns_buffer_write_u16(pkt, LDNS_RR_TYPE_RRSIG);
 			sldns_buffer_write(pkt, &key->rk.rrset_class, 2);
-			if(data->rr_ttl[i] < timenow)
+			if(packed_rr_ttl(data, i) < timenow)
 				sldns_buffer_write_u32(pkt, 0);
 			else 	sldns_buffer_write_u32(pkt, 
-					data->rr_ttl[i]-timenow);
+					packed_rr_ttl(data, i)-timenow);
 			/* rrsig rdata cannot be compressed, perform 100+ byte
 			 * memcopy. */
-			sldns_buffer_write(pkt, data->rr_data[i],
-				data->rr_len[i]);
+			sldns_buffer_write(pkt, packed_rr_data(data, i),
+				packed_rr_len(data, i));
 		}
 	}
 	/* change rrnum only after we are sure it fits */
@@ -529,7 +631,7 @@ packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 static int
 insert_section(struct reply_info* rep, size_t num_rrsets, uint16_t* num_rrs,
 	sldns_buffer* pkt, size_t rrsets_before, time_t timenow, 
-	struct regional* region, struct compress_tree_node** tree,
+	struct regional* region, struct compress_table* tree,
 	sldns_pkt_section s, uint16_t qtype, int dnssec, size_t rr_offset)
 {
 	int r;
@@ -578,13 +680,13 @@ insert_section(struct reply_info* rep, size_t num_rrsets, uint16_t* num_rrs,
 
 /** store query section in wireformat buffer, return RETVAL */
 static int
-insert_query(struct query_info* qinfo, struct compress_tree_node** tree, 
+insert_query(struct query_info* qinfo, struct compress_table* tree, 
 	sldns_buffer* buffer, struct regional* region)
 {
 	if(sldns_buffer_remaining(buffer) < 
 		qinfo->qname_len+sizeof(uint16_t)*2)
 		return RETVAL_TRUNC; /* buffer too small */
-	/* the query is the first name inserted into the tree */
+	/* the query is the first name inserted into the table */
 	if(!compress_tree_store(qinfo->qname, 
 		dname_count_labels(qinfo->qname), 
 		sldns_buffer_position(buffer), region, NULL, tree))
@@ -628,10 +730,11 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 	struct regional* region, uint16_t udpsize, int dnssec)
 {
 	uint16_t ancount=0, nscount=0, arcount=0;
-	struct compress_tree_node* tree = 0;
+	struct compress_table tree;
 	int r;
 	size_t rr_offset; 
 
+	memset(&tree, 0, sizeof(tree));
 	sldns_buffer_clear(buffer);
 	if(udpsize < sldns_buffer_limit(buffer))
 		sldns_buffer_set_limit(buffer, udpsize);
@@ -717,16 +820,21 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 uint16_t
 calc_edns_field_size(struct edns_data* edns)
 {
+	size_t rdlen = 0;
+	struct edns_option* opt;
 	if(!edns || !edns->edns_present) 
 		return 0;
-	/* domain root '.' + type + class + ttl + rdatalen(=0) */
-	return 1 + 2 + 2 + 4 + 2;
+	for(opt = edns->opt_list; opt; opt = opt->next)
+		rdlen += 2 + 2 + opt->opt_len;
+	/* domain root '.' + type + class + ttl + rdatalen + options */
+	return (uint16_t)(1 + 2 + 2 + 4 + 2 + rdlen);
 }
 
 void
 attach_edns_record(sldns_buffer* pkt, struct edns_data* edns)
 {
-	size_t len;
+	size_t len, rdlen = 0;
+	struct edns_option* opt;
 	if(!edns || !edns->edns_present)
 		return;
 	/* inc additional count */
@@ -742,7 +850,15 @@ attach_edns_record(sldns_buffer* pkt, struct edns_data* edns)
 	sldns_buffer_write_u8(pkt, edns->ext_rcode); /* ttl */
 	sldns_buffer_write_u8(pkt, edns->edns_version);
 	sldns_buffer_write_u16(pkt, edns->bits);
-	sldns_buffer_write_u16(pkt, 0); /* rdatalen */
+	for(opt = edns->opt_list; opt; opt = opt->next)
+		rdlen += 2 + 2 + opt->opt_len;
+	sldns_buffer_write_u16(pkt, (uint16_t)rdlen); /* rdatalen */
+	for(opt = edns->opt_list; opt; opt = opt->next) {
+		sldns_buffer_write_u16(pkt, opt->opt_code);
+		sldns_buffer_write_u16(pkt, opt->opt_len);
+		if(opt->opt_len != 0)
+			sldns_buffer_write(pkt, opt->opt_data, opt->opt_len);
+	}
 	sldns_buffer_flip(pkt);
 }
 
@@ -40,7 +40,7 @@
 #include "util/data/msgparse.h"
 #include "util/data/dname.h"
 #include "util/data/packed_rrset.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/keyhash.h"
 #include "util/regional.h"
 #include "ldns/rrdef.h"
 #include "ldns/sbuffer.h"
@@ -164,12 +164,13 @@ pkt_hash_rrset(sldns_buffer* pkt, uint8_t* dname, uint16_t type,
 {
 	/* note this MUST be identical to rrset_key_hash in packed_rrset.c */
 	/* this routine handles compressed names */
+	uint8_t rest[8];
 	hashvalue_t h = 0xab;
 	h = dname_pkt_hash(pkt, dname, h);
-	h = hashlittle(&type, sizeof(type), h);		/* host order */
-	h = hashlittle(&dclass, sizeof(dclass), h);	/* netw order */
-	h = hashlittle(&rrset_flags, sizeof(uint32_t), h);
-	return h;
+	memmove(rest, &type, 2);		/* host order */
+	memmove(rest+2, &dclass, 2);		/* netw order */
+	memmove(rest+4, &rrset_flags, 4);
+	return keyhash(rest, sizeof(rest), h);
 }
 
 /** create partial dname hash for rrset hash */
@@ -191,11 +192,11 @@ pkt_hash_rrset_rest(hashvalue_t dname_h, uint16_t type, uint16_t dclass,
 {
 	/* works together with pkt_hash_rrset_first */
 	/* note this MUST be identical to rrset_key_hash in packed_rrset.c */
-	hashvalue_t h;
-	h = hashlittle(&type, sizeof(type), dname_h);	/* host order */
-	h = hashlittle(&dclass, sizeof(dclass), h);	/* netw order */
-	h = hashlittle(&rrset_flags, sizeof(uint32_t), h);
-	return h;
+	uint8_t rest[8];
+	memmove(rest, &type, 2);		/* host order */
+	memmove(rest+2, &dclass, 2);		/* netw order */
+	memmove(rest+4, &rrset_flags, 4);
+	return keyhash(rest, sizeof(rest), dname_h);
 }
 
 /** compare rrset_parse with data */
@@ -793,14 +794,53 @@ add_rr_to_rrset(struct rrset_parse* rrset, sldns_buffer* pkt,
 		rrset->rr_count++;
 	}
 
-	/* calc decompressed size */
-	if(!calc_size(pkt, type, rr))
+	/* the decompressed size is calculated later, if the rrset is kept */
+	rr->size = 0;
+	if(!skip_ttl_rdata(pkt))
 		return LDNS_RCODE_FORMERR;
-	rrset->size += rr->size;
 
 	return 0;
 }
 
+/** size a list of rrs, adds the sizes to the rrset */
+static int
+calc_size_list(sldns_buffer* pkt, struct rrset_parse* rrset,
+	struct rr_parse* rr, uint16_t type)
+{
+	for(; rr; rr = rr->next) {
+		if(rr->size != 0 || rr->outside_packet)
+			continue;
+		sldns_buffer_set_position(pkt, (size_t)(rr->ttl_data -
+			sldns_buffer_begin(pkt)));
+		if(!calc_size(pkt, type, rr))
+			return 0;
+		rrset->size += rr->size;
+	}
+	return 1;
+}
+
+int
+parse_rrset_calc_size(sldns_buffer* pkt, struct rrset_parse* rrset)
+{
+	size_t pos = sldns_buffer_position(pkt);
+	int r = calc_size_list(pkt, rrset, rrset->rr_first, rrset->type) &&
+		calc_size_list(pkt, rrset, rrset->rrsig_first,
+		LDNS_RR_TYPE_RRSIG);
+	sldns_buffer_set_position(pkt, pos);
+	return r;
+}
+
+int
+parse_msg_calc_size(sldns_buffer* pkt, struct msg_parse* msg)
+{
+	struct rrset_parse* rrset;
+	for(rrset = msg->rrset_first; rrset; rrset = rrset->rrset_all_next) {
+		if(!parse_rrset_calc_size(pkt, rrset))
+			return LDNS_RCODE_FORMERR;
+	}
+	return 0;
+}
+
 /**
  * Parse packet RR section, for answer, authority and additional sections. 
  * @param pkt: packet, position at call must be at start of section.
@@ -981,6 +1021,7 @@ parse_extract_edns(struct msg_parse* msg, struct edns_data* edns)
 	msg->rrset_count --;
 	
 	/* take the data ! */
+	memset(edns, 0, sizeof(*edns));
 	edns->edns_present = 1;
 	edns->ext_rcode = found->rr_last->ttl_data[0];
 	edns->edns_version = found->rr_last->ttl_data[1];
@@ -990,6 +1031,40 @@ parse_extract_edns(struct msg_parse* msg, struct edns_data* edns)
 	return 0;
 }
 
+/** walk the options in the OPT rdata, note the position of the common
+ * ones, return RCODE on error */
+static int
+parse_edns_options(sldns_buffer* pkt, struct edns_data* edns)
+{
+	size_t end, rdlen = sldns_buffer_read_u16(pkt);
+	struct edns_opt_pos* p;
+	uint16_t code, len;
+	if(sldns_buffer_remaining(pkt) < rdlen)
+		return LDNS_RCODE_FORMERR;
+	end = sldns_buffer_position(pkt) + rdlen;
+	while(sldns_buffer_position(pkt) < end) {
+		if(end - sldns_buffer_position(pkt) < 4)
+			return LDNS_RCODE_FORMERR;
+		code = sldns_buffer_read_u16(pkt);
+		len = sldns_buffer_read_u16(pkt);
+		if(end - sldns_buffer_position(pkt) < len)
+			return LDNS_RCODE_FORMERR;
+		switch(code) {
+		case LDNS_EDNS_COOKIE: p = &edns->cookie; break;
+		case LDNS_EDNS_CLIENT_SUBNET: p = &edns->subnet; break;
+		case LDNS_EDNS_PADDING: p = &edns->padding; break;
+		case LDNS_EDNS_KEEPALIVE: p = &edns->keepalive; break;
+		default: p = NULL;
+		}
+		if(p) {
+			p->pos = (uint16_t)sldns_buffer_position(pkt);
+			p->len = len;
+		}
+		sldns_buffer_skip(pkt, (ssize_t)len);
+	}
+	return 0;
+}
+
 int 
 parse_edns_from_pkt(sldns_buffer* pkt, struct edns_data* edns)
 {
@@ -1012,11 +1087,31 @@ parse_edns_from_pkt(sldns_buffer* pkt, struct edns_data* edns)
 		return LDNS_RCODE_FORMERR;
 	if(sldns_buffer_read_u16(pkt) != LDNS_RR_TYPE_OPT)
 		return LDNS_RCODE_FORMERR;
+	memset(edns, 0, sizeof(*edns));
 	edns->edns_present = 1;
 	edns->udp_size = sldns_buffer_read_u16(pkt); /* class is udp size */
 	edns->ext_rcode = sldns_buffer_read_u8(pkt); /* ttl used for bits */
 	edns->edns_version = sldns_buffer_read_u8(pkt);
 	edns->bits = sldns_buffer_read_u16(pkt);
-	/* ignore rdata and rrsigs */
-	return 0;
+	/* ignore rrsigs */
+	return parse_edns_options(pkt, edns);
+}
+
+struct edns_option*
+edns_opt_copy_region(struct edns_option* list, struct regional* region)
+{
+	struct edns_option* first = NULL, **prevp = &first, *o;
+	for(; list; list = list->next) {
+		o = (struct edns_option*)regional_alloc(region, sizeof(*o));
+		if(!o)
+			return NULL;
+		*o = *list;
+		o->next = NULL;
+		if(list->opt_len != 0 && !(o->opt_data = regional_alloc_init(
+			region, list->opt_data, list->opt_len)))
+			return NULL;
+		*prevp = o;
+		prevp = &o->next;
+	}
+	return first;
 }
@@ -152,7 +152,7 @@ struct rrset_parse {
 	uint32_t flags;
 	/** number of RRs in the rr list */
 	size_t rr_count;
-	/** sum of RR rdata sizes */
+	/** sum of RR rdata sizes, of the RRs that have been sized */
 	size_t size;
 	/** linked list of RRs in this rrset. */
 	struct rr_parse* rr_first;
@@ -179,7 +179,9 @@ struct rr_parse {
 	/** true if ttl_data is not part of the packet, but elsewhere in mem.
 	 * Set for generated CNAMEs for DNAMEs. */
 	int outside_packet;
-	/** the length of the rdata if allocated (with no dname compression)*/
+	/** the length of the rdata if allocated (with no dname compression).
+	 * 0 if not calculated yet, parse_packet leaves the rdata alone and
+	 * it is sized (and checked) by parse_rrset_calc_size. */
 	size_t size;
 	/** next in list of RRs. */
 	struct rr_parse* next;
@@ -198,9 +200,35 @@ struct rr_parse {
 /** largest valid compression offset */
 #define PTR_MAX_OFFSET 	0x3fff
 
+/**
+ * Position of an EDNS option in a packet.
+ */
+struct edns_opt_pos {
+	/** offset of the option data, after the code and length; 0 if the
+	 * option is not present */
+	uint16_t pos;
+	/** length of the option data */
+	uint16_t len;
+};
+
+/**
+ * EDNS option, to append to an OPT record.
+ */
+struct edns_option {
+	/** next in the list */
+	struct edns_option* next;
+	/** the option code */
+	uint16_t opt_code;
+	/** length of the option data */
+	uint16_t opt_len;
+	/** the option data */
+	uint8_t* opt_data;
+};
+
 /**
  * EDNS data storage
- * EDNS rdata is ignored.
+ * EDNS rdata is ignored, except for the options of queries that are
+ * decoded by parse_edns_from_pkt.
  */
 struct edns_data {
 	/** if EDNS OPT record was present */
@@ -213,6 +241,21 @@ struct edns_data {
 	uint16_t bits;
 	/** UDP reassembly size. */
 	uint16_t udp_size;
+	/** the options of a query that parse_edns_from_pkt decodes, as
+	 * positions in the query packet; only valid while the query is in
+	 * the buffer.  The cookie option. */
+	struct edns_opt_pos cookie;
+	/** the client-subnet option */
+	struct edns_opt_pos subnet;
+	/** the padding option */
+	struct edns_opt_pos padding;
+	/** the edns-tcp-keepalive option */
+	struct edns_opt_pos keepalive;
+	/** options that are appended to the OPT record when it is encoded,
+	 * or NULL.  They are not copied, the caller keeps them in memory
+	 * until the reply is encoded, or copies them with
+	 * edns_opt_copy_region. */
+	struct edns_option* opt_list;
 };
 
 /**
@@ -225,6 +268,9 @@ size_t get_rdf_size(sldns_rdf_type rdf);
 
 /**
  * Parse the packet.
+ * The rdata is only checked to fit in the packet; the domain names inside
+ * the rdata are walked later, for the rrsets that are kept, by
+ * parse_rrset_calc_size.
  * @param pkt: packet, position at call must be at start of packet.
  *	at end position is after packet.
  * @param msg: where to store results.
@@ -234,6 +280,24 @@ size_t get_rdf_size(sldns_rdf_type rdf);
 int parse_packet(struct sldns_buffer* pkt, struct msg_parse* msg, 
 	struct regional* region);
 
+/**
+ * Calculate the decompressed rdata size of the RRs in an rrset, that
+ * have not been sized yet. This checks the domain names in the rdata.
+ * @param pkt: the packet. Position is not changed.
+ * @param rrset: the rrset, its size is updated.
+ * @return: false if the rdata is malformed.
+ */
+int parse_rrset_calc_size(struct sldns_buffer* pkt, struct rrset_parse* rrset);
+
+/**
+ * Calculate the rdata sizes for all the rrsets in the message.
+ * Call after scrubbing, so that removed rrsets are not walked.
+ * @param pkt: the packet. Position is not changed.
+ * @param msg: the parsed message.
+ * @return: 0 if OK, or RCODE formerr if rdata is malformed.
+ */
+int parse_msg_calc_size(struct sldns_buffer* pkt, struct msg_parse* msg);
+
 /**
  * After parsing the packet, extract EDNS data from packet.
  * If not present this is noted in the data structure.
@@ -254,6 +318,9 @@ int parse_extract_edns(struct msg_parse* msg, struct edns_data* edns);
 
 /**
  * If EDNS data follows a query section, extract it and initialize edns struct.
+ * The options are walked once; the cookie, client-subnet, padding and
+ * keepalive options are noted by their position in the packet, others
+ * are skipped.  Nothing is allocated.
  * @param pkt: the packet. position at start must be right after the query
  *	section. At end, right after EDNS data or no movement if failed.
  * @param edns: the edns data allocated by the caller. Does not have to be
@@ -263,6 +330,15 @@ int parse_extract_edns(struct msg_parse* msg, struct edns_data* edns);
  */
 int parse_edns_from_pkt(struct sldns_buffer* pkt, struct edns_data* edns);
 
+/**
+ * Copy a list of edns options, for a reply that is encoded later.
+ * @param list: the options.
+ * @param region: the copy is allocated here.
+ * @return the copy, or NULL on malloc failure.
+ */
+struct edns_option* edns_opt_copy_region(struct edns_option* list,
+	struct regional* region);
+
 /**
  * Calculate hash value for rrset in packet.
  * @param pkt: the packet.
@@ -41,7 +41,7 @@
 
 #include "config.h"
 #include "util/data/msgreply.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/keyhash.h"
 #include "util/log.h"
 #include "util/alloc.h"
 #include "util/netevent.h"
@@ -79,9 +79,9 @@ parse_create_qinfo(sldns_buffer* pkt, struct msg_parse* msg,
 
 /** constructor for replyinfo */
 static struct reply_info*
-construct_reply_info_base(struct regional* region, uint16_t flags, size_t qd,
-	time_t ttl, time_t prettl, size_t an, size_t ns, size_t ar, 
-	size_t total, enum sec_status sec)
+construct_reply_info_base(struct regional* region, struct alloc_cache* alloc,
+	uint16_t flags, size_t qd, time_t ttl, time_t prettl, size_t an,
+	size_t ns, size_t ar, size_t total, enum sec_status sec)
 {
 	struct reply_info* rep;
 	/* rrset_count-1 because the first ref is part of the struct. */
@@ -89,7 +89,7 @@ construct_reply_info_base(struct regional* region, uint16_t flags, size_t qd,
 		sizeof(struct ub_packed_rrset_key*) * total;
 	if(region)
 		rep = (struct reply_info*)regional_alloc(region, s);
-	else	rep = (struct reply_info*)malloc(s + 
+	else	rep = (struct reply_info*)alloc_sized_obtain(alloc, s + 
 			sizeof(struct rrset_ref) * (total));
 	if(!rep) 
 		return NULL;
@@ -117,11 +117,11 @@ construct_reply_info_base(struct regional* region, uint16_t flags, size_t qd,
 /** allocate replyinfo, return 0 on error */
 static int
 parse_create_repinfo(struct msg_parse* msg, struct reply_info** rep,
-	struct regional* region)
+	struct alloc_cache* alloc, struct regional* region)
 {
-	*rep = construct_reply_info_base(region, msg->flags, msg->qdcount, 0, 
-		0, msg->an_rrsets, msg->ns_rrsets, msg->ar_rrsets, 
-		msg->rrset_count, sec_status_unchecked);
+	*rep = construct_reply_info_base(region, alloc, msg->flags,
+		msg->qdcount, 0, 0, msg->an_rrsets, msg->ns_rrsets,
+		msg->ar_rrsets, msg->rrset_count, sec_status_unchecked);
 	if(!*rep)
 		return 0;
 	return 1;
@@ -155,7 +155,7 @@ repinfo_alloc_rrset_keys(struct reply_info* rep, struct alloc_cache* alloc,
 /** do the rdata copy */
 static int
 rdata_copy(sldns_buffer* pkt, struct packed_rrset_data* data, uint8_t* to, 
-	struct rr_parse* rr, time_t* rr_ttl, uint16_t type)
+	struct rr_parse* rr, uint32_t* rr_ttl, uint16_t type)
 {
 	uint16_t pkt_len;
 	const sldns_rr_descriptor* desc;
@@ -236,59 +236,67 @@ parse_rr_copy(sldns_buffer* pkt, struct rrset_parse* pset,
 	size_t i;
 	struct rr_parse* rr = pset->rr_first;
 	uint8_t* nextrdata;
+	uint32_t ttl;
 	size_t total = pset->rr_count + pset->rrsig_count;
 	data->ttl = MAX_TTL;
 	data->count = pset->rr_count;
 	data->rrsig_count = pset->rrsig_count;
 	data->trust = rrset_trust_none;
 	data->security = sec_status_unchecked;
-	/* layout: struct - rr_len - rr_data - rr_ttl - rdata - rrsig */
-	data->rr_len = (size_t*)((uint8_t*)data + 
-		sizeof(struct packed_rrset_data));
-	data->rr_data = (uint8_t**)&(data->rr_len[total]);
-	data->rr_ttl = (time_t*)&(data->rr_data[total]);
-	nextrdata = (uint8_t*)&(data->rr_ttl[total]);
+	data->wire = 0;
+	/* layout: struct - offsets - ttls - lengths - rdata - rrsig */
+	nextrdata = packed_rrset_rdatas(data);
 	for(i=0; i<data->count; i++) {
-		data->rr_len[i] = rr->size;
-		data->rr_data[i] = nextrdata;
+		packed_rr_len(data, i) = rr->size;
+		packed_rr_set_data(data, i, nextrdata);
 		nextrdata += rr->size;
-		if(!rdata_copy(pkt, data, data->rr_data[i], rr, 
-			&data->rr_ttl[i], pset->type))
+		if(!rdata_copy(pkt, data, packed_rr_data(data, i), rr, 
+			&ttl, pset->type))
 			return 0;
+		packed_rrset_ttls(data)[i] = (int32_t)ttl;
 		rr = rr->next;
 	}
 	/* if rrsig, its rdata is at nextrdata */
 	rr = pset->rrsig_first;
 	for(i=data->count; i<total; i++) {
-		data->rr_len[i] = rr->size;
-		data->rr_data[i] = nextrdata;
+		packed_rr_len(data, i) = rr->size;
+		packed_rr_set_data(data, i, nextrdata);
 		nextrdata += rr->size;
-		if(!rdata_copy(pkt, data, data->rr_data[i], rr, 
-			&data->rr_ttl[i], LDNS_RR_TYPE_RRSIG))
+		if(!rdata_copy(pkt, data, packed_rr_data(data, i), rr, 
+			&ttl, LDNS_RR_TYPE_RRSIG))
 			return 0;
+		packed_rrset_ttls(data)[i] = (int32_t)ttl;
 		rr = rr->next;
 	}
+	/* the ttls were stored as is, make them relative to the minimum */
+	ttl = (uint32_t)data->ttl;
+	data->ttl = 0;
+	packed_rrset_set_ttl(data, (time_t)ttl);
 	return 1;
 }
 
 /** create rrset return 0 on failure */
 static int
 parse_create_rrset(sldns_buffer* pkt, struct rrset_parse* pset,
-	struct packed_rrset_data** data, struct regional* region)
+	struct packed_rrset_data** data, struct alloc_cache* alloc,
+	struct regional* region)
 {
+	size_t s;
+	/* the rdata of the rrs that are not sized yet is walked here */
+	if(!parse_rrset_calc_size(pkt, pset))
+		return 0;
 	/* allocate */
-	size_t s = sizeof(struct packed_rrset_data) + 
-		(pset->rr_count + pset->rrsig_count) * 
-		(sizeof(size_t)+sizeof(uint8_t*)+sizeof(time_t)) + 
+	s = sizeof(struct packed_rrset_data) + 
+		PACKED_RRSET_ARRAYS_SIZE(pset->rr_count + pset->rrsig_count) +
 		pset->size;
 	if(region)
 		*data = regional_alloc(region, s);
-	else	*data = malloc(s);
+	else	*data = alloc_sized_obtain(alloc, s);
 	if(!*data)
 		return 0;
 	/* copy & decompress */
 	if(!parse_rr_copy(pkt, pset, *data)) {
-		if(!region) free(*data);
+		if(!region) alloc_sized_release(alloc, *data);
 		return 0;
 	}
 	return 1;
@@ -334,8 +342,8 @@ get_rrset_trust(struct msg_parse* msg, struct rrset_parse* rrset)
 
 int
 parse_copy_decompress_rrset(sldns_buffer* pkt, struct msg_parse* msg,
-	struct rrset_parse *pset, struct regional* region, 
-	struct ub_packed_rrset_key* pk)
+	struct rrset_parse *pset, struct alloc_cache* alloc,
+	struct regional* region, struct ub_packed_rrset_key* pk)
 {
 	struct packed_rrset_data* data;
 	pk->rk.flags = pset->flags;
@@ -343,8 +351,7 @@ parse_copy_decompress_rrset(sldns_buffer* pkt, struct msg_parse* msg,
 	if(region)
 		pk->rk.dname = (uint8_t*)regional_alloc(
 			region, pset->dname_len);
-	else	pk->rk.dname = 
-			(uint8_t*)malloc(pset->dname_len);
+	else	(void)ub_packed_rrset_name_alloc(pk, pset->dname_len);
 	if(!pk->rk.dname)
 		return 0;
 	/** copy & decompress dname */
@@ -353,7 +360,7 @@ parse_copy_decompress_rrset(sldns_buffer* pkt, struct msg_parse* msg,
 	pk->rk.type = htons(pset->type);
 	pk->rk.rrset_class = pset->rrset_class;
 	/** read data part. */
-	if(!parse_create_rrset(pkt, pset, &data, region))
+	if(!parse_create_rrset(pkt, pset, &data, alloc, region))
 		return 0;
 	pk->entry.data = (void*)data;
 	pk->entry.key = (void*)pk;
@@ -367,12 +374,14 @@ parse_copy_decompress_rrset(sldns_buffer* pkt, struct msg_parse* msg,
  * @param pkt: the packet for compression pointer resolution.
  * @param msg: the parsed message
  * @param rep: reply info to put rrs into.
+ * @param alloc: used for allocation if region is NULL.
  * @param region: if not NULL, used for allocation.
  * @return 0 on failure.
  */
 static int
 parse_copy_decompress(sldns_buffer* pkt, struct msg_parse* msg,
-	struct reply_info* rep, struct regional* region)
+	struct reply_info* rep, struct alloc_cache* alloc,
+	struct regional* region)
 {
 	size_t i;
 	struct rrset_parse *pset = msg->rrset_first;
@@ -384,7 +393,7 @@ parse_copy_decompress(sldns_buffer* pkt, struct msg_parse* msg,
 		rep->ttl = NORR_TTL;
 
 	for(i=0; i<rep->rrset_count; i++) {
-		if(!parse_copy_decompress_rrset(pkt, msg, pset, region,
+		if(!parse_copy_decompress_rrset(pkt, msg, pset, alloc, region,
 			rep->rrsets[i]))
 			return 0;
 		data = (struct packed_rrset_data*)rep->rrsets[i]->entry.data;
@@ -405,11 +414,11 @@ parse_create_msg(sldns_buffer* pkt, struct msg_parse* msg,
 	log_assert(pkt && msg);
 	if(!parse_create_qinfo(pkt, msg, qinf, region))
 		return 0;
-	if(!parse_create_repinfo(msg, rep, region))
+	if(!parse_create_repinfo(msg, rep, alloc, region))
 		return 0;
 	if(!repinfo_alloc_rrset_keys(*rep, alloc, region))
 		return 0;
-	if(!parse_copy_decompress(pkt, msg, *rep, region))
+	if(!parse_copy_decompress(pkt, msg, *rep, alloc, region))
 		return 0;
 	return 1;
 }
@@ -435,6 +444,8 @@ int reply_info_parse(sldns_buffer* pkt, struct alloc_cache* alloc,
 	}
 	if((ret = parse_extract_edns(msg, edns)) != 0)
 		return ret;
+	if((ret = parse_msg_calc_size(pkt, msg)) != 0)
+		return ret;
 
 	/* parse OK, allocate return structures */
 	/* this also performs dname decompression */
@@ -468,7 +479,7 @@ reply_info_sortref(struct reply_info* rep)
 void 
 reply_info_set_ttls(struct reply_info* rep, time_t timenow)
 {
-	size_t i, j;
+	size_t i;
 	rep->ttl += timenow;
 	rep->prefetch_ttl += timenow;
 	for(i=0; i<rep->rrset_count; i++) {
@@ -476,10 +487,8 @@ reply_info_set_ttls(struct reply_info* rep, time_t timenow)
 			rep->ref[i].key->entry.data;
 		if(i>0 && rep->ref[i].key == rep->ref[i-1].key)
 			continue;
+		/* the rr ttls are relative to it and move along */
 		data->ttl += timenow;
-		for(j=0; j<data->count + data->rrsig_count; j++) {
-			data->rr_ttl[j] += timenow;
-		}
 	}
 }
 
@@ -493,7 +502,7 @@ reply_info_parsedelete(struct reply_info* rep, struct alloc_cache* alloc)
 	for(i=0; i<rep->rrset_count; i++) {
 		ub_packed_rrset_parsedelete(rep->rrsets[i], alloc);
 	}
-	free(rep);
+	alloc_sized_release(alloc, rep);
 }
 
 int 
@@ -539,6 +548,12 @@ query_info_compare(void* m1, void* m2)
 #undef COMPARE_IT
 }
 
+int
+msgreply_expired(void* ATTR_UNUSED(k), void* d, time_t now)
+{
+	return now > ((struct reply_info*)d)->ttl;
+}
+
 void 
 query_info_clear(struct query_info* m)
 {
@@ -551,11 +566,12 @@ msgreply_sizefunc(void* k, void* d)
 {
 	struct msgreply_entry* q = (struct msgreply_entry*)k;
 	struct reply_info* r = (struct reply_info*)d;
-	size_t s = sizeof(struct msgreply_entry) + sizeof(struct reply_info)
-		+ q->key.qname_len + lock_get_mem(&q->entry.lock)
-		- sizeof(struct rrset_ref);
-	s += r->rrset_count * sizeof(struct rrset_ref);
-	s += r->rrset_count * sizeof(struct ub_packed_rrset_key*);
+	size_t s = sizeof(struct msgreply_entry) + q->key.qname_len +
+		lock_get_mem(&q->entry.lock);
+	/* the reply is a sized block, count what it really uses */
+	s += alloc_sized_size(sizeof(struct reply_info) -
+		sizeof(struct rrset_ref) + r->rrset_count *
+		(sizeof(struct rrset_ref) + sizeof(struct ub_packed_rrset_key*)));
 	return s;
 }
 
@@ -569,20 +585,19 @@ query_entry_delete(void *k, void* ATTR_UNUSED(arg))
 }
 
 void 
-reply_info_delete(void* d, void* ATTR_UNUSED(arg))
+reply_info_delete(void* d, void* arg)
 {
 	struct reply_info* r = (struct reply_info*)d;
-	free(r);
+	alloc_sized_release((struct alloc_cache*)arg, r);
 }
 
 hashvalue_t 
 query_info_hash(struct query_info *q)
 {
-	hashvalue_t h = 0xab;
-	h = hashlittle(&q->qtype, sizeof(q->qtype), h);
-	h = hashlittle(&q->qclass, sizeof(q->qclass), h);
-	h = dname_query_hash(q->qname, h);
-	return h;
+	uint16_t tc[2];
+	tc[0] = q->qtype;
+	tc[1] = q->qclass;
+	return dname_query_hash(q->qname, keyhash(tc, sizeof(tc), 0xab));
 }
 
 struct msgreply_entry* 
@@ -608,7 +623,7 @@ query_info_entrysetup(struct query_info* q, struct reply_info* r,
 /** copy rrsets from replyinfo to dest replyinfo */
 static int
 repinfo_copy_rrsets(struct reply_info* dest, struct reply_info* from, 
-	struct regional* region)
+	struct alloc_cache* alloc, struct regional* region)
 {
 	size_t i, s;
 	struct packed_rrset_data* fd, *dd;
@@ -623,19 +638,18 @@ repinfo_copy_rrsets(struct reply_info* dest, struct reply_info* from,
 			dk->id = fk->id;
 			dk->rk.dname = (uint8_t*)regional_alloc_init(region,
 				fk->rk.dname, fk->rk.dname_len);
-		} else	
-			dk->rk.dname = (uint8_t*)memdup(fk->rk.dname, 
-				fk->rk.dname_len);
+		} else if(ub_packed_rrset_name_alloc(dk, fk->rk.dname_len))
+			memmove(dk->rk.dname, fk->rk.dname, fk->rk.dname_len);
 		if(!dk->rk.dname)
 			return 0;
-		s = packed_rrset_sizeof(fd);
-		if(region)
+		if(region) {
+			s = packed_rrset_sizeof(fd);
 			dd = (struct packed_rrset_data*)regional_alloc_init(
 				region, fd, s);
-		else	dd = (struct packed_rrset_data*)memdup(fd, s);
-		if(!dd) 
+			if(!dd) 
+				return 0;
+		} else if(!(dd = packed_rrset_data_copy_alloc(fk, alloc)))
 			return 0;
-		packed_rrset_ptr_fixup(dd);
 		dk->entry.data = (void*)dd;
 	}
 	return 1;
@@ -646,8 +660,8 @@ reply_info_copy(struct reply_info* rep, struct alloc_cache* alloc,
 	struct regional* region)
 {
 	struct reply_info* cp;
-	cp = construct_reply_info_base(region, rep->flags, rep->qdcount, 
-		rep->ttl, rep->prefetch_ttl, rep->an_numrrsets, 
+	cp = construct_reply_info_base(region, alloc, rep->flags,
+		rep->qdcount, rep->ttl, rep->prefetch_ttl, rep->an_numrrsets, 
 		rep->ns_numrrsets, rep->ar_numrrsets, rep->rrset_count, 
 		rep->security);
 	if(!cp)
@@ -658,7 +672,7 @@ reply_info_copy(struct reply_info* rep, struct alloc_cache* alloc,
 			reply_info_parsedelete(cp, alloc);
 		return NULL;
 	}
-	if(!repinfo_copy_rrsets(cp, rep, region)) {
+	if(!repinfo_copy_rrsets(cp, rep, alloc, region)) {
 		if(!region)
 			reply_info_parsedelete(cp, alloc);
 		return NULL;
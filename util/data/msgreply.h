@@ -279,10 +279,14 @@ void query_info_clear(struct query_info* m);
 /** calculate size of struct query_info + reply_info */
 size_t msgreply_sizefunc(void* k, void* d);
 
+/** check if the reply_info has expired, for the cache expiry scan */
+int msgreply_expired(void* k, void* d, time_t now);
+
 /** delete msgreply_entry key structure */
 void query_entry_delete(void *q, void* arg);
 
-/** delete reply_info data structure */
+/** delete reply_info data structure, arg is the alloc_cache to
+ * release it to, or NULL */
 void reply_info_delete(void* d, void* arg);
 
 /** calculate hash value of query_info, lowercases the qname */
@@ -301,7 +305,8 @@ struct msgreply_entry* query_info_entrysetup(struct query_info* q,
 /**
  * Copy reply_info and all rrsets in it and allocate.
  * @param rep: what to copy, probably inside region, no ref[] array in it.
- * @param alloc: how to allocate rrset keys.
+ * @param alloc: how to allocate rrset keys, and the sized blocks for the
+ *	reply and rrset data.
  *	Not used if region!=NULL, it can be NULL in that case.
  * @param region: if this parameter is NULL then malloc and the alloc is used.
  *	otherwise, everything is allocated in this region.
@@ -317,6 +322,8 @@ struct reply_info* reply_info_copy(struct reply_info* rep,
  * @param pkt: packet for decompression
  * @param msg: the parser message (for flags for trust).
  * @param pset: the parsed rrset to copy.
+ * @param alloc: if region is NULL, the data is a sized block from this
+ *	alloc (see alloc_sized_obtain), free it with alloc_sized_release.
  * @param region: if NULL - malloc, else data is allocated in this region.
  * @param pk: a freshly obtained rrsetkey structure. No dname is set yet,
  *	will be set on return.
@@ -324,8 +331,8 @@ struct reply_info* reply_info_copy(struct reply_info* rep,
  * @return false on alloc failure.
  */
 int parse_copy_decompress_rrset(struct sldns_buffer* pkt, struct msg_parse* msg,
-	struct rrset_parse *pset, struct regional* region, 
-	struct ub_packed_rrset_key* pk);
+	struct rrset_parse *pset, struct alloc_cache* alloc,
+	struct regional* region, struct ub_packed_rrset_key* pk);
 
 /**
  * Find final cname target in reply, the one matching qinfo. Follows CNAMEs.
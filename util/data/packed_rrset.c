@@ -42,7 +42,7 @@
 #include "config.h"
 #include "util/data/packed_rrset.h"
 #include "util/data/dname.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/keyhash.h"
 #include "util/log.h"
 #include "util/alloc.h"
 #include "util/regional.h"
@@ -58,38 +58,60 @@ ub_packed_rrset_parsedelete(struct ub_packed_rrset_key* pkey,
 	if(!pkey)
 		return;
 	if(pkey->entry.data)
-		free(pkey->entry.data);
+		alloc_sized_release(alloc, pkey->entry.data);
 	pkey->entry.data = NULL;
-	if(pkey->rk.dname)
-		free(pkey->rk.dname);
-	pkey->rk.dname = NULL;
+	ub_packed_rrset_name_free(pkey);
 	pkey->id = 0;
 	alloc_special_release(alloc, pkey);
 }
 
+uint8_t*
+ub_packed_rrset_name_alloc(struct ub_packed_rrset_key* pkey, size_t len)
+{
+	pkey->rk.dname_len = len;
+	if(len <= sizeof(pkey->name))
+		pkey->rk.dname = pkey->name;
+	else	pkey->rk.dname = (uint8_t*)malloc(len);
+	return pkey->rk.dname;
+}
+
+void
+ub_packed_rrset_name_free(struct ub_packed_rrset_key* pkey)
+{
+	if(pkey->rk.dname && !ub_packed_rrset_name_inline(pkey))
+		free(pkey->rk.dname);
+	pkey->rk.dname = NULL;
+}
+
 size_t 
 ub_rrset_sizefunc(void* key, void* data)
 {
 	struct ub_packed_rrset_key* k = (struct ub_packed_rrset_key*)key;
 	struct packed_rrset_data* d = (struct packed_rrset_data*)data;
-	size_t s = sizeof(struct ub_packed_rrset_key) + k->rk.dname_len;
-	s += packed_rrset_sizeof(d) + lock_get_mem(&k->entry.lock);
+	size_t s = sizeof(struct ub_packed_rrset_key);
+	if(!ub_packed_rrset_name_inline(k))
+		s += k->rk.dname_len;
+	/* the data is a sized block, count what it really uses */
+	s += alloc_sized_size(packed_rrset_sizeof(d)) +
+		lock_get_mem(&k->entry.lock);
 	return s;
 }
 
+int
+ub_rrset_expired(void* ATTR_UNUSED(key), void* data, time_t now)
+{
+	return now > ((struct packed_rrset_data*)data)->ttl;
+}
+
 size_t 
 packed_rrset_sizeof(struct packed_rrset_data* d)
 {
-	size_t s;
-	if(d->rrsig_count > 0) {
-		s = ((uint8_t*)d->rr_data[d->count+d->rrsig_count-1] - 
-			(uint8_t*)d) + d->rr_len[d->count+d->rrsig_count-1];
-	} else {
-		log_assert(d->count > 0);
-		s = ((uint8_t*)d->rr_data[d->count-1] - (uint8_t*)d) + 
-			d->rr_len[d->count-1];
-	}
-	return s;
+	size_t last;
+	if(packed_rrset_total(d) == 0)
+		return sizeof(*d);
+	/* the rdatas are in order, the last one ends the blob */
+	last = packed_rrset_total(d) - 1;
+	return (size_t)packed_rrset_offs(d)[last] + packed_rr_len(d, last);
 }
 
 int 
@@ -131,16 +153,16 @@ ub_rrset_key_delete(void* key, void* userdata)
 	struct ub_packed_rrset_key* k = (struct ub_packed_rrset_key*)key;
 	struct alloc_cache* a = (struct alloc_cache*)userdata;
 	k->id = 0;
-	free(k->rk.dname);
-	k->rk.dname = NULL;
-	alloc_special_release(a, k);
+	/* readers without locks can still be looking at the key and name,
+	 * the name is freed when the key is released */
+	alloc_retire(a, k, ALLOC_RETIRE_SPECIAL);
 }
 
 void 
-rrset_data_delete(void* data, void* ATTR_UNUSED(userdata))
+rrset_data_delete(void* data, void* userdata)
 {
 	struct packed_rrset_data* d = (struct packed_rrset_data*)data;
-	free(d);
+	alloc_retire((struct alloc_cache*)userdata, d, ALLOC_RETIRE_SIZED);
 }
 
 int 
@@ -150,11 +172,12 @@ rrsetdata_equal(struct packed_rrset_data* d1, struct packed_rrset_data* d2)
 	size_t total;
 	if(d1->count != d2->count || d1->rrsig_count != d2->rrsig_count) 
 		return 0;
-	total = d1->count + d1->rrsig_count;
+	total = packed_rrset_total(d1);
 	for(i=0; i<total; i++) {
-		if(d1->rr_len[i] != d2->rr_len[i])
+		if(packed_rr_len(d1, i) != packed_rr_len(d2, i))
 			return 0;
-		if(memcmp(d1->rr_data[i], d2->rr_data[i], d1->rr_len[i]) != 0)
+		if(memcmp(packed_rr_data(d1, i), packed_rr_data(d2, i),
+			packed_rr_len(d1, i)) != 0)
 			return 0;
 	}
 	return 1;
@@ -167,30 +190,98 @@ rrset_key_hash(struct packed_rrset_key* key)
 	uint16_t t = ntohs(key->type);
 	/* Note this MUST be identical to pkt_hash_rrset in msgparse.c */
 	/* this routine does not have a compressed name */
+	uint8_t rest[8];
 	hashvalue_t h = 0xab;
 	h = dname_query_hash(key->dname, h);
-	h = hashlittle(&t, sizeof(t), h);
-	h = hashlittle(&key->rrset_class, sizeof(uint16_t), h);
-	h = hashlittle(&key->flags, sizeof(uint32_t), h);
-	return h;
+	memmove(rest, &t, 2);
+	memmove(rest+2, &key->rrset_class, 2);
+	memmove(rest+4, &key->flags, 4);
+	return keyhash(rest, sizeof(rest), h);
 }
 
 void 
-packed_rrset_ptr_fixup(struct packed_rrset_data* data)
+packed_rrset_offs_setup(struct packed_rrset_data* data)
+{
+	size_t i;
+	size_t total = packed_rrset_total(data);
+	uint8_t* nextrdata = packed_rrset_rdatas(data);
+	data->wire = 0;
+	for(i=0; i<total; i++) {
+		packed_rr_set_data(data, i, nextrdata);
+		nextrdata += packed_rr_len(data, i);
+	}
+}
+
+void
+packed_rrset_set_ttl(struct packed_rrset_data* data, time_t ttl)
 {
 	size_t i;
-	size_t total = data->count + data->rrsig_count;
-	uint8_t* nextrdata;
-	/* fixup pointers in packed rrset data */
-	data->rr_len = (size_t*)((uint8_t*)data +
-		sizeof(struct packed_rrset_data));
-	data->rr_data = (uint8_t**)&(data->rr_len[total]);
-	data->rr_ttl = (time_t*)&(data->rr_data[total]);
-	nextrdata = (uint8_t*)&(data->rr_ttl[total]);
+	size_t total = packed_rrset_total(data);
+	int32_t diff = (int32_t)(data->ttl - ttl);
+	data->ttl = ttl;
+	for(i=0; i<total; i++)
+		packed_rrset_ttls(data)[i] += diff;
+}
+
+/** see if the rrset data is stored with wire headers */
+static int
+packed_rrset_wire_ok(struct ub_packed_rrset_key* key,
+	struct packed_rrset_data* d)
+{
+	const sldns_rr_descriptor* desc;
+	/* the root owner is not written with a compression pointer, and
+	 * a single rr does not gain from the copy in one piece */
+	if(key->rk.dname_len <= 1 || packed_rrset_total(d) < 2)
+		return 0;
+	/* names in the rdata are compressed when the rrset is encoded */
+	desc = sldns_rr_descript(ntohs(key->rk.type));
+	if(desc && desc->_compress == LDNS_RR_COMPRESS)
+		return 0;
+	return 1;
+}
+
+struct packed_rrset_data* 
+packed_rrset_data_copy_alloc(struct ub_packed_rrset_key* key,
+	struct alloc_cache* alloc)
+{
+	struct packed_rrset_data* fd = (struct packed_rrset_data*)
+		key->entry.data, *dd;
+	size_t i, s, total = packed_rrset_total(fd);
+	uint8_t* p;
+	if(!packed_rrset_wire_ok(key, fd)) {
+		s = packed_rrset_sizeof(fd);
+		if(!(dd = (struct packed_rrset_data*)alloc_sized_obtain(alloc,
+			s)))
+			return NULL;
+		memcpy(dd, fd, s);
+		return dd;
+	}
+	s = sizeof(*dd) + PACKED_RRSET_ARRAYS_SIZE(total) +
+		total*PACKED_RRSET_WIRE_HDR;
+	for(i=0; i<total; i++)
+		s += packed_rr_len(fd, i);
+	if(!(dd = (struct packed_rrset_data*)alloc_sized_obtain(alloc, s)))
+		return NULL;
+	memcpy(dd, fd, sizeof(*dd));
+	dd->wire = 1;
+	memcpy(packed_rrset_ttls(dd), packed_rrset_ttls(fd),
+		total*sizeof(int32_t));
+	memcpy(packed_rrset_lens(dd), packed_rrset_lens(fd),
+		total*sizeof(uint16_t));
+	p = packed_rrset_rdatas(dd);
 	for(i=0; i<total; i++) {
-		data->rr_data[i] = nextrdata;
-		nextrdata += data->rr_len[i];
+		/* the owner pointer and ttl are filled in when encoded */
+		memset(p, 0, PACKED_RRSET_WIRE_HDR);
+		if(i < fd->count)
+			memcpy(p+2, &key->rk.type, 2);
+		else	sldns_write_uint16(p+2, LDNS_RR_TYPE_RRSIG);
+		memcpy(p+4, &key->rk.rrset_class, 2);
+		p += PACKED_RRSET_WIRE_HDR;
+		memcpy(p, packed_rr_data(fd, i), packed_rr_len(fd, i));
+		packed_rr_set_data(dd, i, p);
+		p += packed_rr_len(fd, i);
 	}
+	return dd;
 }
 
 void 
@@ -205,25 +296,22 @@ get_cname_target(struct ub_packed_rrset_key* rrset, uint8_t** dname,
 	d = (struct packed_rrset_data*)rrset->entry.data;
 	if(d->count < 1)
 		return;
-	if(d->rr_len[0] < 3) /* at least rdatalen + 0byte root label */
+	if(packed_rr_len(d, 0) < 3) /* at least rdatalen + 0byte root label */
 		return;
-	len = sldns_read_uint16(d->rr_data[0]);
-	if(len != d->rr_len[0] - sizeof(uint16_t))
+	len = sldns_read_uint16(packed_rr_data(d, 0));
+	if(len != packed_rr_len(d, 0) - sizeof(uint16_t))
 		return;
-	if(dname_valid(d->rr_data[0]+sizeof(uint16_t), len) != len)
+	if(dname_valid(packed_rr_data(d, 0)+sizeof(uint16_t), len) != len)
 		return;
-	*dname = d->rr_data[0]+sizeof(uint16_t);
+	*dname = packed_rr_data(d, 0)+sizeof(uint16_t);
 	*dname_len = len;
 }
 
 void 
 packed_rrset_ttl_add(struct packed_rrset_data* data, time_t add)
 {
-	size_t i;
-	size_t total = data->count + data->rrsig_count;
+	/* the ttls of the rrs are relative to it */
 	data->ttl += add;
-	for(i=0; i<total; i++)
-		data->rr_ttl[i] += add;
 }
 
 const char* 
@@ -274,7 +362,7 @@ int packed_rr_to_string(struct ub_packed_rrset_key* rrset, size_t i,
 	struct packed_rrset_data* d = (struct packed_rrset_data*)rrset->
 		entry.data;
 	uint8_t rr[65535];
-	size_t rlen = rrset->rk.dname_len + 2 + 2 + 4 + d->rr_len[i];
+	size_t rlen = rrset->rk.dname_len + 2 + 2 + 4 + packed_rr_len(d, i);
 	log_assert(dest_len > 0 && dest);
 	if(rlen > dest_len) {
 		dest[0] = 0;
@@ -286,10 +374,11 @@ int packed_rr_to_string(struct ub_packed_rrset_key* rrset, size_t i,
 	else	sldns_write_uint16(rr+rrset->rk.dname_len, LDNS_RR_TYPE_RRSIG);
 	memmove(rr+rrset->rk.dname_len+2, &rrset->rk.rrset_class, 2);
 	sldns_write_uint32(rr+rrset->rk.dname_len+4,
-		(uint32_t)(d->rr_ttl[i]-now));
-	memmove(rr+rrset->rk.dname_len+8, d->rr_data[i], d->rr_len[i]);
+		(uint32_t)(packed_rr_ttl(d, i)-now));
+	memmove(rr+rrset->rk.dname_len+8, packed_rr_data(d, i),
+		packed_rr_len(d, i));
 	if(sldns_wire2str_rr_buf(rr, rlen, dest, dest_len) == -1) {
-		log_info("rrbuf failure %d %s", (int)d->rr_len[i], dest);
+		log_info("rrbuf failure %d %s", (int)packed_rr_len(d, i), dest);
 		dest[0] = 0;
 		return 0;
 	} 
@@ -348,16 +437,16 @@ packed_rrset_copy_region(struct ub_packed_rrset_key* key,
 	if(!d)
 		return NULL;
 	ck->entry.data = d;
-	packed_rrset_ptr_fixup(d);
 	/* make TTLs relative - once per rrset */
-	for(i=0; i<d->count + d->rrsig_count; i++) {
-		if(d->rr_ttl[i] < now)
-			d->rr_ttl[i] = 0;
-		else	d->rr_ttl[i] -= now;
-	}
 	if(d->ttl < now)
 		d->ttl = 0;
 	else	d->ttl -= now;
+	for(i=0; i<packed_rrset_total(d); i++) {
+		if(packed_rr_ttl(data, i) < now)
+			packed_rr_set_ttl(d, i, 0);
+		else	packed_rr_set_ttl(d, i,
+				packed_rr_ttl(data, i) - now);
+	}
 	return ck;
 }
 
@@ -365,24 +454,22 @@ struct ub_packed_rrset_key*
 packed_rrset_copy_alloc(struct ub_packed_rrset_key* key, 
 	struct alloc_cache* alloc, time_t now)
 {
-	struct packed_rrset_data* fd, *dd;
+	struct packed_rrset_data* dd;
 	struct ub_packed_rrset_key* dk = alloc_special_obtain(alloc);
 	if(!dk) return NULL;
-	fd = (struct packed_rrset_data*)key->entry.data;
 	dk->entry.hash = key->entry.hash;
 	dk->rk = key->rk;
-	dk->rk.dname = (uint8_t*)memdup(key->rk.dname, key->rk.dname_len);
-	if(!dk->rk.dname) {
+	if(!ub_packed_rrset_name_alloc(dk, key->rk.dname_len)) {
 		alloc_special_release(alloc, dk);
 		return NULL;
 	}
-	dd = (struct packed_rrset_data*)memdup(fd, packed_rrset_sizeof(fd));
+	memmove(dk->rk.dname, key->rk.dname, key->rk.dname_len);
+	dd = packed_rrset_data_copy_alloc(key, alloc);
 	if(!dd) {
-		free(dk->rk.dname);
+		ub_packed_rrset_name_free(dk);
 		alloc_special_release(alloc, dk);
 		return NULL;
 	}
-	packed_rrset_ptr_fixup(dd);
 	dk->entry.data = (void*)dd;
 	packed_rrset_ttl_add(dd, now);
 	return dk;
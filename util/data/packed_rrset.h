@@ -85,6 +85,9 @@ struct packed_rrset_key {
 	uint16_t rrset_class;
 };
 
+/** owner names up to this length are stored in the rrset key itself */
+#define PACKED_RRSET_NAME_INLINE 32
+
 /**
  * This structure contains an RRset. A set of resource records that
  * share the same domain name, type and class.
@@ -111,8 +114,18 @@ struct ub_packed_rrset_key {
 	rrset_id_t id;
 	/** key data: dname, type and class */
 	struct packed_rrset_key rk;
+	/** 
+	 * The owner name, if the key has allocated rk.dname with
+	 * ub_packed_rrset_name_alloc and it fits, so the hash compare
+	 * does not have to follow a pointer.  Readers without locks can
+	 * look at it, deleted keys are retired before they are reused.
+	 */
+	uint8_t name[PACKED_RRSET_NAME_INLINE];
 };
 
+/** true if the owner name is stored in the key */
+#define ub_packed_rrset_name_inline(k) ((k)->rk.dname == (k)->name)
+
 /**
  * RRset trustworthiness. Bigger value is more trust. RFC 2181.
  * The rrset_trust_add_noAA, rrset_trust_auth_noAA, rrset_trust_add_AA,
@@ -187,16 +200,36 @@ enum sec_status {
  * The data is packed, stored contiguously in memory.
  * memory layout:
  *	o base struct
- *	o rr_len size_t array
- *	o rr_data uint8_t* array
- *	o rr_ttl uint32_t array (after size_t and ptrs because those may be
- *		64bit and this array before those would make them unaligned).
- *		Since the stuff before is 32/64bit, rr_ttl is 32 bit aligned.
+ *	o uint32_t array with the offset of every rdata from the start of
+ *	  the struct
+ *	o int32_t array with the ttl of every rr, relative to the ttl of
+ *	  the rrset
+ *	o uint16_t array with the length of every rdata
+ *		The arrays are ordered from large to small elements, so that
+ *		all of them are aligned without padding.
  *	o rr_data rdata wireformats
  *	o rrsig_data rdata wireformat(s)
+ * The arrays are read and written with the packed_rr_data, packed_rr_len
+ * and packed_rr_ttl accessors below.  There are no pointers inside the
+ * blob, it can be copied with memcpy.
+ *
+ * If wire is set, every rdata is preceded by PACKED_RRSET_WIRE_HDR octets,
+ * the rest of the RR as it appears in a packet: owner name compression
+ * pointer (zero), type, class and ttl (zero).  The rrs can then be copied
+ * to a packet in one piece, and the pointers and ttls filled in.  This is
+ * only done in the cache, for rrsets without compressed names in the
+ * rdata.
+ *
+ * The per-RR overhead is 10 bytes, instead of 24 on 64bit for size_t and
+ * time_t arrays and rdata pointers.  The rdata of an RR fits in a 64k
+ * message, so the length (with the rdlength) fits in 16 bits, and the
+ * blob fits the 32bit offsets.  The TTLs of the rrs are mostly the same as
+ * that of the rrset, the difference fits in 32 bits.
  *
  * Rdata is stored in wireformat. The dname is stored in wireformat.
- * TTLs are stored as absolute values (and could be expired).
+ * TTLs are stored as absolute values (and could be expired).  When the
+ * ttl of the rrset is changed, the ttls of the rrs change with it, use
+ * packed_rrset_set_ttl to keep the ttls of the rrs.
  *
  * RRSIGs are stored in the arrays after the regular rrs.
  *
@@ -206,9 +239,9 @@ enum sec_status {
  * On the wire an RR is:
  *	name, type, class, ttl, rdlength, rdata.
  * So we need to send the following per RR:
- *	key.dname, ttl, rr_data[i].
+ *	key.dname, ttl, packed_rr_data(d, i).
  *	since key.dname ends with type and class.
- *	and rr_data starts with the rdlength.
+ *	and the rdata starts with the rdlength.
  *	the ttl value to send changes due to time.
  */
 struct packed_rrset_data {
@@ -216,25 +249,15 @@ struct packed_rrset_data {
 	 * Same for all RRs see rfc2181(5.2).  */
 	time_t ttl;
 	/** number of rrs. */
-	size_t count;
+	uint32_t count;
 	/** number of rrsigs, if 0 no rrsigs */
-	size_t rrsig_count;
+	uint32_t rrsig_count;
 	/** the trustworthiness of the rrset data */
 	enum rrset_trust trust; 
 	/** security status of the rrset data */
 	enum sec_status security;
-	/** length of every rr's rdata, rr_len[i] is size of rr_data[i]. */
-	size_t* rr_len;
-	/** ttl of every rr. rr_ttl[i] ttl of rr i. */
-	time_t *rr_ttl;
-	/** 
-	 * Array of pointers to every rr's rdata. 
-	 * The rr_data[i] rdata is stored in uncompressed wireformat. 
-	 * The first uint16_t of rr_data[i] is network format rdlength.
-	 *
-	 * rr_data[count] to rr_data[count+rrsig_count] contain the rrsig data.
-	 */
-	uint8_t** rr_data;
+	/** if true, the rdatas have wire headers in front of them */
+	int wire;
 };
 
 /**
@@ -263,11 +286,29 @@ struct packed_rrset_list {
  * Delete packed rrset key and data, not entered in hashtables yet.
  * Used during parsing.
  * @param pkey: rrset key structure with locks, key and data pointers.
- * @param alloc: where to return the unfree-able key structure.
+ * @param alloc: where to return the unfree-able key structure, and the
+ *	data, that is a sized block (see alloc_sized_obtain).
  */
 void ub_packed_rrset_parsedelete(struct ub_packed_rrset_key* pkey,
 	struct alloc_cache* alloc);
 
+/**
+ * Allocate the owner name of an rrset key, in the key itself if it fits,
+ * otherwise with malloc.  Sets rk.dname and rk.dname_len.
+ * @param pkey: the rrset key.
+ * @param len: length of the name.
+ * @return the buffer for the name, or NULL on malloc failure.
+ */
+uint8_t* ub_packed_rrset_name_alloc(struct ub_packed_rrset_key* pkey,
+	size_t len);
+
+/**
+ * Free the owner name of an rrset key, if it was malloced.  Sets
+ * rk.dname to NULL.
+ * @param pkey: the rrset key.
+ */
+void ub_packed_rrset_name_free(struct ub_packed_rrset_key* pkey);
+
 /**
  * Memory size of rrset data. RRset data must be filled in correctly.
  * @param data: data to examine.
@@ -290,6 +331,15 @@ time_t ub_packed_rrset_ttl(struct ub_packed_rrset_key* key);
  */
 size_t ub_rrset_sizefunc(void* key, void* data);
 
+/**
+ * Check if the rrset entry has expired. For the cache expiry scan.
+ * @param key: struct ub_packed_rrset_key*.
+ * @param data: struct packed_rrset_data*.
+ * @param now: the current time.
+ * @return true if expired.
+ */
+int ub_rrset_expired(void* key, void* data, time_t now);
+
 /**
  * compares two rrset keys.
  * @param k1: struct ub_packed_rrset_key*.
@@ -311,15 +361,17 @@ int rrsetdata_equal(struct packed_rrset_data* d1, struct packed_rrset_data* d2);
  * Old key to be deleted. RRset keys are recycled via alloc.
  * The id is set to 0. So that other threads, after acquiring a lock always
  * get the correct value, in this case the 0 deleted-special value.
+ * The key and its name are recycled after the readers without locks are
+ * done with them.
  * @param key: struct ub_packed_rrset_key*.
  * @param userdata: alloc structure to use for recycling.
  */
 void ub_rrset_key_delete(void* key, void* userdata);
 
 /**
- * Old data to be deleted.
- * @param data: what to delete.
- * @param userdata: user data ptr.
+ * Old data to be deleted, after the readers without locks are done with it.
+ * @param data: what to delete, a sized block (see alloc_sized_obtain).
+ * @param userdata: alloc structure to release the data to.
  */
 void rrset_data_delete(void* data, void* userdata);
 
@@ -330,12 +382,65 @@ void rrset_data_delete(void* data, void* userdata);
  */
 hashvalue_t rrset_key_hash(struct packed_rrset_key* key);
 
+/** size of the offset, ttl and length arrays for total rrs */
+#define PACKED_RRSET_ARRAYS_SIZE(total) ((total)*(sizeof(uint32_t) + \
+	sizeof(int32_t) + sizeof(uint16_t)))
+
+/** number of rrs and rrsigs in the rrset data */
+#define packed_rrset_total(d) ((size_t)(d)->count + (size_t)(d)->rrsig_count)
+/** the offsets of the rdatas from the start of the rrset data */
+#define packed_rrset_offs(d) ((uint32_t*)((d)+1))
+/** the ttls of the rrs, relative to the ttl of the rrset */
+#define packed_rrset_ttls(d) ((int32_t*)((d)+1) + packed_rrset_total(d))
+/** the lengths of the rdatas */
+#define packed_rrset_lens(d) ((uint16_t*)((int32_t*)((d)+1) + \
+	2*packed_rrset_total(d)))
+/** where the rdatas start, after the arrays */
+#define packed_rrset_rdatas(d) ((uint8_t*)(packed_rrset_lens(d) + \
+	packed_rrset_total(d)))
+/** the rdata of rr i, it starts with the rdlength */
+#define packed_rr_data(d, i) ((uint8_t*)(d) + packed_rrset_offs(d)[i])
+/** set the rdata of rr i, p points into the blob */
+#define packed_rr_set_data(d, i, p) (packed_rrset_offs(d)[i] = \
+	(uint32_t)((uint8_t*)(p) - (uint8_t*)(d)))
+/** the length of the rdata of rr i, with the rdlength, can be assigned */
+#define packed_rr_len(d, i) (packed_rrset_lens(d)[i])
+/** the absolute ttl of rr i */
+#define packed_rr_ttl(d, i) ((d)->ttl + (time_t)packed_rrset_ttls(d)[i])
+/** set the absolute ttl of rr i, set the ttl of the rrset first */
+#define packed_rr_set_ttl(d, i, t) (packed_rrset_ttls(d)[i] = \
+	(int32_t)((t) - (d)->ttl))
+
+/** octets in front of the rdata for rrset data with wire headers,
+ * compression pointer, type, class, ttl */
+#define PACKED_RRSET_WIRE_HDR 10
+
 /**
- * Fixup pointers in fixed data packed_rrset_data blob.
- * After a memcpy of the data for example. Will set internal pointers right.
- * @param data: rrset data structure. Otherwise correctly filled in.
+ * Set the rdata offsets in a packed_rrset_data blob, from the count,
+ * rrsig_count and the rdata lengths.  The rdatas are in order after the
+ * arrays.  The blob is set up without wire headers.
+ * @param data: rrset data structure, count, rrsig_count and the lengths
+ *	filled in.
+ */
+void packed_rrset_offs_setup(struct packed_rrset_data* data);
+
+/**
+ * Set the ttl of the rrset, and keep the ttls of the rrs as they are.
+ * @param data: rrset data structure.
+ * @param ttl: the new ttl of the rrset.
+ */
+void packed_rrset_set_ttl(struct packed_rrset_data* data, time_t ttl);
+
+/**
+ * Copy the data of an rrset into a sized block from the alloc cache,
+ * for storage in the cache.  If the rrset benefits, the copy has wire
+ * headers.
+ * @param key: the rrset, with the data to copy.
+ * @param alloc: where to allocate the copy.
+ * @return the copy or NULL on alloc failure.
  */
-void packed_rrset_ptr_fixup(struct packed_rrset_data* data);
+struct packed_rrset_data* packed_rrset_data_copy_alloc(
+	struct ub_packed_rrset_key* key, struct alloc_cache* alloc);
 
 /**
  * Fixup TTLs in fixed data packed_rrset_data blob.
@@ -417,7 +522,7 @@ struct ub_packed_rrset_key* packed_rrset_copy_region(
 /** 
  * Allocate rrset with malloc (from region or you are holding the lock).
  * @param key: key with data entry.
- * @param alloc: alloc_cache to create rrset_keys
+ * @param alloc: alloc_cache to create rrset_keys and the data.
  * @param now: adjust the TTLs to be absolute (add to all TTLs).
  * @return new region-alloced rrset key or NULL on alloc failure.
  */
@@ -106,6 +106,8 @@ fptr_whitelist_comm_timer(void (*fptr)(void*))
 	else if(fptr == &outnet_tcptimer) return 1;
 	else if(fptr == &pending_udp_timer_delay_cb) return 1;
 	else if(fptr == &worker_stat_timer_cb) return 1;
+	else if(fptr == &worker_expiry_timer_cb) return 1;
+	else if(fptr == &worker_hot_timer_cb) return 1;
 	else if(fptr == &worker_probe_timer_cb) return 1;
 #ifdef UB_ON_WINDOWS
 	else if(fptr == &wsvc_cron_cb) return 1;
@@ -188,6 +190,7 @@ fptr_whitelist_rbtree_cmp(int (*fptr) (const void *, const void *))
 	else if(fptr == &fwd_cmp) return 1;
 	else if(fptr == &pending_cmp) return 1;
 	else if(fptr == &serviced_cmp) return 1;
+	else if(fptr == &ssl_session_cmp) return 1;
 	else if(fptr == &name_tree_compare) return 1;
 	else if(fptr == &order_lock_cmp) return 1;
 	else if(fptr == &codeline_cmp) return 1;
@@ -209,6 +212,7 @@ fptr_whitelist_hash_sizefunc(lruhash_sizefunc_t fptr)
 	if(fptr == &msgreply_sizefunc) return 1;
 	else if(fptr == &ub_rrset_sizefunc) return 1;
 	else if(fptr == &infra_sizefunc) return 1;
+	else if(fptr == &rate_sizefunc) return 1;
 	else if(fptr == &key_entry_sizefunc) return 1;
 	else if(fptr == &test_slabhash_sizefunc) return 1;
 	return 0;
@@ -220,6 +224,7 @@ fptr_whitelist_hash_compfunc(lruhash_compfunc_t fptr)
 	if(fptr == &query_info_compare) return 1;
 	else if(fptr == &ub_rrset_compare) return 1;
 	else if(fptr == &infra_compfunc) return 1;
+	else if(fptr == &rate_compfunc) return 1;
 	else if(fptr == &key_entry_compfunc) return 1;
 	else if(fptr == &test_slabhash_compfunc) return 1;
 	return 0;
@@ -231,6 +236,7 @@ fptr_whitelist_hash_delkeyfunc(lruhash_delkeyfunc_t fptr)
 	if(fptr == &query_entry_delete) return 1;
 	else if(fptr == &ub_rrset_key_delete) return 1;
 	else if(fptr == &infra_delkeyfunc) return 1;
+	else if(fptr == &rate_delkeyfunc) return 1;
 	else if(fptr == &key_entry_delkeyfunc) return 1;
 	else if(fptr == &test_slabhash_delkey) return 1;
 	return 0;
@@ -242,6 +248,7 @@ fptr_whitelist_hash_deldatafunc(lruhash_deldatafunc_t fptr)
 	if(fptr == &reply_info_delete) return 1;
 	else if(fptr == &rrset_data_delete) return 1;
 	else if(fptr == &infra_deldatafunc) return 1;
+	else if(fptr == &rate_deldatafunc) return 1;
 	else if(fptr == &key_entry_deldatafunc) return 1;
 	else if(fptr == &test_slabhash_deldata) return 1;
 	return 0;
@@ -255,6 +262,15 @@ fptr_whitelist_hash_markdelfunc(lruhash_markdelfunc_t fptr)
 	return 0;
 }
 
+int 
+fptr_whitelist_hash_expiredfunc(lruhash_expiredfunc_t fptr)
+{
+	if(fptr == &msgreply_expired) return 1;
+	else if(fptr == &ub_rrset_expired) return 1;
+	else if(fptr == &test_slabhash_expired) return 1;
+	return 0;
+}
+
 /** whitelist env->send_query callbacks */
 int 
 fptr_whitelist_modenv_send_query(struct outbound_entry* (*fptr)(
@@ -45,6 +45,11 @@
 #ifdef HAVE_SYS_WAIT_H
 #include <sys/wait.h>
 #endif
+#if defined(USE_COMPACT_LOCKS) && !defined(USE_THREAD_DEBUG)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <limits.h>
+#endif
 
 /** block all signals, masks them away. */
 void 
@@ -142,6 +147,164 @@ void ub_thr_fork_wait(ub_thread_t thread)
 }
 #endif /* !defined(HAVE_PTHREAD) && !defined(HAVE_SOLARIS_THREADS) && !defined(HAVE_WINDOWS_THREADS) */
 
+#if defined(USE_COMPACT_LOCKS) && !defined(USE_THREAD_DEBUG)
+/** number of times to retry a contended lock before going to sleep */
+#define LOCK_RW_SPINS 100
+/** futex bitset that readers sleep on */
+#define LOCK_RW_READER_BITS 1
+/** futex bitset that writers sleep on */
+#define LOCK_RW_WRITER_BITS 2
+
+/** try to get a read lock, returns true on success.  It waits for
+ * sleeping writers, so that they get the lock before new readers. */
+static int
+lock_rw_tryrdlock(lock_rw_t* lock)
+{
+	uint32_t val = __atomic_load_n(lock, __ATOMIC_RELAXED);
+	while((val&LOCK_RW_COUNT) < LOCK_RW_WRITER-1 &&
+		!(val&LOCK_RW_WWAIT)) {
+		/* on failure val is updated with the current value */
+		if(__atomic_compare_exchange_n(lock, &val, val+1, 1,
+			__ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+			return 1;
+	}
+	return 0;
+}
+
+/** try to get the write lock, returns true on success.
+ * @param lock: the lock.
+ * @param wwait: LOCK_RW_WWAIT if the caller has slept, other writers
+ *	may be sleeping and the unlock has to wake them.
+ */
+static int
+lock_rw_trywrlock(lock_rw_t* lock, uint32_t wwait)
+{
+	uint32_t val = __atomic_load_n(lock, __ATOMIC_RELAXED);
+	while((val&LOCK_RW_COUNT) == 0) {
+		if(__atomic_compare_exchange_n(lock, &val,
+			val|LOCK_RW_WRITER|wwait, 1, __ATOMIC_ACQUIRE,
+			__ATOMIC_RELAXED))
+			return 1;
+	}
+	return 0;
+}
+
+/**
+ * Sleep on the lock, unless it has changed from val.  Sets the waiters
+ * flag so that the unlock wakes us up.
+ * @param lock: the lock.
+ * @param val: the value of the lock that made the caller wait.
+ * @param flag: LOCK_RW_WWAIT or LOCK_RW_RWAIT.
+ * @param bits: the futex bitset to sleep on.
+ */
+static void
+lock_rw_sleep(lock_rw_t* lock, uint32_t val, uint32_t flag, int bits)
+{
+	if(!(val&flag)) {
+		if(!__atomic_compare_exchange_n(lock, &val, val|flag, 0,
+			__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+			return; /* changed, try again */
+		val |= flag;
+	}
+	/* returns at once if the value is no longer val */
+	(void)syscall(SYS_futex, lock, FUTEX_WAIT_BITSET_PRIVATE, val, NULL,
+		NULL, bits);
+}
+
+void
+lock_rw_rdlock(lock_rw_t* lock)
+{
+	int spins = LOCK_RW_SPINS;
+	uint32_t val;
+	while(!lock_rw_tryrdlock(lock)) {
+		val = __atomic_load_n(lock, __ATOMIC_RELAXED);
+		if((val&LOCK_RW_COUNT) < LOCK_RW_WRITER-1 &&
+			!(val&LOCK_RW_WWAIT))
+			continue;
+		if(spins > 0) {
+			spins--;
+			continue;
+		}
+		lock_rw_sleep(lock, val, LOCK_RW_RWAIT, LOCK_RW_READER_BITS);
+	}
+}
+
+void
+lock_rw_wrlock(lock_rw_t* lock)
+{
+	int spins = LOCK_RW_SPINS;
+	uint32_t val, wwait = 0;
+	while(!lock_rw_trywrlock(lock, wwait)) {
+		val = __atomic_load_n(lock, __ATOMIC_RELAXED);
+		if((val&LOCK_RW_COUNT) == 0)
+			continue;
+		if(spins > 0) {
+			spins--;
+			continue;
+		}
+		lock_rw_sleep(lock, val, LOCK_RW_WWAIT, LOCK_RW_WRITER_BITS);
+		wwait = LOCK_RW_WWAIT;
+	}
+}
+
+void
+lock_rw_unlock(lock_rw_t* lock)
+{
+	uint32_t val = __atomic_load_n(lock, __ATOMIC_RELAXED), cnt, nval;
+	do {
+		cnt = val&LOCK_RW_COUNT;
+		log_assert(cnt != 0);
+		/* a writer counts the write in the version */
+		if(cnt == LOCK_RW_WRITER)
+			nval = (val&(LOCK_RW_WWAIT|LOCK_RW_RWAIT)) |
+				((val+LOCK_RW_GEN_ONE)&LOCK_RW_GEN);
+		else	nval = val-1;
+		/* the last one out wakes a writer, or else the readers */
+		if((nval&LOCK_RW_COUNT) == 0) {
+			if((nval&LOCK_RW_WWAIT))
+				nval &= ~LOCK_RW_WWAIT;
+			else	nval &= ~LOCK_RW_RWAIT;
+		}
+	} while(!__atomic_compare_exchange_n(lock, &val, nval, 1,
+		__ATOMIC_RELEASE, __ATOMIC_RELAXED));
+	if((nval&LOCK_RW_COUNT) != 0)
+		return;
+	if((val&LOCK_RW_WWAIT)) {
+		if(syscall(SYS_futex, lock, FUTEX_WAKE_BITSET_PRIVATE, 1,
+			NULL, NULL, LOCK_RW_WRITER_BITS) > 0)
+			return;
+		/* the writers are gone, wake the readers */
+		if(!(__atomic_fetch_and(lock, ~LOCK_RW_RWAIT,
+			__ATOMIC_RELAXED)&LOCK_RW_RWAIT))
+			return;
+	} else if(!(val&LOCK_RW_RWAIT))
+		return;
+	(void)syscall(SYS_futex, lock, FUTEX_WAKE_BITSET_PRIVATE, INT_MAX,
+		NULL, NULL, LOCK_RW_READER_BITS);
+}
+
+int
+lock_rw_version(lock_rw_t* lock, uint32_t* version)
+{
+	uint32_t val = __atomic_load_n(lock, __ATOMIC_ACQUIRE);
+	if((val&LOCK_RW_COUNT) == LOCK_RW_WRITER)
+		return 0;
+	*version = val&LOCK_RW_GEN;
+	return 1;
+}
+
+int
+lock_rw_version_check(lock_rw_t* lock, uint32_t version)
+{
+	uint32_t val;
+	/* the reads of the data may not move after the load of the lock */
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	val = __atomic_load_n(lock, __ATOMIC_RELAXED);
+	return (val&LOCK_RW_COUNT) != LOCK_RW_WRITER &&
+		(val&LOCK_RW_GEN) == version;
+}
+#endif /* USE_COMPACT_LOCKS and not USE_THREAD_DEBUG */
+
 #ifdef HAVE_SOLARIS_THREADS
 void* ub_thread_key_get(ub_thread_key_t key)
 {
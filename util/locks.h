@@ -47,6 +47,8 @@
  *
  * Types of locks that are supported.
  *   o lock_rw: lock that has many readers and one writer (to a data entry).
+ *     On systems with futexes this is a compact lock of one 32bit word,
+ *     because every cache entry has one.
  *   o lock_basic: simple mutex. Blocking, one person has access only.
  *     This lock is meant for non performance sensitive uses.
  *   o lock_quick: speed lock. For performance sensitive locking of critical
@@ -99,7 +101,66 @@ typedef pthread_mutex_t lock_basic_t;
 #define lock_basic_lock(lock) LOCKRET(pthread_mutex_lock(lock))
 #define lock_basic_unlock(lock) LOCKRET(pthread_mutex_unlock(lock))
 
-#ifndef HAVE_PTHREAD_RWLOCK_T
+#ifdef USE_COMPACT_LOCKS
+/**
+ * Compact rwlock, a single 32bit word that is changed with atomic
+ * operations, and threads that have to wait sleep on a futex.
+ * The lock is taken without a system call if it is not contended.
+ * It is used because there is one in every cache entry, and
+ * pthread_rwlock_t is much larger (56 bytes on glibc).
+ * The low 15 bits are the number of readers, or LOCK_RW_WRITER if
+ * write locked.  The next two bits are set if there are writers or
+ * readers sleeping, the last unlock wakes one writer, or if there is
+ * none, all the readers.  New readers wait while a writer is sleeping,
+ * so that the writer is not starved by a stream of readers.
+ * The top 15 bits count the write unlocks, so that a reader can
+ * check, without locking, that no writer held the lock in the meantime.
+ * The counter wraps after 32768 write unlocks, a reader that is
+ * stalled for that many writes of the same lock between the version
+ * and the check could miss them; the reads done that way are a few
+ * loads long.
+ */
+typedef uint32_t lock_rw_t;
+/** value of the reader count if the lock is write locked */
+#define LOCK_RW_WRITER 0x00007fffU
+/** the bits of the reader count */
+#define LOCK_RW_COUNT 0x00007fffU
+/** flag set in the lock if there are writers sleeping on it */
+#define LOCK_RW_WWAIT 0x00008000U
+/** flag set in the lock if there are readers sleeping on it */
+#define LOCK_RW_RWAIT 0x00010000U
+/** the bits of the write unlock counter, it wraps around */
+#define LOCK_RW_GEN 0xfffe0000U
+/** one write unlock in the counter */
+#define LOCK_RW_GEN_ONE 0x00020000U
+#define lock_rw_init(lock) (*(lock) = 0)
+#define lock_rw_destroy(lock) /* nop */
+/** obtain read lock, blocks until available */
+void lock_rw_rdlock(lock_rw_t* lock);
+/** obtain write lock, blocks until available */
+void lock_rw_wrlock(lock_rw_t* lock);
+/** release read or write lock */
+void lock_rw_unlock(lock_rw_t* lock);
+/** the lock has a version, for reads without the lock */
+#define LOCK_RW_HAVE_VERSION 1
+/**
+ * Get the version of the lock, to read the data it protects without
+ * taking the lock.  The data read must be checked with
+ * lock_rw_version_check afterwards, and pointers in it can point to
+ * memory that is being freed.
+ * @param lock: the lock.
+ * @param version: returns the version.
+ * @return false if the lock is write locked.
+ */
+int lock_rw_version(lock_rw_t* lock, uint32_t* version);
+/**
+ * Check that no writer has held the lock since lock_rw_version.
+ * @param lock: the lock.
+ * @param version: from lock_rw_version.
+ * @return true if the data that was read is consistent.
+ */
+int lock_rw_version_check(lock_rw_t* lock, uint32_t version);
+#elif !defined(HAVE_PTHREAD_RWLOCK_T)
 /** in case rwlocks are not supported, use a mutex. */
 typedef pthread_mutex_t lock_rw_t;
 #define lock_rw_init(lock) LOCKRET(pthread_mutex_init(lock, NULL))
@@ -107,7 +168,7 @@ typedef pthread_mutex_t lock_rw_t;
 #define lock_rw_rdlock(lock) LOCKRET(pthread_mutex_lock(lock))
 #define lock_rw_wrlock(lock) LOCKRET(pthread_mutex_lock(lock))
 #define lock_rw_unlock(lock) LOCKRET(pthread_mutex_unlock(lock))
-#else /* HAVE_PTHREAD_RWLOCK_T */
+#else /* USE_COMPACT_LOCKS or HAVE_PTHREAD_RWLOCK_T */
 /** we use the pthread rwlock */
 typedef pthread_rwlock_t lock_rw_t;
 /** small front for pthread init func, NULL is default attrs. */
@@ -116,9 +177,18 @@ typedef pthread_rwlock_t lock_rw_t;
 #define lock_rw_rdlock(lock) LOCKRET(pthread_rwlock_rdlock(lock))
 #define lock_rw_wrlock(lock) LOCKRET(pthread_rwlock_wrlock(lock))
 #define lock_rw_unlock(lock) LOCKRET(pthread_rwlock_unlock(lock))
-#endif /* HAVE_PTHREAD_RWLOCK_T */
-
-#ifndef HAVE_PTHREAD_SPINLOCK_T
+#endif /* USE_COMPACT_LOCKS or HAVE_PTHREAD_RWLOCK_T */
+
+#if !defined(HAVE_PTHREAD_SPINLOCK_T) && defined(USE_COMPACT_LOCKS)
+/** in case spinlocks are not supported, use the compact rwlock, that
+ * is smaller than a mutex, in the hash bins. */
+typedef lock_rw_t lock_quick_t;
+#define lock_quick_init(lock) lock_rw_init(lock)
+#define lock_quick_destroy(lock) lock_rw_destroy(lock)
+#define lock_quick_lock(lock) lock_rw_wrlock(lock)
+#define lock_quick_unlock(lock) lock_rw_unlock(lock)
+
+#elif !defined(HAVE_PTHREAD_SPINLOCK_T)
 /** in case spinlocks are not supported, use a mutex. */
 typedef pthread_mutex_t lock_quick_t;
 /** small front for pthread init func, NULL is default attrs. */
@@ -279,6 +349,19 @@ typedef void* ub_thread_key_t;
 #endif /* HAVE_PTHREAD */
 #endif /* USE_THREAD_DEBUG */
 
+/**
+ * Load and store of a word that one thread changes while other threads
+ * read it without a lock, like a setting the remote control changes.
+ * Without the atomic builtins, a plain load or store of the word.
+ */
+#ifdef __ATOMIC_RELAXED
+#define lock_atomic_load(p) __atomic_load_n(p, __ATOMIC_RELAXED)
+#define lock_atomic_store(p, v) __atomic_store_n(p, v, __ATOMIC_RELAXED)
+#else
+#define lock_atomic_load(p) (*(p))
+#define lock_atomic_store(p, v) (*(p) = (v))
+#endif
+
 /**
  * Block all signals for this thread.
  * fatal exit on error.
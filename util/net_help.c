@@ -39,6 +39,7 @@
 
 #include "config.h"
 #include "util/net_help.h"
+#include "util/config_file.h"
 #include "util/log.h"
 #include "util/data/dname.h"
 #include "util/module.h"
@@ -52,6 +53,14 @@
 #ifdef HAVE_OPENSSL_ERR_H
 #include <openssl/err.h>
 #endif
+#ifdef HAVE_SSL
+#include <openssl/rand.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#endif
+#ifdef HAVE_SSL_CTX_SET_TLSEXT_TICKET_KEY_EVP_CB
+#include <openssl/core_names.h>
+#endif
 
 /** max length of an IP address (the address portion) that we allow */
 #define MAX_ADDR_STRLEN 128 /* characters */
@@ -64,6 +73,23 @@ int MINIMAL_RESPONSES = 0;
 /** rrset order roundrobin: default is no */
 int RRSET_ROUNDROBIN = 0;
 
+/** session ticket key, as read from the ticket key file */
+struct tls_session_ticket_key {
+	/** the key name, sent in the ticket to find the key */
+	unsigned char key_name[16];
+	/** HMAC-SHA256 secret */
+	unsigned char hmac_key[32];
+	/** AES-256 key */
+	unsigned char aes_key[32];
+};
+
+/** session ticket keys, shared by the threads. The first one is used
+ * to create new tickets, the others only to resume sessions.
+ * NULL if not configured. */
+static struct tls_session_ticket_key* ticket_keys = NULL;
+/** number of session ticket keys */
+static size_t ticket_keys_num = 0;
+
 /* returns true is string addr is an ip6 specced address */
 int
 str_is_ip6(const char* str)
@@ -617,6 +643,15 @@ void* listen_sslctx_create(char* key, char* pem, char* verifypem)
 		SSL_CTX_free(ctx);
 		return NULL;
 	}
+	/* server side session cache, shared by the threads, so that
+	 * clients can resume with the session id */
+	(void)SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER);
+	if(!SSL_CTX_set_session_id_context(ctx,
+		(const unsigned char*)"unbound", 7)) {
+		log_crypto_err("Error in SSL_CTX set_session_id_context");
+		SSL_CTX_free(ctx);
+		return NULL;
+	}
 
 	if(verifypem && verifypem[0]) {
 		if(!SSL_CTX_load_verify_locations(ctx, verifypem, NULL)) {
@@ -683,6 +718,191 @@ void* connect_sslctx_create(char* key, char* pem, char* verifypem)
 #endif
 }
 
+#if defined(HAVE_SSL) && (defined(HAVE_SSL_CTX_SET_TLSEXT_TICKET_KEY_EVP_CB) \
+	|| defined(SSL_CTX_set_tlsext_ticket_key_cb))
+/** the ticket key callback is available in the SSL library */
+#define USE_TICKET_KEY_CB 1
+#ifdef HAVE_SSL_CTX_SET_TLSEXT_TICKET_KEY_EVP_CB
+/** the mac context of the ticket callback */
+typedef EVP_MAC_CTX ticket_mac_ctx_t;
+#else
+/** the mac context of the ticket callback */
+typedef HMAC_CTX ticket_mac_ctx_t;
+#endif
+
+/** set up the HMAC-SHA256 of the ticket with the key, false on failure */
+static int
+tls_session_ticket_mac_init(ticket_mac_ctx_t* mac_ctx, unsigned char* key)
+{
+#ifdef HAVE_SSL_CTX_SET_TLSEXT_TICKET_KEY_EVP_CB
+	OSSL_PARAM params[3];
+	params[0] = OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY,
+		key, 32);
+	params[1] = OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST,
+		"sha256", 0);
+	params[2] = OSSL_PARAM_construct_end();
+	if(EVP_MAC_CTX_set_params(mac_ctx, params) != 1) {
+		verbose(VERB_CLIENT, "EVP_MAC_CTX_set_params failed");
+		return 0;
+	}
+#else
+	if(HMAC_Init_ex(mac_ctx, key, 32, EVP_sha256(), NULL) != 1) {
+		verbose(VERB_CLIENT, "HMAC_Init_ex failed");
+		return 0;
+	}
+#endif
+	return 1;
+}
+
+/** callback from openssl to set up the encryption of session tickets */
+static int
+tls_session_ticket_key_cb(SSL* ATTR_UNUSED(ssl), unsigned char* key_name,
+	unsigned char* iv, EVP_CIPHER_CTX* evp_ctx, ticket_mac_ctx_t* mac_ctx,
+	int enc)
+{
+	size_t i;
+	if(ticket_keys_num == 0) {
+		/* the keys are gone after a reload, no tickets */
+		return 0;
+	}
+	if(enc == 1) {
+		/* new ticket, encrypt with the first key */
+		if(RAND_bytes(iv, EVP_MAX_IV_LENGTH) != 1) {
+			verbose(VERB_CLIENT, "RAND_bytes failed for ticket");
+			return -1;
+		}
+		memcpy(key_name, ticket_keys[0].key_name, 16);
+		if(EVP_EncryptInit_ex(evp_ctx, EVP_aes_256_cbc(), NULL,
+			ticket_keys[0].aes_key, iv) != 1) {
+			verbose(VERB_CLIENT, "EVP_EncryptInit_ex failed");
+			return -1;
+		}
+		if(!tls_session_ticket_mac_init(mac_ctx,
+			ticket_keys[0].hmac_key))
+			return -1;
+		return 1;
+	} else if(enc == 0) {
+		/* ticket from the client, find the key it was made with */
+		for(i=0; i<ticket_keys_num; i++) {
+			if(memcmp(key_name, ticket_keys[i].key_name, 16) == 0)
+				break;
+		}
+		if(i == ticket_keys_num) {
+			verbose(VERB_CLIENT, "ticket with unknown key, "
+				"full handshake");
+			return 0;
+		}
+		if(!tls_session_ticket_mac_init(mac_ctx,
+			ticket_keys[i].hmac_key))
+			return -1;
+		if(EVP_DecryptInit_ex(evp_ctx, EVP_aes_256_cbc(), NULL,
+			ticket_keys[i].aes_key, iv) != 1) {
+			verbose(VERB_CLIENT, "EVP_DecryptInit_ex failed");
+			return -1;
+		}
+		/* an older key: resume, but renew the ticket */
+		return (i == 0)?1:2;
+	}
+	return -1;
+}
+
+/** read a session ticket key file, false on failure */
+static int
+tls_session_ticket_key_read(const char* fname,
+	struct tls_session_ticket_key* k)
+{
+	unsigned char data[80];
+	FILE* f = fopen(fname, "rb");
+	size_t r;
+	if(!f) {
+		log_err("could not read ssl-session-ticket-keys %s: %s",
+			fname, strerror(errno));
+		return 0;
+	}
+	r = fread(data, 1, sizeof(data), f);
+	fclose(f);
+	if(r != sizeof(data)) {
+		log_err("ssl-session-ticket-keys %s: need %d bytes "
+			"of random data", fname, (int)sizeof(data));
+		memset(data, 0, sizeof(data));
+		return 0;
+	}
+	memcpy(k->key_name, data, 16);
+	memcpy(k->hmac_key, data+16, 32);
+	memcpy(k->aes_key, data+48, 32);
+	memset(data, 0, sizeof(data));
+	return 1;
+}
+#endif /* HAVE_SSL and ticket key callback */
+
+int listen_sslctx_setup_ticket_keys(void* sslctx,
+	struct config_strlist* keyfiles)
+{
+#ifdef USE_TICKET_KEY_CB
+	struct tls_session_ticket_key* keys;
+	struct config_strlist* p;
+	size_t n = 0;
+	for(p = keyfiles; p; p = p->next)
+		n++;
+	if(n == 0) {
+		/* if keys were removed on reload, stop making tickets */
+		listen_sslctx_delete_ticket_keys();
+		return 1;
+	}
+	keys = (struct tls_session_ticket_key*)calloc(n,
+		sizeof(struct tls_session_ticket_key));
+	if(!keys) {
+		log_err("out of memory");
+		return 0;
+	}
+	n = 0;
+	for(p = keyfiles; p; p = p->next) {
+		if(!tls_session_ticket_key_read(p->str, &keys[n])) {
+			/* the keys in use, if any, are kept */
+			memset(keys, 0, sizeof(*keys)*n);
+			free(keys);
+			return 0;
+		}
+		n++;
+	}
+#ifdef HAVE_SSL_CTX_SET_TLSEXT_TICKET_KEY_EVP_CB
+	if(SSL_CTX_set_tlsext_ticket_key_evp_cb((SSL_CTX*)sslctx,
+		tls_session_ticket_key_cb) != 1) {
+#else
+	if(SSL_CTX_set_tlsext_ticket_key_cb((SSL_CTX*)sslctx,
+		tls_session_ticket_key_cb) != 1) {
+#endif
+		log_crypto_err("could not set the ticket key callback");
+		memset(keys, 0, sizeof(*keys)*n);
+		free(keys);
+		return 0;
+	}
+	listen_sslctx_delete_ticket_keys();
+	ticket_keys = keys;
+	ticket_keys_num = n;
+	verbose(VERB_OPS, "read %d ssl session ticket keys",
+		(int)ticket_keys_num);
+	return 1;
+#else
+	(void)sslctx;
+	if(keyfiles)
+		log_warn("ssl-session-ticket-keys not supported by the "
+			"SSL library, ignored");
+	return 1;
+#endif
+}
+
+void listen_sslctx_delete_ticket_keys(void)
+{
+	if(!ticket_keys)
+		return;
+	/* do not leave the keys in memory */
+	memset(ticket_keys, 0, sizeof(*ticket_keys)*ticket_keys_num);
+	free(ticket_keys);
+	ticket_keys = NULL;
+	ticket_keys_num = 0;
+}
+
 void* incoming_ssl_fd(void* sslctx, int fd)
 {
 #ifdef HAVE_SSL
@@ -43,6 +43,7 @@
 #define NET_HELP_H
 #include "util/log.h"
 struct sock_list;
+struct config_strlist;
 struct regional;
 
 /** DNS constants for uint16_t style flag manipulation. host byteorder. 
@@ -344,6 +345,22 @@ void log_crypto_err(const char* str);
  */
 void* listen_sslctx_create(char* key, char* pem, char* verifypem);
 
+/**
+ * Read the session ticket keys and set them up for the SSL listen context.
+ * The keys are shared by all threads that use the context.  The first key
+ * encrypts new tickets, the others decrypt tickets made earlier, so keys
+ * can be rotated.
+ * @param sslctx: the SSL_CTX from listen_sslctx_create().
+ * @param keyfiles: list of key files, with 80 bytes of random data each.
+ *	If NULL, the default ticket handling of the SSL library is used.
+ * @return false on failure (logged).
+ */
+int listen_sslctx_setup_ticket_keys(void* sslctx,
+	struct config_strlist* keyfiles);
+
+/** delete the session ticket keys, from memory */
+void listen_sslctx_delete_ticket_keys(void);
+
 /**
  * create SSL connect context
  * @param key: if nonNULL (also pem nonNULL), the client private key.
@@ -130,6 +130,10 @@ struct internal_base {
 	struct event slow_accept;
 	/** true if slow_accept is enabled */
 	int slow_accept_enabled;
+	/** SSL handshake counters for the ssl service */
+	struct comm_ssl_stats ssl_service;
+	/** SSL handshake counters for ssl upstream connections */
+	struct comm_ssl_stats ssl_upstream;
 };
 
 /**
@@ -156,9 +160,13 @@ struct internal_signal {
 
 /** create a tcp handler with a parent */
 static struct comm_point* comm_point_create_tcp_handler(
-	struct comm_base *base, struct comm_point* parent, size_t bufsize,
+	struct comm_base *base, struct comm_point* parent,
+	struct comm_buffer_pool* pool,
         comm_point_callback_t* callback, void* callback_arg);
 
+/** make tcp handler free for next assignment */
+static void reclaim_tcp_handler(struct comm_point* c);
+
 /* -------- End of local definitions -------- */
 
 #ifdef USE_MINI_EVENT
@@ -328,6 +336,17 @@ struct event_base* comm_base_internal(struct comm_base* b)
 	return b->eb->base;
 }
 
+void comm_base_ssl_stats(struct comm_base* b, struct comm_ssl_stats* service,
+	struct comm_ssl_stats* upstream, int reset)
+{
+	*service = b->eb->ssl_service;
+	*upstream = b->eb->ssl_upstream;
+	if(reset) {
+		memset(&b->eb->ssl_service, 0, sizeof(b->eb->ssl_service));
+		memset(&b->eb->ssl_upstream, 0, sizeof(b->eb->ssl_upstream));
+	}
+}
+
 /** see if errno for udp has to be logged or not uses globals */
 static int
 udp_send_errno_needs_log(struct sockaddr* addr, socklen_t addrlen)
@@ -707,16 +726,178 @@ comm_point_udp_callback(int fd, short event, void* arg)
 	}
 }
 
+/**
+ * The idle timeout for tcp connections of the accept commpoint, in msec.
+ * When more than half of the handlers are in use, the timeout is
+ * reduced, down to a minimum when all handlers are in use.
+ */
+static int
+tcp_idle_timeout(struct comm_point* c)
+{
+	int half = c->max_tcp_count/2;
+	int to = c->tcp_idle_timeout;
+	if(half > 0 && c->cur_tcp_count > half) {
+		int left = c->max_tcp_count - c->cur_tcp_count;
+		if(left < 0)
+			left = 0;
+		to = (int)(((long long)to * left) / half);
+	}
+	if(to < NETEVENT_TCP_IDLE_TIMEOUT_MIN)
+		to = NETEVENT_TCP_IDLE_TIMEOUT_MIN;
+	return to;
+}
+
+/** put the tcp handler on the front of the idle list of its parent,
+ * and set its timeout to the idle timeout */
+static void
+tcp_idle_insert(struct comm_point* c)
+{
+	struct comm_point* p = c->tcp_parent;
+	int to;
+	log_assert(!c->tcp_is_idle);
+	c->tcp_is_idle = 1;
+	c->tcp_idle_prev = NULL;
+	c->tcp_idle_next = p->tcp_idle_first;
+	if(p->tcp_idle_first)
+		p->tcp_idle_first->tcp_idle_prev = c;
+	else	p->tcp_idle_last = c;
+	p->tcp_idle_first = c;
+	to = tcp_idle_timeout(p);
+	c->tcp_idle_start = c->ev->base->eb->now;
+	c->tcp_idle_msec = to;
+	c->timeout->tv_sec = to/1000;
+	c->timeout->tv_usec = (to%1000)*1000;
+}
+
+/**
+ * The idle timeout has become shorter, after a new connection.  The idle
+ * handlers that wait with a longer timeout get the new one, counted from
+ * the time they became idle, so that they are closed as soon as the
+ * handlers that became idle now.
+ */
+static void
+tcp_idle_shrink(struct comm_point* p)
+{
+	int to = tcp_idle_timeout(p);
+	struct timeval* now = &p->ev->base->eb->now;
+	struct comm_point* c;
+	for(c = p->tcp_idle_first; c; c = c->tcp_idle_next) {
+		long long left;
+		if(c->tcp_idle_msec <= to)
+			continue;
+		left = (long long)to - ((long long)(now->tv_sec -
+			c->tcp_idle_start.tv_sec)*1000 + (long long)(
+			now->tv_usec - c->tcp_idle_start.tv_usec)/1000);
+		if(left < 0)
+			left = 0;
+		c->tcp_idle_msec = to;
+		comm_point_stop_listening(c);
+		c->timeout->tv_sec = (int)(left/1000);
+		c->timeout->tv_usec = (int)(left%1000)*1000;
+		comm_point_start_listening(c, -1, -1);
+	}
+}
+
+/** remove the tcp handler from the idle list of its parent */
+static void
+tcp_idle_remove(struct comm_point* c)
+{
+	struct comm_point* p = c->tcp_parent;
+	if(!c->tcp_is_idle)
+		return;
+	if(c->tcp_idle_prev)
+		c->tcp_idle_prev->tcp_idle_next = c->tcp_idle_next;
+	else	p->tcp_idle_first = c->tcp_idle_next;
+	if(c->tcp_idle_next)
+		c->tcp_idle_next->tcp_idle_prev = c->tcp_idle_prev;
+	else	p->tcp_idle_last = c->tcp_idle_prev;
+	c->tcp_idle_prev = NULL;
+	c->tcp_idle_next = NULL;
+	c->tcp_is_idle = 0;
+}
+
+/** take a buffer from the pool for the tcp handler, false on failure */
+static int
+tcp_buffer_obtain(struct comm_point* c)
+{
+	struct comm_buffer_pool* pool = c->tcp_pool;
+	if(c->buffer)
+		return 1;
+	if(pool->num_free > 0)
+		c->buffer = pool->free_list[--pool->num_free];
+	else if(!(c->buffer = sldns_buffer_new(pool->bufsize))) {
+		log_err("tcp: out of memory for query buffer");
+		return 0;
+	}
+	pool->num_inuse++;
+	sldns_buffer_clear(c->buffer);
+	return 1;
+}
+
+/** return the buffer of the tcp handler to the pool */
+static void
+tcp_buffer_release(struct comm_point* c)
+{
+	struct comm_buffer_pool* pool = c->tcp_pool;
+	if(!c->buffer)
+		return;
+	if(pool->num_free < pool->max_free)
+		pool->free_list[pool->num_free++] = c->buffer;
+	else	sldns_buffer_free(c->buffer);
+	c->buffer = NULL;
+	pool->num_inuse--;
+}
+
+/**
+ * The tcp handler starts to read a query. If it was idle, it leaves the
+ * idle list, gets a buffer from the pool and the query timeout.
+ * @param c: the tcp handler.
+ * @return false on alloc failure, the connection should be closed.
+ */
+static int
+tcp_handler_start_query(struct comm_point* c)
+{
+	if(!c->tcp_is_idle)
+		return 1;
+	tcp_idle_remove(c);
+	if(!tcp_buffer_obtain(c))
+		return 0;
+	comm_point_start_listening(c, -1, TCP_QUERY_TIMEOUT);
+	return 1;
+}
+
+/**
+ * Close the least recently active idle connection of the accept
+ * commpoint, to make its handler free for a new connection.
+ * @param c: the tcp accept commpoint.
+ * @return false if there is no idle connection.
+ */
+static int
+tcp_close_idle(struct comm_point* c)
+{
+	if(c->type != comm_tcp_accept || !c->tcp_idle_last)
+		return 0;
+	verbose(VERB_ALGO, "tcp: close least recently active idle "
+		"connection");
+	reclaim_tcp_handler(c->tcp_idle_last);
+	return 1;
+}
+
 /** Use a new tcp handler for new query fd, set to read query */
 static void
 setup_tcp_handler(struct comm_point* c, int fd) 
 {
 	log_assert(c->type == comm_tcp);
 	log_assert(c->fd == -1);
-	sldns_buffer_clear(c->buffer);
+	log_assert(c->buffer == NULL);
 	c->tcp_is_reading = 1;
 	c->tcp_byte_count = 0;
-	comm_point_start_listening(c, fd, TCP_QUERY_TIMEOUT);
+	/* no buffer until the query starts to arrive */
+	c->tcp_parent->cur_tcp_count++;
+	if(c->tcp_parent->cur_tcp_count > c->tcp_parent->max_tcp_count/2)
+		tcp_idle_shrink(c->tcp_parent);
+	tcp_idle_insert(c);
+	comm_point_start_listening(c, fd, -1);
 }
 
 void comm_base_handle_slow_accept(int ATTR_UNUSED(fd),
@@ -755,8 +936,12 @@ int comm_point_perform_accept(struct comm_point* c,
 			return -1;
 #if defined(ENFILE) && defined(EMFILE)
 		if(errno == ENFILE || errno == EMFILE) {
-			/* out of file descriptors, likely outside of our
-			 * control. stop accept() calls for some time */
+			/* out of file descriptors, close an idle connection
+			 * to get one; the next accept event takes it */
+			if(tcp_close_idle(c))
+				return -1;
+			/* likely outside of our control.
+			 * stop accept() calls for some time */
 			if(c->ev->base->stop_accept) {
 				struct comm_base* b = c->ev->base;
 				struct timeval tv;
@@ -852,8 +1037,8 @@ comm_point_tcp_accept_callback(int fd, short event, void* arg)
 		return;
 	}
 	comm_base_now(c->ev->base);
-	/* find free tcp handler. */
-	if(!c->tcp_free) {
+	/* find free tcp handler, or close an idle connection for it. */
+	if(!c->tcp_free && !tcp_close_idle(c)) {
 		log_warn("accepted too many tcp, connections full");
 		return;
 	}
@@ -879,8 +1064,9 @@ comm_point_tcp_accept_callback(int fd, short event, void* arg)
 
 	/* grab the tcp handler buffers */
 	c->tcp_free = c_hdl->tcp_free;
-	if(!c->tcp_free) {
-		/* stop accepting incoming queries for now. */
+	if(!c->tcp_free && !c->tcp_idle_last) {
+		/* stop accepting incoming queries for now, until a
+		 * handler is free or idle. */
 		comm_point_stop_listening(c);
 	}
 	/* addr is dropped. Not needed for tcp reply. */
@@ -901,6 +1087,9 @@ reclaim_tcp_handler(struct comm_point* c)
 	}
 	comm_point_close(c);
 	if(c->tcp_parent) {
+		tcp_idle_remove(c);
+		tcp_buffer_release(c);
+		c->tcp_parent->cur_tcp_count--;
 		c->tcp_free = c->tcp_parent->tcp_free;
 		c->tcp_parent->tcp_free = c;
 		if(!c->tcp_free) {
@@ -921,6 +1110,17 @@ tcp_callback_writer(struct comm_point* c)
 	c->tcp_byte_count = 0;
 	/* switch from listening(write) to listening(read) */
 	comm_point_stop_listening(c);
+	if(c->tcp_pool) {
+		/* wait for the next query without a buffer */
+		struct comm_point* p = c->tcp_parent;
+		int stopped = (!p->tcp_free && !p->tcp_idle_last);
+		tcp_buffer_release(c);
+		tcp_idle_insert(c);
+		if(stopped)
+			/* the accept commpoint can close this connection
+			 * for a new one, so it listens again */
+			comm_point_start_listening(p, -1, -1);
+	}
 	comm_point_start_listening(c, -1, -1);
 }
 
@@ -941,8 +1141,25 @@ tcp_callback_reader(struct comm_point* c)
 	}
 }
 
-/** continue ssl handshake */
 #ifdef HAVE_SSL
+/** count the end of an ssl handshake, failed or done, in the counters of
+ * the service (handlers of an accept commpoint) or upstream */
+static void
+ssl_handshake_count(struct comm_point* c, int done)
+{
+	struct internal_base* eb = c->ev->base->eb;
+	struct comm_ssl_stats* st = c->tcp_parent?&eb->ssl_service:
+		&eb->ssl_upstream;
+	if(!done) {
+		st->failed++;
+		return;
+	}
+	st->handshake++;
+	if(SSL_session_reused(c->ssl))
+		st->resumed++;
+}
+
+/** continue ssl handshake */
 static int
 ssl_handshake(struct comm_point* c)
 {
@@ -977,23 +1194,27 @@ ssl_handshake(struct comm_point* c)
 			comm_point_listen_for_rw(c, 0, 1);
 			return 1;
 		} else if(r == 0) {
+			ssl_handshake_count(c, 0);
 			return 0; /* closed */
 		} else if(want == SSL_ERROR_SYSCALL) {
 			/* SYSCALL and errno==0 means closed uncleanly */
 			if(errno != 0)
 				log_err("SSL_handshake syscall: %s",
 					strerror(errno));
+			ssl_handshake_count(c, 0);
 			return 0;
 		} else {
 			log_crypto_err("ssl handshake failed");
 			log_addr(1, "ssl handshake failed", &c->repinfo.addr,
 				c->repinfo.addrlen);
+			ssl_handshake_count(c, 0);
 			return 0;
 		}
 	}
 	/* this is where peer verification could take place */
 	log_addr(VERB_ALGO, "SSL DNS connection", &c->repinfo.addr,
 		c->repinfo.addrlen);
+	ssl_handshake_count(c, 1);
 
 	/* setup listen rw correctly */
 	if(c->tcp_is_reading) {
@@ -1019,6 +1240,8 @@ ssl_handle_read(struct comm_point* c)
 		if(c->ssl_shake_state != comm_ssl_shake_none)
 			return 1;
 	}
+	if(!tcp_handler_start_query(c))
+		return 0;
 	if(c->tcp_byte_count < sizeof(uint16_t)) {
 		/* read length bytes */
 		ERR_clear_error();
@@ -1202,6 +1425,8 @@ comm_point_tcp_handle_read(int fd, struct comm_point* c, int short_ok)
 		return ssl_handle_it(c);
 	if(!c->tcp_is_reading)
 		return 0;
+	if(!tcp_handler_start_query(c))
+		return 0;
 
 	log_assert(fd != -1);
 	if(c->tcp_byte_count < sizeof(uint16_t)) {
@@ -1601,7 +1826,7 @@ comm_point_create_udp_ancil(struct comm_base *base, int fd,
 
 static struct comm_point* 
 comm_point_create_tcp_handler(struct comm_base *base, 
-	struct comm_point* parent, size_t bufsize,
+	struct comm_point* parent, struct comm_buffer_pool* pool,
         comm_point_callback_t* callback, void* callback_arg)
 {
 	struct comm_point* c = (struct comm_point*)calloc(1,
@@ -1617,15 +1842,11 @@ comm_point_create_tcp_handler(struct comm_base *base,
 	}
 	c->ev->base = base;
 	c->fd = -1;
-	c->buffer = sldns_buffer_new(bufsize);
-	if(!c->buffer) {
-		free(c->ev);
-		free(c);
-		return NULL;
-	}
+	/* the buffer is taken from the pool when a query arrives */
+	c->buffer = NULL;
+	c->tcp_pool = pool;
 	c->timeout = (struct timeval*)malloc(sizeof(struct timeval));
 	if(!c->timeout) {
-		sldns_buffer_free(c->buffer);
 		free(c->ev);
 		free(c);
 		return NULL;
@@ -1662,7 +1883,8 @@ comm_point_create_tcp_handler(struct comm_base *base,
 }
 
 struct comm_point* 
-comm_point_create_tcp(struct comm_base *base, int fd, int num, size_t bufsize,
+comm_point_create_tcp(struct comm_base *base, int fd, int num,
+	int idle_timeout, struct comm_buffer_pool* pool,
         comm_point_callback_t* callback, void* callback_arg)
 {
 	struct comm_point* c = (struct comm_point*)calloc(1,
@@ -1694,6 +1916,10 @@ comm_point_create_tcp(struct comm_base *base, int fd, int num, size_t bufsize,
 		return NULL;
 	}
 	c->tcp_free = NULL;
+	c->cur_tcp_count = 0;
+	c->tcp_idle_timeout = idle_timeout;
+	c->tcp_idle_first = NULL;
+	c->tcp_idle_last = NULL;
 	c->type = comm_tcp_accept;
 	c->tcp_do_close = 0;
 	c->do_not_close = 0;
@@ -1715,7 +1941,7 @@ comm_point_create_tcp(struct comm_base *base, int fd, int num, size_t bufsize,
 	/* now prealloc the tcp handlers */
 	for(i=0; i<num; i++) {
 		c->tcp_handlers[i] = comm_point_create_tcp_handler(base,
-			c, bufsize, callback, callback_arg);
+			c, pool, callback, callback_arg);
 		if(!c->tcp_handlers[i]) {
 			comm_point_delete(c);
 			return NULL;
@@ -1967,8 +2193,9 @@ comm_point_start_listening(struct comm_point* c, int newfd, int sec)
 {
 	verbose(VERB_ALGO, "comm point start listening %d", 
 		c->fd==-1?newfd:c->fd);
-	if(c->type == comm_tcp_accept && !c->tcp_free) {
-		/* no use to start listening no free slots. */
+	if(c->type == comm_tcp_accept && !c->tcp_free && !c->tcp_idle_last) {
+		/* no use to start listening no free slots, and no idle
+		 * connections to close for a new one. */
 		return;
 	}
 	if(sec != -1 && sec != 0) {
@@ -2030,7 +2257,7 @@ size_t comm_point_get_mem(struct comm_point* c)
 	s = sizeof(*c) + sizeof(*c->ev);
 	if(c->timeout) 
 		s += sizeof(*c->timeout);
-	if(c->type == comm_tcp || c->type == comm_local)
+	if((c->type == comm_tcp || c->type == comm_local) && c->buffer)
 		s += sizeof(*c->buffer) + sldns_buffer_capacity(c->buffer);
 	if(c->type == comm_tcp_accept) {
 		int i;
@@ -2040,6 +2267,59 @@ size_t comm_point_get_mem(struct comm_point* c)
 	return s;
 }
 
+int
+comm_point_tcp_idle_timeout(struct comm_point* c)
+{
+	if(c->type != comm_tcp || !c->tcp_parent)
+		return 0;
+	return tcp_idle_timeout(c->tcp_parent);
+}
+
+struct comm_buffer_pool*
+comm_buffer_pool_create(size_t bufsize, size_t max_free)
+{
+	struct comm_buffer_pool* pool = (struct comm_buffer_pool*)calloc(1,
+		sizeof(struct comm_buffer_pool));
+	if(!pool)
+		return NULL;
+	pool->bufsize = bufsize;
+	pool->max_free = max_free;
+	if(max_free > 0) {
+		pool->free_list = (struct sldns_buffer**)calloc(max_free,
+			sizeof(struct sldns_buffer*));
+		if(!pool->free_list) {
+			free(pool);
+			return NULL;
+		}
+	}
+	return pool;
+}
+
+void
+comm_buffer_pool_delete(struct comm_buffer_pool* pool)
+{
+	size_t i;
+	if(!pool)
+		return;
+	for(i=0; i<pool->num_free; i++)
+		sldns_buffer_free(pool->free_list[i]);
+	free(pool->free_list);
+	free(pool);
+}
+
+size_t
+comm_buffer_pool_get_mem(struct comm_buffer_pool* pool)
+{
+	size_t i, s;
+	if(!pool)
+		return 0;
+	s = sizeof(*pool) + sizeof(struct sldns_buffer*)*pool->max_free;
+	for(i=0; i<pool->num_free; i++)
+		s += sizeof(struct sldns_buffer) +
+			sldns_buffer_capacity(pool->free_list[i]);
+	return s;
+}
+
 struct comm_timer* 
 comm_timer_create(struct comm_base* base, void (*cb)(void*), void* cb_arg)
 {
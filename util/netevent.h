@@ -85,6 +85,23 @@ typedef int comm_point_callback_t(struct comm_point*, void*, int,
 
 /** timeout to slow accept calls when not possible, in msec. */
 #define NETEVENT_SLOW_ACCEPT_TIME 2000
+/** minimum timeout for idle tcp connections, in msec, when the idle
+ * timeout is reduced because many connections are in use. */
+#define NETEVENT_TCP_IDLE_TIMEOUT_MIN 200
+/** max number of free buffers kept in the tcp buffer pool */
+#define NETEVENT_TCP_POOL_MAX_FREE 16
+
+/**
+ * Counters for the SSL handshakes of a thread.
+ */
+struct comm_ssl_stats {
+	/** number of completed handshakes, including resumed sessions */
+	size_t handshake;
+	/** number of handshakes that resumed an earlier session */
+	size_t resumed;
+	/** number of handshakes that failed or were closed */
+	size_t failed;
+};
 
 /**
  * A communication point dispatcher. Thread specific.
@@ -102,6 +119,25 @@ struct comm_base {
 	void* cb_arg;
 };
 
+/**
+ * Pool of buffers for the TCP handlers of a thread, shared by the
+ * tcp-accept commpoints of that thread.  A handler holds a buffer only
+ * while it reads a query or writes an answer; idle connections that
+ * wait for the next query hold no buffer.
+ */
+struct comm_buffer_pool {
+	/** size of the buffers in the pool */
+	size_t bufsize;
+	/** number of buffers handed out to tcp handlers */
+	size_t num_inuse;
+	/** free buffers, kept for reuse. array of max_free. */
+	struct sldns_buffer** free_list;
+	/** number of buffers in the free list */
+	size_t num_free;
+	/** max number of free buffers, more are deleted */
+	size_t max_free;
+};
+
 /**
  * Reply information for a communication point.
  */
@@ -160,6 +196,23 @@ struct comm_point {
 	struct comm_point* tcp_parent;
 	/** sockaddr from peer, for TCP handlers */
 	struct comm_reply repinfo;
+	/** buffer pool the buffer is taken from when a query starts to
+	 * arrive, and returned to when the answer has been written.
+	 * NULL if the commpoint has its own buffer. */
+	struct comm_buffer_pool* tcp_pool;
+	/** if the handler is idle: the connection is open and waits for
+	 * the next query, and holds no buffer */
+	int tcp_is_idle;
+	/** previous in the idle list of the parent, towards more recently
+	 * idle handlers */
+	struct comm_point* tcp_idle_prev;
+	/** next in the idle list of the parent, towards the least recently
+	 * active handler */
+	struct comm_point* tcp_idle_next;
+	/** the time the handler became idle */
+	struct timeval tcp_idle_start;
+	/** the idle timeout of the handler, in msec from tcp_idle_start */
+	int tcp_idle_msec;
 
 	/* -------- TCP Accept -------- */
 	/** the number of TCP handlers for this tcp-accept socket */
@@ -170,6 +223,17 @@ struct comm_point {
 	/** linked list of free tcp_handlers to use for new queries.
 	    For tcp_accept the first entry, for tcp_handlers the next one. */
 	struct comm_point* tcp_free;
+	/** the number of TCP handlers that have a connection */
+	int cur_tcp_count;
+	/** idle timeout, in msec, for tcp handler connections that wait
+	 * for the next query.  Reduced when more than half of the handlers
+	 * are in use. */
+	int tcp_idle_timeout;
+	/** list of idle tcp handlers, the first is most recently active */
+	struct comm_point* tcp_idle_first;
+	/** the last in the idle list, least recently active, closed first
+	 * when a new connection needs a handler */
+	struct comm_point* tcp_idle_last;
 
 	/* -------- SSL TCP DNS ------- */
 	/** the SSL object with rw bio (owned) or for commaccept ctx ref */
@@ -348,6 +412,16 @@ void comm_base_exit(struct comm_base* b);
 void comm_base_set_slow_accept_handlers(struct comm_base* b,
 	void (*stop_accept)(void*), void (*start_accept)(void*), void* arg);
 
+/**
+ * Get the SSL handshake counters of the comm base.
+ * @param b: comm base
+ * @param service: the counters for the ssl service are returned.
+ * @param upstream: the counters for ssl upstream connections are returned.
+ * @param reset: if true, the counters are set to zero.
+ */
+void comm_base_ssl_stats(struct comm_base* b, struct comm_ssl_stats* service,
+	struct comm_ssl_stats* upstream, int reset);
+
 /**
  * Access internal data structure (for util/tube.c on windows)
  * @param b: comm base
@@ -395,7 +469,9 @@ struct comm_point* comm_point_create_udp_ancil(struct comm_base* base,
  * @param fd: file descriptor of open TCP socket set to listen nonblocking.
  * @param num: becomes max_tcp_count, the routine allocates that
  *	many tcp handler commpoints.
- * @param bufsize: size of buffer to create for handlers.
+ * @param idle_timeout: timeout in msec for idle connections.
+ * @param pool: buffer pool that the handlers take their buffers from,
+ *	when they read a query or write an answer.
  * @param callback: callback function pointer for TCP handlers.
  * @param callback_arg: will be passed to your callback function.
  * @return: returns the TCP listener commpoint. You can find the
@@ -404,7 +480,7 @@ struct comm_point* comm_point_create_udp_ancil(struct comm_base* base,
  * Inits timeout to NULL. All handlers are on the free list.
  */
 struct comm_point* comm_point_create_tcp(struct comm_base* base,
-	int fd, int num, size_t bufsize, 
+	int fd, int num, int idle_timeout, struct comm_buffer_pool* pool,
 	comm_point_callback_t* callback, void* callback_arg);
 
 /**
@@ -511,6 +587,37 @@ void comm_point_listen_for_rw(struct comm_point* c, int rd, int wr);
  */
 size_t comm_point_get_mem(struct comm_point* c);
 
+/**
+ * Get the idle timeout that a tcp handler has after it sends its reply.
+ * @param c: commpoint.
+ * @return timeout in msec, or 0 if c is not a tcp handler.
+ */
+int comm_point_tcp_idle_timeout(struct comm_point* c);
+
+/**
+ * Create a buffer pool for tcp handlers.
+ * @param bufsize: size of the buffers.
+ * @param max_free: max number of free buffers kept for reuse.
+ * @return new pool or NULL on alloc failure.
+ */
+struct comm_buffer_pool* comm_buffer_pool_create(size_t bufsize,
+	size_t max_free);
+
+/**
+ * Delete the buffer pool.  The buffers handed out must have been
+ * returned, or deleted with their commpoints.
+ * @param pool: to delete.
+ */
+void comm_buffer_pool_delete(struct comm_buffer_pool* pool);
+
+/**
+ * Get size of memory used by the buffer pool, for the free buffers.
+ * The buffers in use are accounted for by their commpoints.
+ * @param pool: the buffer pool.
+ * @return size in bytes.
+ */
+size_t comm_buffer_pool_get_mem(struct comm_buffer_pool* pool);
+
 /**
  * create timer. Not active upon creation.
  * @param base: event handling base.
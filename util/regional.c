@@ -43,6 +43,7 @@
 #include "config.h"
 #include "util/log.h"
 #include "util/regional.h"
+#include "util/alloc.h"
 
 #ifdef ALIGNMENT
 #  undef ALIGNMENT
@@ -61,6 +62,13 @@
 /** Default size for large objects - allocated outside of chunks. */
 #define REGIONAL_LARGE_OBJECT_SIZE  2048
 #endif
+#ifdef UNBOUND_ALLOC_NONREGIONAL
+/** large objects are never put in the current chunk, for debug */
+#define REGIONAL_LARGE_FITS(r, a) 0
+#else
+/** large objects that fit are put in the current chunk (a reserved one) */
+#define REGIONAL_LARGE_FITS(r, a) ((a) <= (r)->available)
+#endif
 
 struct regional* 
 regional_create(void)
@@ -78,6 +86,25 @@ regional_init(struct regional* r)
 	r->next = NULL;
 	r->large_list = NULL;
 	r->total_large = 0;
+	r->total_chunks = 0;
+}
+
+/** get a chunk or large object, from the alloc cache if there is one */
+static void*
+regional_malloc(struct regional* r, size_t size)
+{
+	if(r->alloc)
+		return alloc_sized_obtain(r->alloc, size);
+	return malloc(size);
+}
+
+/** free a chunk or large object, to the alloc cache if there is one */
+static void
+regional_free(struct regional* r, void* p)
+{
+	if(r->alloc)
+		alloc_sized_release(r->alloc, p);
+	else	free(p);
 }
 
 struct regional* 
@@ -87,6 +114,7 @@ regional_create_custom(size_t size)
 	log_assert(sizeof(struct regional) <= size);
 	if(!r) return NULL;
 	r->first_size = size;
+	r->alloc = NULL;
 	regional_init(r);
 	return r;
 }
@@ -97,13 +125,13 @@ regional_free_all(struct regional *r)
 	char* p = r->next, *np;
 	while(p) {
 		np = *(char**)p;
-		free(p);
+		regional_free(r, p);
 		p = np;
 	}
 	p = r->large_list;
 	while(p) {
 		np = *(char**)p;
-		free(p);
+		regional_free(r, p);
 		p = np;
 	}
 	regional_init(r);
@@ -123,8 +151,8 @@ regional_alloc(struct regional *r, size_t size)
 	size_t a = ALIGN_UP(size, ALIGNMENT);
 	void *s;
 	/* large objects */
-	if(a > REGIONAL_LARGE_OBJECT_SIZE) {
-		s = malloc(ALIGNMENT + size);
+	if(a > REGIONAL_LARGE_OBJECT_SIZE && !REGIONAL_LARGE_FITS(r, a)) {
+		s = regional_malloc(r, ALIGNMENT + size);
 		if(!s) return NULL;
 		r->total_large += ALIGNMENT+size;
 		*(char**)s = r->large_list;
@@ -133,12 +161,13 @@ regional_alloc(struct regional *r, size_t size)
 	}
 	/* create a new chunk */
 	if(a > r->available) {
-		s = malloc(REGIONAL_CHUNK_SIZE);
+		s = regional_malloc(r, REGIONAL_CHUNK_SIZE);
 		if(!s) return NULL;
 		*(char**)s = r->next;
 		r->next = (char*)s;
 		r->data = (char*)s + ALIGNMENT;
 		r->available = REGIONAL_CHUNK_SIZE - ALIGNMENT;
+		r->total_chunks += REGIONAL_CHUNK_SIZE;
 	}
 	/* put in this chunk */
 	r->available -= a;
@@ -147,6 +176,22 @@ regional_alloc(struct regional *r, size_t size)
 	return s;
 }
 
+void
+regional_reserve(struct regional *r, size_t size)
+{
+	size_t a = ALIGN_UP(size, ALIGNMENT) + ALIGNMENT;
+	char* s;
+	if(size <= r->available)
+		return;
+	if(!(s = (char*)regional_malloc(r, a)))
+		return;
+	*(char**)s = r->next;
+	r->next = s;
+	r->data = s + ALIGNMENT;
+	r->available = a - ALIGNMENT;
+	r->total_chunks += a;
+}
+
 void *
 regional_alloc_init(struct regional* r, const void *init, size_t size)
 {
@@ -218,6 +263,5 @@ regional_log_stats(struct regional *r)
 size_t 
 regional_get_mem(struct regional* r)
 {
-	return r->first_size + (count_chunks(r)-1)*REGIONAL_CHUNK_SIZE 
-		+ r->total_large;
+	return r->first_size + r->total_chunks + r->total_large;
 }
@@ -46,10 +46,12 @@
  * 	o allocs the regional struct inside the first block.
  * 	o can take a block to create regional from.
  * 	o blocks and large allocations are kept on singly linked lists.
+ * 	o can take the blocks and large allocations from an alloc cache.
  */
 
 #ifndef UTIL_REGIONAL_H_
 #define UTIL_REGIONAL_H_
+struct alloc_cache;
 
 /** 
  * the regional* is the first block*.
@@ -68,12 +70,17 @@ struct regional
 	char* large_list;
 	/** total large size */
 	size_t total_large;
+	/** total size of the chunks after the first */
+	size_t total_chunks;
 	/** initial chunk size */
 	size_t first_size;
 	/** number of bytes available in the current chunk. */
 	size_t available;
 	/** current chunk data position. */
 	char* data;
+	/** the alloc cache that chunks and large objects are obtained
+	 * from and released to, or NULL to use malloc and free. */
+	struct alloc_cache* alloc;
 };
 
 /**
@@ -112,6 +119,16 @@ void regional_destroy(struct regional *r);
  */
 void *regional_alloc(struct regional *r, size_t size);
 
+/**
+ * Make sure the regional has size bytes available in one chunk, so that
+ * a query that is expected to be large fetches one chunk up front
+ * instead of many chunks and large objects.  On alloc failure nothing
+ * happens, regional_alloc gets the memory later on.
+ * @param r: the region.
+ * @param size: number of bytes.
+ */
+void regional_reserve(struct regional *r, size_t size);
+
 /**
  * Allocate size bytes of memory inside regional and copy INIT into it.
  * The memory is deallocated when region_free_all is called for this
@@ -0,0 +1,193 @@
+/*
+ * util/storage/keyhash.c - keyed hash function for the hash tables.
+ *
+ * Copyright (c) 2014, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains SipHash, by Jean-Philippe Aumasson and Daniel J.
+ * Bernstein, written after the reference implementation, and the hash
+ * function for the hash tables that uses it.
+ */
+
+#include "config.h"
+#include "util/storage/keyhash.h"
+#include "util/storage/lookup3.h"
+
+/** the selected hash function */
+static enum keyhash_func keyhash_f = keyhash_siphash;
+
+/** the key, as two 64bit numbers; the default is used if it is not set,
+ * by the test tools */
+static uint64_t keyhash_k0 = 0x736f6d6570736575ULL,
+	keyhash_k1 = 0x646f72616e646f6dULL;
+
+/** rotate left */
+#define ROTL(x, b) (uint64_t)(((x) << (b)) | ((x) >> (64 - (b))))
+
+/** one SipRound on the state */
+#define SIPROUND do { \
+	v0 += v1; v1 = ROTL(v1, 13); v1 ^= v0; v0 = ROTL(v0, 32); \
+	v2 += v3; v3 = ROTL(v3, 16); v3 ^= v2; \
+	v0 += v3; v3 = ROTL(v3, 21); v3 ^= v0; \
+	v2 += v1; v1 = ROTL(v1, 17); v1 ^= v2; v2 = ROTL(v2, 32); \
+	} while(0)
+
+/** read 64bit little endian number, the compiler makes it one load */
+#define READ_LE64(p) (((uint64_t)(p)[0]) | ((uint64_t)(p)[1] << 8) | \
+	((uint64_t)(p)[2] << 16) | ((uint64_t)(p)[3] << 24) | \
+	((uint64_t)(p)[4] << 32) | ((uint64_t)(p)[5] << 40) | \
+	((uint64_t)(p)[6] << 48) | ((uint64_t)(p)[7] << 56))
+
+/**
+ * Read the last bytes of the input, that do not fill a word, with the
+ * length in the top byte.
+ * @param in: the last bytes.
+ * @param inlen: total length of the input.
+ * @return the last word.
+ */
+static uint64_t
+sip_last(const uint8_t* in, size_t inlen)
+{
+	uint64_t b = ((uint64_t)inlen) << 56;
+	switch(inlen & 7) {
+	case 7: b |= ((uint64_t)in[6]) << 48; /* fallthrough */
+	case 6: b |= ((uint64_t)in[5]) << 40; /* fallthrough */
+	case 5: b |= ((uint64_t)in[4]) << 32; /* fallthrough */
+	case 4: b |= ((uint64_t)in[3]) << 24; /* fallthrough */
+	case 3: b |= ((uint64_t)in[2]) << 16; /* fallthrough */
+	case 2: b |= ((uint64_t)in[1]) << 8; /* fallthrough */
+	case 1: b |= ((uint64_t)in[0]); break;
+	case 0: break;
+	}
+	return b;
+}
+
+/** the initial state of SipHash, from the key */
+#define SIP_INIT(k0, k1) \
+	uint64_t v0 = 0x736f6d6570736575ULL ^ (k0); \
+	uint64_t v1 = 0x646f72616e646f6dULL ^ (k1); \
+	uint64_t v2 = 0x6c7967656e657261ULL ^ (k0); \
+	uint64_t v3 = 0x7465646279746573ULL ^ (k1)
+
+/**
+ * SipHash-1-3, written out for speed, it is used for every hash.
+ * @param k0: first half of the key.
+ * @param k1: second half of the key.
+ * @param in: data.
+ * @param inlen: length of data.
+ * @return the hash.
+ */
+static uint64_t
+sip13(uint64_t k0, uint64_t k1, const uint8_t* in, size_t inlen)
+{
+	SIP_INIT(k0, k1);
+	uint64_t m;
+	const uint8_t* end = in + inlen - (inlen % 8);
+	for(; in != end; in += 8) {
+		m = READ_LE64(in);
+		v3 ^= m;
+		SIPROUND;
+		v0 ^= m;
+	}
+	m = sip_last(in, inlen);
+	v3 ^= m;
+	SIPROUND;
+	v0 ^= m;
+	v2 ^= 0xff;
+	SIPROUND;
+	SIPROUND;
+	SIPROUND;
+	return v0 ^ v1 ^ v2 ^ v3;
+}
+
+uint64_t
+siphash_1_3(const uint8_t* key, const void* in, size_t inlen)
+{
+	return sip13(READ_LE64(key), READ_LE64(key+8), (const uint8_t*)in,
+		inlen);
+}
+
+uint64_t
+siphash_2_4(const uint8_t* key, const void* in, size_t inlen)
+{
+	SIP_INIT(READ_LE64(key), READ_LE64(key+8));
+	const uint8_t* p = (const uint8_t*)in;
+	const uint8_t* end = p + inlen - (inlen % 8);
+	uint64_t m;
+	for(; p != end; p += 8) {
+		m = READ_LE64(p);
+		v3 ^= m;
+		SIPROUND;
+		SIPROUND;
+		v0 ^= m;
+	}
+	m = sip_last(p, inlen);
+	v3 ^= m;
+	SIPROUND;
+	SIPROUND;
+	v0 ^= m;
+	v2 ^= 0xff;
+	SIPROUND;
+	SIPROUND;
+	SIPROUND;
+	SIPROUND;
+	return v0 ^ v1 ^ v2 ^ v3;
+}
+
+uint32_t
+keyhash(const void* k, size_t length, uint32_t initval)
+{
+	uint64_t h;
+	if(keyhash_f == keyhash_lookup3)
+		return hashlittle(k, length, initval);
+	/* the previous hash is mixed into the key, so the hash of the
+	 * pieces of a key can be chained */
+	h = sip13(keyhash_k0 ^ initval, keyhash_k1, (const uint8_t*)k,
+		length);
+	return (uint32_t)(h ^ (h >> 32));
+}
+
+void
+keyhash_set_key(const uint8_t* key)
+{
+	keyhash_k0 = READ_LE64(key);
+	keyhash_k1 = READ_LE64(key+8);
+}
+
+void
+keyhash_set_func(enum keyhash_func f)
+{
+	keyhash_f = f;
+}
@@ -0,0 +1,102 @@
+/*
+ * util/storage/keyhash.h - keyed hash function for the hash tables.
+ *
+ * Copyright (c) 2014, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the hash function for the keys of the hash tables,
+ * the caches and the other tables with keys from the network.  It is
+ * SipHash-1-3 with a random key, set once when the process starts, so
+ * that hash collisions cannot be computed by an outsider.  The lookup3
+ * hash can be selected instead, for comparison.
+ */
+
+#ifndef UTIL_STORAGE_KEYHASH_H
+#define UTIL_STORAGE_KEYHASH_H
+
+/** the length of the hash key, in bytes */
+#define KEYHASH_KEY_SIZE 16
+
+/** the hash functions that keyhash can use */
+enum keyhash_func {
+	/** SipHash-1-3, keyed with the hash key, the default */
+	keyhash_siphash = 0,
+	/** lookup3 hashlittle, with its randomised initial value */
+	keyhash_lookup3
+};
+
+/**
+ * Hash key data, the hash function for the hash tables.
+ * @param k: the key data.
+ * @param length: the length of the key, in bytes.
+ * @param initval: the previous hash, or an arbitrary value.
+ * @return hash value.
+ */
+uint32_t keyhash(const void* k, size_t length, uint32_t initval);
+
+/**
+ * Set the hash key.  Set it before threads start and before hash values
+ * are made, because it changes the results.  It has to stay the same
+ * while hash tables exist.
+ * @param key: KEYHASH_KEY_SIZE bytes, random.
+ */
+void keyhash_set_key(const uint8_t* key);
+
+/**
+ * Select the hash function.  Like the key, set it before hashing.
+ * @param f: the function.
+ */
+void keyhash_set_func(enum keyhash_func f);
+
+/**
+ * SipHash-1-3, one compression and three finalization rounds.
+ * @param key: KEYHASH_KEY_SIZE bytes.
+ * @param in: the data.
+ * @param inlen: length of the data.
+ * @return 64bit hash.
+ */
+uint64_t siphash_1_3(const uint8_t* key, const void* in, size_t inlen);
+
+/**
+ * SipHash-2-4, the standard variant, to check the implementation with
+ * the reference test vectors.
+ * @param key: KEYHASH_KEY_SIZE bytes.
+ * @param in: the data.
+ * @param inlen: length of the data.
+ * @return 64bit hash.
+ */
+uint64_t siphash_2_4(const uint8_t* key, const void* in, size_t inlen);
+
+#endif /* UTIL_STORAGE_KEYHASH_H */
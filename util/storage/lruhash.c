@@ -42,6 +42,7 @@
 
 #include "config.h"
 #include "util/storage/lruhash.h"
+#include "util/storage/tinylfu.h"
 #include "util/fptr_wlist.h"
 
 void
@@ -159,6 +160,7 @@ lruhash_delete(struct lruhash* table)
 	for(i=0; i<table->size; i++)
 		bin_delete(table, &table->array[i]);
 	free(table->array);
+	tinylfu_delete(table->admission);
 	free(table);
 }
 
@@ -177,11 +179,35 @@ bin_overflow_remove(struct lruhash_bin* bin, struct lruhash_entry* entry)
 	}
 }
 
+/** take entry out of the table, and put it on the list for deletion.
+ * Caller holds the table lock, but no bin lock. */
+static void
+lru_evict(struct lruhash* table, struct lruhash_entry* d,
+	struct lruhash_entry** list)
+{
+	struct lruhash_bin* bin;
+	if(d->in_window)
+		table->win_used -= table->sizefunc(d->key, d->data);
+	lru_remove(table, d);
+	/* schedule entry for deletion */
+	bin = &table->array[d->hash & table->size_mask];
+	table->num --;
+	lock_quick_lock(&bin->lock);
+	bin_overflow_remove(bin, d);
+	d->overflow_next = *list;
+	*list = d;
+	lock_rw_wrlock(&d->lock);
+	table->space_used -= table->sizefunc(d->key, d->data);
+	if(table->markdelfunc)
+		(*table->markdelfunc)(d->key);
+	lock_rw_unlock(&d->lock);
+	lock_quick_unlock(&bin->lock);
+}
+
 void 
 reclaim_space(struct lruhash* table, struct lruhash_entry** list)
 {
 	struct lruhash_entry* d;
-	struct lruhash_bin* bin;
 	log_assert(table);
 	/* does not delete MRU entry, so table will not be empty. */
 	while(table->num > 1 && table->space_used > table->space_max) {
@@ -192,24 +218,40 @@ reclaim_space(struct lruhash* table, struct lruhash_entry** list)
 		   which is unlikely, since it is LRU, if someone got a rdlock
 		   it would be moved to front, but to be sure. */
 		d = table->lru_end;
-		/* specialised, delete from end of double linked list,
-		   and we know num>1, so there is a previous lru entry. */
-		log_assert(d && d->lru_prev);
-		table->lru_end = d->lru_prev;
-		d->lru_prev->lru_next = NULL;
-		/* schedule entry for deletion */
-		bin = &table->array[d->hash & table->size_mask];
-		table->num --;
-		lock_quick_lock(&bin->lock);
-		bin_overflow_remove(bin, d);
-		d->overflow_next = *list;
-		*list = d;
-		lock_rw_wrlock(&d->lock);
-		table->space_used -= table->sizefunc(d->key, d->data);
-		if(table->markdelfunc)
-			(*table->markdelfunc)(d->key);
-		lock_rw_unlock(&d->lock);
-		lock_quick_unlock(&bin->lock);
+		/* with the admission window, the main lru can be empty;
+		 * then we know num>1 and the window end is not the MRU */
+		if(!d)
+			d = table->win_end;
+		log_assert(d);
+		lru_evict(table, d, list);
+	}
+}
+
+/**
+ * Move the entries that fall out of the admission window to the main lru.
+ * If the table is full, the candidate from the window and the lru end
+ * compete on their estimated frequency, and the loser is evicted.
+ * Caller holds the table lock, but no bin lock.
+ */
+static void
+window_evict(struct lruhash* table, struct lruhash_entry** list)
+{
+	struct lruhash_entry* c, *v;
+	size_t max = table->space_max/100*HASH_ADMISSION_WINDOW;
+	/* the window keeps the most recent entry, it is the one that the
+	 * caller has just inserted */
+	while(table->win_used > max && table->win_end != table->win_start) {
+		c = table->win_end;
+		lru_remove(table, c);
+		table->win_used -= table->sizefunc(c->key, c->data);
+		v = table->lru_end;
+		lru_front(table, c);
+		if(!v || table->space_used <= table->space_max)
+			continue;
+		if(tinylfu_estimate(table->admission, c->hash) >
+			tinylfu_estimate(table->admission, v->hash))
+			lru_evict(table, v, list);
+		else	lru_evict(table, c, list);
 	}
 }
 
@@ -264,6 +306,7 @@ table_grow(struct lruhash* table)
 void 
 lru_front(struct lruhash* table, struct lruhash_entry* entry)
 {
+	entry->in_window = 0;
 	entry->lru_prev = NULL;
 	entry->lru_next = table->lru_start;
 	if(!table->lru_start)
@@ -272,9 +315,31 @@ lru_front(struct lruhash* table, struct lruhash_entry* entry)
 	table->lru_start = entry;
 }
 
+/** put entry at the front of the admission window, it is unlinked */
+static void
+win_front(struct lruhash* table, struct lruhash_entry* entry)
+{
+	entry->in_window = 1;
+	entry->lru_prev = NULL;
+	entry->lru_next = table->win_start;
+	if(!table->win_start)
+		table->win_end = entry;
+	else	table->win_start->lru_prev = entry;
+	table->win_start = entry;
+}
+
 void 
 lru_remove(struct lruhash* table, struct lruhash_entry* entry)
 {
+	if(entry->in_window) {
+		if(entry->lru_prev)
+			entry->lru_prev->lru_next = entry->lru_next;
+		else	table->win_start = entry->lru_next;
+		if(entry->lru_next)
+			entry->lru_next->lru_prev = entry->lru_prev;
+		else	table->win_end = entry->lru_prev;
+		return;
+	}
 	if(entry->lru_prev)
 		entry->lru_prev->lru_next = entry->lru_next;
 	else	table->lru_start = entry->lru_next;
@@ -287,6 +352,14 @@ void
 lru_touch(struct lruhash* table, struct lruhash_entry* entry)
 {
 	log_assert(table && entry);
+	if(entry->in_window) {
+		/* entries stay in the admission window until they fall out */
+		if(entry == table->win_start)
+			return;
+		lru_remove(table, entry);
+		win_front(table, entry);
+		return;
+	}
 	if(entry == table->lru_start)
 		return; /* nothing to do */
 	/* remove from current lru position */
@@ -320,13 +393,19 @@ lruhash_insert(struct lruhash* table, hashvalue_t hash,
 		/* if not: add to bin */
 		entry->overflow_next = bin->overflow_list;
 		bin->overflow_list = entry;
-		lru_front(table, entry);
+		if(table->admission) {
+			tinylfu_increment(table->admission, hash);
+			win_front(table, entry);
+			table->win_used += need_size;
+		} else	lru_front(table, entry);
 		table->num++;
 		table->space_used += need_size;
 	} else {
 		/* if so: update data - needs a writelock */
-		table->space_used += need_size -
-			(*table->sizefunc)(found->key, found->data);
+		size_t old_size = (*table->sizefunc)(found->key, found->data);
+		table->space_used += need_size - old_size;
+		if(found->in_window)
+			table->win_used += need_size - old_size;
 		(*table->delkeyfunc)(entry->key, cb_arg);
 		lru_touch(table, found);
 		lock_rw_wrlock(&found->lock);
@@ -335,6 +414,8 @@ lruhash_insert(struct lruhash* table, hashvalue_t hash,
 		lock_rw_unlock(&found->lock);
 	}
 	lock_quick_unlock(&bin->lock);
+	if(table->admission)
+		window_evict(table, &reclaimlist);
 	if(table->space_used > table->space_max)
 		reclaim_space(table, &reclaimlist);
 	if(table->num >= table->size)
@@ -361,8 +442,12 @@ lruhash_lookup(struct lruhash* table, hashvalue_t hash, void* key, int wr)
 	lock_quick_lock(&table->lock);
 	bin = &table->array[hash & table->size_mask];
 	lock_quick_lock(&bin->lock);
-	if((entry=bin_find_entry(table, bin, hash, key)))
+	if((entry=bin_find_entry(table, bin, hash, key))) {
 		lru_touch(table, entry);
+		/* a miss is counted when the entry is inserted */
+		if(table->admission)
+			tinylfu_increment(table->admission, hash);
+	}
 	lock_quick_unlock(&table->lock);
 
 	if(entry) {
@@ -398,6 +483,8 @@ lruhash_remove(struct lruhash* table, hashvalue_t hash, void* key)
 	}
 	table->num--;
 	table->space_used -= (*table->sizefunc)(entry->key, entry->data);
+	if(entry->in_window)
+		table->win_used -= (*table->sizefunc)(entry->key, entry->data);
 	lock_quick_unlock(&table->lock);
 	lock_rw_wrlock(&entry->lock);
 	if(table->markdelfunc)
@@ -449,6 +536,9 @@ lruhash_clear(struct lruhash* table)
 	}
 	table->lru_start = NULL;
 	table->lru_end = NULL;
+	table->win_start = NULL;
+	table->win_end = NULL;
+	table->win_used = 0;
 	table->num = 0;
 	table->space_used = 0;
 	lock_quick_unlock(&table->lock);
@@ -506,6 +596,7 @@ lruhash_get_mem(struct lruhash* table)
 		s += (table->size)*(sizeof(struct lruhash_bin) + 
 			lock_get_mem(&table->array[0].lock));
 #endif
+	s += tinylfu_get_mem(table->admission);
 	lock_quick_unlock(&table->lock);
 	s += lock_get_mem(&table->lock);
 	return s;
@@ -519,6 +610,118 @@ lruhash_setmarkdel(struct lruhash* table, lruhash_markdelfunc_t md)
 	lock_quick_unlock(&table->lock);
 }
 
+int
+lruhash_set_admission(struct lruhash* table, int on, uint32_t seed)
+{
+	struct lruhash_entry* e;
+	struct tinylfu* lfu = NULL;
+	if(on) {
+		/* a sketch that is on already keeps its counts, so the
+		 * frequencies of the kept cache survive a reload */
+		lock_quick_lock(&table->lock);
+		if(table->admission) {
+			lock_quick_unlock(&table->lock);
+			return 1;
+		}
+		lock_quick_unlock(&table->lock);
+		/* a row has a few counters per entry, and with 4 bit
+		 * counters, it costs about 3% of the memory */
+		lfu = tinylfu_create(table->space_max/64 < 64 ? 64 :
+			table->space_max/64, seed);
+		if(!lfu) {
+			log_err("lruhash_set_admission: out of memory");
+			on = 0;
+		}
+	}
+	lock_quick_lock(&table->lock);
+	tinylfu_delete(table->admission);
+	table->admission = lfu;
+	if(!on) {
+		/* the window entries go in front of the lru */
+		while((e = table->win_end) != NULL) {
+			lru_remove(table, e);
+			lru_front(table, e);
+		}
+		table->win_used = 0;
+	}
+	lock_quick_unlock(&table->lock);
+	return on;
+}
+
+size_t
+lruhash_reclaim_expired(struct lruhash* table, lruhash_expiredfunc_t isexp,
+	time_t now, size_t bins)
+{
+	struct lruhash_entry* p, *np, *list = NULL;
+	struct lruhash_bin* bin;
+	size_t n = 0, s;
+	fptr_ok(fptr_whitelist_hash_expiredfunc(isexp));
+	fptr_ok(fptr_whitelist_hash_sizefunc(table->sizefunc));
+	fptr_ok(fptr_whitelist_hash_delkeyfunc(table->delkeyfunc));
+	fptr_ok(fptr_whitelist_hash_deldatafunc(table->deldatafunc));
+	fptr_ok(fptr_whitelist_hash_markdelfunc(table->markdelfunc));
+
+	lock_quick_lock(&table->lock);
+	for(; bins > 0; bins--) {
+		if(table->scan_bin >= table->size) {
+			/* a pass over the table is complete */
+			table->scan_bin = 0;
+			table->last_live = table->scan_live;
+			table->last_expired = table->scan_expired;
+			table->scan_live = 0;
+			table->scan_expired = 0;
+		}
+		bin = &table->array[table->scan_bin++];
+		lock_quick_lock(&bin->lock);
+		for(p = bin->overflow_list; p; p = np) {
+			np = p->overflow_next;
+			/* writelock, the ttl can be updated by a reader that
+			 * holds the writelock, and the entry is marked */
+			lock_rw_wrlock(&p->lock);
+			if(!(*isexp)(p->key, p->data, now)) {
+				lock_rw_unlock(&p->lock);
+				table->scan_live++;
+				continue;
+			}
+			bin_overflow_remove(bin, p);
+			lru_remove(table, p);
+			table->num--;
+			s = (*table->sizefunc)(p->key, p->data);
+			table->space_used -= s;
+			if(p->in_window)
+				table->win_used -= s;
+			if(table->markdelfunc)
+				(*table->markdelfunc)(p->key);
+			lock_rw_unlock(&p->lock);
+			p->overflow_next = list;
+			list = p;
+			table->scan_expired++;
+			n++;
+		}
+		lock_quick_unlock(&bin->lock);
+	}
+	lock_quick_unlock(&table->lock);
+
+	/* delete outside of the critical region */
+	while(list) {
+		void* d = list->data;
+		np = list->overflow_next;
+		(*table->delkeyfunc)(list->key, table->cb_arg);
+		(*table->deldatafunc)(d, table->cb_arg);
+		list = np;
+	}
+	return n;
+}
+
+void
+lruhash_expiry_stats(struct lruhash* table, size_t* live, size_t* expired)
+{
+	lock_quick_lock(&table->lock);
+	*live = table->last_live;
+	*expired = table->last_expired;
+	lock_quick_unlock(&table->lock);
+}
+
 void 
 lruhash_traverse(struct lruhash* h, int wr, 
 	void (*func)(struct lruhash_entry*, void*), void* arg)
@@ -109,11 +109,14 @@
 #include "util/locks.h"
 struct lruhash_bin;
 struct lruhash_entry;
+struct tinylfu;
 
 /** default start size for hash arrays */
 #define HASH_DEFAULT_STARTARRAY		1024 /* entries in array */
 /** default max memory for hash arrays */
 #define HASH_DEFAULT_MAXMEM		4*1024*1024 /* bytes */
+/** size of the admission window, in percent of the max memory */
+#define HASH_ADMISSION_WINDOW		1 /* percent */
 
 /** the type of a hash value */
 typedef uint32_t hashvalue_t;
@@ -141,6 +144,10 @@ typedef void (*lruhash_deldatafunc_t)(void*, void*);
  * called: func(key) */
 typedef void (*lruhash_markdelfunc_t)(void*);
 
+/** check if the entry has expired, and can be removed. Called with the
+ * entry locked.  called: func(key, data, now). true if expired. */
+typedef int (*lruhash_expiredfunc_t)(void*, void*, time_t);
+
 /**
  * Hash table that keeps LRU list of entries.
  */
@@ -171,6 +178,26 @@ struct lruhash {
 	struct lruhash_entry* lru_start;
 	/** lru list end item (least recently used) */
 	struct lruhash_entry* lru_end;
+	/** the admission window lru list, used if the admission filter is
+	 * on.  New entries go into the window, and when they fall out of
+	 * it, they only replace the lru_end entry if they are used more. */
+	struct lruhash_entry* win_start;
+	/** admission window list end item */
+	struct lruhash_entry* win_end;
+	/** the amount of space used by the entries in the window. */
+	size_t win_used;
+	/** the frequency sketch of the admission filter, NULL if off. */
+	struct tinylfu* admission;
+	/** the next bin for the expiry scan */
+	size_t scan_bin;
+	/** number of live entries seen in the current expiry scan pass */
+	size_t scan_live;
+	/** number of expired entries removed in the current pass */
+	size_t scan_expired;
+	/** number of live entries seen in the last complete pass */
+	size_t last_live;
+	/** number of expired entries removed in the last complete pass */
+	size_t last_expired;
 
 	/** the number of entries in the hash table. */
 	size_t num;
@@ -214,6 +241,9 @@ struct lruhash_entry {
 	struct lruhash_entry* lru_next;
 	/** prev entry in lru chain. covered by hashlock. */
 	struct lruhash_entry* lru_prev;
+	/** if the entry is in the admission window list. covered by
+	 * hashlock. */
+	uint8_t in_window;
 	/** hash value of the key. It may not change, until entry deleted. */
 	hashvalue_t hash;
 	/** key */
@@ -301,6 +331,42 @@ void lru_touch(struct lruhash* table, struct lruhash_entry* entry);
  */
 void lruhash_setmarkdel(struct lruhash* table, lruhash_markdelfunc_t md);
 
+/**
+ * Turn the admission filter on or off.  With the filter on, new entries
+ * go into a small window lru, and when they fall out of the window they
+ * replace the least recently used entry only if they are estimated to be
+ * used more often.  So a scan of one-time entries does not push the
+ * popular entries out of the table.
+ * @param table: hash table.
+ * @param on: if true the filter is turned on, if false it is turned off.
+ * @param seed: random seed for the hash of the frequency sketch.  If the
+ *	filter is on already, its sketch is kept, with the old seed.
+ * @return false on malloc failure, the filter is off then.
+ */
+int lruhash_set_admission(struct lruhash* table, int on, uint32_t seed);
+
+/**
+ * Remove expired entries from the hash table, a slice at a time.  The
+ * next bins after the previous call are scanned, so that repeated calls
+ * walk over the whole table, and it does not block the table for long.
+ * @param table: hash table.
+ * @param isexp: function that checks if the entry is expired.
+ * @param now: the current time.
+ * @param bins: the number of bins to scan.
+ * @return the number of entries that are removed.
+ */
+size_t lruhash_reclaim_expired(struct lruhash* table,
+	lruhash_expiredfunc_t isexp, time_t now, size_t bins);
+
+/**
+ * Get the counts of the last complete expiry scan pass.
+ * @param table: hash table.
+ * @param live: the number of live entries seen is returned.
+ * @param expired: the number of expired entries found is returned.
+ */
+void lruhash_expiry_stats(struct lruhash* table, size_t* live,
+	size_t* expired);
+
 /************************* Internal functions ************************/
 /*** these are only exposed for unit tests. ***/
 
@@ -379,7 +445,7 @@ void table_grow(struct lruhash* table);
 void lru_front(struct lruhash* table, struct lruhash_entry* entry);
 
 /**
- * Remove entry from lru list.
+ * Remove entry from lru list, or from the admission window list.
  * Caller must hold hash table lock.
  * @param table: hash table with lru head and tail.
  * @param entry: entry to remove from lru.
@@ -202,6 +202,11 @@ void test_slabhash_deldata(void* data, void* ATTR_UNUSED(arg))
 	deldata((struct slabhash_testdata*)data);
 }
 
+int test_slabhash_expired(void* ATTR_UNUSED(key), void* data, time_t now)
+{
+	return now > (time_t)((struct slabhash_testdata*)data)->data;
+}
+
 void slabhash_setmarkdel(struct slabhash* sl, lruhash_markdelfunc_t md)
 {
 	size_t i;
@@ -210,6 +215,42 @@ void slabhash_setmarkdel(struct slabhash* sl, lruhash_markdelfunc_t md)
 	}
 }
 
+int slabhash_set_admission(struct slabhash* sl, int on, uint32_t seed)
+{
+	size_t i;
+	for(i=0; i<sl->size; i++) {
+		if(!lruhash_set_admission(sl->array[i], on, seed+(uint32_t)i))
+			on = 0;
+	}
+	if(!on) {
+		for(i=0; i<sl->size; i++)
+			(void)lruhash_set_admission(sl->array[i], 0, 0);
+	}
+	return on;
+}
+
+size_t slabhash_reclaim_expired(struct slabhash* sl,
+	lruhash_expiredfunc_t isexp, time_t now, size_t bins)
+{
+	size_t i, n = 0;
+	for(i=0; i<sl->size; i++)
+		n += lruhash_reclaim_expired(sl->array[i], isexp, now, bins);
+	return n;
+}
+
+void slabhash_expiry_stats(struct slabhash* sl, size_t* live,
+	size_t* expired)
+{
+	size_t i, l, e;
+	*live = 0;
+	*expired = 0;
+	for(i=0; i<sl->size; i++) {
+		lruhash_expiry_stats(sl->array[i], &l, &e);
+		*live += l;
+		*expired += e;
+	}
+}
+
 void slabhash_traverse(struct slabhash* sh, int wr,
         void (*func)(struct lruhash_entry*, void*), void* arg)
 {
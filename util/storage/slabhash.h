@@ -174,6 +174,35 @@ struct lruhash* slabhash_gettable(struct slabhash* table, hashvalue_t hash);
  */
 void slabhash_setmarkdel(struct slabhash* table, lruhash_markdelfunc_t md);
 
+/**
+ * Turn the admission filter of the slabs on or off.
+ * @param table: slabbed hash table.
+ * @param on: if true, turned on, otherwise off.
+ * @param seed: random seed for the frequency sketches.
+ * @return false on malloc failure, the filter is off then.
+ */
+int slabhash_set_admission(struct slabhash* table, int on, uint32_t seed);
+
+/**
+ * Remove expired entries, a slice of every slab.
+ * @param table: slabbed hash table.
+ * @param isexp: function that checks if the entry is expired.
+ * @param now: the current time.
+ * @param bins: the number of bins to scan in every slab.
+ * @return the number of entries that are removed.
+ */
+size_t slabhash_reclaim_expired(struct slabhash* table,
+	lruhash_expiredfunc_t isexp, time_t now, size_t bins);
+
+/**
+ * Get the counts of the last complete expiry scan of the slabs.
+ * @param table: slabbed hash table.
+ * @param live: the number of live entries seen is returned.
+ * @param expired: the number of expired entries found is returned.
+ */
+void slabhash_expiry_stats(struct slabhash* table, size_t* live,
+	size_t* expired);
+
 /**
  * Traverse a slabhash.
  * @param table: slabbed hash table.
@@ -206,6 +235,8 @@ int test_slabhash_compfunc(void*, void*);
 void test_slabhash_delkey(void*, void*);
 /** test deldata for lruhash */
 void test_slabhash_deldata(void*, void*);
+/** test expiredfunc for lruhash, the data value is the expiry time */
+int test_slabhash_expired(void*, void*, time_t);
 /* --- end test representation --- */
 
 #endif /* UTIL_STORAGE_SLABHASH_H */
@@ -0,0 +1,142 @@
+/*
+ * util/storage/tinylfu.c - frequency sketch for cache admission.
+ *
+ * Copyright (c) 2014, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the frequency sketch of the TinyLFU cache admission
+ * policy.
+ */
+#include "config.h"
+#include "util/storage/tinylfu.h"
+#include "util/storage/lookup3.h"
+
+struct tinylfu*
+tinylfu_create(size_t width, uint32_t seed)
+{
+	struct tinylfu* lfu = (struct tinylfu*)calloc(1, sizeof(*lfu));
+	size_t w = 2;
+	if(!lfu)
+		return NULL;
+	while(w < width)
+		w <<= 1;
+	lfu->width = w;
+	/* two counters of 4 bits in a byte */
+	lfu->counts = (uint8_t*)calloc(TINYLFU_DEPTH*w/2, sizeof(uint8_t));
+	if(!lfu->counts) {
+		free(lfu);
+		return NULL;
+	}
+	lfu->seed = seed;
+	return lfu;
+}
+
+void
+tinylfu_delete(struct tinylfu* lfu)
+{
+	if(!lfu)
+		return;
+	free(lfu->counts);
+	free(lfu);
+}
+
+/** get the value of counter number i */
+#define TINYLFU_GET(lfu, i) (((lfu)->counts[(i)>>1] >> (((i)&1)*4)) & 0xf)
+
+/** find the counters of the key in every row */
+static void
+tinylfu_counters(struct tinylfu* lfu, hashvalue_t hash,
+	size_t c[TINYLFU_DEPTH])
+{
+	hashvalue_t h1, h2;
+	int i;
+	/* the table hash is rehashed, because the slabs of a slabhash
+	 * pick the table with the high bits of the hash. The rows are
+	 * indexed with h1 + i*h2 */
+	h1 = hashlittle(&hash, sizeof(hash), lfu->seed);
+	h2 = hashlittle(&h1, sizeof(h1), lfu->seed) | 1;
+	for(i=0; i<TINYLFU_DEPTH; i++)
+		c[i] = i*lfu->width + ((h1 + (hashvalue_t)i*h2) &
+			(lfu->width-1));
+}
+
+/** halve all the counters, so that old popularity fades */
+static void
+tinylfu_age(struct tinylfu* lfu)
+{
+	size_t i;
+	for(i=0; i<TINYLFU_DEPTH*lfu->width/2; i++)
+		lfu->counts[i] = (lfu->counts[i] >> 1) & 0x77;
+	lfu->additions /= 2;
+}
+
+void
+tinylfu_increment(struct tinylfu* lfu, hashvalue_t hash)
+{
+	size_t c[TINYLFU_DEPTH];
+	int min = TINYLFU_MAXCOUNT, i;
+	tinylfu_counters(lfu, hash, c);
+	for(i=0; i<TINYLFU_DEPTH; i++)
+		if(TINYLFU_GET(lfu, c[i]) < min)
+			min = TINYLFU_GET(lfu, c[i]);
+	if(min == TINYLFU_MAXCOUNT)
+		return;
+	/* conservative update, only the lowest counters go up */
+	for(i=0; i<TINYLFU_DEPTH; i++)
+		if(TINYLFU_GET(lfu, c[i]) == min)
+			lfu->counts[c[i]>>1] += (uint8_t)(1 << ((c[i]&1)*4));
+	if(++lfu->additions >= TINYLFU_SAMPLE*lfu->width)
+		tinylfu_age(lfu);
+}
+
+int
+tinylfu_estimate(struct tinylfu* lfu, hashvalue_t hash)
+{
+	size_t c[TINYLFU_DEPTH];
+	int min = TINYLFU_MAXCOUNT, i;
+	tinylfu_counters(lfu, hash, c);
+	for(i=0; i<TINYLFU_DEPTH; i++)
+		if(TINYLFU_GET(lfu, c[i]) < min)
+			min = TINYLFU_GET(lfu, c[i]);
+	return min;
+}
+
+size_t
+tinylfu_get_mem(struct tinylfu* lfu)
+{
+	if(!lfu)
+		return 0;
+	return sizeof(*lfu) + TINYLFU_DEPTH*lfu->width/2;
+}
@@ -0,0 +1,110 @@
+/*
+ * util/storage/tinylfu.h - frequency sketch for cache admission.
+ *
+ * Copyright (c) 2014, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the frequency sketch of the TinyLFU cache admission
+ * policy.  The accesses to the hash table are counted in a count-min
+ * sketch with small counters, that are halved when enough accesses have
+ * been counted, so that the counts follow the recent popularity.  When
+ * the table is full, a new entry replaces the least recently used entry
+ * only if its estimated frequency is higher.  The sketch is covered by
+ * the lock of the hash table.
+ */
+
+#ifndef UTIL_STORAGE_TINYLFU_H
+#define UTIL_STORAGE_TINYLFU_H
+#include "util/storage/lruhash.h"
+
+/** number of rows (hash functions) in the count-min sketch */
+#define TINYLFU_DEPTH 4
+/** the counters stop at this value, they have 4 bits */
+#define TINYLFU_MAXCOUNT 15
+/** the counters are halved after this many times width accesses */
+#define TINYLFU_SAMPLE 10
+
+/**
+ * Frequency sketch.
+ */
+struct tinylfu {
+	/** number of counters per row, a power of two */
+	size_t width;
+	/** counters of 4 bits, TINYLFU_DEPTH rows of width counters */
+	uint8_t* counts;
+	/** number of accesses counted since the last halving */
+	size_t additions;
+	/** random seed for the hash, so colliding keys cannot be picked */
+	uint32_t seed;
+};
+
+/**
+ * Create frequency sketch.
+ * @param width: number of counters per row, rounded up to a power of two.
+ *	A few times the number of entries in the table.
+ * @param seed: random seed for the hash.
+ * @return new sketch or NULL on malloc failure.
+ */
+struct tinylfu* tinylfu_create(size_t width, uint32_t seed);
+
+/**
+ * Delete frequency sketch.
+ * @param lfu: to delete.
+ */
+void tinylfu_delete(struct tinylfu* lfu);
+
+/**
+ * Count an access to a key.
+ * @param lfu: the sketch.
+ * @param hash: hash value of the key.
+ */
+void tinylfu_increment(struct tinylfu* lfu, hashvalue_t hash);
+
+/**
+ * Estimate the recent access frequency of a key.
+ * @param lfu: the sketch.
+ * @param hash: hash value of the key.
+ * @return estimated count.
+ */
+int tinylfu_estimate(struct tinylfu* lfu, hashvalue_t hash);
+
+/**
+ * Get memory used by the sketch.
+ * @param lfu: the sketch.
+ * @return number of bytes.
+ */
+size_t tinylfu_get_mem(struct tinylfu* lfu);
+
+#endif /* UTIL_STORAGE_TINYLFU_H */
@@ -658,7 +658,6 @@ packed_rrset_heap_data(int iter(struct autr_ta**, uint8_t**, size_t*,
 	size_t rr_len = 0, dname_len = 0;
 	struct packed_rrset_data* data;
 	size_t count=0, rrsig_count=0, len=0, i, total;
-	uint8_t* nextrdata;
 	struct autr_ta* list_i;
 	time_t ttl = 0;
 
@@ -677,48 +676,39 @@ packed_rrset_heap_data(int iter(struct autr_ta**, uint8_t**, size_t*,
 
 	/* allocate */
 	total = count + rrsig_count;
-	len += sizeof(*data) + total*(sizeof(size_t) + sizeof(time_t) + 
-		sizeof(uint8_t*));
+	len += sizeof(*data) + PACKED_RRSET_ARRAYS_SIZE(total);
 	data = (struct packed_rrset_data*)calloc(1, len);
 	if(!data)
 		return NULL;
 
 	/* fill it */
-	data->ttl = ttl;
+	data->ttl = 0;
 	data->count = count;
 	data->rrsig_count = rrsig_count;
-	data->rr_len = (size_t*)((uint8_t*)data +
-		sizeof(struct packed_rrset_data));
-	data->rr_data = (uint8_t**)&(data->rr_len[total]);
-	data->rr_ttl = (time_t*)&(data->rr_data[total]);
-	nextrdata = (uint8_t*)&(data->rr_ttl[total]);
 
 	/* fill out len, ttl, fields */
 	list_i = list;
 	i = 0;
 	while(iter(&list_i, &rr, &rr_len, &dname_len)) {
-		data->rr_ttl[i] = (time_t)sldns_wirerr_get_ttl(rr, rr_len,
-			dname_len);
-		if(data->rr_ttl[i] < data->ttl)
-			data->ttl = data->rr_ttl[i];
-		data->rr_len[i] = 2 /* the rdlength */ +
+		packed_rr_set_ttl(data, i, (time_t)sldns_wirerr_get_ttl(rr,
+			rr_len, dname_len));
+		if(packed_rr_ttl(data, i) < ttl)
+			ttl = packed_rr_ttl(data, i);
+		packed_rr_len(data, i) = 2 /* the rdlength */ +
 			sldns_wirerr_get_rdatalen(rr, rr_len, dname_len);
 		i++;
 	}
-
-	/* fixup rest of ptrs */
-	for(i=0; i<total; i++) {
-		data->rr_data[i] = nextrdata;
-		nextrdata += data->rr_len[i];
-	}
+	/* the rrset ttl is the smallest, the rr ttls are relative to it */
+	packed_rrset_set_ttl(data, ttl);
+	packed_rrset_offs_setup(data);
 
 	/* copy data in there */
 	list_i = list;
 	i = 0;
 	while(iter(&list_i, &rr, &rr_len, &dname_len)) {
-		memmove(data->rr_data[i],
+		memmove(packed_rr_data(data, i),
 			sldns_wirerr_get_rdatawl(rr, rr_len, dname_len),
-			data->rr_len[i]);
+			packed_rr_len(data, i));
 		i++;
 	}
 
@@ -1253,7 +1243,8 @@ min_expiry(struct module_env* env, struct packed_rrset_data* dd)
 	size_t i;
 	int32_t t, r = 15 * 24 * 3600; /* 15 days max */
 	for(i=dd->count; i<dd->count+dd->rrsig_count; i++) {
-		t = rrsig_get_expiry(dd->rr_data[i], dd->rr_len[i]);
+		t = rrsig_get_expiry(packed_rr_data(dd, i),
+			packed_rr_len(dd, i));
 		if((int32_t)t - (int32_t)*env->now > 0) {
 			t -= (int32_t)*env->now;
 			if(t < r)
@@ -1496,12 +1487,12 @@ check_contains_revoked(struct module_env* env, struct val_env* ve,
 	for(i=0; i<dd->count; i++) {
 		struct autr_ta* ta = NULL;
 		if(!rr_is_dnskey_sep(ntohs(dnskey_rrset->rk.type),
-			dd->rr_data[i]+2, dd->rr_len[i]-2) ||
+			packed_rr_data(dd, i)+2, packed_rr_len(dd, i)-2) ||
 			!rr_is_dnskey_revoked(ntohs(dnskey_rrset->rk.type),
-			dd->rr_data[i]+2, dd->rr_len[i]-2))
+			packed_rr_data(dd, i)+2, packed_rr_len(dd, i)-2))
 			continue; /* not a revoked KSK */
 		if(!find_key(tp, ntohs(dnskey_rrset->rk.type),
-			dd->rr_data[i]+2, dd->rr_len[i]-2, &ta)) {
+			packed_rr_data(dd, i)+2, packed_rr_len(dd, i)-2, &ta)) {
 			log_err("malloc failure");
 			continue; /* malloc fail in compare*/
 		}
@@ -1582,10 +1573,10 @@ update_events(struct module_env* env, struct val_env* ve,
 	for(i=0; i<dd->count; i++) {
 		struct autr_ta* ta = NULL;
 		if(!rr_is_dnskey_sep(ntohs(dnskey_rrset->rk.type),
-			dd->rr_data[i]+2, dd->rr_len[i]-2))
+			packed_rr_data(dd, i)+2, packed_rr_len(dd, i)-2))
 			continue;
 		if(rr_is_dnskey_revoked(ntohs(dnskey_rrset->rk.type),
-			dd->rr_data[i]+2, dd->rr_len[i]-2)) {
+			packed_rr_data(dd, i)+2, packed_rr_len(dd, i)-2)) {
 			/* self-signed revoked keys already detected before,
 			 * other revoked keys are not 'added' again */
 			continue;
@@ -1602,12 +1593,13 @@ update_events(struct module_env* env, struct val_env* ve,
 
 		/* is it new? if revocation bit set, find the unrevoked key */
 		if(!find_key(tp, ntohs(dnskey_rrset->rk.type),
-			dd->rr_data[i]+2, dd->rr_len[i]-2, &ta)) {
+			packed_rr_data(dd, i)+2, packed_rr_len(dd, i)-2, &ta)) {
 			return 0;
 		}
 		if(!ta) {
-			ta = add_key(tp, (uint32_t)dd->rr_ttl[i],
-				dd->rr_data[i]+2, dd->rr_len[i]-2);
+			ta = add_key(tp, (uint32_t)packed_rr_ttl(dd, i),
+				packed_rr_data(dd, i)+2,
+				packed_rr_len(dd, i)-2);
 			*changed = 1;
 			/* first time seen, do we have DSes? if match: VALID */
 			if(ta && tp->ds_rrset && key_matches_a_ds(env, ve,
@@ -2317,6 +2309,7 @@ probe_anchor(struct module_env* env, struct trust_anchor* tp)
 	edns.ext_rcode = 0;
 	edns.edns_version = 0;
 	edns.bits = EDNS_DO;
+	edns.opt_list = NULL;
 	if(sldns_buffer_capacity(buf) < 65535)
 		edns.udp_size = (uint16_t)sldns_buffer_capacity(buf);
 	else	edns.udp_size = 65535;
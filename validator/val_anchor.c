@@ -101,9 +101,6 @@ assembled_rrset_delete(struct ub_packed_rrset_key* pkey)
 	if(pkey->entry.data) {
 		struct packed_rrset_data* pd = (struct packed_rrset_data*)
 			pkey->entry.data;
-		free(pd->rr_data);
-		free(pd->rr_ttl);
-		free(pd->rr_len);
 		free(pd);
 	}
 	free(pkey->rk.dname);
@@ -858,7 +855,7 @@ assemble_it(struct trust_anchor* ta, size_t num, uint16_t type)
 		malloc(sizeof(*pkey));
 	struct packed_rrset_data* pd;
 	struct ta_key* tk;
-	size_t i;
+	size_t i, len;
 	if(!pkey)
 		return NULL;
 	memset(pkey, 0, sizeof(*pkey));
@@ -871,9 +868,12 @@ assemble_it(struct trust_anchor* ta, size_t num, uint16_t type)
 	pkey->rk.dname_len = ta->namelen;
 	pkey->rk.type = htons(type);
 	pkey->rk.rrset_class = htons(ta->dclass);
-	/* The rrset is build in an uncompressed way. This means it
-	 * cannot be copied in the normal way. */
-	pd = (struct packed_rrset_data*)malloc(sizeof(*pd));
+	/* The rrset data is one block, with the rdatas after the arrays */
+	len = sizeof(*pd) + PACKED_RRSET_ARRAYS_SIZE(num);
+	for(tk = ta->keylist; tk; tk = tk->next)
+		if(tk->type == type)
+			len += tk->len;
+	pd = (struct packed_rrset_data*)malloc(len);
 	if(!pd) {
 		free(pkey->rk.dname);
 		free(pkey);
@@ -882,39 +882,21 @@ assemble_it(struct trust_anchor* ta, size_t num, uint16_t type)
 	memset(pd, 0, sizeof(*pd));
 	pd->count = num;
 	pd->trust = rrset_trust_ultimate;
-	pd->rr_len = (size_t*)malloc(num*sizeof(size_t));
-	if(!pd->rr_len) {
-		free(pd);
-		free(pkey->rk.dname);
-		free(pkey);
-		return NULL;
-	}
-	pd->rr_ttl = (time_t*)malloc(num*sizeof(time_t));
-	if(!pd->rr_ttl) {
-		free(pd->rr_len);
-		free(pd);
-		free(pkey->rk.dname);
-		free(pkey);
-		return NULL;
-	}
-	pd->rr_data = (uint8_t**)malloc(num*sizeof(uint8_t*));
-	if(!pd->rr_data) {
-		free(pd->rr_ttl);
-		free(pd->rr_len);
-		free(pd);
-		free(pkey->rk.dname);
-		free(pkey);
-		return NULL;
-	}
 	/* fill in rrs */
 	i=0;
 	for(tk = ta->keylist; tk; tk = tk->next) {
 		if(tk->type != type)
 			continue;
-		pd->rr_len[i] = tk->len;
-		/* reuse data ptr to allocation in talist */
-		pd->rr_data[i] = tk->data;
-		pd->rr_ttl[i] = 0;
+		packed_rr_len(pd, i) = tk->len;
+		packed_rr_set_ttl(pd, i, 0);
+		i++;
+	}
+	packed_rrset_offs_setup(pd);
+	i=0;
+	for(tk = ta->keylist; tk; tk = tk->next) {
+		if(tk->type != type)
+			continue;
+		memmove(packed_rr_data(pd, i), tk->data, tk->len);
 		i++;
 	}
 	pkey->entry.data = (void*)pd;
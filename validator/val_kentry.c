@@ -42,7 +42,7 @@
 #include "validator/val_kentry.h"
 #include "util/data/packed_rrset.h"
 #include "util/data/dname.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/keyhash.h"
 #include "util/regional.h"
 #include "util/net_help.h"
 #include "ldns/rrdef.h"
@@ -102,7 +102,7 @@ void
 key_entry_hash(struct key_entry_key* kk)
 {
 	kk->entry.hash = 0x654;
-	kk->entry.hash = hashlittle(&kk->key_class, sizeof(kk->key_class), 
+	kk->entry.hash = keyhash(&kk->key_class, sizeof(kk->key_class), 
 		kk->entry.hash);
 	kk->entry.hash = dname_query_hash(kk->name, kk->entry.hash);
 }
@@ -133,7 +133,6 @@ key_entry_copy_toregion(struct key_entry_key* kkey, struct regional* region)
 				packed_rrset_sizeof(d->rrset_data));
 			if(!newd->rrset_data)
 				return NULL;
-			packed_rrset_ptr_fixup(newd->rrset_data);
 		}
 		if(d->reason) {
 			newd->reason = regional_strdup(region, d->reason);
@@ -188,7 +187,6 @@ key_entry_copy(struct key_entry_key* kkey)
 				free(newk);
 				return NULL;
 			}
-			packed_rrset_ptr_fixup(newd->rrset_data);
 		}
 		if(d->reason) {
 			newd->reason = strdup(d->reason);
@@ -316,7 +314,6 @@ key_entry_create_rrset(struct regional* region,
 		if(!d->algo)
 			return NULL;
 	} else d->algo = NULL;
-	packed_rrset_ptr_fixup(d->rrset_data);
 	return k;
 }
 
@@ -362,7 +359,6 @@ key_entry_get_rrset(struct key_entry_key* kkey, struct regional* region)
 	if(!rrd)
 		return NULL;
 	rrk->entry.data = rrd;
-	packed_rrset_ptr_fixup(rrd);
 	return rrk;
 }
 
@@ -373,11 +369,11 @@ dnskey_get_keysize(struct packed_rrset_data* data, size_t idx)
 	unsigned char* pk;
 	unsigned int pklen = 0;
 	int algo;
-	if(data->rr_len[idx] < 2+5)
+	if(packed_rr_len(data, idx) < 2+5)
 		return 0;
-	algo = (int)data->rr_data[idx][2+3];
-	pk = (unsigned char*)data->rr_data[idx]+2+4;
-	pklen = (unsigned)data->rr_len[idx]-2-4;
+	algo = (int)packed_rr_data(data, idx)[2+3];
+	pk = (unsigned char*)packed_rr_data(data, idx)+2+4;
+	pklen = (unsigned)packed_rr_len(data, idx)-2-4;
 	return sldns_rr_dnskey_key_size_raw(pk, pklen, algo);
 }
 
@@ -386,9 +382,9 @@ static uint16_t
 kd_get_flags(struct packed_rrset_data* data, size_t idx)
 {
 	uint16_t f;
-	if(data->rr_len[idx] < 2+2)
+	if(packed_rr_len(data, idx) < 2+2)
 		return 0;
-	memmove(&f, data->rr_data[idx]+2, 2);
+	memmove(&f, packed_rr_data(data, idx)+2, 2);
 	f = ntohs(f);
 	return f;
 }
@@ -681,11 +681,11 @@ static void wipeout(struct val_neg_cache* neg, struct val_neg_zone* zone,
 	struct val_neg_data* cur;
 	uint8_t buf[257];
 	/* get endpoint */
-	if(!d || d->count == 0 || d->rr_len[0] < 2+1)
+	if(!d || d->count == 0 || packed_rr_len(d, 0) < 2+1)
 		return;
 	if(ntohs(nsec->rk.type) == LDNS_RR_TYPE_NSEC) {
-		end = d->rr_data[0]+2;
-		end_len = dname_valid(end, d->rr_len[0]-2);
+		end = packed_rr_data(d, 0)+2;
+		end_len = dname_valid(end, packed_rr_len(d, 0)-2);
 		end_labs = dname_count_labels(end);
 	} else {
 		/* NSEC3 */
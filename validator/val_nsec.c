@@ -99,13 +99,13 @@ nsec_has_type(struct ub_packed_rrset_key* nsec, uint16_t type)
 	struct packed_rrset_data* d = (struct packed_rrset_data*)nsec->
 		entry.data;
 	size_t len;
-	if(!d || d->count == 0 || d->rr_len[0] < 2+1)
+	if(!d || d->count == 0 || packed_rr_len(d, 0) < 2+1)
 		return 0;
-	len = dname_valid(d->rr_data[0]+2, d->rr_len[0]-2);
+	len = dname_valid(packed_rr_data(d, 0)+2, packed_rr_len(d, 0)-2);
 	if(!len)
 		return 0;
-	return nsecbitmap_has_type_rdata(d->rr_data[0]+2+len, 
-		d->rr_len[0]-2-len, type);
+	return nsecbitmap_has_type_rdata(packed_rr_data(d, 0)+2+len, 
+		packed_rr_len(d, 0)-2-len, type);
 }
 
 /**
@@ -121,13 +121,13 @@ nsec_get_next(struct ub_packed_rrset_key* nsec, uint8_t** nm, size_t* ln)
 {
 	struct packed_rrset_data* d = (struct packed_rrset_data*)nsec->
 		entry.data;
-	if(!d || d->count == 0 || d->rr_len[0] < 2+1) {
+	if(!d || d->count == 0 || packed_rr_len(d, 0) < 2+1) {
 		*nm = 0;
 		*ln = 0;
 		return 0;
 	}
-	*nm = d->rr_data[0]+2;
-	*ln = dname_valid(*nm, d->rr_len[0]-2);
+	*nm = packed_rr_data(d, 0)+2;
+	*ln = dname_valid(*nm, packed_rr_len(d, 0)-2);
 	if(!*ln) {
 		*nm = 0;
 		*ln = 0;
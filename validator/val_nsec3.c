@@ -52,6 +52,7 @@
 #include "validator/val_nsec3.h"
 #include "validator/validator.h"
 #include "validator/val_kentry.h"
+#include "validator/val_sha1mb.h"
 #include "services/cache/rrset.h"
 #include "util/regional.h"
 #include "util/rbtree.h"
@@ -130,9 +131,9 @@ nsec3_unknown_flags(struct ub_packed_rrset_key* rrset, int r)
         struct packed_rrset_data* d = (struct packed_rrset_data*)
 	        rrset->entry.data;
 	log_assert(d && r < (int)d->count);
-	if(d->rr_len[r] < 2+2)
+	if(packed_rr_len(d, r) < 2+2)
 		return 0; /* malformed */
-	return (int)(d->rr_data[r][2+1] & NSEC3_UNKNOWN_FLAGS);
+	return (int)(packed_rr_data(d, r)[2+1] & NSEC3_UNKNOWN_FLAGS);
 }
 
 int
@@ -141,9 +142,9 @@ nsec3_has_optout(struct ub_packed_rrset_key* rrset, int r)
         struct packed_rrset_data* d = (struct packed_rrset_data*)
 	        rrset->entry.data;
 	log_assert(d && r < (int)d->count);
-	if(d->rr_len[r] < 2+2)
+	if(packed_rr_len(d, r) < 2+2)
 		return 0; /* malformed */
-	return (int)(d->rr_data[r][2+1] & NSEC3_OPTOUT);
+	return (int)(packed_rr_data(d, r)[2+1] & NSEC3_OPTOUT);
 }
 
 /** return nsec3 RR algorithm */
@@ -153,9 +154,9 @@ nsec3_get_algo(struct ub_packed_rrset_key* rrset, int r)
         struct packed_rrset_data* d = (struct packed_rrset_data*)
 	        rrset->entry.data;
 	log_assert(d && r < (int)d->count);
-	if(d->rr_len[r] < 2+1)
+	if(packed_rr_len(d, r) < 2+1)
 		return 0; /* malformed */
-	return (int)(d->rr_data[r][2+0]);
+	return (int)(packed_rr_data(d, r)[2+0]);
 }
 
 /** return if nsec3 RR has known algorithm */
@@ -165,9 +166,9 @@ nsec3_known_algo(struct ub_packed_rrset_key* rrset, int r)
         struct packed_rrset_data* d = (struct packed_rrset_data*)
 	        rrset->entry.data;
 	log_assert(d && r < (int)d->count);
-	if(d->rr_len[r] < 2+1)
+	if(packed_rr_len(d, r) < 2+1)
 		return 0; /* malformed */
-	switch(d->rr_data[r][2+0]) {
+	switch(packed_rr_data(d, r)[2+0]) {
 		case NSEC3_HASH_SHA1:
 			return 1;
 	}
@@ -182,9 +183,9 @@ nsec3_get_iter(struct ub_packed_rrset_key* rrset, int r)
         struct packed_rrset_data* d = (struct packed_rrset_data*)
 	        rrset->entry.data;
 	log_assert(d && r < (int)d->count);
-	if(d->rr_len[r] < 2+4)
+	if(packed_rr_len(d, r) < 2+4)
 		return 0; /* malformed */
-	memmove(&i, d->rr_data[r]+2+2, sizeof(i));
+	memmove(&i, packed_rr_data(d, r)+2+2, sizeof(i));
 	i = ntohs(i);
 	return (size_t)i;
 }
@@ -197,18 +198,18 @@ nsec3_get_salt(struct ub_packed_rrset_key* rrset, int r,
         struct packed_rrset_data* d = (struct packed_rrset_data*)
 	        rrset->entry.data;
 	log_assert(d && r < (int)d->count);
-	if(d->rr_len[r] < 2+5) {
+	if(packed_rr_len(d, r) < 2+5) {
 		*salt = 0;
 		*saltlen = 0;
 		return 0; /* malformed */
 	}
-	*saltlen = (size_t)d->rr_data[r][2+4];
-	if(d->rr_len[r] < 2+5+(size_t)*saltlen) {
+	*saltlen = (size_t)packed_rr_data(d, r)[2+4];
+	if(packed_rr_len(d, r) < 2+5+(size_t)*saltlen) {
 		*salt = 0;
 		*saltlen = 0;
 		return 0; /* malformed */
 	}
-	*salt = d->rr_data[r]+2+5;
+	*salt = packed_rr_data(d, r)+2+5;
 	return 1;
 }
 
@@ -232,24 +233,24 @@ nsec3_get_nextowner(struct ub_packed_rrset_key* rrset, int r,
         struct packed_rrset_data* d = (struct packed_rrset_data*)
 	        rrset->entry.data;
 	log_assert(d && r < (int)d->count);
-	if(d->rr_len[r] < 2+5) {
+	if(packed_rr_len(d, r) < 2+5) {
 		*next = 0;
 		*nextlen = 0;
 		return 0; /* malformed */
 	}
-	saltlen = (size_t)d->rr_data[r][2+4];
-	if(d->rr_len[r] < 2+5+saltlen+1) {
+	saltlen = (size_t)packed_rr_data(d, r)[2+4];
+	if(packed_rr_len(d, r) < 2+5+saltlen+1) {
 		*next = 0;
 		*nextlen = 0;
 		return 0; /* malformed */
 	}
-	*nextlen = (size_t)d->rr_data[r][2+5+saltlen];
-	if(d->rr_len[r] < 2+5+saltlen+1+*nextlen) {
+	*nextlen = (size_t)packed_rr_data(d, r)[2+5+saltlen];
+	if(packed_rr_len(d, r) < 2+5+saltlen+1+*nextlen) {
 		*next = 0;
 		*nextlen = 0;
 		return 0; /* malformed */
 	}
-	*next = d->rr_data[r]+2+5+saltlen+1;
+	*next = packed_rr_data(d, r)+2+5+saltlen+1;
 	return 1;
 }
 
@@ -295,17 +296,17 @@ nsec3_has_type(struct ub_packed_rrset_key* rrset, int r, uint16_t type)
 	log_assert(d && r < (int)d->count);
 	skiplen = 2+4;
 	/* skip salt */
-	if(d->rr_len[r] < skiplen+1)
+	if(packed_rr_len(d, r) < skiplen+1)
 		return 0; /* malformed, too short */
-	skiplen += 1+(size_t)d->rr_data[r][skiplen]; 
+	skiplen += 1+(size_t)packed_rr_data(d, r)[skiplen]; 
 	/* skip next hashed owner */
-	if(d->rr_len[r] < skiplen+1)
+	if(packed_rr_len(d, r) < skiplen+1)
 		return 0; /* malformed, too short */
-	skiplen += 1+(size_t)d->rr_data[r][skiplen]; 
-	if(d->rr_len[r] < skiplen)
+	skiplen += 1+(size_t)packed_rr_data(d, r)[skiplen]; 
+	if(packed_rr_len(d, r) < skiplen)
 		return 0; /* malformed, too short */
-	bitlen = d->rr_len[r] - skiplen;
-	bitmap = d->rr_data[r]+skiplen;
+	bitlen = packed_rr_len(d, r) - skiplen;
+	bitmap = packed_rr_data(d, r)+skiplen;
 	return nsecbitmap_has_type_rdata(bitmap, bitlen, type);
 }
 	
@@ -539,6 +540,7 @@ nsec3_get_hashed(sldns_buffer* buf, uint8_t* nm, size_t nmlen, int algo,
 	size_t iter, uint8_t* salt, size_t saltlen, uint8_t* res, size_t max)
 {
 	size_t i, hash_len;
+	uint8_t* lc;
 	/* prepare buffer for first iteration */
 	sldns_buffer_clear(buf);
 	sldns_buffer_write(buf, nm, nmlen);
@@ -555,6 +557,10 @@ nsec3_get_hashed(sldns_buffer* buf, uint8_t* nm, size_t nmlen, int algo,
 #endif
 			if(hash_len > max)
 				return 0;
+			lc = sldns_buffer_begin(buf);
+			if(sha1mb_nsec3_hash(1, &lc, &nmlen, salt, saltlen,
+				iter, &res))
+				break;
 #  ifdef HAVE_SSL
 			(void)SHA1((unsigned char*)sldns_buffer_begin(buf),
 				(unsigned long)sldns_buffer_limit(buf),
@@ -655,6 +661,46 @@ nsec3_calc_hash(struct regional* region, sldns_buffer* buf,
 	return 1;
 }
 
+/** perform hash of several names, with the parameters of the first */
+static int
+nsec3_calc_hashes(struct regional* region, sldns_buffer* buf, 
+	struct nsec3_cached_hash** c, size_t num)
+{
+	int algo = nsec3_get_algo(c[0]->nsec3, c[0]->rr);
+	size_t iter = nsec3_get_iter(c[0]->nsec3, c[0]->rr);
+	uint8_t* salt, **names, **res;
+	size_t saltlen, i, *lens;
+	int r;
+	if(algo != NSEC3_HASH_SHA1 || !sha1mb_available()) {
+		/* one by one, with the crypto library */
+		for(i=0; i<num; i++) {
+			if((r=nsec3_calc_hash(region, buf, c[i])) != 1)
+				return r;
+		}
+		return 1;
+	}
+	if(!nsec3_get_salt(c[0]->nsec3, c[0]->rr, &salt, &saltlen))
+		return -1;
+	names = (uint8_t**)regional_alloc(region, sizeof(uint8_t*)*num);
+	res = (uint8_t**)regional_alloc(region, sizeof(uint8_t*)*num);
+	lens = (size_t*)regional_alloc(region, sizeof(size_t)*num);
+	if(!names || !res || !lens)
+		return 0;
+	for(i=0; i<num; i++) {
+		c[i]->hash_len = SHA1MB_DIGEST_LEN;
+		c[i]->hash = (uint8_t*)regional_alloc(region, c[i]->hash_len);
+		names[i] = regional_alloc_init(region, c[i]->dname,
+			c[i]->dname_len);
+		if(!c[i]->hash || !names[i])
+			return 0;
+		query_dname_tolower(names[i]);
+		lens[i] = c[i]->dname_len;
+		res[i] = c[i]->hash;
+	}
+	(void)sha1mb_nsec3_hash(num, names, lens, salt, saltlen, iter, res);
+	return 1;
+}
+
 /** perform b32 encoding of hash */
 static int
 nsec3_calc_b32(struct regional* region, sldns_buffer* buf, 
@@ -706,7 +752,7 @@ nsec3_hash_name(rbtree_t* table, struct regional* region, sldns_buffer* buf,
 	c->rr = rr;
 	c->dname = dname;
 	c->dname_len = dname_len;
-	r = nsec3_calc_hash(region, buf, c);
+	r = nsec3_calc_hashes(region, buf, &c, 1);
 	if(r != 1)
 		return r;
 	r = nsec3_calc_b32(region, buf, c);
@@ -723,6 +769,54 @@ nsec3_hash_name(rbtree_t* table, struct regional* region, sldns_buffer* buf,
 	return 1;
 }
 
+int
+nsec3_hash_names(rbtree_t* table, struct regional* region, sldns_buffer* buf,
+	struct ub_packed_rrset_key* nsec3, int rr, size_t num,
+	uint8_t** dnames, size_t* dname_lens)
+{
+	struct nsec3_cached_hash** todo;
+	struct nsec3_cached_hash* c;
+	struct nsec3_cached_hash looki;
+	size_t i, n = 0;
+	int r = 1;
+	todo = (struct nsec3_cached_hash**)regional_alloc(region,
+		sizeof(*todo)*num);
+	if(!todo) return 0;
+	looki.node.key = &looki;
+	looki.nsec3 = nsec3;
+	looki.rr = rr;
+	for(i=0; i<num; i++) {
+		looki.dname = dnames[i];
+		looki.dname_len = dname_lens[i];
+		if(rbtree_search(table, &looki))
+			continue;
+		c = (struct nsec3_cached_hash*)regional_alloc(region,
+			sizeof(*c));
+		if(!c) {
+			r = 0;
+			break;
+		}
+		c->node.key = c;
+		c->nsec3 = nsec3;
+		c->rr = rr;
+		c->dname = dnames[i];
+		c->dname_len = dname_lens[i];
+		/* insert now, so that a name that is listed twice is hashed
+		 * once; on failure the entries are removed again */
+		(void)rbtree_insert(table, &c->node);
+		todo[n++] = c;
+	}
+	if(r == 1 && n > 0)
+		r = nsec3_calc_hashes(region, buf, todo, n);
+	for(i=0; r == 1 && i<n; i++)
+		r = nsec3_calc_b32(region, buf, todo[i]);
+	if(r != 1) {
+		for(i=0; i<n; i++)
+			(void)rbtree_delete(table, todo[i]);
+	}
+	return r;
+}
+
 /**
  * compare a label lowercased
  */
@@ -909,6 +1003,48 @@ find_covering_nsec3(struct module_env* env, struct nsec3_filter* flt,
 	return 0;
 }
 
+/**
+ * Hash a name and its parents up to the zone in one go, with the
+ * parameters of the first NSEC3 in the filter, so the names are hashed
+ * side by side.  The NSEC3s of a zone normally share their parameters,
+ * so the closest encloser search then finds the hashes in the cache.
+ * The parents above the closest encloser are hashed in vain, but that
+ * is usually the zone apex.  Without side by side SHA1, the search
+ * hashes the names it needs itself.
+ * @param env: module environment with temporary region and buffer.
+ * @param flt: the NSEC3 RR filter, contains zone name and RRs.
+ * @param ct: cached hashes table.
+ * @param nm: name to hash, with its parents.
+ * @param nmlen: length of name.
+ */
+static void
+nsec3_hash_parents(struct module_env* env, struct nsec3_filter* flt,
+	rbtree_t* ct, uint8_t* nm, size_t nmlen)
+{
+	uint8_t* names[LDNS_MAX_DOMAINLEN/2+1];
+	size_t lens[LDNS_MAX_DOMAINLEN/2+1];
+	size_t num = 0, i_rs;
+	int i_rr;
+	struct ub_packed_rrset_key* s;
+	if(!sha1mb_available())
+		return;
+	s = filter_first(flt, &i_rs, &i_rr);
+	if(!s || nsec3_get_algo(s, i_rr) != NSEC3_HASH_SHA1)
+		return;
+	while(num < sizeof(lens)/sizeof(lens[0]) &&
+		dname_subdomain_c(nm, flt->zone)) {
+		names[num] = nm;
+		lens[num++] = nmlen;
+		if(dname_is_root(nm))
+			break;
+		dname_remove_label(&nm, &nmlen);
+	}
+	/* on failure, the search hashes the names one by one */
+	if(num > 1)
+		(void)nsec3_hash_names(ct, env->scratch, env->scratch_buffer,
+			s, i_rr, num, names, lens);
+}
+
 /**
  * findClosestEncloser
  * Given a name and a list of NSEC3s, find the candidate closest encloser.
@@ -928,6 +1064,9 @@ nsec3_find_closest_encloser(struct module_env* env, struct nsec3_filter* flt,
 	uint8_t* nm = qinfo->qname;
 	size_t nmlen = qinfo->qname_len;
 
+	/* hash the candidates in one go, the loop finds them in the cache */
+	nsec3_hash_parents(env, flt, ct, nm, nmlen);
+
 	/* This scans from longest name to shortest, so the first match 
 	 * we find is the only viable candidate. */
 
@@ -275,6 +275,29 @@ int nsec3_hash_name(rbtree_t* table, struct regional* region,
 	struct sldns_buffer* buf, struct ub_packed_rrset_key* nsec3, int rr,
 	uint8_t* dname, size_t dname_len, struct nsec3_cached_hash** hash);
 
+/**
+ * Obtain the hashes of several owner names, with the same NSEC3
+ * parameters.  The hashes are stored in the cache, names that are in
+ * the cache already are skipped.  Where the CPU supports it the names
+ * are hashed side by side, that is faster than one by one.
+ *
+ * @param table: the cache table. Must be inited at start.
+ * @param region: scratch region to use for allocation.
+ * @param buf: temporary buffer.
+ * @param nsec3: the rrset with parameters
+ * @param rr: rr number from d that has the NSEC3 parameters to hash to.
+ * @param num: number of names.
+ * @param dnames: names to hash, the pointers are used inside the tree.
+ * @param dname_lens: the lengths of the names.
+ * @return:
+ * 	1 on success, the names are in the cache.
+ * 	0 on a malloc failure.
+ * 	-1 if the NSEC3 rr was badly formatted (i.e. formerr).
+ */
+int nsec3_hash_names(rbtree_t* table, struct regional* region,
+	struct sldns_buffer* buf, struct ub_packed_rrset_key* nsec3, int rr,
+	size_t num, uint8_t** dnames, size_t* dname_lens);
+
 /**
  * Get next owner name, converted to base32 encoding and with the
  * zone name (taken from the nsec3 owner name) appended.
@@ -0,0 +1,346 @@
+/*
+ * validator/val_sha1mb.c - multi-buffer SHA-1 for NSEC3 hashes.
+ *
+ * Copyright (c) 2014, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the SHA-1 for the NSEC3 hash iterations, with the
+ * x86 SHA instructions.  The iterations of a hash depend on each other,
+ * but the hashes of different names do not, and they are iterated side
+ * by side.
+ */
+#include "config.h"
+#include "validator/val_sha1mb.h"
+#ifdef USE_SHA_NI
+#include <immintrin.h>
+#include <cpuid.h>
+
+/** compile for the SHA instructions, they are used after a cpuid check */
+#define SHA1MB_TARGET __attribute__((target("sha,sse4.1,ssse3")))
+
+/** largest salt for which hash|salt fits in one block with padding */
+#define SHA1MB_MAX_ONEBLOCK_SALT (64 - 9 - SHA1MB_DIGEST_LEN)
+
+/**
+ * SHA-1 state of one hash, in the register layout of the SHA
+ * instructions.  The words are in reverse order, a is in the top lane.
+ */
+struct sha1mb_lane {
+	/** state words a, b, c, d */
+	__m128i abcd;
+	/** state word e, in the top lane, the other lanes are zero */
+	__m128i e;
+	/** the message block, 16 words, in the same order */
+	__m128i m[4];
+	/** working value of e, in even and odd round groups */
+	__m128i e0, e1;
+};
+
+/**
+ * Four rounds, round group k (0..19), of a SHA-1 block, and the message
+ * schedule for the later groups.  k is a constant, so that the
+ * conditions fold away and the round function is an immediate.
+ */
+#define SHA1MB_ROUNDS(l, k) do { \
+	if((k) == 0) \
+		(l).e0 = _mm_add_epi32((l).e0, (l).m[0]); \
+	else if((k)%2 == 0) \
+		(l).e0 = _mm_sha1nexte_epu32((l).e0, (l).m[(k)%4]); \
+	else	(l).e1 = _mm_sha1nexte_epu32((l).e1, (l).m[(k)%4]); \
+	if((k)%2 == 0) \
+		(l).e1 = (l).abcd; \
+	else	(l).e0 = (l).abcd; \
+	if((k) >= 3 && (k) <= 18) \
+		(l).m[((k)+1)%4] = _mm_sha1msg2_epu32((l).m[((k)+1)%4], \
+			(l).m[(k)%4]); \
+	(l).abcd = _mm_sha1rnds4_epu32((l).abcd, \
+		((k)%2 == 0)?(l).e0:(l).e1, (k)/5); \
+	if((k) >= 1 && (k) <= 16) \
+		(l).m[((k)+3)%4] = _mm_sha1msg1_epu32((l).m[((k)+3)%4], \
+			(l).m[(k)%4]); \
+	if((k) >= 2 && (k) <= 17) \
+		(l).m[((k)+2)%4] = _mm_xor_si128((l).m[((k)+2)%4], \
+			(l).m[(k)%4]); \
+	} while(0)
+
+/** the 80 rounds, R(k) is called for every round group */
+#define SHA1MB_ALL_ROUNDS(R) do { \
+	R(0); R(1); R(2); R(3); R(4); R(5); R(6); R(7); R(8); R(9); \
+	R(10); R(11); R(12); R(13); R(14); R(15); R(16); R(17); R(18); \
+	R(19); } while(0)
+
+/** round group for one lane */
+#define SHA1MB_R1(k) SHA1MB_ROUNDS(a, k)
+/** round group for two lanes, interleaved */
+#define SHA1MB_R2(k) do { SHA1MB_ROUNDS(a, k); SHA1MB_ROUNDS(b, k); \
+	} while(0)
+
+/** byte order of a message block to the SHA instruction layout */
+#define SHA1MB_BSWAP _mm_set_epi64x(0x0001020304050607ULL, \
+	0x08090a0b0c0d0e0fULL)
+
+/** SHA-1 initial state a, b, c, d */
+#define SHA1MB_IV_ABCD _mm_set_epi32(0x67452301, 0xefcdab89, 0x98badcfe, \
+	0x10325476)
+/** SHA-1 initial state e */
+#define SHA1MB_IV_E _mm_set_epi32(0xc3d2e1f0, 0, 0, 0)
+
+/** process a block for one lane, the state is added to */
+static SHA1MB_TARGET void
+sha1mb_block1(struct sha1mb_lane* p)
+{
+	struct sha1mb_lane a = *p;
+	a.e0 = a.e;
+	SHA1MB_ALL_ROUNDS(SHA1MB_R1);
+	p->e = _mm_sha1nexte_epu32(a.e0, p->e);
+	p->abcd = _mm_add_epi32(a.abcd, p->abcd);
+}
+
+/** process a block for two lanes side by side, the states are added to */
+static SHA1MB_TARGET void
+sha1mb_block2(struct sha1mb_lane* p, struct sha1mb_lane* q)
+{
+	struct sha1mb_lane a = *p, b = *q;
+	a.e0 = a.e;
+	b.e0 = b.e;
+	SHA1MB_ALL_ROUNDS(SHA1MB_R2);
+	p->e = _mm_sha1nexte_epu32(a.e0, p->e);
+	p->abcd = _mm_add_epi32(a.abcd, p->abcd);
+	q->e = _mm_sha1nexte_epu32(b.e0, q->e);
+	q->abcd = _mm_add_epi32(b.abcd, q->abcd);
+}
+
+/** load a 64 byte message block into the lane */
+static SHA1MB_TARGET void
+sha1mb_load(struct sha1mb_lane* l, uint8_t* blk)
+{
+	const __m128i bswap = SHA1MB_BSWAP;
+	int i;
+	for(i=0; i<4; i++)
+		l->m[i] = _mm_shuffle_epi8(_mm_loadu_si128(
+			(__m128i*)(blk+16*i)), bswap);
+}
+
+/** store the digest of the lane */
+static SHA1MB_TARGET void
+sha1mb_store(struct sha1mb_lane* l, uint8_t* res)
+{
+	uint32_t e = (uint32_t)_mm_extract_epi32(l->e, 3);
+	_mm_storeu_si128((__m128i*)res, _mm_shuffle_epi8(l->abcd,
+		SHA1MB_BSWAP));
+	res[16] = (uint8_t)(e>>24);
+	res[17] = (uint8_t)(e>>16);
+	res[18] = (uint8_t)(e>>8);
+	res[19] = (uint8_t)e;
+}
+
+/** SHA-1 of the concatenation of a and b, for one lane */
+static SHA1MB_TARGET void
+sha1mb_hash(uint8_t* a, size_t alen, uint8_t* b, size_t blen, uint8_t* res)
+{
+	struct sha1mb_lane l;
+	uint8_t blk[64];
+	uint64_t bits = ((uint64_t)alen + (uint64_t)blen)*8;
+	size_t pos = 0, n;
+	int i;
+	l.abcd = SHA1MB_IV_ABCD;
+	l.e = SHA1MB_IV_E;
+	/* full blocks */
+	while(alen + blen > 0) {
+		n = (alen < 64-pos)?alen:64-pos;
+		memcpy(blk+pos, a, n);
+		a += n; alen -= n; pos += n;
+		n = (blen < 64-pos)?blen:64-pos;
+		memcpy(blk+pos, b, n);
+		b += n; blen -= n; pos += n;
+		if(pos < 64)
+			break;
+		sha1mb_load(&l, blk);
+		sha1mb_block1(&l);
+		pos = 0;
+	}
+	/* padding and the length in bits */
+	blk[pos++] = 0x80;
+	if(pos > 56) {
+		memset(blk+pos, 0, 64-pos);
+		sha1mb_load(&l, blk);
+		sha1mb_block1(&l);
+		pos = 0;
+	}
+	memset(blk+pos, 0, 56-pos);
+	for(i=0; i<8; i++)
+		blk[56+i] = (uint8_t)(bits>>(56-8*i));
+	sha1mb_load(&l, blk);
+	sha1mb_block1(&l);
+	sha1mb_store(&l, res);
+}
+
+/** load a digest in a lane, for the iterations */
+static SHA1MB_TARGET void
+sha1mb_start(struct sha1mb_lane* l, uint8_t* digest)
+{
+	uint8_t blk[64];
+	memset(blk, 0, sizeof(blk));
+	memcpy(blk, digest, SHA1MB_DIGEST_LEN);
+	sha1mb_load(l, blk);
+	l->abcd = l->m[0];
+	l->e = _mm_andnot_si128(_mm_set_epi32(0, -1, -1, -1), l->m[1]);
+}
+
+/** set up the next iteration of a lane: the digest, with the salt and
+ * padding of the template */
+static SHA1MB_TARGET void
+sha1mb_next(struct sha1mb_lane* l, struct sha1mb_lane* tmpl)
+{
+	l->m[0] = l->abcd;
+	l->m[1] = _mm_or_si128(l->e, tmpl->m[1]);
+	l->m[2] = tmpl->m[2];
+	l->m[3] = tmpl->m[3];
+	l->abcd = SHA1MB_IV_ABCD;
+	l->e = SHA1MB_IV_E;
+}
+
+/**
+ * Iterate hash = SHA1(hash | salt) for one or two hashes, where
+ * hash|salt fits in one block.  Only the digest and the e word change
+ * between iterations; the salt and padding words are loaded once, and
+ * the digest goes from the state to the message without byte swaps.
+ */
+static SHA1MB_TARGET void
+sha1mb_iterate(uint8_t** res, size_t num, uint8_t* salt, size_t saltlen,
+	size_t iter)
+{
+	struct sha1mb_lane a, b, tmpl;
+	uint8_t blk[64];
+	size_t i;
+	memset(blk, 0, sizeof(blk));
+	memcpy(blk+SHA1MB_DIGEST_LEN, salt, saltlen);
+	blk[SHA1MB_DIGEST_LEN+saltlen] = 0x80;
+	blk[62] = (uint8_t)(((SHA1MB_DIGEST_LEN+saltlen)*8)>>8);
+	blk[63] = (uint8_t)((SHA1MB_DIGEST_LEN+saltlen)*8);
+	sha1mb_load(&tmpl, blk);
+	/* the top lane of m[1] is the e word of the digest */
+	tmpl.m[1] = _mm_and_si128(tmpl.m[1], _mm_set_epi32(0, -1, -1, -1));
+
+	sha1mb_start(&a, res[0]);
+	if(num == 1) {
+		for(i=0; i<iter; i++) {
+			sha1mb_next(&a, &tmpl);
+			sha1mb_block1(&a);
+		}
+		sha1mb_store(&a, res[0]);
+		return;
+	}
+	sha1mb_start(&b, res[1]);
+	for(i=0; i<iter; i++) {
+		sha1mb_next(&a, &tmpl);
+		sha1mb_next(&b, &tmpl);
+		sha1mb_block2(&a, &b);
+	}
+	sha1mb_store(&a, res[0]);
+	sha1mb_store(&b, res[1]);
+}
+
+/** cpuid leaf 1 ecx bits for SSSE3 and SSE4.1 */
+#define SHA1MB_CPUID_SSSE3 (1<<9)
+#define SHA1MB_CPUID_SSE41 (1<<19)
+/** cpuid leaf 7 ebx bit for the SHA extensions */
+#define SHA1MB_CPUID_SHA (1<<29)
+
+int
+sha1mb_available(void)
+{
+	/* -1 until checked, the check has the same result in every thread */
+	static int avail = -1;
+	unsigned int a, b, c, d;
+	if(avail != -1)
+		return avail;
+	if(__get_cpuid_max(0, 0) < 7) {
+		avail = 0;
+		return avail;
+	}
+	__cpuid(1, a, b, c, d);
+	if(!(c&SHA1MB_CPUID_SSSE3) || !(c&SHA1MB_CPUID_SSE41)) {
+		avail = 0;
+		return avail;
+	}
+	__cpuid_count(7, 0, a, b, c, d);
+	avail = (b&SHA1MB_CPUID_SHA)?1:0;
+	return avail;
+}
+
+int
+sha1mb_nsec3_hash(size_t num, uint8_t** names, size_t* lens,
+	uint8_t* salt, size_t saltlen, size_t iter, uint8_t** res)
+{
+	size_t i, j;
+	if(!sha1mb_available())
+		return 0;
+	for(i=0; i<num; i+=SHA1MB_LANES) {
+		size_t n = (num-i < SHA1MB_LANES)?num-i:SHA1MB_LANES;
+		for(j=i; j<i+n; j++)
+			sha1mb_hash(names[j], lens[j], salt, saltlen, res[j]);
+		if(saltlen <= SHA1MB_MAX_ONEBLOCK_SALT) {
+			sha1mb_iterate(res+i, n, salt, saltlen, iter);
+			continue;
+		}
+		/* long salts take two blocks, iterate one by one */
+		for(j=i; j<i+n; j++) {
+			size_t k;
+			for(k=0; k<iter; k++)
+				sha1mb_hash(res[j], SHA1MB_DIGEST_LEN, salt,
+					saltlen, res[j]);
+		}
+	}
+	return 1;
+}
+
+#else /* USE_SHA_NI */
+
+int
+sha1mb_available(void)
+{
+	return 0;
+}
+
+int
+sha1mb_nsec3_hash(size_t ATTR_UNUSED(num), uint8_t** ATTR_UNUSED(names),
+	size_t* ATTR_UNUSED(lens), uint8_t* ATTR_UNUSED(salt),
+	size_t ATTR_UNUSED(saltlen), size_t ATTR_UNUSED(iter),
+	uint8_t** ATTR_UNUSED(res))
+{
+	return 0;
+}
+#endif /* USE_SHA_NI */
@@ -0,0 +1,76 @@
+/*
+ * validator/val_sha1mb.h - multi-buffer SHA-1 for NSEC3 hashes.
+ *
+ * Copyright (c) 2014, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the SHA-1 for the NSEC3 hash iterations.  It uses
+ * the x86 SHA instructions, and computes several hashes side by side so
+ * that the rounds of one hash fill the wait for the rounds of the other.
+ * Without CPU support the caller uses the crypto library instead.
+ */
+
+#ifndef VALIDATOR_VAL_SHA1MB_H
+#define VALIDATOR_VAL_SHA1MB_H
+
+/** length of a SHA-1 digest */
+#define SHA1MB_DIGEST_LEN 20
+/** number of hashes computed side by side */
+#define SHA1MB_LANES 2
+
+/**
+ * See if the multi-buffer SHA-1 can be used; if it is compiled in and
+ * the CPU has the SHA instructions.
+ * @return true if it can be used.
+ */
+int sha1mb_available(void);
+
+/**
+ * Compute the NSEC3 hash of several names, with the same salt and
+ * iterations: hash = SHA1(name | salt), and then iter times
+ * hash = SHA1(hash | salt).
+ * @param num: number of names.
+ * @param names: the names, already lowercased.
+ * @param lens: length of the names.
+ * @param salt: the salt.
+ * @param saltlen: length of the salt.
+ * @param iter: number of iterations after the first hash.
+ * @param res: per name a result of SHA1MB_DIGEST_LEN bytes.
+ * @return false if not available, nothing is computed.
+ */
+int sha1mb_nsec3_hash(size_t num, uint8_t** names, size_t* lens,
+	uint8_t* salt, size_t saltlen, size_t iter, uint8_t** res);
+
+#endif /* VALIDATOR_VAL_SHA1MB_H */
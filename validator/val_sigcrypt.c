@@ -109,9 +109,9 @@ rrset_get_sig_keytag(struct ub_packed_rrset_key* k, size_t sig_idx)
 	uint16_t t;
 	struct packed_rrset_data* d = (struct packed_rrset_data*)k->entry.data;
 	log_assert(sig_idx < d->rrsig_count);
-	if(d->rr_len[d->count + sig_idx] < 2+18)
+	if(packed_rr_len(d, d->count + sig_idx) < 2+18)
 		return 0;
-	memmove(&t, d->rr_data[d->count + sig_idx]+2+16, 2);
+	memmove(&t, packed_rr_data(d, d->count + sig_idx)+2+16, 2);
 	return ntohs(t);
 }
 
@@ -126,9 +126,9 @@ rrset_get_sig_algo(struct ub_packed_rrset_key* k, size_t sig_idx)
 {
 	struct packed_rrset_data* d = (struct packed_rrset_data*)k->entry.data;
 	log_assert(sig_idx < d->rrsig_count);
-	if(d->rr_len[d->count + sig_idx] < 2+3)
+	if(packed_rr_len(d, d->count + sig_idx) < 2+3)
 		return 0;
-	return (int)d->rr_data[d->count + sig_idx][2+2];
+	return (int)packed_rr_data(d, d->count + sig_idx)[2+2];
 }
 
 /** get rdata pointer and size */
@@ -138,8 +138,8 @@ rrset_get_rdata(struct ub_packed_rrset_key* k, size_t idx, uint8_t** rdata,
 {
 	struct packed_rrset_data* d = (struct packed_rrset_data*)k->entry.data;
 	log_assert(d && idx < (d->count + d->rrsig_count));
-	*rdata = d->rr_data[idx];
-	*len = d->rr_len[idx];
+	*rdata = packed_rr_data(d, idx);
+	*len = packed_rr_len(d, idx);
 }
 
 uint16_t
@@ -483,7 +483,7 @@ dnskeyset_verify_rrset(struct module_env* env, struct val_env* ve,
 {
 	enum sec_status sec;
 	size_t i, num;
-	rbtree_t* sortree = NULL;
+	struct canon_order* sorted = NULL;
 	/* make sure that for all DNSKEY algorithms there are valid sigs */
 	struct algo_needs needs;
 	int alg;
@@ -506,7 +506,7 @@ dnskeyset_verify_rrset(struct module_env* env, struct val_env* ve,
 	}
 	for(i=0; i<num; i++) {
 		sec = dnskeyset_verify_rrset_sig(env, ve, *env->now, rrset, 
-			dnskey, i, &sortree, reason);
+			dnskey, i, &sorted, reason);
 		/* see which algorithm has been fixed up */
 		if(sec == sec_status_secure) {
 			if(!sigalg)
@@ -551,7 +551,7 @@ dnskey_verify_rrset(struct module_env* env, struct val_env* ve,
 {
 	enum sec_status sec;
 	size_t i, num, numchecked = 0;
-	rbtree_t* sortree = NULL;
+	struct canon_order* sorted = NULL;
 	int buf_canon = 0;
 	uint16_t tag = dnskey_calc_keytag(dnskey, dnskey_idx);
 	int algo = dnskey_get_algo(dnskey, dnskey_idx);
@@ -571,7 +571,7 @@ dnskey_verify_rrset(struct module_env* env, struct val_env* ve,
 		buf_canon = 0;
 		sec = dnskey_verify_rrset_sig(env->scratch, 
 			env->scratch_buffer, ve, *env->now, rrset, 
-			dnskey, dnskey_idx, i, &sortree, &buf_canon, reason);
+			dnskey, dnskey_idx, i, &sorted, &buf_canon, reason);
 		if(sec == sec_status_secure)
 			return sec;
 		numchecked ++;
@@ -585,7 +585,7 @@ enum sec_status
 dnskeyset_verify_rrset_sig(struct module_env* env, struct val_env* ve, 
 	time_t now, struct ub_packed_rrset_key* rrset, 
 	struct ub_packed_rrset_key* dnskey, size_t sig_idx, 
-	struct rbtree_t** sortree, char** reason)
+	struct canon_order** sorted, char** reason)
 {
 	/* find matching keys and check them */
 	enum sec_status sec = sec_status_bogus;
@@ -610,7 +610,7 @@ dnskeyset_verify_rrset_sig(struct module_env* env, struct val_env* ve,
 		/* see if key verifies */
 		sec = dnskey_verify_rrset_sig(env->scratch, 
 			env->scratch_buffer, ve, now, rrset, dnskey, i, 
-			sig_idx, sortree, &buf_canon, reason);
+			sig_idx, sorted, &buf_canon, reason);
 		if(sec == sec_status_secure)
 			return sec;
 	}
@@ -636,15 +636,16 @@ struct canon_rr {
 
 /**
  * Compare two RR for canonical order, in a field-style sweep.
- * @param d: rrset data
+ * @param rdi: rdata of the first RR, with the rdlength.
+ * @param leni: length of rdi.
+ * @param rdj: rdata of the second RR, with the rdlength.
+ * @param lenj: length of rdj.
  * @param desc: ldns wireformat descriptor.
- * @param i: first RR to compare
- * @param j: first RR to compare
  * @return comparison code.
  */
 static int
-canonical_compare_byfield(struct packed_rrset_data* d, 
-	const sldns_rr_descriptor* desc, size_t i, size_t j)
+canonical_compare_byfield(uint8_t* rdi, size_t leni, uint8_t* rdj,
+	size_t lenj, const sldns_rr_descriptor* desc)
 {
 	/* sweep across rdata, keep track of some state:
 	 * 	which rr field, and bytes left in field.
@@ -653,10 +654,10 @@ canonical_compare_byfield(struct packed_rrset_data* d,
 	 */
 	int wfi = -1;	/* current wireformat rdata field (rdf) */
 	int wfj = -1;
-	uint8_t* di = d->rr_data[i]+2; /* ptr to current rdata byte */
-	uint8_t* dj = d->rr_data[j]+2;
-	size_t ilen = d->rr_len[i]-2; /* length left in rdata */
-	size_t jlen = d->rr_len[j]-2;
+	uint8_t* di = rdi+2; /* ptr to current rdata byte */
+	uint8_t* dj = rdj+2;
+	size_t ilen = leni-2; /* length left in rdata */
+	size_t jlen = lenj-2;
 	int dname_i = 0;  /* true if these bytes are part of a name */
 	int dname_j = 0;
 	size_t lablen_i = 0; /* 0 for label length byte,for first byte of rdf*/
@@ -776,27 +777,25 @@ canonical_compare_byfield(struct packed_rrset_data* d,
 }
 
 /**
- * Compare two RRs in the same RRset and determine their relative
- * canonical order.
- * @param rrset: the rrset in which to perform compares.
- * @param i: first RR to compare
- * @param j: first RR to compare
+ * Compare the rdata of two RRs of the same type and determine their
+ * relative canonical order.
+ * @param type: the RR type, host order.
+ * @param rdi: rdata of the first RR, with the rdlength.
+ * @param leni: length of rdi.
+ * @param rdj: rdata of the second RR, with the rdlength.
+ * @param lenj: length of rdj.
  * @return 0 if RR i== RR j, -1 if <, +1 if >.
  */
 static int
-canonical_compare(struct ub_packed_rrset_key* rrset, size_t i, size_t j)
+canonical_compare_rdata(uint16_t type, uint8_t* rdi, size_t leni,
+	uint8_t* rdj, size_t lenj)
 {
-	struct packed_rrset_data* d = (struct packed_rrset_data*)
-		rrset->entry.data;
 	const sldns_rr_descriptor* desc;
-	uint16_t type = ntohs(rrset->rk.type);
 	size_t minlen;
 	int c;
 
-	if(i==j)
-		return 0;
 	/* in case rdata-len is to be compared for canonical order
-	c = memcmp(d->rr_data[i], d->rr_data[j], 2);
+	c = memcmp(rdi, rdj, 2);
 	if(c != 0)
 		return c; */
 
@@ -814,11 +813,10 @@ canonical_compare(struct ub_packed_rrset_key* rrset, size_t i, size_t j)
 		case LDNS_RR_TYPE_DNAME:
 			/* the wireread function has already checked these
 			 * dname's for correctness, and this double checks */
-			if(!dname_valid(d->rr_data[i]+2, d->rr_len[i]-2) ||
-				!dname_valid(d->rr_data[j]+2, d->rr_len[j]-2))
+			if(!dname_valid(rdi+2, leni-2) ||
+				!dname_valid(rdj+2, lenj-2))
 				return 0;
-			return query_dname_compare(d->rr_data[i]+2,
-				d->rr_data[j]+2);
+			return query_dname_compare(rdi+2, rdj+2);
 
 		/* These RR types have STR and fixed size rdata fields
 		 * before one or more name fields that need canonicalizing,
@@ -844,7 +842,8 @@ canonical_compare(struct ub_packed_rrset_key* rrset, size_t i, size_t j)
 			log_assert(desc);
 			/* this holds for the types that need canonicalizing */
 			log_assert(desc->_minimum == desc->_maximum);
-			return canonical_compare_byfield(d, desc, i, j);
+			return canonical_compare_byfield(rdi, leni, rdj, lenj,
+				desc);
 
 		case LDNS_RR_TYPE_HINFO: /* no longer downcased */
 		case LDNS_RR_TYPE_NSEC: 
@@ -852,16 +851,16 @@ canonical_compare(struct ub_packed_rrset_key* rrset, size_t i, size_t j)
 		/* For unknown RR types, or types not listed above,
 		 * no canonicalization is needed, do binary compare */
 		/* byte for byte compare, equal means shortest first*/
-		minlen = d->rr_len[i]-2;
-		if(minlen > d->rr_len[j]-2)
-			minlen = d->rr_len[j]-2;
-		c = memcmp(d->rr_data[i]+2, d->rr_data[j]+2, minlen);
+		minlen = leni-2;
+		if(minlen > lenj-2)
+			minlen = lenj-2;
+		c = memcmp(rdi+2, rdj+2, minlen);
 		if(c!=0)
 			return c;
 		/* rdata equal, shortest is first */
-		if(d->rr_len[i] < d->rr_len[j])
+		if(leni < lenj)
 			return -1;
-		if(d->rr_len[i] > d->rr_len[j])
+		if(leni > lenj)
 			return 1;
 		/* rdata equal, length equal */
 		break;
@@ -869,6 +868,26 @@ canonical_compare(struct ub_packed_rrset_key* rrset, size_t i, size_t j)
 	return 0;
 }
 
+/**
+ * Compare two RRs in the same RRset and determine their relative
+ * canonical order.
+ * @param rrset: the rrset in which to perform compares.
+ * @param i: first RR to compare
+ * @param j: first RR to compare
+ * @return 0 if RR i== RR j, -1 if <, +1 if >.
+ */
+static int
+canonical_compare(struct ub_packed_rrset_key* rrset, size_t i, size_t j)
+{
+	struct packed_rrset_data* d = (struct packed_rrset_data*)
+		rrset->entry.data;
+	if(i==j)
+		return 0;
+	return canonical_compare_rdata(ntohs(rrset->rk.type),
+		packed_rr_data(d, i), packed_rr_len(d, i),
+		packed_rr_data(d, j), packed_rr_len(d, j));
+}
+
 int
 canonical_tree_compare(const void* k1, const void* k2)
 {
@@ -903,6 +922,296 @@ canonical_sort(struct ub_packed_rrset_key* rrset, struct packed_rrset_data* d,
 	}
 }
 
+struct canon_order*
+canonical_order_tree(struct regional* region, struct ub_packed_rrset_key* k)
+{
+	struct packed_rrset_data* d = (struct packed_rrset_data*)k->entry.data;
+	struct canon_order* sorted;
+	struct canon_rr* rrs, *walk;
+	rbtree_t sortree;
+	sorted = (struct canon_order*)regional_alloc(region, sizeof(*sorted));
+	rrs = regional_alloc(region, sizeof(struct canon_rr)*d->count);
+	if(!sorted || !rrs)
+		return NULL;
+	sorted->idx = (size_t*)regional_alloc(region, sizeof(size_t)*d->count);
+	if(!sorted->idx)
+		return NULL;
+	rbtree_init(&sortree, &canonical_tree_compare);
+	canonical_sort(k, d, &sortree, rrs);
+	sorted->count = 0;
+	RBTREE_FOR(walk, struct canon_rr*, &sortree) {
+		sorted->idx[sorted->count++] = walk->rr_idx;
+	}
+	return sorted;
+}
+
+/**
+ * Sort key of an RR for the canonical radix sort
+ */
+struct canon_key {
+	/** the rdata (without rdatalength), lowercased where canonical
+	 * compare lowercases it; points into the rrset when unchanged */
+	uint8_t* key;
+	/** length of the key */
+	size_t len;
+	/** which RR in the rrset */
+	size_t rr_idx;
+};
+
+/**
+ * Range of keys with a common prefix, still to be sorted by the
+ * radix sort.
+ */
+struct canon_range {
+	/** start of the range in the key array */
+	size_t start;
+	/** number of keys in the range */
+	size_t num;
+	/** length of the prefix the keys have in common */
+	size_t depth;
+};
+
+/** ranges with this many keys or less are insertion sorted */
+#define CANON_INSERTION_SORT 16
+
+/**
+ * Lowercase the rdata in the same field-style sweep as
+ * canonical_compare_byfield does, so that keys compare the same.
+ * @param desc: ldns wireformat descriptor.
+ * @param d: rdata to lowercase in place.
+ * @param len: length of the rdata.
+ */
+static void
+canonical_lowercase_byfield(const sldns_rr_descriptor* desc, uint8_t* d,
+	size_t len)
+{
+	int wf = -1;	/* current wireformat rdata field */
+	int dname = 0;	/* true if these bytes are part of a name */
+	size_t lablen = 0; /* 0 for label length byte, first byte of rdf */
+	int dname_num = (int)desc->_dname_count; /* decreased at root label */
+
+	while(len > 0 && dname_num > 0) {
+		if(dname && lablen)
+			*d = (uint8_t)tolower((int)*d);
+		len--;
+		if(lablen == 0) {
+			if(dname) {
+				lablen = (size_t)*d;
+				if(lablen == 0) {
+					dname = 0;
+					dname_num--;
+				}
+			} else {
+				if(++wf >= (int)desc->_maximum)
+					return;
+				if(desc->_wireformat[wf] 
+					== LDNS_RDF_TYPE_DNAME) {
+					dname = 1; 
+					lablen = (size_t)*d;
+					if(lablen == 0) {
+						dname = 0;
+						dname_num--;
+					}
+				} else if(desc->_wireformat[wf] 
+					== LDNS_RDF_TYPE_STR)
+					lablen = (size_t)*d;
+				else	lablen = get_rdf_size(
+					desc->_wireformat[wf]) - 1;
+			}
+		} else	lablen--;
+		d++;
+	}
+}
+
+/**
+ * Compare two sort keys, bytewise, shortest first.
+ * @param a: key
+ * @param b: key
+ * @param depth: length of the prefix known to be equal.
+ * @return comparison code.
+ */
+static int
+canon_key_cmp(struct canon_key* a, struct canon_key* b, size_t depth)
+{
+	size_t minlen = (a->len < b->len)?a->len:b->len;
+	int c;
+	if(minlen > depth && (c = memcmp(a->key+depth, b->key+depth,
+		minlen-depth)) != 0)
+		return c;
+	if(a->len < b->len)
+		return -1;
+	if(a->len > b->len)
+		return 1;
+	return 0;
+}
+
+/** stable insertion sort of keys that share depth bytes of prefix */
+static void
+canon_insertion_sort(struct canon_key* a, size_t num, size_t depth)
+{
+	struct canon_key t;
+	size_t i, j;
+	for(i=1; i<num; i++) {
+		t = a[i];
+		for(j=i; j>0 && canon_key_cmp(&a[j-1], &t, depth) > 0; j--)
+			a[j] = a[j-1];
+		a[j] = t;
+	}
+}
+
+/**
+ * Stable MSD radix sort of the keys.  The ranges still to sort are
+ * kept on an explicit stack, so deep common prefixes do not recurse.
+ * @param a: keys to sort.
+ * @param tmp: scratch space for num keys.
+ * @param num: number of keys.
+ * @param stack: scratch space for num ranges.
+ */
+static void
+canon_radix_sort(struct canon_key* a, struct canon_key* tmp, size_t num,
+	struct canon_range* stack)
+{
+	/* bucket 0 is for keys that end at depth, then the byte values */
+	size_t count[257], pos[257];
+	size_t sp = 0, start, n, depth, i, j, b;
+	stack[sp].start = 0;
+	stack[sp].num = num;
+	stack[sp].depth = 0;
+	sp++;
+	while(sp > 0) {
+		sp--;
+		start = stack[sp].start;
+		n = stack[sp].num;
+		depth = stack[sp].depth;
+		if(n <= CANON_INSERTION_SORT) {
+			canon_insertion_sort(a+start, n, depth);
+			continue;
+		}
+		/* skip the prefix that all keys in the range share, so
+		 * that every pass splits the range */
+		for(j=a[start].len, i=start+1; i<start+n && j>depth; i++) {
+			b = depth;
+			while(b < j && b < a[i].len &&
+				a[i].key[b] == a[start].key[b])
+				b++;
+			j = b;
+		}
+		depth = j;
+		memset(count, 0, sizeof(count));
+		for(i=start; i<start+n; i++)
+			count[(a[i].len==depth)?0:(size_t)a[i].key[depth]+1]++;
+		pos[0] = 0;
+		for(b=1; b<257; b++)
+			pos[b] = pos[b-1] + count[b-1];
+		for(i=start; i<start+n; i++)
+			tmp[pos[(a[i].len==depth)?0:(size_t)a[i].key[depth]+1]++]
+				= a[i];
+		memcpy(a+start, tmp, n*sizeof(*a));
+		/* bucket 0 holds equal keys, they are done */
+		for(i=start+count[0], b=1; b<257; i+=count[b], b++) {
+			if(count[b] < 2)
+				continue;
+			stack[sp].start = i;
+			stack[sp].num = count[b];
+			stack[sp].depth = depth+1;
+			sp++;
+		}
+	}
+}
+
+struct canon_order*
+canonical_order(struct regional* region, struct ub_packed_rrset_key* k)
+{
+	struct packed_rrset_data* d = (struct packed_rrset_data*)k->entry.data;
+	const sldns_rr_descriptor* desc = NULL;
+	struct canon_order* sorted;
+	struct canon_key* keys;
+	struct canon_range* stack;
+	uint16_t type = ntohs(k->rk.type);
+	int dname_only = 0;
+	size_t i, prev = 0;
+
+	switch(type) {
+		/* the name is the key, see canonical_compare */
+		case LDNS_RR_TYPE_NS:
+		case LDNS_RR_TYPE_MD:
+		case LDNS_RR_TYPE_MF:
+		case LDNS_RR_TYPE_CNAME:
+		case LDNS_RR_TYPE_MB:
+		case LDNS_RR_TYPE_MG:
+		case LDNS_RR_TYPE_MR:
+		case LDNS_RR_TYPE_PTR:
+		case LDNS_RR_TYPE_DNAME:
+			dname_only = 1;
+			break;
+		case LDNS_RR_TYPE_NXT: 
+		case LDNS_RR_TYPE_MINFO:
+		case LDNS_RR_TYPE_RP:
+		case LDNS_RR_TYPE_SOA:
+		case LDNS_RR_TYPE_RT:
+		case LDNS_RR_TYPE_AFSDB:
+		case LDNS_RR_TYPE_KX:
+		case LDNS_RR_TYPE_MX:
+		case LDNS_RR_TYPE_SIG:
+		case LDNS_RR_TYPE_RRSIG:
+		case LDNS_RR_TYPE_PX:
+		case LDNS_RR_TYPE_NAPTR:
+		case LDNS_RR_TYPE_SRV:
+			desc = sldns_rr_descript(type);
+			log_assert(desc);
+			break;
+		default:
+			/* binary compare of the rdata */
+			break;
+	}
+
+	sorted = (struct canon_order*)regional_alloc(region, sizeof(*sorted));
+	if(!sorted)
+		return NULL;
+	sorted->idx = (size_t*)regional_alloc(region, sizeof(size_t)*d->count);
+	keys = (struct canon_key*)regional_alloc(region,
+		sizeof(struct canon_key)*d->count*2);
+	stack = (struct canon_range*)regional_alloc(region,
+		sizeof(struct canon_range)*d->count);
+	if(!sorted->idx || !keys || !stack)
+		return NULL;
+	for(i=0; i<d->count; i++) {
+		keys[i].rr_idx = i;
+		keys[i].key = packed_rr_data(d, i)+2;
+		keys[i].len = packed_rr_len(d, i)-2;
+		if(dname_only) {
+			/* the name is compared, trailing rdata is not */
+			keys[i].len = dname_valid(keys[i].key, keys[i].len);
+			if(keys[i].len == 0) {
+				/* malformed name, use tree compare of it */
+				return canonical_order_tree(region, k);
+			}
+		} else if(!desc)
+			continue;
+		keys[i].key = regional_alloc_init(region, keys[i].key,
+			keys[i].len);
+		if(!keys[i].key)
+			return NULL;
+		if(dname_only)
+			query_dname_tolower(keys[i].key);
+		else	canonical_lowercase_byfield(desc, keys[i].key,
+				keys[i].len);
+	}
+	if(d->count > 1)
+		canon_radix_sort(keys, keys+d->count, d->count, stack);
+
+	/* the sort is stable; keep the first RR of equal ones, like the
+	 * tree insert that detects duplicates does */
+	sorted->count = 0;
+	for(i=0; i<d->count; i++) {
+		if(i > 0 && canon_key_cmp(&keys[prev], &keys[i], 0) == 0)
+			continue;
+		sorted->idx[sorted->count++] = keys[i].rr_idx;
+		prev = i;
+	}
+	return sorted;
+}
+
 /**
  * Inser canonical owner name into buffer.
  * @param buf: buffer to insert into at current position.
@@ -1047,14 +1356,10 @@ canonicalize_rdata(sldns_buffer* buf, struct ub_packed_rrset_key* rrset,
 int rrset_canonical_equal(struct regional* region,
 	struct ub_packed_rrset_key* k1, struct ub_packed_rrset_key* k2)
 {
-	struct rbtree_t sortree1, sortree2;
-	struct canon_rr *rrs1, *rrs2, *p1, *p2;
+	struct canon_order *sorted1, *sorted2;
 	struct packed_rrset_data* d1=(struct packed_rrset_data*)k1->entry.data;
 	struct packed_rrset_data* d2=(struct packed_rrset_data*)k2->entry.data;
-	struct ub_packed_rrset_key fk;
-	struct packed_rrset_data fd;
-	size_t flen[2];
-	uint8_t* fdata[2];
+	size_t i;
 
 	/* basic compare */
 	if(k1->rk.dname_len != k2->rk.dname_len ||
@@ -1070,39 +1375,21 @@ int rrset_canonical_equal(struct regional* region,
 		d1->security != d2->security)
 		return 0;
 
-	/* init */
-	memset(&fk, 0, sizeof(fk));
-	memset(&fd, 0, sizeof(fd));
-	fk.entry.data = &fd;
-	fd.count = 2;
-	fd.rr_len = flen;
-	fd.rr_data = fdata;
-	rbtree_init(&sortree1, &canonical_tree_compare);
-	rbtree_init(&sortree2, &canonical_tree_compare);
-	rrs1 = regional_alloc(region, sizeof(struct canon_rr)*d1->count);
-	rrs2 = regional_alloc(region, sizeof(struct canon_rr)*d2->count);
-	if(!rrs1 || !rrs2) return 1; /* alloc failure */
-
 	/* sort */
-	canonical_sort(k1, d1, &sortree1, rrs1);
-	canonical_sort(k2, d2, &sortree2, rrs2);
+	sorted1 = canonical_order(region, k1);
+	sorted2 = canonical_order(region, k2);
+	if(!sorted1 || !sorted2) return 1; /* alloc failure */
 
 	/* compare canonical-sorted RRs for canonical-equality */
-	if(sortree1.count != sortree2.count)
+	if(sorted1->count != sorted2->count)
 		return 0;
-	p1 = (struct canon_rr*)rbtree_first(&sortree1);
-	p2 = (struct canon_rr*)rbtree_first(&sortree2);
-	while(p1 != (struct canon_rr*)RBTREE_NULL &&
-		p2 != (struct canon_rr*)RBTREE_NULL) {
-		flen[0] = d1->rr_len[p1->rr_idx];
-		flen[1] = d2->rr_len[p2->rr_idx];
-		fdata[0] = d1->rr_data[p1->rr_idx];
-		fdata[1] = d2->rr_data[p2->rr_idx];
-
-		if(canonical_compare(&fk, 0, 1) != 0)
+	for(i=0; i<sorted1->count; i++) {
+		if(canonical_compare_rdata(ntohs(k1->rk.type),
+			packed_rr_data(d1, sorted1->idx[i]),
+			packed_rr_len(d1, sorted1->idx[i]),
+			packed_rr_data(d2, sorted2->idx[i]),
+			packed_rr_len(d2, sorted2->idx[i])) != 0)
 			return 0;
-		p1 = (struct canon_rr*)rbtree_next(&p1->node);
-		p2 = (struct canon_rr*)rbtree_next(&p2->node);
 	}
 	return 1;
 }
@@ -1115,43 +1402,35 @@ int rrset_canonical_equal(struct regional* region,
  * @param sig: RRSIG rdata to include.
  * @param siglen: RRSIG rdata len excluding signature field, but inclusive
  * 	signer name length.
- * @param sortree: if NULL is passed a new sorted rrset tree is built.
+ * @param sorted: if NULL is passed a new sorted rrset order is made.
  * 	Otherwise it is reused.
  * @return false on alloc error.
  */
 static int
 rrset_canonical(struct regional* region, sldns_buffer* buf, 
 	struct ub_packed_rrset_key* k, uint8_t* sig, size_t siglen,
-	struct rbtree_t** sortree)
+	struct canon_order** sorted)
 {
 	struct packed_rrset_data* d = (struct packed_rrset_data*)k->entry.data;
 	uint8_t* can_owner = NULL;
 	size_t can_owner_len = 0;
-	struct canon_rr* walk;
-	struct canon_rr* rrs;
+	size_t i, rr;
 
-	if(!*sortree) {
-		*sortree = (struct rbtree_t*)regional_alloc(region, 
-			sizeof(rbtree_t));
-		if(!*sortree)
+	if(!*sorted) {
+		*sorted = canonical_order(region, k);
+		if(!*sorted)
 			return 0;
-		rrs = regional_alloc(region, sizeof(struct canon_rr)*d->count);
-		if(!rrs) {
-			*sortree = NULL;
-			return 0;
-		}
-		rbtree_init(*sortree, &canonical_tree_compare);
-		canonical_sort(k, d, *sortree, rrs);
 	}
 
 	sldns_buffer_clear(buf);
 	sldns_buffer_write(buf, sig, siglen);
 	/* canonicalize signer name */
 	query_dname_tolower(sldns_buffer_begin(buf)+18); 
-	RBTREE_FOR(walk, struct canon_rr*, (*sortree)) {
+	for(i=0; i<(*sorted)->count; i++) {
+		rr = (*sorted)->idx[i];
 		/* see if there is enough space left in the buffer */
 		if(sldns_buffer_remaining(buf) < can_owner_len + 2 + 2 + 4
-			+ d->rr_len[walk->rr_idx]) {
+			+ packed_rr_len(d, rr)) {
 			log_err("verify: failed to canonicalize, "
 				"rrset too big");
 			return 0;
@@ -1164,9 +1443,9 @@ rrset_canonical(struct regional* region, sldns_buffer* buf,
 		sldns_buffer_write(buf, &k->rk.type, 2);
 		sldns_buffer_write(buf, &k->rk.rrset_class, 2);
 		sldns_buffer_write(buf, sig+4, 4);
-		sldns_buffer_write(buf, d->rr_data[walk->rr_idx], 
-			d->rr_len[walk->rr_idx]);
-		canonicalize_rdata(buf, k, d->rr_len[walk->rr_idx]);
+		sldns_buffer_write(buf, packed_rr_data(d, rr),
+			packed_rr_len(d, rr));
+		canonicalize_rdata(buf, k, packed_rr_len(d, rr));
 	}
 	sldns_buffer_flip(buf);
 	return 1;
@@ -1290,12 +1569,12 @@ adjust_ttl(struct val_env* ve, uint32_t unow,
 	if(d->ttl > (time_t)origttl) {
 		verbose(VERB_QUERY, "rrset TTL larger than original TTL,"
 			" adjusting TTL downwards");
-		d->ttl = origttl;
+		packed_rrset_set_ttl(d, (time_t)origttl);
 	}
 	if(expittl > 0 && d->ttl > (time_t)expittl) {
 		verbose(VERB_ALGO, "rrset TTL larger than sig expiration ttl,"
 			" adjusting TTL downwards");
-		d->ttl = expittl;
+		packed_rrset_set_ttl(d, (time_t)expittl);
 	}
 }
 
@@ -1304,7 +1583,7 @@ dnskey_verify_rrset_sig(struct regional* region, sldns_buffer* buf,
 	struct val_env* ve, time_t now,
         struct ub_packed_rrset_key* rrset, struct ub_packed_rrset_key* dnskey,
         size_t dnskey_idx, size_t sig_idx,
-	struct rbtree_t** sortree, int* buf_canon, char** reason)
+	struct canon_order** sorted, int* buf_canon, char** reason)
 {
 	enum sec_status sec;
 	uint8_t* sig;		/* RRSIG rdata */
@@ -1403,7 +1682,7 @@ dnskey_verify_rrset_sig(struct regional* region, sldns_buffer* buf,
 		/* create rrset canonical format in buffer, ready for 
 		 * signature */
 		if(!rrset_canonical(region, buf, rrset, sig+2, 
-			18 + signer_len, sortree)) {
+			18 + signer_len, sorted)) {
 			log_err("verify: failed due to alloc error");
 			return sec_status_unchecked;
 		}
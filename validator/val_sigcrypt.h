@@ -47,13 +47,23 @@
 struct val_env;
 struct module_env;
 struct ub_packed_rrset_key;
-struct rbtree_t;
 struct regional;
 struct sldns_buffer;
 
 /** number of entries in algorithm needs array */
 #define ALGO_NEEDS_MAX 256
 
+/**
+ * The RRs of an rrset in canonical order, duplicates removed.
+ * Stored in the region, reused for every signature over the rrset.
+ */
+struct canon_order {
+	/** number of RRs, after duplicates are removed */
+	size_t count;
+	/** index of the RRs in the rrset data, in canonical order */
+	size_t* idx;
+};
+
 /**
  * Storage for algorithm needs.  DNSKEY algorithms.
  */
@@ -268,7 +278,7 @@ enum sec_status dnskey_verify_rrset(struct module_env* env,
  * @param rrset: to be validated.
  * @param dnskey: DNSKEY rrset, keyset to try.
  * @param sig_idx: which signature to try to validate.
- * @param sortree: reused sorted order. Stored in region. Pass NULL at start,
+ * @param sorted: reused sorted order. Stored in region. Pass NULL at start,
  * 	and for a new rrset.
  * @param reason: if bogus, a string returned, fixed or alloced in scratch.
  * @return secure if any key signs *this* signature. bogus if no key signs it,
@@ -277,7 +287,7 @@ enum sec_status dnskey_verify_rrset(struct module_env* env,
 enum sec_status dnskeyset_verify_rrset_sig(struct module_env* env, 
 	struct val_env* ve, time_t now, struct ub_packed_rrset_key* rrset, 
 	struct ub_packed_rrset_key* dnskey, size_t sig_idx, 
-	struct rbtree_t** sortree, char** reason);
+	struct canon_order** sorted, char** reason);
 
 /** 
  * verify rrset, with specific dnskey(from set), for a specific rrsig 
@@ -289,7 +299,7 @@ enum sec_status dnskeyset_verify_rrset_sig(struct module_env* env,
  * @param dnskey: DNSKEY rrset, keyset.
  * @param dnskey_idx: which key from the rrset to try.
  * @param sig_idx: which signature to try to validate.
- * @param sortree: pass NULL at start, the sorted rrset order is returned.
+ * @param sorted: pass NULL at start, the sorted rrset order is returned.
  * 	pass it again for the same rrset.
  * @param buf_canon: if true, the buffer is already canonical.
  * 	pass false at start. pass old value only for same rrset and same
@@ -302,13 +312,34 @@ enum sec_status dnskey_verify_rrset_sig(struct regional* region,
 	struct sldns_buffer* buf, struct val_env* ve, time_t now,
 	struct ub_packed_rrset_key* rrset, struct ub_packed_rrset_key* dnskey, 
 	size_t dnskey_idx, size_t sig_idx,
-	struct rbtree_t** sortree, int* buf_canon, char** reason);
+	struct canon_order** sorted, int* buf_canon, char** reason);
 
 /**
  * canonical compare for two tree entries
  */
 int canonical_tree_compare(const void* k1, const void* k2);
 
+/**
+ * Sort the RRs of an rrset in canonical order.  The rdata is lowercased
+ * once into sort keys, and the keys are radix sorted bytewise.
+ * @param region: temporary region, the result is allocated here.
+ * @param k: the rrset, its data is not altered.
+ * @return the canonical order, or NULL on alloc failure.
+ */
+struct canon_order* canonical_order(struct regional* region,
+	struct ub_packed_rrset_key* k);
+
+/**
+ * Sort the RRs of an rrset in canonical order, by inserting them into
+ * a tree with canonical_tree_compare.  Used for rdata with malformed
+ * names, and as reference for canonical_order.
+ * @param region: temporary region, the result is allocated here.
+ * @param k: the rrset, its data is not altered.
+ * @return the canonical order, or NULL on alloc failure.
+ */
+struct canon_order* canonical_order_tree(struct regional* region,
+	struct ub_packed_rrset_key* k);
+
 /**
  * Compare two rrsets and see if they are the same, canonicalised.
  * The rrsets are not altered.
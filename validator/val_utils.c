@@ -166,8 +166,8 @@ val_find_rrset_signer(struct ub_packed_rrset_key* rrset, uint8_t** sname,
 		return;
 	}
 	/* get rrsig signer name out of the signature */
-	rrsig_get_signer(d->rr_data[d->count], d->rr_len[d->count], 
-		sname, slen);
+	rrsig_get_signer(packed_rr_data(d, d->count),
+		packed_rr_len(d, d->count), sname, slen);
 }
 
 /**
@@ -190,12 +190,12 @@ val_find_best_signer(struct ub_packed_rrset_key* rrset,
 	size_t i;
 	int m;
 	for(i=d->count; i<d->count+d->rrsig_count; i++) {
-		sign = d->rr_data[i]+2+18;
+		sign = packed_rr_data(d, i)+2+18;
 		/* look at signatures that are valid (long enough),
 		 * and have a signer name that is a superdomain of qname,
 		 * and then check the number of labels in the shared topdomain
 		 * improve the match if possible */
-		if(d->rr_len[i] > 2+19 && /* rdata, sig + root label*/
+		if(packed_rr_len(d, i) > 2+19 && /* rdata, sig + root label*/
 			dname_subdomain_c(qinf->qname, sign)) {
 			(void)dname_lab_cmp(qinf->qname, 
 				dname_count_labels(qinf->qname), 
@@ -347,7 +347,7 @@ val_verify_rrset(struct module_env* env, struct val_env* ve,
 			/* update ttl for rrset to fixed value. */
 			d->ttl = ve->bogus_ttl;
 			for(i=0; i<d->count+d->rrsig_count; i++)
-				d->rr_ttl[i] = ve->bogus_ttl;
+				packed_rr_set_ttl(d, i, ve->bogus_ttl);
 			/* leave RR specific TTL: not used for determine
 			 * if RRset timed out and clients see proper value. */
 			lock_basic_lock(&ve->bogus_lock);
@@ -698,9 +698,9 @@ val_dsset_isusable(struct ub_packed_rrset_key* ds_rrset)
 static uint8_t
 rrsig_get_labcount(struct packed_rrset_data* d, size_t sig)
 {
-	if(d->rr_len[sig] < 2+4)
+	if(packed_rr_len(d, sig) < 2+4)
 		return 0; /* bad sig length */
-	return d->rr_data[sig][2+3];
+	return packed_rr_data(d, sig)[2+3];
 }
 
 int 
@@ -771,11 +771,13 @@ rrset_has_signer(struct ub_packed_rrset_key* rrset, uint8_t* name, size_t len)
 		entry.data;
 	size_t i;
 	for(i = d->count; i< d->count+d->rrsig_count; i++) {
-		if(d->rr_len[i] > 2+18+len) {
+		if(packed_rr_len(d, i) > 2+18+len) {
 			/* at least rdatalen + signature + signame (+1 sig)*/
-			if(!dname_valid(d->rr_data[i]+2+18, d->rr_len[i]-2-18))
+			if(!dname_valid(packed_rr_data(d, i)+2+18,
+				packed_rr_len(d, i)-2-18))
 				continue;
-			if(query_dname_compare(name, d->rr_data[i]+2+18) == 0)
+			if(query_dname_compare(name,
+				packed_rr_data(d, i)+2+18) == 0)
 			{
 				return 1;
 			}
@@ -2865,7 +2865,6 @@ process_dlv_response(struct module_qstate* qstate, struct val_qstate* vq,
 			vq->dlv_status = dlv_error;
 			return;
 		}
-		packed_rrset_ptr_fixup(vq->ds_rrset->entry.data);
 		/* make vq do a DNSKEY query next up */
 		vq->dlv_status = dlv_success;
 		return;